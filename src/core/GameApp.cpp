@@ -13,6 +13,7 @@
 #include "WindowsMessageHandler.hpp"
 
 #include "../utils/Timer.hpp"
+#include "../game/RenderableObject.hpp"
 
 //#include <SDL3/SDL_main.h>
 #include <SDL3/SDL_image.h>
@@ -160,9 +161,30 @@ void GameApp::MainLoop()
         elapsed_time_ = timer_->GetElapsedTime();
         accumulated_time_ += elapsed_time_;
 
+        if (NETWORK.IsRunning())
+        {
+            NETWORK.Update();
+        }
+
+        //    θ  ( и  ,  0 )
+        step_clock_.BeginFrame(elapsed_time_);
+        while (step_clock_.ConsumeStep())
+        {
+            RenderableObject::AdvanceStep();
+            Update(step_clock_.GetStep());
+        }
+
+        // ̹  ܵ鿡  Ŷ   
+        if (NETWORK.IsRunning())
+        {
+            NETWORK.FlushSend();
+        }
+
         //HandleEvents();
-        Update();
+        RenderableObject::SetInterpolationAlpha(step_clock_.GetAlpha());
         Render();
+
+        LogFrameStats();
     }
 }
 
@@ -198,14 +220,9 @@ void GameApp::HandleEvents(const SDL_Event& event)
     }
 }
 
-void GameApp::Update() 
+void GameApp::Update(float deltaTime) 
 {
-    if (NETWORK.IsRunning())
-    {
-        NETWORK.Update();
-    }
-
-    managers_->Update(elapsed_time_);
+    managers_->Update(deltaTime);
 }
 
 void GameApp::Render() 
@@ -213,6 +230,22 @@ void GameApp::Render()
     managers_->RenderAll(renderer_.get());
 }
 
+void GameApp::LogFrameStats()
+{
+    stats_log_time_ += elapsed_time_;
+    if (stats_log_time_ < Constants::Time::FRAME_STATS_LOG_INTERVAL)
+    {
+        return;
+    }
+
+    stats_log_time_ = 0.0f;
+
+    const auto stats = step_clock_.GetStats();
+    LOGGER.Debug("frame avg {:.2f} ms, max {:.2f} ms, steps {}/{} frames, catch-up {}, clamped {}, dropped {:.3f} s",
+        stats.average_frame_time * 1000.0f, stats.max_frame_time * 1000.0f, stats.steps, stats.frames,
+        stats.catch_up_frames, stats.clamped_frames, stats.dropped_time);
+}
+
 bool GameApp::SetFullscreen(bool enable) 
 {
     
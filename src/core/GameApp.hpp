@@ -13,11 +13,13 @@
 #include <unordered_map>
 #include <atomic>
 #include <concepts>
+#include <optional>
 #include <wtypes.h>
 
 #include "./common/constants/Constants.hpp"
 #include "manager/IManager.hpp"
 #include "manager/Managers.hpp"
+#include "../utils/FixedStepClock.hpp"
 
 
 class IManager;
@@ -30,6 +32,7 @@ class MapManager;
 class PlayerManager;
 class ParticleManager;
 class WindowsMessageHandler;
+enum class PuyoCpuLevel : uint8_t;
 
 
 class GameApp 
@@ -56,8 +59,13 @@ public:
     [[nodiscard]] bool IsFullscreen() const noexcept { return is_full_screen_; }
     [[nodiscard]] float GetAccumulatedTime() const noexcept { return accumulated_time_; }
     [[nodiscard]] float GetElapsedTime() const noexcept { return elapsed_time_; }
+    [[nodiscard]] FrameStats GetFrameStats() const { return step_clock_.GetStats(); }
 
     void SetGameRunning(bool running){ is_running_ = running; }
+
+    //   --cpu ϸ  ÷̾ ڸ CPU ÷̾ 
+    void SetCpuLevel(std::optional<PuyoCpuLevel> level) { cpu_level_ = level; }
+    [[nodiscard]] std::optional<PuyoCpuLevel> GetCpuLevel() const noexcept { return cpu_level_; }
     
     template<std::derived_from<IManager> T>
     [[nodiscard]] T* GetManager(std::string_view name) const
@@ -119,8 +127,9 @@ private:
 
     bool InitializeSDL();
     void InitializeManagers();    
-    void Update();
+    void Update(float deltaTime);
     void Render();
+    void LogFrameStats();
     bool SetFullscreen(bool enable);
 
     struct SDLDeleter {
@@ -147,6 +156,9 @@ private:
     int window_height_{ Constants::Window::DEFAULT_HEIGHT };
     float accumulated_time_{ 0.0f };
     float elapsed_time_{ 0.0f };    
+    float stats_log_time_{ 0.0f };
+    FixedStepClock step_clock_{ Constants::Time::SIMULATION_STEP, Constants::Time::MAX_FRAME_TIME, Constants::Time::MAX_STEPS_PER_FRAME };
+    std::optional<PuyoCpuLevel> cpu_level_;
 
     HWND hwnd_;
 
@@ -9,9 +9,9 @@
 #include <SDL3/SDL.h>
 
 #include "../core/common/constants/Constants.hpp"
+#include "../utils/Random.hpp"
 
 #include <concepts>
-#include <random>
 #include <type_traits>
 
 #include <cassert>
@@ -30,40 +30,31 @@ struct Point {
 
 namespace GameUtils 
 {
+    //  (RandomService 庰 Ʈ .  [min, max], Ǽ [min, max))
     namespace Random
     {
-        inline std::mt19937& GetRandomEngine() 
+        template<typename T>
+        inline T Range(T min, T max, RandomStream stream = RandomStream::Default) 
         {
-            static std::random_device rd;
-            static std::mt19937 engine(rd());
-            return engine;
+            assert(min <= max);
+            return RandomService::Range(min, max, stream);
         }
 
-        template<typename T>
-        inline T Range(T min, T max) 
+        //     [min, max) ä (ƼŬ  )
+        inline void Fill(std::span<float> out, float min, float max, RandomStream stream = RandomStream::Effects)
         {
-            assert(min <= max);
-            if constexpr (std::is_floating_point_v<T>) 
-            {
-                std::uniform_real_distribution<T> dist(min, max);
-                return dist(GetRandomEngine());
-            }
-            else 
-            {
-                std::uniform_int_distribution<T> dist(min, max);
-                return dist(GetRandomEngine());
-            }
+            RandomService::Fill(out, min, max, stream);
         }
 
-        inline float Percent() 
+        inline float Percent(RandomStream stream = RandomStream::Default) 
         {
-            return Range(0.0f, 1.0f);
+            return Range(0.0f, 1.0f, stream);
         }
 
         // 0 ~ 2    
-        inline float Angle() 
+        inline float Angle(RandomStream stream = RandomStream::Default) 
         {
-            return Range(0.0f, 2.0f * static_cast<float>(Constants::Math::PI));
+            return Range(0.0f, 2.0f * static_cast<float>(Constants::Math::PI), stream);
         }
     }
 
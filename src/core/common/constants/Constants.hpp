@@ -7,6 +7,9 @@
 #include <limits>
 #include <cfloat>
 
+#include "RuleConstants.hpp"
+#include "NetworkConstants.hpp"
+
 #define SDL_USEREVENT_SOCK		WM_USER + 1
 
 
@@ -32,46 +35,8 @@ namespace Constants
         constexpr float PLAY_START_DELAY = 2.0f;
         constexpr float MATCH_ANIMATION_DURATION = 0.5f;
 
-        constexpr int MAX_COMBO = 19;
-        constexpr int MIN_MATCH_COUNT = 4;
-
         constexpr float DEFAULT_DROP_SPEED = 1.0f;
         constexpr float FAST_DROP_SPEED = 10.0f;
-
-        constexpr struct TimeMargin
-        {
-            float time;
-            uint8_t margin;
-        }
-        SCORE_MARGINS[] =
-        {
-            {96.0f,  70},
-            {112.0f, 52},
-            {128.0f, 34},
-            {144.0f, 25},
-            {160.0f, 16},
-            {176.0f, 12},
-            {192.0f, 8},
-            {208.0f, 6},
-            {224.0f, 4},
-            {240.0f, 3},
-            {256.0f, 2},
-            { FLT_MAX, 1 }
-        };
-
-        inline namespace Score 
-        {
-            constexpr int BASE_MATCH_SCORE = 10;
-            constexpr int COMBO_MULTIPLIER_BASE = 2;
-            constexpr int MAX_LINK_BONUS = 10;
-            constexpr int MAX_TYPE_BONUS = 24;
-        }
-
-        inline namespace CharacterSelect
-        {
-            constexpr int CHARACTER_GRID_HEIGHT = 4;
-            constexpr int CHARACTER_GRID_WIDTH = 7;
-        }
     }
 
     inline namespace Math
@@ -96,11 +61,16 @@ namespace Constants
         constexpr int HOUR = 60 * MINUTE;
         constexpr int DAY = 24 * HOUR;
         constexpr float FRAME_TIME = 1.0f / 60.0f;
+
+        //   ùķ̼ ( ƽ  , ũ     ð/  )
+        constexpr float SIMULATION_STEP = FRAME_TIME;
+        constexpr float MAX_FRAME_TIME = 0.25f;
+        constexpr uint32_t MAX_STEPS_PER_FRAME = 5;
+        constexpr float FRAME_STATS_LOG_INTERVAL = 10.0f;
     }
 
     inline namespace Block
     {
-        constexpr float SIZE = 31.0f;                
         constexpr float GRAVITY = 9.8f;              
         constexpr float CHANGE_TIME = 0.2f;          
 
@@ -142,9 +112,6 @@ namespace Constants
 
     namespace Board
     {
-        constexpr int BOARD_X_COUNT = 6;
-        constexpr int BOARD_Y_COUNT = 13;
-
         constexpr float POSITION_X = 30;
         constexpr float POSITION_Y = 32;
 
@@ -152,9 +119,6 @@ namespace Constants
         constexpr float PLAYER_POSITION_Y = 32;
 
         constexpr int WIDTH = 194;
-        constexpr int HEIGHT = 372;
-
-        constexpr float WIDTH_MARGIN = 4;
 
         constexpr float NEW_BLOCK_POS_X = WIDTH_MARGIN + Block::SIZE * 2;
         constexpr float NEW_BLOCK_POS_Y = 0;
@@ -188,24 +152,6 @@ namespace Constants
         constexpr float NEW_BLOCK_SCALE_VELOCITY = 50.0f;
     }
 
-
-    inline namespace Network
-    {
-        constexpr int NETWORK_EVENT_CODE = 1;
-
-        constexpr int NET_PORT = 9000;
-
-        constexpr int PACKET_SIZE_LEN = sizeof(unsigned int);
-        constexpr int MAX_PACKET_SIZE = 256;
-        constexpr int PACKET_DATA_SIZE_LEN = MAX_PACKET_SIZE - PACKET_SIZE_LEN;
-        constexpr int MAX_WORKERTHREAD = 1;
-        constexpr int MAX_CLIENT = 4;
-        constexpr int MAX_RINGBUFSIZE = 1024;
-
-        constexpr int CLIENT_BUF_SIZE = 256;
-        constexpr int MAX_CHAT_LEN = 100;
-    }
-
     inline namespace BulletEffect
     {
         constexpr int SIZE = 18;
@@ -0,0 +1,92 @@
+#pragma once
+/*
+ *
+ * 설명: 네트워크/서버 상수 (SDL에 의존하지 않음)
+ *  1. 전용 서버, 중계 노드, 벤치마크 등 헤드리스 대상이 Constants.hpp(SDL) 없이 포함할 수 있도록 분리.
+ *  2. Constants.hpp가 이 파일을 포함하므로 기존 Constants:: 경로는 그대로 사용.
+ *
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Constants
+{
+    inline namespace Network
+    {
+        constexpr int NETWORK_EVENT_CODE = 1;
+
+        constexpr int NET_PORT = 9000;
+
+        constexpr int PACKET_SIZE_LEN = sizeof(unsigned int);
+        constexpr int MAX_PACKET_SIZE = 256;
+        constexpr int PACKET_DATA_SIZE_LEN = MAX_PACKET_SIZE - PACKET_SIZE_LEN;
+        constexpr int MAX_WORKERTHREAD = 1;
+        constexpr int MAX_CLIENT = 4;
+        constexpr int DEDICATED_MAX_CLIENT = 2048;      // 전용 서버 최대 접속 수 (2인 매치 1000개 이상)
+        constexpr int ROOM_CAPACITY = 2;
+        constexpr float SERVER_TICK_TIME = 1.0f / 60.0f;   // 전용 서버 틱 간격(초), 클라이언트 SIMULATION_STEP과 같음
+
+        // 전용 서버 방 샤드
+        constexpr size_t SHARD_QUEUE_CAPACITY = 8192;   // 샤드별 SPSC 큐 크기
+        constexpr int SHARD_BALANCE_INTERVAL = 1000;    // 샤드 간 방 개수 점검 주기(ms)
+        constexpr size_t SHARD_BALANCE_THRESHOLD = 4;   // 방 개수 차이가 이 값을 넘으면 이관
+        constexpr int MAX_AUTO_JOIN_RETRY = 3;
+
+        // 서버 타이머 (샤드/라우터별 계층형 타이밍 휠)
+        constexpr uint32_t SERVER_TIMER_TICK = 10;      // 타이밍 휠 틱 단위(ms)
+        constexpr int SHARD_TICK_INTERVAL = 50;         // 라우터가 샤드 타이머 진행을 요청하는 주기(ms)
+        constexpr int SESSION_IDLE_TIMEOUT = 300000;    // 수신이 없는 세션 종료 시간(ms)
+        constexpr int CHAR_SELECT_TIMEOUT = 30000;      // 캐릭터 선택 제한 시간(ms), 초과 시 현재 선택으로 확정
+
+        // 매치메이킹 (레이팅 구간별 대기열, 대기 시간에 따라 허용 범위 확장)
+        constexpr uint16_t MATCH_DEFAULT_RATING = 1500;
+        constexpr uint16_t MATCH_MAX_RATING = 4000;
+        constexpr uint16_t MATCH_BUCKET_WIDTH = 100;
+        constexpr uint16_t MATCH_BASE_WINDOW = 50;      // 대기 직후 허용 레이팅 차이
+        constexpr uint16_t MATCH_WINDOW_STEP = 50;      // 확장 주기마다 늘어나는 허용 차이
+        constexpr uint16_t MATCH_MAX_WINDOW = 1000;
+        constexpr int MATCH_WIDEN_INTERVAL = 1000;      // 허용 범위 확장 주기(ms)
+
+        // NAT 뒤의 P2P 호스트를 위한 중계 노드
+        constexpr int RELAY_PORT = 9100;
+        constexpr size_t RELAY_MAX_LINK = 100000;       // 최대 연결 수 (짝 하나당 2개)
+        constexpr size_t RELAY_SLOT_COUNT = 2;          // 방향별 수신 버퍼 수 (수신과 송신을 겹쳐서 진행)
+        constexpr size_t RELAY_SLOT_SIZE = 2048;
+        constexpr int RELAY_PAIR_TIMEOUT = 30000;       // 상대를 기다리는 최대 시간(ms)
+
+        // MAX_PACKET_SIZE를 넘는 패킷의 조각 전송
+        constexpr size_t MAX_CHUNKED_MESSAGE_SIZE = 256 * 1024;  // 재조립 가능한 최대 패킷 크기
+        constexpr size_t CHUNK_MAX_STREAMS = 4;         // 접속당 동시에 재조립 중인 메시지 수
+        constexpr size_t CHUNK_MAX_QUEUED = 16;         // 접속당 전송 대기 중인 대용량 메시지 수
+        constexpr size_t CHUNK_SEND_BUDGET = 4;         // 송신 한 번에 작은 패킷 뒤에 붙이는 최대 조각 수
+        constexpr size_t CHUNK_POOL_SIZE = 16;          // 재사용을 위해 보관하는 재조립 버퍼 수
+        constexpr size_t CHUNK_MAX_PENDING_BYTES = MAX_CHUNKED_MESSAGE_SIZE;    // 접속당 재조립 중인 최대 바이트 (받은 만큼만 계산)
+        constexpr int CHUNK_REASSEMBLY_TIMEOUT = 5000;  // 다음 조각을 기다리는 최대 시간(ms), 초과 시 메시지 폐기
+
+        constexpr int MAX_RINGBUFSIZE = 1024;
+
+        constexpr int CLIENT_BUF_SIZE = 256;
+        constexpr int MAX_CHAT_LEN = 100;
+
+        constexpr bool SEND_CORK_ENABLED = true;        // 틱 단위 송신 묶음(코킹) 사용 여부
+        constexpr size_t MAX_SEND_GATHER_COUNT = 64;    // WSASend 한 번에 묶을 최대 버퍼 수
+        constexpr int SEND_STATS_INTERVAL = 5000;       // 송신 통계 출력 주기(ms)
+
+        // 수신 속도 제한 (토큰 버킷: 최대 버스트, 초당 충전량)
+        constexpr float RATE_CONNECTION_BURST = 120.0f;
+        constexpr float RATE_CONNECTION_PER_SEC = 120.0f;
+        constexpr float RATE_CONTROL_BURST = 20.0f;
+        constexpr float RATE_CONTROL_PER_SEC = 10.0f;
+        constexpr float RATE_CHAT_BURST = 5.0f;
+        constexpr float RATE_CHAT_PER_SEC = 2.0f;
+        constexpr float RATE_BLOCK_BURST = 60.0f;
+        constexpr float RATE_BLOCK_PER_SEC = 60.0f;
+        constexpr float RATE_COMBAT_BURST = 30.0f;
+        constexpr float RATE_COMBAT_PER_SEC = 30.0f;
+        constexpr float RATE_BULK_BURST = 300.0f;       // 대용량 메시지 조각 (접속 전체 버킷과 별도)
+        constexpr float RATE_BULK_PER_SEC = 300.0f;
+        constexpr uint32_t RATE_MAX_STRIKES = 50;       // 누적 시 연결 종료
+        constexpr int RATE_STRIKE_RESET_TIME = 5000;    // 위반이 없으면 스트라이크 초기화(ms)
+    }
+}
@@ -0,0 +1,71 @@
+#pragma once
+/*
+ *
+ * 설명: 게임 규칙 상수 (SDL/플랫폼에 의존하지 않음)
+ *  1. 헤드리스 규칙 엔진(src/sim)이 Constants.hpp 없이 포함할 수 있도록 분리.
+ *  2. Constants.hpp가 이 파일을 포함하므로 기존 Constants:: 경로는 그대로 사용.
+ *  3. 블록 크기, 보드 높이/여백처럼 충돌 판정(BlockGrid)이 쓰는 픽셀 배치 값도 여기 둠.
+ *
+ */
+
+#include <cfloat>
+#include <cstdint>
+
+namespace Constants
+{
+    inline namespace Game
+    {
+        constexpr int MAX_COMBO = 19;
+        constexpr int MIN_MATCH_COUNT = 4;
+
+        constexpr struct TimeMargin
+        {
+            float time;
+            uint8_t margin;
+        }
+        SCORE_MARGINS[] =
+        {
+            {96.0f,  70},
+            {112.0f, 52},
+            {128.0f, 34},
+            {144.0f, 25},
+            {160.0f, 16},
+            {176.0f, 12},
+            {192.0f, 8},
+            {208.0f, 6},
+            {224.0f, 4},
+            {240.0f, 3},
+            {256.0f, 2},
+            { FLT_MAX, 1 }
+        };
+
+        inline namespace Score
+        {
+            constexpr int BASE_MATCH_SCORE = 10;
+            constexpr int COMBO_MULTIPLIER_BASE = 2;
+            constexpr int MAX_LINK_BONUS = 10;
+            constexpr int MAX_TYPE_BONUS = 24;
+        }
+
+        // 서버가 캐릭터 선택 패킷 범위를 검사할 때도 사용
+        inline namespace CharacterSelect
+        {
+            constexpr int CHARACTER_GRID_HEIGHT = 4;
+            constexpr int CHARACTER_GRID_WIDTH = 7;
+        }
+    }
+
+    inline namespace Block
+    {
+        constexpr float SIZE = 31.0f;
+    }
+
+    namespace Board
+    {
+        constexpr int BOARD_X_COUNT = 6;
+        constexpr int BOARD_Y_COUNT = 13;
+
+        constexpr int HEIGHT = 372;
+        constexpr float WIDTH_MARGIN = 4;
+    }
+}
@@ -2,8 +2,8 @@
 #include "../../game/map/GameBackground.hpp"
 #include "../../game/map/GrasslandBackground.hpp"
 #include "../../game/map/IcelandBackground.hpp"
+#include "../GameUtils.hpp"
 
-#include <random>
 #include <chrono>
 #include <algorithm>
 #include <stdexcept>
@@ -79,11 +79,7 @@ std::shared_ptr<GameBackground> MapManager::GetRandomMap()
         throw std::runtime_error("No maps available");
     }
 
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    std::uniform_int_distribution<size_t> dist(0, map_indices_.size() - 1);
-
-    return CreateMap(map_indices_[dist(gen)]);
+    return CreateMap(map_indices_[GameUtils::Random::Range<size_t>(0, map_indices_.size() - 1, RandomStream::Map)]);
 }
 
 bool MapManager::RemoveMap(uint8_t index) 
@@ -11,7 +11,8 @@ bool PlayerManager::Initialize()
 {
     try 
     {
-        players_.reserve(16);
+        players_.Reserve(16);
+        player_sessions_.fill(INVALID_SLOT_ID);
         return true;
     }
     catch (const std::exception& e) 
@@ -23,20 +24,24 @@ bool PlayerManager::Initialize()
 
 void PlayerManager::Update(float deltaTime) 
 {
+    // Խ  б ̶  ִ   ȸ
+    roster_.Reclaim();
 }
 
 void PlayerManager::Release() 
 {
     CriticalSection::Lock lock(critical_section_);
-    players_.clear();
+    players_.Clear();
+    player_sessions_.fill(INVALID_SLOT_ID);
     my_player_.reset();
+    PublishRoster();
 }
 
 std::shared_ptr<Player> PlayerManager::CreatePlayer(uint8_t id, ClientInfo* net_info) 
 {
     CriticalSection::Lock lock(critical_section_);
 
-    if (players_.contains(id)) 
+    if (players_.Contains(player_sessions_[id])) 
     {
         return nullptr;
     }
@@ -46,24 +51,37 @@ std::shared_ptr<Player> PlayerManager::CreatePlayer(uint8_t id, ClientInfo* net_
     player->SetId(id);
     player->SetNetInfo(net_info);    
 
-    players_[id] = player;
+    const SlotId session_id = players_.Insert(player);
+    if (session_id == INVALID_SLOT_ID)
+    {
+        return nullptr;
+    }
+
+    player->SetSessionId(session_id);
+    player_sessions_[id] = session_id;
+
+    PublishRoster();
     return player;
 }
 
 uint8_t PlayerManager::RemovePlayerByNetInfo(ClientInfo* net_info) 
 {
+    //  ڽ(net_info )   ƴ
+    if (!net_info)
+    {
+        return 0;
+    }
+
     CriticalSection::Lock lock(critical_section_);
 
-    auto it = std::next(players_.begin());
-    while (it != players_.end()) 
+    for (const auto& [_, player] : players_)
     {
-        if (it->second->GetNetInfo() == net_info) 
+        if (player->GetNetInfo() == net_info) 
         {
-            uint8_t removed_id = it->first;
-            it = players_.erase(it);
+            const uint8_t removed_id = player->GetId();
+            ErasePlayer(removed_id);
             return removed_id;
         }
-        ++it;
     }
     return 0;
 }
@@ -71,45 +89,48 @@ uint8_t PlayerManager::RemovePlayerByNetInfo(ClientInfo* net_info)
 std::shared_ptr<Player> PlayerManager::FindPlayer(uint8_t id) 
 {
     CriticalSection::Lock lock(critical_section_);
-    auto it = players_.find(id);
-    return (it != players_.end()) ? it->second : nullptr;
+    auto player = players_.Find(player_sessions_[id]);
+    return player ? *player : nullptr;
 }
 
-bool PlayerManager::RemovePlayer(uint8_t id)
+std::shared_ptr<Player> PlayerManager::FindPlayerBySession(SlotId session_id)
 {
     CriticalSection::Lock lock(critical_section_);
+    auto player = players_.Find(session_id);
+    return player ? *player : nullptr;
+}
 
-    auto it = players_.find(id);
-    if (it != players_.end())
-    {
-        players_.erase(it);
-        return true;
-    }
-
-    return false;
+bool PlayerManager::RemovePlayer(uint8_t id)
+{
+    CriticalSection::Lock lock(critical_section_);
+    return ErasePlayer(id);
 }
 
 uint8_t PlayerManager::RemovePlayerInRoom(ClientInfo* pNetInfo) 
 {
-    CriticalSection::Lock lock(critical_section_);
+    if (!pNetInfo)
+    {
+        return 0;
+    }
 
-    auto iter = std::next(players_.begin());
+    CriticalSection::Lock lock(critical_section_);
 
-    while (iter != players_.end()) 
+    for (const auto& [_, player] : players_)
     {
-        if (iter->second->GetNetInfo() == pNetInfo) 
+        if (player->GetNetInfo() == pNetInfo) 
         {
             RemovePlayerPacket packet;
-            packet.player_id = iter->second->GetId();
+            packet.player_id = player->GetId();
 
             uint8_t removed_id = packet.player_id;
-            iter = players_.erase(iter);
+            ErasePlayer(removed_id);
 
-            if (players_.size() > 1) 
+            const auto roster = GetRoster();
+            if (roster->size() > 1) 
             {
-                for (const auto& [_, player] : players_) 
+                for (const auto& other : *roster) 
                 {
-                    if (player->GetNetInfo()) 
+                    if (other->GetNetInfo()) 
                     {
                         NETWORK.SendData(packet);
                     }
@@ -117,11 +138,39 @@ uint8_t PlayerManager::RemovePlayerInRoom(ClientInfo* pNetInfo)
             }
             return removed_id;
         }
-        ++iter;
     }
     return 0;
 }
 
+bool PlayerManager::ErasePlayer(uint8_t id)
+{
+    const SlotId session_id = player_sessions_[id];
+    player_sessions_[id] = INVALID_SLOT_ID;
+
+    if (players_.Erase(session_id) == false)
+    {
+        return false;
+    }
+
+    PublishRoster();
+    return true;
+}
+
+void PlayerManager::PublishRoster()
+{
+    //  幮 ̹Ƿ Ź ü    ü
+    auto roster = std::make_unique<PlayerRoster>();
+    roster->version = roster_.GetCurrent()->version + 1;
+    roster->players.reserve(players_.Size());
+
+    for (const auto& [_, player] : players_)
+    {
+        roster->players.push_back(player);
+    }
+
+    roster_.Publish(std::move(roster));
+}
+
 bool PlayerManager::IsLocalPlayer(uint8_t playerId) 
 { 
     return  my_player_ != nullptr && my_player_->GetId() == playerId;
@@ -2,22 +2,40 @@
 /*
  *
  * :  ӿ  Player  Class
+ *  1. Player 32Ʈ  id( ε + ) Ű  ʿ .
+ *  2. Ŷ uint8_t player_id ġ   ȣ,  id ٷ ȯϴ 迭 .
+ *  3. ߰/εĳƮ   ø Һ (PlayerRoster) ԽϹǷ б  /  ȸ.
  *
  */
 
 #include "../../network/CriticalSection.hpp"
 #include "../../core/manager/IManager.hpp"
+#include "../../utils/SlotMap.hpp"
+#include "../../utils/Rcu.hpp"
 
-#include <unordered_map>
+#include <array>
 #include <memory>
+#include <vector>
 
 class Player;
 
+// Խ   ʴ ÷̾ 
+struct PlayerRoster
+{
+    uint64_t version{ 0 };
+    std::vector<std::shared_ptr<Player>> players;
+
+    [[nodiscard]] auto begin() const { return players.begin(); }
+    [[nodiscard]] auto end() const { return players.end(); }
+    [[nodiscard]] size_t size() const { return players.size(); }
+};
+
 class PlayerManager : public IManager 
 {
 public:
 
-    using PlayerMap = std::unordered_map<uint8_t, std::shared_ptr<Player>>;
+    using PlayerMap = SlotMap<std::shared_ptr<Player>>;
+    using RosterGuard = RcuReadGuard<PlayerRoster>;
 
     PlayerManager() = default;
     ~PlayerManager() override = default;
@@ -36,22 +54,32 @@ public:
     [[nodiscard]] std::shared_ptr<Player> CreatePlayer(uint8_t id, struct ClientInfo* net_info = nullptr);        
     [[nodiscard]] uint8_t RemovePlayerByNetInfo(struct ClientInfo* net_info);
     [[nodiscard]] std::shared_ptr<Player> FindPlayer(uint8_t id);
-    [[nodiscard]] size_t GetPlayerCount() const { return players_.size(); }
+    [[nodiscard]] std::shared_ptr<Player> FindPlayerBySession(SlotId session_id);
+    [[nodiscard]] size_t GetPlayerCount() const { return players_.Size(); }
     bool RemovePlayer(uint8_t id);
     uint8_t RemovePlayerInRoom(ClientInfo* pNetInfo);
     void SetMyPlayer(std::shared_ptr<Player> player) { my_player_ = player; }
     [[nodiscard]] const std::shared_ptr<Player>& GetMyPlayer() const { return my_player_; }
-    [[nodiscard]] CriticalSection& GetCriticalSection() { return critical_section_; }
-    [[nodiscard]] PlayerMap& GetPlayers() { return players_; }
+
+    // 尡  ִ  ȿ  ÷̾  ( )
+    [[nodiscard]] RosterGuard GetRoster() const { return roster_.Read(); }
     [[nodiscard]] bool IsLocalPlayer(uint8_t playerId);
     [[nodiscard]] bool IsRemotePlayer(uint8_t playerId);
 
 
+private:
+
+    // ȣ  critical_section_  · 
+    bool ErasePlayer(uint8_t id);
+    void PublishRoster();
+
 private:
 
     PlayerMap players_;
+    std::array<SlotId, 256> player_sessions_{};     // Ŷ player_id ->  id
     std::shared_ptr<Player> my_player_;
-    CriticalSection critical_section_{};
+    CriticalSection critical_section_{};    // (/) ȭ
+    RcuPtr<PlayerRoster> roster_;
 };
 
 
@@ -2,10 +2,14 @@
 /*
  *
  * : ȭ ׷ ü  ߻ Class
+ *  1.   : Update   SavePreviousPosition   ġ 
+ *     Render GetInterpolatedRect  ܰ   (interpolation_alpha_) ׸.
  *
  */
 
 #include <SDL3/SDL.h>
+#include <cstdint>
+#include <limits>
 #include "../core/IRenderable.hpp"
 #include "../math/Vector2.h"
 
@@ -41,6 +45,10 @@ public:
 
     void SetVisible(bool visible) { is_visible_ = visible; }
 
+    // GameApp::MainLoop ܸ AdvanceStep,   SetInterpolationAlpha ȣ
+    static void AdvanceStep() { ++simulation_step_; }
+    static void SetInterpolationAlpha(float alpha) { interpolation_alpha_ = alpha; }
+
 
 protected:
     virtual void UpdateDestinationRect()
@@ -51,6 +59,28 @@ protected:
         destination_rect_.h = size_.y;
     }
 
+    // ̹ ܿ ̱  ġ 
+    void SavePreviousPosition()
+    {
+        previous_position_ = position_;
+        previous_step_ = simulation_step_;
+    }
+
+    //  ܰ  ġ ̸  ׸  (̹ ܿ ŵ  ü   ״)
+    [[nodiscard]] SDL_FRect GetInterpolatedRect() const
+    {
+        SDL_FRect rect = destination_rect_;
+
+        if (previous_step_ == simulation_step_)
+        {
+            const float remain = 1.0f - interpolation_alpha_;
+            rect.x += (previous_position_.x - position_.x) * remain;
+            rect.y += (previous_position_.y - position_.y) * remain;
+        }
+
+        return rect;
+    }
+
 protected:
 	
     SDL_FPoint position_{ 0.0f, 0.0f };
@@ -58,4 +88,11 @@ protected:
 
     SDL_FRect destination_rect_{ 0.0f, 0.0f, 0.0f, 0.0f };
     bool is_visible_{ true };
+
+    SDL_FPoint previous_position_{ 0.0f, 0.0f };
+    uint64_t previous_step_{ std::numeric_limits<uint64_t>::max() };
+
+private:
+    inline static uint64_t simulation_step_{ 0 };
+    inline static float interpolation_alpha_{ 1.0f };
 };
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include "../../states/GameState.hpp"
 #include "../system/LocalPlayer.hpp"
 #include "../system/RemotePlayer.hpp"
+#include "../system/BlockGrid.hpp"
 
 
 #include <stdexcept>
@@ -63,12 +64,12 @@ std::shared_ptr<Block> Block::Clone() const
     newBlock->texture_ = texture_;
 
     newBlock->is_scaled_ = is_scaled_;
-    newBlock->is_recursionCheck_ = is_recursionCheck_;
     newBlock->is_standard_ = is_standard_;
     newBlock->is_changed_ = is_changed_;
 
     newBlock->index_x_ = index_x_;
     newBlock->index_y_ = index_y_;
+    newBlock->landing_row_ = landing_row_;
 
     newBlock->accumulate_time_ = accumulate_time_;
     newBlock->accumulate_effect_time_ = accumulate_effect_time_;
@@ -89,6 +90,8 @@ void Block::InitializeEffectPositions()
 
 void Block::Update(float deltaTime) 
 {
+    SavePreviousPosition();
+
     switch (state_) 
     {
     case BlockState::Playing:
@@ -230,7 +233,13 @@ void Block::UpdateDownMoving(float deltaTime)
 
     SetY(position_.y);
 
-    Block* (*blocks)[Constants::Board::BOARD_X_COUNT] = nullptr;
+    if (landing_row_ >= 0)
+    {
+        UpdateLandingRow();
+        return;
+    }
+
+    BlockGrid* blocks = nullptr;
 
     if (auto gameState = dynamic_cast<GameState*>(GAME_APP.GetStateManager().GetCurrentState().get()))
     {        
@@ -251,7 +260,7 @@ void Block::UpdateDownMoving(float deltaTime)
 
     for (int y = 0; y < Constants::Board::BOARD_Y_COUNT; ++y) 
     {
-        Block* targetBlock = blocks[y][index_x_];
+        Block* targetBlock = blocks->Get(index_x_, y);
 
         if (!targetBlock || targetBlock == this)
         {
@@ -283,16 +292,33 @@ void Block::UpdateDownMoving(float deltaTime)
 
     if (canMove == false) 
     {
-        blocks[index_y_][index_x_] = nullptr;
+        blocks->Set(index_x_, index_y_, nullptr);
 
         index_y_ = (Constants::Board::BOARD_Y_COUNT - 2) - static_cast<int>(position_.y / Constants::Block::SIZE);
 
-        blocks[index_y_][index_x_] = this;
+        blocks->Set(index_x_, index_y_, this);
 
         SetState(BlockState::Stationary);
     }    
 }
 
+void Block::UpdateLandingRow()
+{
+    //  迭 BasePlayer::UpdateFallingBlocks ̹   Ű ξǷ ġ Ȯ
+    const float landingY = Constants::Board::HEIGHT - static_cast<float>(landing_row_ + 1) * Constants::Block::SIZE;
+
+    if (position_.y < landingY)
+    {
+        return;
+    }
+
+    SetY(landingY);
+    index_y_ = landing_row_;
+    landing_row_ = -1;
+
+    SetState(BlockState::Stationary);
+}
+
 void Block::Render() 
 {
     if (!is_visible_ || !texture_)
@@ -302,13 +328,15 @@ void Block::Render()
 
     texture_->SetAlpha(255);
 
+    const SDL_FRect renderRect = GetInterpolatedRect();
+
     if (is_scaled_) 
     {
-        texture_->RenderScaled(&source_rect_, &destination_rect_, rotation_angle_);
+        texture_->RenderScaled(&source_rect_, &renderRect, rotation_angle_);
     }
     else 
     {
-        texture_->Render(position_.x, position_.y, &source_rect_);
+        texture_->Render(renderRect.x, renderRect.y, &source_rect_);
     }
 }
 
@@ -437,7 +465,7 @@ void Block::UpdateLinkStateForDownMoving()
     //  ũ ִ 쿡 ̿   Ʈ 
     if (hasHorizontalLinks)
     {
-        Block* (*gameBoard)[Constants::Board::BOARD_X_COUNT] = nullptr;
+        BlockGrid* gameBoard = nullptr;
         if (auto gameState = dynamic_cast<GameState*>(GAME_APP.GetStateManager().GetCurrentState().get()))
         {
             gameBoard = gameState->GetGameBlocks(playerID_);
@@ -448,7 +476,7 @@ void Block::UpdateLinkStateForDownMoving()
             //   üũ
             if (index_x_ > 0)
             {
-                if (auto leftBlock = gameBoard[index_y_][index_x_ - 1])
+                if (auto leftBlock = gameBoard->Get(index_x_ - 1, index_y_))
                 {
                     if (leftBlock->GetBlockType() == block_type_)
                     {
@@ -463,7 +491,7 @@ void Block::UpdateLinkStateForDownMoving()
             //   üũ
             if (index_x_ < Constants::Board::BOARD_X_COUNT - 1)
             {
-                if (auto rightBlock = gameBoard[index_y_][index_x_ + 1])
+                if (auto rightBlock = gameBoard->Get(index_x_ + 1, index_y_))
                 {
                     if (rightBlock->GetBlockType() == block_type_)
                     {
@@ -119,12 +119,13 @@ public:
     [[nodiscard]] LinkState GetLinkState() const { return link_state_; }
     [[nodiscard]] EffectState GetEffectState() const { return effect_state_; }
 
-    void SetRecursionCheck(bool check) { is_recursionCheck_ = check; }
-    [[nodiscard]] bool IsRecursionCheck() const { return is_recursionCheck_; }
-
     void SetStandard(bool standard) { is_standard_ = standard; }
     [[nodiscard]] bool IsStandard() const { return is_standard_; }   
 
+    // ߷ ó ̸    (-1̸  浹 ˻ )
+    void SetLandingRow(int row) { landing_row_ = row; }
+    [[nodiscard]] int GetLandingRow() const { return landing_row_; }
+
 private:
     void UpdateBlockEffect(float deltaTime);     //  Ʈ Ʈ
     void UpdateDestroying(float deltaTime);      // ı  Ʈ
@@ -139,6 +140,7 @@ private:
     
 
 protected:
+    void UpdateLandingRow();                     //    
 
     SDL_FRect source_rect_;                       // ؽó ҽ 
     SDL_FPoint block_origin_Position_;                  //   ġ
@@ -153,12 +155,12 @@ protected:
     std::shared_ptr<ImageTexture> texture_;      //  ؽó
 
     bool is_scaled_{ false };                     // ũ  
-    bool is_recursionCheck_{ false };             //  üũ 
     bool is_standard_{ false };                   // ǥ  
     bool is_changed_{ false };                    //  
 
     int index_x_{ -1 };                           // X ε
     int index_y_{ -1 };                           // Y ε
+    int landing_row_{ -1 };                       //  
 
     float accumulate_time_{ 0.0f };                    //  ð
     float accumulate_effect_time_{ 0.0f };              // Ʈ  ð
@@ -11,12 +11,12 @@
 #include "../../core/manager/StateManager.hpp"
 #include "../../core/manager/PlayerManager.hpp"
 #include "../system/LocalPlayer.hpp"
+#include "../system/BlockGrid.hpp"
 
 #include <algorithm>
 #include <cmath>
 #include <stdexcept>
 #include "../../utils/Logger.hpp"
-#include "../../utils/RectUtil.hpp"
 
 
 GameGroupBlock::GameGroupBlock()
@@ -152,27 +152,10 @@ void GameGroupBlock::MoveLeft(bool collisionCheck)
 
     if (collisionCheck) 
     {
-        
-        SDL_Rect leftCollRects[2]{};
-        SDL_Rect targetRect;
-
-        GetCollisionRect(blocks_[Standard].get(), &leftCollRects[0], Constants::Direction::Left);
-        GetCollisionRect(blocks_[Satellite].get(), &leftCollRects[1], Constants::Direction::Left);
-
-        bool canMove = true;
-
-        // 浹 üũ
-        for (const auto& block : *game_block_list_) 
-        {
-            RectUtils::ConvertFRectToRect(block->GetRect(), &targetRect);
-
-            if (SDL_HasRectIntersection(&leftCollRects[0], &targetRect) == true ||
-                SDL_HasRectIntersection(&leftCollRects[1], &targetRect) == true)
-            {
-                canMove = false;
-                break;
-            }
-        }
+        // 浹 üũ (      ִ )
+        const bool canMove =
+            !IsCellBlocked(BlockGrid::GetColumnAt(blocks_[Standard]->GetX()) - 1, blocks_[Standard]->GetY()) &&
+            !IsCellBlocked(BlockGrid::GetColumnAt(blocks_[Satellite]->GetX()) - 1, blocks_[Satellite]->GetY());
 
         //  üũ
         float limit = Constants::Board::WIDTH_MARGIN;
@@ -221,25 +204,10 @@ void GameGroupBlock::MoveRight(bool collisionCheck)
 
     if (collisionCheck) 
     {   
-        SDL_Rect rightCollRects[2]{};
-        SDL_Rect targetRect;
-
-        GetCollisionRect(blocks_[Standard].get(), &rightCollRects[0], Constants::Direction::Right);
-        GetCollisionRect(blocks_[Satellite].get(), &rightCollRects[1], Constants::Direction::Right);
-
-        bool canMove = true;
-
-        for (const auto& block : *game_block_list_) 
-        {
-            RectUtils::ConvertFRectToRect(block->GetRect(), &targetRect);
-
-            if (SDL_GetRectIntersection(&rightCollRects[Standard], &targetRect, &rightCollRects[0]) == true ||
-                SDL_GetRectIntersection(&rightCollRects[Satellite], &targetRect, &rightCollRects[1]) == true)
-            {
-                canMove = false;
-                break;
-            }
-        }
+        // 浹 üũ (      ִ )
+        const bool canMove =
+            !IsCellBlocked(BlockGrid::GetColumnAt(blocks_[Standard]->GetX()) + 1, blocks_[Standard]->GetY()) &&
+            !IsCellBlocked(BlockGrid::GetColumnAt(blocks_[Satellite]->GetX()) + 1, blocks_[Satellite]->GetY());
 
         float limit = Constants::Board::WIDTH - Constants::Board::WIDTH_MARGIN;
         if (rotateState_ == RotateState::Right) 
@@ -281,49 +249,21 @@ bool GameGroupBlock::MoveDown(bool collisionCheck)
 {
     checking_collision_ = true;    
 
-    bool hasCollision = false;
-    bool canMove = true;
-    SDL_Rect resultRect{};
-    SDL_Rect controlRect{};
-    SDL_Rect targetRect{};
-
-    float standardY = blocks_[Standard]->GetY();
-    float satelliteY = blocks_[Satellite]->GetY();
-
     switch (rotateState_) 
     {
     case RotateState::Default:
-        // -Ʒ ġ  浹 üũ
-        for (const auto& block : *game_block_list_) 
-        {
-            if (!block)
-            {
-                continue;
-            }
-
-            RectUtils::ConvertFRectToRect(blocks_[Satellite]->GetRect(), &controlRect);
-            RectUtils::ConvertFRectToRect(block->GetRect(), &targetRect);
-
-            if (SDL_GetRectIntersection(&controlRect, &targetRect, &resultRect))
-            {
-                hasCollision = true;
-                break;
-            }
-        }
+    {
+        // -Ʒ ġ  浹 üũ (Ʒ   ̿  )
+        const float landingY = GetLandingY(blocks_[Satellite].get());
 
-        if (hasCollision) 
-        {
-            blocks_[Standard]->SetY(targetRect.y - Constants::Block::SIZE * 2);
-            blocks_[Satellite]->SetY(targetRect.y - Constants::Block::SIZE);
-            can_move_ = false;
-        }
-        else if (satelliteY + Constants::Block::SIZE >= Constants::Board::HEIGHT) 
+        if (blocks_[Satellite]->GetY() >= landingY) 
         {
-            blocks_[Standard]->SetY(static_cast<float>(Constants::Board::HEIGHT - Constants::Block::SIZE * 2));
-            blocks_[Satellite]->SetY(static_cast<float>(Constants::Board::HEIGHT - Constants::Block::SIZE));
+            blocks_[Standard]->SetY(landingY - Constants::Block::SIZE);
+            blocks_[Satellite]->SetY(landingY);
             can_move_ = false;
         }
         break;
+    }
 
     case RotateState::Right:
     case RotateState::Left:
@@ -339,38 +279,19 @@ bool GameGroupBlock::MoveDown(bool collisionCheck)
         break;
 
     case RotateState::Top:
-        // Ʒ- ġ  浹 üũ
-        for (const auto& block : *game_block_list_) 
-        {
-            if (!block)
-            {
-                continue;
-            }
-
-            RectUtils::ConvertFRectToRect(blocks_[Standard]->GetRect(), &controlRect);
-            RectUtils::ConvertFRectToRect(block->GetRect(), &targetRect);
-
-            if (SDL_GetRectIntersection(&controlRect, &targetRect, &resultRect))
-            {
-                hasCollision = true;
-                break;
-            }
-        }
+    {
+        // Ʒ- ġ  浹 üũ (Ʒ   ̿  )
+        const float landingY = GetLandingY(blocks_[Standard].get());
 
-        if (hasCollision) 
+        if (blocks_[Standard]->GetY() >= landingY) 
         {
-            blocks_[Standard]->SetY(targetRect.y - Constants::Block::SIZE);
-            blocks_[Satellite]->SetY(targetRect.y - Constants::Block::SIZE * 2);
-            can_move_ = false;
-        }
-        else if (satelliteY + Constants::Block::SIZE * 2 >= Constants::Board::HEIGHT) 
-        {
-            blocks_[Standard]->SetY(static_cast<float>(Constants::Board::HEIGHT - Constants::Block::SIZE));
-            blocks_[Satellite]->SetY(static_cast<float>(Constants::Board::HEIGHT - Constants::Block::SIZE * 2));
+            blocks_[Standard]->SetY(landingY);
+            blocks_[Satellite]->SetY(landingY - Constants::Block::SIZE);
             can_move_ = false;
         }
         break;
     }
+    }
 
     checking_collision_ = false;
     return can_move_;
@@ -378,41 +299,12 @@ bool GameGroupBlock::MoveDown(bool collisionCheck)
 
 void GameGroupBlock::HandleHorizontalCollision() 
 {
-    bool collision1 = false;
-    bool collision2 = false;
-    SDL_Rect resultRect[2]{};
-    SDL_Rect controlRect[2]{};
-    SDL_Rect targetRect[2]{};
-
-    for (const auto& block : *game_block_list_) 
-    {
-        if (!block)
-        {
-            continue;
-        }
+    //    ڱ  ̿ Ҵ Ȯ
+    landing_y_[Standard] = GetLandingY(blocks_[Standard].get());
+    landing_y_[Satellite] = GetLandingY(blocks_[Satellite].get());
 
-        RectUtils::ConvertFRectToRect(blocks_[Standard]->GetRect(), &controlRect[0]);
-        RectUtils::ConvertFRectToRect(blocks_[Satellite]->GetRect(), &controlRect[1]);
-        RectUtils::ConvertFRectToRect(block->GetRect(), &targetRect[0]);
-        RectUtils::ConvertFRectToRect(block->GetRect(), &targetRect[1]);
-
-        if (SDL_GetRectIntersection(&controlRect[0], &targetRect[0], &resultRect[0]) == true)
-        {
-            SDL_RectToFRect(&resultRect[0], &intersect_result_rect_[0]);
-            collision1 = true;
-        }                
-
-        if (SDL_GetRectIntersection(&controlRect[1], &targetRect[1], &resultRect[1]) == true)
-        {
-            SDL_RectToFRect(&resultRect[1], &intersect_result_rect_[1]);
-            collision2 = true;
-        }
-
-        if (collision1 && collision2)
-        {
-            break;
-        }
-    }
+    const bool collision1 = blocks_[Standard]->GetY() >= landing_y_[Standard];
+    const bool collision2 = blocks_[Satellite]->GetY() >= landing_y_[Satellite];
 
     ProcessHorizontalCollisionResult(collision1, collision2);
 }
@@ -421,35 +313,24 @@ void GameGroupBlock::ProcessHorizontalCollisionResult(bool collision1, bool coll
 {
     if (collision1 == true && collision2 == true)
     {
-        blocks_[Standard]->SetY(intersect_result_rect_[0].y - Constants::Block::SIZE);
-        blocks_[Satellite]->SetY(intersect_result_rect_[1].y - Constants::Block::SIZE);
+        blocks_[Standard]->SetY(landing_y_[Standard]);
+        blocks_[Satellite]->SetY(landing_y_[Satellite]);
         can_move_ = false;
     }
     else if (collision1 == true && collision2 == false) 
     {
-        blocks_[Standard]->SetY(intersect_result_rect_[0].y - Constants::Block::SIZE);
+        blocks_[Standard]->SetY(landing_y_[Standard]);
         falling_Index_ = Satellite;
         is_falling_ = true;
         NETWORK.RequireFallingBlock(falling_Index_, is_falling_);
     }
     else if (collision1 == false && collision2 == true) 
     {
-        blocks_[Satellite]->SetY(intersect_result_rect_[1].y - Constants::Block::SIZE);
+        blocks_[Satellite]->SetY(landing_y_[Satellite]);
         falling_Index_ = Standard;
         is_falling_ = true;
         NETWORK.RequireFallingBlock(falling_Index_, is_falling_);
     }
-    else
-    {
-        float satelliteY = blocks_[Satellite]->GetY();
-        if (satelliteY + Constants::Block::SIZE >= Constants::Board::HEIGHT)
-        {
-            blocks_[Standard]->SetY(Constants::Board::HEIGHT - Constants::Block::SIZE);
-            blocks_[Satellite]->SetY(Constants::Board::HEIGHT - Constants::Block::SIZE);
-
-            can_move_ = false;
-        }
-    }
 }
 
 
@@ -699,48 +580,6 @@ void GameGroupBlock::ProcessBlockPlacement()
     }
 }
 
-void GameGroupBlock::GetCollisionRect(Block* block, SDL_Rect* rect, Constants::Direction dir) 
-{
-    if (!block || !rect)
-    {
-        return;
-    }
-
-    float halfWidth = block->GetWidth() / 2.0f;
-    float halfHeight = block->GetHeight() / 2.0f;
-
-    switch (dir) 
-    {
-    case Constants::Direction::Left:
-        rect->x = static_cast<int>(block->GetX() - halfWidth);
-        rect->y = static_cast<int>(block->GetY());
-        rect->w = static_cast<int>(halfWidth);
-        rect->h = static_cast<int>(block->GetHeight());
-        break;
-
-    case Constants::Direction::Top:
-        rect->x = static_cast<int>(block->GetX());
-        rect->y = static_cast<int>(block->GetY() - halfHeight);
-        rect->w = static_cast<int>(block->GetWidth());
-        rect->h = static_cast<int>(halfHeight);
-        break;
-
-    case Constants::Direction::Right:
-        rect->x = static_cast<int>(block->GetX() + block->GetWidth());
-        rect->y = static_cast<int>(block->GetY());
-        rect->w = static_cast<int>(halfWidth);
-        rect->h = static_cast<int>(block->GetHeight());
-        break;
-
-    case Constants::Direction::Bottom:
-        rect->x = static_cast<int>(block->GetX());
-        rect->y = static_cast<int>(block->GetY() + block->GetWidth());
-        rect->w = static_cast<int>(block->GetWidth());
-        rect->h = static_cast<int>(halfHeight);
-        break;
-    }
-}
-
 void GameGroupBlock::ResetBlock() 
 {
     for (auto& block : blocks_) 
@@ -863,48 +702,16 @@ void GameGroupBlock::SetGroupBlock(GroupBlock* block)
 
 void GameGroupBlock::HandleSingleBlockFalling() 
 {
-    bool hasCollision = false;
-
-    SDL_Rect resultRect;
-    SDL_Rect controlRect;
-    SDL_Rect targetRect;
-
-    for (const auto& block : *game_block_list_) 
-    {
-        if (!block)
-        {
-            continue;
-        }
-
-        RectUtils::ConvertFRectToRect(blocks_[falling_Index_]->GetRect(), &controlRect);
-        RectUtils::ConvertFRectToRect(block->GetRect(), &targetRect);
+    auto& fallingBlock = blocks_[falling_Index_];
+    const float landingY = GetLandingY(fallingBlock.get());
 
-        if (SDL_GetRectIntersection(&controlRect,&targetRect, &resultRect) == true)
-        {
-            hasCollision = true;
-            break;
-        }
-    }
-
-    if (hasCollision) 
+    if (fallingBlock->GetY() >= landingY) 
     {
-        blocks_[falling_Index_]->SetY(resultRect.y - Constants::Block::SIZE);
+        fallingBlock->SetY(landingY);
         can_move_ = false;
         is_falling_ = false;
         NETWORK.RequireFallingBlock(falling_Index_, is_falling_);
     }
-    else 
-    {
-        float currentY = blocks_[falling_Index_]->GetY();
-
-        if (currentY + Constants::Block::SIZE >= Constants::Board::HEIGHT) 
-        {
-            blocks_[falling_Index_]->SetY(Constants::Board::HEIGHT - Constants::Block::SIZE);
-            can_move_ = false;
-            is_falling_ = false;
-            NETWORK.RequireFallingBlock(falling_Index_, is_falling_);
-        }
-    }
 }
 
 void GameGroupBlock::Rotate() 
@@ -933,51 +740,12 @@ void GameGroupBlock::Rotate()
 
 void GameGroupBlock::HandleDefaultTopRotation() 
 {
-    SDL_Rect rightCollRect{}, leftCollRect{}, resultRect{}, targetRect{};
-    bool rightColl = false, leftColl = false;
-
-    GetCollisionRect(blocks_[static_cast<size_t>(BlockIndex::Standard)].get(), &leftCollRect, Constants::Direction::Left);
-    GetCollisionRect(blocks_[static_cast<size_t>(BlockIndex::Standard)].get(), &rightCollRect, Constants::Direction::Right);
-
-    for (const auto& block : *game_block_list_) 
-    {
-        if (!block)
-        {
-            continue;
-        }
-
-        RectUtils::ConvertFRectToRect(block->GetRect(), &targetRect);
-
-        //  浹 üũ
-        if (SDL_GetRectIntersection(&leftCollRect, &targetRect, &resultRect))
-        {
-            SDL_RectToFRect(&resultRect, &intersect_result_rect_[0]);
-            leftColl = true;
-        }
-
-        //  浹 üũ
-        if (SDL_GetRectIntersection(&rightCollRect, &targetRect, &resultRect))
-        {
-            SDL_RectToFRect(&resultRect, &intersect_result_rect_[1]);
-            rightColl = true;
-        }
-
-        if (rightColl && leftColl) 
-        {
-            return;
-        }
-    }
-
-    //    üũ
-    if (rightCollRect.x + Constants::Block::SIZE > Constants::Board::WIDTH - Constants::Board::WIDTH_MARGIN) 
-    {
-        rightColl = true;
-    }
+    const auto& standard = blocks_[static_cast<size_t>(BlockIndex::Standard)];
+    const int column = BlockGrid::GetColumnAt(standard->GetX());
 
-    if (leftCollRect.x < Constants::Board::WIDTH_MARGIN) 
-    {
-        leftColl = true;
-    }
+    //   ¿ ĭ 浹 üũ (   )
+    const bool leftColl = column <= 0 || IsCellBlocked(column - 1, standard->GetY());
+    const bool rightColl = column >= Constants::Board::BOARD_X_COUNT - 1 || IsCellBlocked(column + 1, standard->GetY());
 
     if (rotateState_ == RotateState::Top) 
     {
@@ -1053,6 +821,16 @@ int GameGroupBlock::CalculateIdxY(float y) const
     return (Constants::Board::BOARD_Y_COUNT- 2) - (int)(y / Constants::Block::SIZE);
 }
 
+bool GameGroupBlock::IsCellBlocked(int column, float y) const
+{
+    return game_blocks_ && game_blocks_->IsCellBlocked(column, y);
+}
+
+float GameGroupBlock::GetLandingY(const Block* block) const
+{
+    return game_blocks_ ? game_blocks_->GetLandingY(block->GetX()) : BlockGrid::GetRestY(0);
+}
+
 void GameGroupBlock::SetPlayerID(uint8_t id)
 {
     player_id_ = id;
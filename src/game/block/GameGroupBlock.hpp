@@ -2,13 +2,17 @@
 /**
  *
  * : Block 2 ̷ ׷  Ʈ Ѵ Class
+ * 1. 浹 ÷̾ (BlockGrid) ĭ .  ȼ ġ  ִ / ٲ   Ʈ ϰ,
+ *     ġ  ̷  (     )
  *
  */
+#include <cstdint>
 #include <memory>
-#include <list>
 #include "GroupBlock.hpp"
 #include "../../core/common/constants/Constants.hpp"
 
+class BlockGrid;
+
 
 // ȸ 
 enum class RotateState 
@@ -60,16 +64,16 @@ public:
     [[nodiscard]] int CalculateIdxY(float y) const;
 
     void SetGroupBlock(GroupBlock* block);
-    void SetGameBlocks(std::list<std::shared_ptr<Block>>* gameBlocks) { game_block_list_ = gameBlocks; }
+    void SetGameBlocks(BlockGrid* gameBlocks) { game_blocks_ = gameBlocks; }
     void SetEffectState(EffectState state);
     void ResetBlock();
     void SetPlayerID(uint8_t id);
     void UpdateFallingBlock(uint8_t fallingIdx, bool falling);
 
-protected:
-    void GetCollisionRect(Block* block, SDL_Rect* rect, Constants::Direction dir);
-
 private:
+    [[nodiscard]] bool IsCellBlocked(int column, float y) const;
+    [[nodiscard]] float GetLandingY(const Block* block) const;
+
     void HandleHorizontalCollision();
     void ProcessHorizontalCollisionResult(bool collision1, bool collision2);
     void HandleSingleBlockFalling();
@@ -102,6 +106,6 @@ private:
     float rotate_velocity_{ 0.0f };
     float horizontal_velocity_{ 0.0f };
 
-    SDL_FRect intersect_result_rect_[2]{};
-    std::list<std::shared_ptr<Block>>* game_block_list_;
+    float landing_y_[2]{};
+    BlockGrid* game_blocks_{ nullptr };
 };
\ No newline at end of file
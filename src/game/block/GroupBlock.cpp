@@ -1,11 +1,8 @@
 #include "GroupBlock.hpp"
 #include "../../core/manager/ResourceManager.hpp"
-#include "../../core/manager/PlayerManager.hpp"
 #include "../../states/GameState.hpp"
 #include "../../core/common/constants/Constants.hpp"
 #include "../../core/GameApp.hpp"
-#include "../../network/player/Player.hpp"
-#include <random>
 #include <functional>
 #include <cassert>
 
@@ -24,48 +21,6 @@ void GroupBlock::InitializeBlocks()
     }
 }
 
-bool GroupBlock::Create() 
-{
-    try 
-    {
-        InitializeBlocks();
-
-        auto texture = ImageTexture::Create("PUYO/puyo_beta.png");
-        if (texture == nullptr) 
-        {
-            throw std::runtime_error("Failed to load block texture");
-        }
-
-        std::random_device rd;
-        std::mt19937 randEngine(rd());
-        std::uniform_int_distribution<int> distribution(static_cast<int>(BlockType::Red), static_cast<int>(BlockType::Purple));
-
-        for (auto& block : blocks_) 
-        {
-            if (!block) 
-            {
-                throw std::runtime_error("Block initialization failed");
-            }
-
-#ifdef _APP_DEBUG_
-            block->SetBlockType(BlockType::Purple);
-#else
-            block->SetBlockType(static_cast<BlockType>(distribution(randEngine)));
-#endif
-
-            block->SetBlockTex(texture);
-            block->SetPlayerID(GAME_APP.GetPlayerManager().GetMyPlayer()->GetId());
-        }
-
-        return true;
-    }
-    catch (const std::exception&) 
-    {    
-        blocks_.fill(nullptr);
-        return false;
-    }
-}
-
 bool GroupBlock::Create(BlockType type1, BlockType type2) {
     try 
     {
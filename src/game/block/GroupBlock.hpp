@@ -36,7 +36,6 @@ public:
     virtual void Render() override;
     virtual void Release() override;
 
-    bool Create();
     bool Create(BlockType type1, BlockType type2);
 
     void SetState(BlockState state);
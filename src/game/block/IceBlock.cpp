@@ -1,6 +1,7 @@
 #include "IceBlock.hpp"
 #include "../../core/GameApp.hpp"
 #include "../../states/GameState.hpp"
+#include "../system/BlockGrid.hpp"
 #include "../../core/manager/StateManager.hpp"
 #include "../../texture/ImageTexture.hpp"
 #include "../../utils/RectUtil.hpp"
@@ -42,6 +43,8 @@ void IceBlock::SetState(BlockState state)
 
 void IceBlock::Update(float deltaTime) 
 {
+    SavePreviousPosition();
+
     switch (state_) 
     {
     case BlockState::Destroying:
@@ -81,7 +84,13 @@ void IceBlock::UpdateDownMoving(float deltaTime)
     position_.y += down_velocity_;
     SetY(position_.y);
 
-    Block* (*blocks)[Constants::Board::BOARD_X_COUNT] = nullptr;
+    if (landing_row_ >= 0)
+    {
+        UpdateLandingRow();
+        return;
+    }
+
+    BlockGrid* blocks = nullptr;
 
     if (auto gameState = dynamic_cast<GameState*>(GAME_APP.GetStateManager().GetCurrentState().get())) 
     {
@@ -100,7 +109,7 @@ void IceBlock::UpdateDownMoving(float deltaTime)
 
     for (int y = 0; y < Constants::Board::BOARD_Y_COUNT; ++y) 
     {
-        Block* block = blocks[y][index_x_];
+        Block* block = blocks->Get(index_x_, y);
         if (!block || block == this)
         {
             continue;
@@ -134,7 +143,7 @@ void IceBlock::UpdateDownMoving(float deltaTime)
             if (index_y_ >= 0 && index_y_ < Constants::Board::BOARD_Y_COUNT &&
                 index_x_ >= 0 && index_x_ < Constants::Board::BOARD_X_COUNT)
             {
-                blocks[index_y_][index_x_] = nullptr;
+                blocks->Set(index_x_, index_y_, nullptr);
             }
         }
 
@@ -144,7 +153,7 @@ void IceBlock::UpdateDownMoving(float deltaTime)
         if (newIndexY >= 0 && newIndexY < Constants::Board::BOARD_Y_COUNT &&
             index_x_ >= 0 && index_x_ < Constants::Board::BOARD_X_COUNT)
         {
-            blocks[newIndexY][index_x_] = this;
+            blocks->Set(index_x_, newIndexY, this);
             index_y_ = newIndexY;
             is_initialized_ = true;
             SetState(BlockState::Stationary);
@@ -161,12 +170,14 @@ void IceBlock::Render()
 
     texture_->SetAlpha(static_cast<uint8_t>(alpha_));
 
+    const SDL_FRect renderRect = GetInterpolatedRect();
+
     if (is_scaled_) 
     {
-        texture_->RenderScaled(&source_rect_, &destination_rect_, rotation_angle_);
+        texture_->RenderScaled(&source_rect_, &renderRect, rotation_angle_);
     }
     else 
     {
-        texture_->Render(position_.x, position_.y, &source_rect_);
+        texture_->Render(renderRect.x, renderRect.y, &source_rect_);
     }
 }
\ No newline at end of file
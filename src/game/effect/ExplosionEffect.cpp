@@ -6,7 +6,9 @@
 #include "../../core/GameUtils.hpp"
 #include "../../game/block/Block.hpp"
 
+#include <array>
 #include <cassert>
+#include <cmath>
 
 ExplosionParticle::ExplosionParticle() = default;
 
@@ -35,14 +37,23 @@ bool ExplosionContainer::InitializeParticles()
     particles_.clear();
     particles_.reserve(Constants::Particle::Explosion::PARTICLE_COUNT);
 
+    // 파티클 전체의 난수를 한 번에 생성
+    std::array<float, Constants::Particle::Explosion::PARTICLE_COUNT> angles;
+    std::array<float, Constants::Particle::Explosion::PARTICLE_COUNT> forces;
+    std::array<float, Constants::Particle::Explosion::PARTICLE_COUNT> sizes;
+
+    GameUtils::Random::Fill(angles, 25.0f, 155.0f);
+    GameUtils::Random::Fill(forces, 20.0f, 40.0f);
+    GameUtils::Random::Fill(sizes, 7.0f, 16.0f);
+
     for (size_t i = 0; i < Constants::Particle::Explosion::PARTICLE_COUNT; ++i)
     {
         auto particle = std::make_unique<ExplosionParticle>();
 
         particle->SetPosition(position_.x, position_.y);
 
-        const float angle = GameUtils::Random::Range(25.0f, 155.0f);
-        const float force = GameUtils::Random::Range(20.0f, 40.0f);
+        const float angle = angles[i];
+        const float force = forces[i];
 
         particle->direction_ =
         {
@@ -50,7 +61,7 @@ bool ExplosionContainer::InitializeParticles()
             force * -std::sin(GameUtils::ToRadians(angle))
         };
 
-        const float size = static_cast<float>(GameUtils::Random::Range(7, 15)); // 7 ~ 15
+        const float size = std::floor(sizes[i]); // 7 ~ 15
         particle->SetScale(size, size);
 
         particle->lifetime_ = 0.0f;
@@ -11,7 +11,6 @@
 
 #include <vector>
 #include <memory>
-#include <random>
 
 
 enum class BlockType;
@@ -8,14 +8,14 @@
 void GrasslandParticleSystem::SpawnParticle(BGParticle& particle)
 {
     particle.is_active = true;
-    particle.x = GameUtils::Random::Range(bounds_.x, bounds_.x + bounds_.w);
+    particle.x = GameUtils::Random::Range(bounds_.x, bounds_.x + bounds_.w, RandomStream::Effects);
     particle.y = -100.0f;
-    particle.create_time = GameUtils::Random::Range(3.5f, 6.5f);
-    particle.down_velocity = GameUtils::Random::Range(150.0f, 250.0f);
-    particle.rotation_velocity = GameUtils::Random::Range(MIN_ROTATION_SPEED, MAX_ROTATION_SPEED);
-    particle.amplitude = GameUtils::Random::Range(MIN_AMPLITUDE, MAX_AMPLITUDE);
-    particle.curve_period = GameUtils::Random::Range(50.0f, 100.0f);
-    particle.effect_type = GameUtils::Random::Range(0, 1);
+    particle.create_time = GameUtils::Random::Range(3.5f, 6.5f, RandomStream::Effects);
+    particle.down_velocity = GameUtils::Random::Range(150.0f, 250.0f, RandomStream::Effects);
+    particle.rotation_velocity = GameUtils::Random::Range(MIN_ROTATION_SPEED, MAX_ROTATION_SPEED, RandomStream::Effects);
+    particle.amplitude = GameUtils::Random::Range(MIN_AMPLITUDE, MAX_AMPLITUDE, RandomStream::Effects);
+    particle.curve_period = GameUtils::Random::Range(50.0f, 100.0f, RandomStream::Effects);
+    particle.effect_type = GameUtils::Random::Range(0, 1, RandomStream::Effects);
 }
 
 void GrasslandParticleSystem::UpdateParticle(BGParticle& particle, float deltaTime)
@@ -39,13 +39,13 @@ void IcelandParticleSystem::UpdateDirectionVector()
 void IcelandParticleSystem::SpawnParticle(BGParticle& particle)
 {
     particle.is_active = true;
-    particle.x = GameUtils::Random::Range(100.0f, 500.0f);
+    particle.x = GameUtils::Random::Range(100.0f, 500.0f, RandomStream::Effects);
     particle.y = -100.0f;
-    particle.create_time = GameUtils::Random::Range(1.5f, 5.5f);
-    particle.down_velocity = GameUtils::Random::Range(150.0f, 250.0f);
-    particle.rotation_velocity = GameUtils::Random::Range(35.0f, 85.0f);
-    particle.amplitude = GameUtils::Random::Range(0.5f, 1.0f);
-    particle.curve_period = GameUtils::Random::Range(50.0f, 100.0f);
+    particle.create_time = GameUtils::Random::Range(1.5f, 5.5f, RandomStream::Effects);
+    particle.down_velocity = GameUtils::Random::Range(150.0f, 250.0f, RandomStream::Effects);
+    particle.rotation_velocity = GameUtils::Random::Range(35.0f, 85.0f, RandomStream::Effects);
+    particle.amplitude = GameUtils::Random::Range(0.5f, 1.0f, RandomStream::Effects);
+    particle.curve_period = GameUtils::Random::Range(50.0f, 100.0f, RandomStream::Effects);
 }
 
 void IcelandParticleSystem::UpdateParticle(BGParticle& particle, float deltaTime)
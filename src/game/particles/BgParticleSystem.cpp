@@ -95,14 +95,14 @@ void GrasslandBgParticleSystem::UpdateParticle(BgParticle& particle, float delta
 void GrasslandBgParticleSystem::RespawnParticle(BgParticle& particle)
 {
     particle.is_active = true;
-    particle.x = GameUtils::Random::Range(100.0f, 500.0f);
+    particle.x = GameUtils::Random::Range(100.0f, 500.0f, RandomStream::Effects);
     particle.y = -100.0f;
-    particle.create_time = GameUtils::Random::Range(1.5f, 5.5f);
-    particle.down_velocity = GameUtils::Random::Range(150.0f, 250.0f);
-    particle.rotation_velocity = GameUtils::Random::Range(35.0f, 85.0f);
-    particle.amplitude = GameUtils::Random::Range(0.5f, 1.0f);
-    particle.curve_period = GameUtils::Random::Range(50.0f, 100.0f);
-    particle.effect_type = GameUtils::Random::Range(0, 1);
+    particle.create_time = GameUtils::Random::Range(1.5f, 5.5f, RandomStream::Effects);
+    particle.down_velocity = GameUtils::Random::Range(150.0f, 250.0f, RandomStream::Effects);
+    particle.rotation_velocity = GameUtils::Random::Range(35.0f, 85.0f, RandomStream::Effects);
+    particle.amplitude = GameUtils::Random::Range(0.5f, 1.0f, RandomStream::Effects);
+    particle.curve_period = GameUtils::Random::Range(50.0f, 100.0f, RandomStream::Effects);
+    particle.effect_type = GameUtils::Random::Range(0, 1, RandomStream::Effects);
     particle.accumulated_time = 0.0f;
     particle.angle = 0.0f;
     particle.curve_angle = 0.0f;
@@ -143,13 +143,13 @@ void IcelandBgParticleSystem::UpdateParticle(BgParticle& particle, float delta_t
 void IcelandBgParticleSystem::RespawnParticle(BgParticle& particle)
 {
     particle.is_active = true;
-    particle.x = GameUtils::Random::Range(100.0f, 500.0f);
+    particle.x = GameUtils::Random::Range(100.0f, 500.0f, RandomStream::Effects);
     particle.y = -100.0f;
-    particle.create_time = GameUtils::Random::Range(1.5f, 5.5f);
-    particle.down_velocity = GameUtils::Random::Range(150.0f, 250.0f);
-    particle.rotation_velocity = GameUtils::Random::Range(35.0f, 85.0f);
-    particle.amplitude = GameUtils::Random::Range(0.5f, 1.0f);
-    particle.curve_period = GameUtils::Random::Range(50.0f, 100.0f);
+    particle.create_time = GameUtils::Random::Range(1.5f, 5.5f, RandomStream::Effects);
+    particle.down_velocity = GameUtils::Random::Range(150.0f, 250.0f, RandomStream::Effects);
+    particle.rotation_velocity = GameUtils::Random::Range(35.0f, 85.0f, RandomStream::Effects);
+    particle.amplitude = GameUtils::Random::Range(0.5f, 1.0f, RandomStream::Effects);
+    particle.curve_period = GameUtils::Random::Range(50.0f, 100.0f, RandomStream::Effects);
     particle.accumulated_time = 0.0f;
     particle.angle = 0.0f;
     particle.curve_angle = 0.0f;
@@ -24,10 +24,13 @@
 
 #include "../../texture/ImageTexture.hpp"
 #include "../../core/GameApp.hpp"
+#include "../../core/GameUtils.hpp"
 #include "../../network/NetworkController.hpp"
 #include "../../network/player/Player.hpp"
 
 #include "../../utils/Logger.hpp"
+#include "../../sim/PuyoBoard.hpp"
+#include "../../sim/PuyoRules.hpp"
 
 #include <stdexcept>
 #include <algorithm>
@@ -35,6 +38,11 @@
 #include <iostream>
 #include <fstream>
 
+// 헤드리스 엔진 셀 값과 BlockType은 같은 숫자를 사용
+static_assert(static_cast<int>(PuyoCell::Red) == static_cast<int>(BlockType::Red));
+static_assert(static_cast<int>(PuyoCell::Purple) == static_cast<int>(BlockType::Purple));
+static_assert(static_cast<int>(PuyoCell::Garbage) == static_cast<int>(BlockType::Ice));
+
 BasePlayer::BasePlayer()
 {
     draw_objects_.reserve(100);
@@ -78,7 +86,7 @@ void BasePlayer::Reset()
 
     draw_objects_.clear();
 
-    std::memset(board_blocks_, 0, sizeof(Block*) * Constants::Board::BOARD_Y_COUNT * Constants::Board::BOARD_X_COUNT);
+    board_blocks_.Clear();
     
     score_info_.reset();
     state_info_ = GameStateInfo{};
@@ -224,7 +232,7 @@ bool BasePlayer::InitializeControlBlock()
 
     if (control_block_)
     {
-        control_block_->SetGameBlocks(&block_list_);
+        control_block_->SetGameBlocks(&board_blocks_);
         control_block_->SetPlayerID(player_id_);
         //control_block_->ResetBlock();
         return true;
@@ -333,7 +341,7 @@ void BasePlayer::RemoveBlock(Block* block, const SDL_Point& pos_idx)
     if (pos_idx.x >= 0 && pos_idx.x < Constants::Board::BOARD_X_COUNT &&
         pos_idx.y >= 0 && pos_idx.y < Constants::Board::BOARD_Y_COUNT)
     {
-        board_blocks_[pos_idx.y][pos_idx.x] = nullptr;
+        board_blocks_.Set(pos_idx.x, pos_idx.y, nullptr);
     }
 
     auto it = std::find_if(block_list_.begin(), block_list_.end(),
@@ -351,24 +359,69 @@ void BasePlayer::RemoveBlock(Block* block, const SDL_Point& pos_idx)
 
 void BasePlayer::UpdateFallingBlocks(const std::list<SDL_Point>& x_index_list)
 {
-    for (const auto& pos : x_index_list)
+    if (x_index_list.empty())
+    {
+        return;
+    }
+
+    // 블록 배치를 바이트 보드로 옮겨 중력 커널로 착지 행 계산 (PuyoGravity)
+    PuyoBoard board;
+    for (int x = 0; x < Constants::Board::BOARD_X_COUNT; x++)
+    {
+        for (int y = 0; y < board_blocks_.GetHeight(x); y++)
+        {
+            if (const Block* block = board_blocks_[y][x]; block != nullptr)
+            {
+                board.Set(x, y, static_cast<PuyoCell>(block->GetBlockType()));
+            }
+        }
+    }
+
+    PuyoLanding landing;
+    if (!board.ApplyGravity(landing))
+    {
+        return;
+    }
+
+    // 낙하 상태로 바꿀 때 이웃 링크를 현재 배열 기준으로 갱신하므로 배열을 옮기기 전에 처리
+    for (int x = 0; x < Constants::Board::BOARD_X_COUNT; x++)
     {
         for (int y = 0; y < Constants::Board::BOARD_Y_COUNT; y++)
         {
-            if (Block* block = board_blocks_[y][pos.x]; block != nullptr)
+            Block* block = board_blocks_[y][x];
+            const int row = landing.GetRow(x, y);
+
+            if (!block || row == y)
             {
-                if (block->GetState() == BlockState::DownMoving)
-                {
-                    continue;
-                }
+                continue;
+            }
 
-                if (y > pos.y)
-                {
-                    block->SetState(BlockState::DownMoving);
-                }
+            block->SetLandingRow(row);
+
+            if (block->GetState() != BlockState::DownMoving)
+            {
+                block->SetState(BlockState::DownMoving);
             }
         }
     }
+
+    // 배열은 착지 위치로 바로 옮기고 블록은 착지 행까지 낙하 연출만 진행 (아래 행부터 옮기므로 덮어쓰지 않음)
+    for (int x = 0; x < Constants::Board::BOARD_X_COUNT; x++)
+    {
+        for (int y = 0; y < Constants::Board::BOARD_Y_COUNT; y++)
+        {
+            Block* block = board_blocks_[y][x];
+            const int row = landing.GetRow(x, y);
+
+            if (!block || row == y)
+            {
+                continue;
+            }
+
+            board_blocks_.Set(x, row, block);
+            board_blocks_.Set(x, y, nullptr);
+        }
+    }
 }
 
 void BasePlayer::UpdateBlockLinks()
@@ -383,66 +436,25 @@ void BasePlayer::UpdateBlockLinks()
     }
 }
 
+// 점수 규칙은 헤드리스 엔진과 공유 (sim/PuyoRules.hpp)
 int16_t BasePlayer::GetComboConstant(uint8_t combo_count) const
 {
-    if (combo_count <= 1)
-    {
-        return 0;
-    }
-
-    if (combo_count <= 4)
-    {
-        return static_cast<int16_t>(std::pow(2, combo_count + 1));
-    }
-
-    if (combo_count <= Constants::Game::MAX_COMBO)
-    {
-        return 32 * (combo_count - 3);
-    }
-
-    return 0;
+    return PuyoRules::GetComboConstant(combo_count);
 }
 
 uint8_t BasePlayer::GetLinkBonus(size_t link_count) const
 {
-    static const std::array<uint8_t, 8> LINK_BONUSES = { 0, 0, 0, 0, 2, 3, 4, 5 };
-
-    if (link_count <= 4)
-    {
-        return 0;
-    }
-    else if (link_count <= 10)
-    {
-        return LINK_BONUSES[link_count - 4];
-    }
-    else
-    {
-        return Constants::Game::Score::MAX_LINK_BONUS;
-    }
+    return PuyoRules::GetLinkBonus(link_count);
 }
 
 uint8_t BasePlayer::GetTypeBonus(size_t count) const
 {
-    static const std::array<uint8_t, 6> TYPE_BONUSES =
-    {
-        0, 0, 3, 6, 12, Constants::Game::Score::MAX_TYPE_BONUS
-    };
-    return count < TYPE_BONUSES.size() ? TYPE_BONUSES[count] : TYPE_BONUSES.back();
+    return PuyoRules::GetTypeBonus(count);
 }
 
 uint8_t BasePlayer::GetMargin() const
 {
-    const float play_time = state_info_.play_time;
-
-    for (const auto& margin : Constants::Game::SCORE_MARGINS)
-    {
-        if (play_time <= margin.time)
-        {
-            return margin.margin;
-        }
-    }
-
-    return Constants::Game::SCORE_MARGINS[std::size(Constants::Game::SCORE_MARGINS) - 1].margin;
+    return PuyoRules::GetMargin(state_info_.play_time);
 }
 
 void BasePlayer::LoseGame(bool isWin)
@@ -507,9 +519,7 @@ void BasePlayer::UpdateInterruptBlock(int16_t count)
 
 bool BasePlayer::IsPossibleMove(int xIdx)
 {
-    return
-        board_blocks_[Constants::Board::BOARD_Y_COUNT - 2][xIdx] == nullptr ||
-        board_blocks_[Constants::Board::BOARD_Y_COUNT - 1][xIdx] == nullptr ? true : false;
+    return !board_blocks_.IsTopFull(xIdx);
 }
 
 
@@ -566,7 +576,7 @@ void BasePlayer::CreateBlocksFromFile()
             block->SetBlockTex(texture);
             block->SetPlayerID(player_id_);
 
-            board_blocks_[Constants::Board::BOARD_Y_COUNT - 1 - y][x] = block.get();
+            board_blocks_.Set(x, Constants::Board::BOARD_Y_COUNT - 1 - y, block.get());
             block_list_.push_back(block);
 
             UpdateLinkState(block.get());
@@ -576,6 +586,32 @@ void BasePlayer::CreateBlocksFromFile()
     block_list_.sort([](const auto& a, const auto& b) { return *a < *b; });
 }
 
+std::shared_ptr<GroupBlock> BasePlayer::CreateSequenceBlock()
+{
+    // BlockType 색 값은 PuyoCell과 같음
+    [[maybe_unused]] const PuyoPair pair = piece_sequence_.Next();
+
+    auto group_block = std::make_shared<GroupBlock>();
+
+#ifdef _APP_DEBUG_
+    const bool created = group_block->Create(BlockType::Purple, BlockType::Purple);
+#else
+    const bool created = group_block->Create(static_cast<BlockType>(pair.axis), static_cast<BlockType>(pair.child));
+#endif
+
+    if (!created)
+    {
+        return nullptr;
+    }
+
+    for (const auto& block : group_block->GetBlocks())
+    {
+        block->SetPlayerID(player_id_);
+    }
+
+    return group_block;
+}
+
 
 void BasePlayer::NotifyEvent(const std::shared_ptr<BasePlayerEvent>& event)
 {
@@ -608,55 +644,49 @@ void BasePlayer::RemoveEventListener(IPlayerEventListener* listener)
 
 bool BasePlayer::FindMatchedBlocks(std::list<BlockVector>& matchedGroups) 
 {
-    std::vector<Block*> currentGroup;
-    int blockCount = 0;
-    auto blockListSize = block_list_.size();
+    // 색별 비트보드로 옮긴 뒤 비트 연산으로 그룹 검색 (PuyoBitboard)
+    PuyoColorBoards boards;
 
     for (int y = 0; y < Constants::Board::BOARD_Y_COUNT; y++) 
     {
         for (int x = 0; x < Constants::Board::BOARD_X_COUNT; x++) 
         {
-            if (blockCount == blockListSize) 
+            const Block* block = board_blocks_[y][x];
+            if (!block || block->GetState() != BlockState::Stationary) 
             {
-                break;
+                continue;
             }
 
-            Block* block = board_blocks_[y][x];
-            if (!block) 
+            const auto cell = static_cast<PuyoCell>(block->GetBlockType());
+            if (IsPuyoColor(cell))
             {
-                continue;
+                boards.colors[static_cast<uint8_t>(cell) - static_cast<uint8_t>(PuyoCell::Red)].Set(x, y);
             }
-            else 
+            else if (cell == PuyoCell::Garbage)
             {
-                blockCount++;
+                boards.garbage.Set(x, y);
             }
+        }
+    }
 
-            if (block->GetBlockType() == BlockType::Ice || block->IsRecursionCheck()) 
-            {
-                continue;
-            }
+    PuyoGroups groups;
+    if (FindPuyoGroups(boards.colors, boards.garbage, groups) == 0)
+    {
+        return false;
+    }
 
-            block->SetRecursionCheck(true);
-            currentGroup.clear();
+    for (uint8_t i = 0; i < groups.count; ++i)
+    {
+        BlockVector& group = matchedGroups.emplace_back();
+        group.reserve(groups.GetGroupSize(i));
 
-            if (RecursionCheckBlock(x, y, Constants::Direction::None, currentGroup) >= Constants::Game::MIN_MATCH_COUNT - 1) 
-            {
-                currentGroup.push_back(block);
-                matchedGroups.push_back(currentGroup);
-            }
-            else 
+        groups.masks[i].ForEachIndex([this, &group](uint8_t index)
             {
-                block->SetRecursionCheck(false);
-
-                for (auto* matchedBlock : currentGroup) 
-                {
-                    matchedBlock->SetRecursionCheck(false);
-                }
-            }
-        }
+                group.push_back(board_blocks_[PuyoBoard::GetY(index)][PuyoBoard::GetX(index)]);
+            });
     }
 
-    return !matchedGroups.empty();
+    return true;
 }
 
 void BasePlayer::UpdateComboState() 
@@ -774,13 +804,9 @@ void BasePlayer::GenerateSmallIceBlockGroup(const std::shared_ptr<ImageTexture>&
         else 
         {
             // 랜덤 인덱스 생성
-            std::random_device rd;
-            std::mt19937 gen(rd());
-            std::uniform_int_distribution<> dist(0, Constants::Board::BOARD_X_COUNT - 1);
-
             while (positions.size() < xCnt) 
             {
-                positions.insert(dist(gen));
+                positions.insert(GameUtils::Random::Range(0, Constants::Board::BOARD_X_COUNT - 1, RandomStream::Gameplay));
             }
         }
 
@@ -834,7 +860,7 @@ void BasePlayer::RemoveIceBlocks(std::list<SDL_Point>& x_index_list)
     {
         SDL_Point pos_idx{ ice_block->GetPosIdx_X(), ice_block->GetPosIdx_Y() };
 
-        board_blocks_[pos_idx.y][pos_idx.x] = nullptr;
+        board_blocks_.Set(pos_idx.x, pos_idx.y, nullptr);
         block_list_.remove(ice_block);
         x_index_list.push_back(pos_idx);
     }
@@ -844,13 +870,7 @@ void BasePlayer::RemoveIceBlocks(std::list<SDL_Point>& x_index_list)
 
 bool BasePlayer::IsGameOver() const 
 {
-    bool isGameOverState =
-        board_blocks_[Constants::Board::BOARD_Y_COUNT - 1][2] != nullptr ||
-        board_blocks_[Constants::Board::BOARD_Y_COUNT - 1][3] != nullptr ||
-        board_blocks_[Constants::Board::BOARD_Y_COUNT - 2][2] != nullptr ||
-        board_blocks_[Constants::Board::BOARD_Y_COUNT - 2][3] != nullptr;
-
-    return isGameOverState;
+    return board_blocks_.IsTopOccupied(2) || board_blocks_.IsTopOccupied(3);
 }
 
 bool BasePlayer::ProcessGameOver() 
@@ -940,7 +960,7 @@ void BasePlayer::HandleClearedBlockGroup(std::list<BlockVector>::iterator& group
 
         CreateBlockClearEffect(std::shared_ptr<Block>(block, [](Block*) {}));
 
-        board_blocks_[idx.y][idx.x] = nullptr;
+        board_blocks_.Set(idx.x, idx.y, nullptr);
 
         auto it = std::find_if(block_list_.begin(), block_list_.end(),
             [block](const std::shared_ptr<Block>& ptr)
@@ -1000,54 +1020,6 @@ void BasePlayer::UpdateAfterBlocksCleared()
     }
 }
 
-short BasePlayer::RecursionCheckBlock(short x, short y, Constants::Direction direction, std::vector<Block*>& matchedBlocks)
-{
-    if (!board_blocks_[y][x])
-    {
-        return 0;
-    }
-
-    Block* block = board_blocks_[y][x];
-    BlockType blockType = block->GetBlockType();
-    short matchCount = 0;
-
-    // 주변 블록 검사 (정적 상수 사용)
-    for (const auto& [dir, offset] : Constants::DirectionInfo::DIRECTION_OFFSETS)
-    {
-        if (direction == dir)
-        {
-            continue;
-        }
-
-        const auto [dx, dy] = offset;
-        short checkX = x + dx;
-        short checkY = y + dy;
-
-        if (checkX < 0 || checkX >= Constants::Board::BOARD_X_COUNT ||
-            checkY < 0 || checkY >= Constants::Board::BOARD_Y_COUNT)
-        {
-            continue;
-        }
-
-        Block* checkBlock = board_blocks_[checkY][checkX];
-        if (!checkBlock || checkBlock->IsRecursionCheck() || checkBlock->GetState() != BlockState::Stationary)
-        {
-            continue;
-        }
-
-        if (blockType == checkBlock->GetBlockType())
-        {
-            checkBlock->SetRecursionCheck(true);
-            matchedBlocks.push_back(checkBlock);
-            matchCount++;
-            matchCount += RecursionCheckBlock(checkX, checkY, GameStateDetail::GetOppositeDirection(dir), matchedBlocks);
-        }
-    }
-
-    return matchCount;
-}
-
-
 void BasePlayer::CollectRemoveIceBlocks()
 {
     if (block_list_.empty() || matched_blocks_.empty() || state_info_.current_phase != GamePhase::Shattering)
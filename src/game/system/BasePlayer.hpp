@@ -16,6 +16,8 @@
 #include "../../core/common/types/GameTypes.hpp"
 #include "../../states/GameState.hpp"
 #include "../event/PlayerEvent.hpp"
+#include "BlockGrid.hpp"
+#include "../../sim/PuyoPieceSequence.hpp"
 
 class Block;
 class GameBackground;
@@ -49,12 +51,12 @@ public:
     void ReleaseContainer(Container& container);
 
     // ʱȭ  
-    virtual bool Initialize(const std::span<const uint8_t>& blocktype1,
-        const std::span<const uint8_t>& blocktype2,
+    // pieceSeed:    õ (   ,  밡  )
+    virtual bool Initialize(uint32_t pieceSeed,
         uint8_t playerIdx,
         uint16_t characterIdx,
         const std::shared_ptr<GameBackground>& background) = 0;
-    virtual bool Restart(const std::span<const uint8_t>& blockType1 = {}, const std::span<const uint8_t>& blockType2 = {}) = 0;
+    virtual bool Restart(uint32_t pieceSeed) = 0;
 
     //  
     virtual void CreateNextBlock() = 0;
@@ -82,10 +84,11 @@ public:
     //  ȸ
     GamePhase GetGameState() const { return state_info_.current_phase; }
     uint8_t GetPlayerID() const { return player_id_; }
+    uint32_t GetPieceSeed() const { return piece_sequence_.GetSeed(); }
     int16_t GetTotalInterruptBlockCount() const { return score_info_.total_interrupt_block_count; }
     int16_t GetTotalEnemyInterruptBlockCount() const { return score_info_.total_enemy_interrupt_block_count; }
     std::shared_ptr<GameBoard> GetGameBoard() const { return game_board_; }
-    Block* (*GetGameBlocks())[Constants::Board::BOARD_X_COUNT] { return board_blocks_; }
+    BlockGrid* GetGameBlocks() { return &board_blocks_; }
 
     bool IsRunning() const { return state_info_.is_running; }
     void SetRunning(bool running) { state_info_.is_running = running; }
@@ -124,6 +127,7 @@ protected:
 
     //    ޼
     void RemoveBlock(Block* block, const SDL_Point& pos_idx);
+    //  ŵ       ϸ    (x_index_list   )
     void UpdateFallingBlocks(const std::list<SDL_Point>& x_index_list);
     void UpdateBlockLinks();
 
@@ -142,9 +146,11 @@ protected:
     //  Ϸ  
     void CreateBlocksFromFile();
 
+    //       ׷   (  nullptr)
+    [[nodiscard]] std::shared_ptr<GroupBlock> CreateSequenceBlock();
+
     //   ڵ鸵 (ø ޼ )
     virtual bool FindMatchedBlocks(std::list<BlockVector>& matchedGroups);
-    virtual short RecursionCheckBlock(short x, short y, Constants::Direction direction, std::vector<Block*>& matchedBlocks);    
     virtual void UpdateComboState();
     virtual void ResetComboState();
 
@@ -221,7 +227,7 @@ protected:
     std::shared_ptr<GameBackground> background_;
 
     //  
-    Block* board_blocks_[Constants::Board::BOARD_Y_COUNT][Constants::Board::BOARD_X_COUNT]{ nullptr };
+    BlockGrid board_blocks_;
     
     std::vector<RenderableObject*> draw_objects_;
     std::vector<IPlayerEventListener*> event_listeners_;
@@ -232,6 +238,7 @@ protected:
     
     std::set<std::shared_ptr<IceBlock>> ice_blocks_;
     std::deque<std::shared_ptr<GroupBlock>> next_blocks_;    
+    PuyoPieceSequence piece_sequence_;
 };
 
 template<typename Container>
@@ -0,0 +1,168 @@
+#pragma once
+/*
+ *
+ * 설명: 플레이어 보드의 블록 배열과 열별 점유 비트 (높이 맵)
+ *  1. grid[y][x] 로 읽기만 가능하고 쓰기는 Set/Clear로만 하므로 배치, 제거, 낙하, 방해 블록 착지 때 열 비트가 함께 갱신됨.
+ *  2. 열 비트의 y번째 비트 = (x, y) 칸 점유 여부 (y = 0이 바닥). 높이, 가장 낮은 빈 행, 윗줄 점유 여부를
+ *     배열을 다시 훑지 않고 비트 연산으로 계산.
+ *  3. 디버그 빌드에서는 질의마다 열 비트를 배열과 비교해 갱신 누락을 검출.
+ *  4. 조작 블록의 픽셀 위치 -> 칸 변환(옆 칸 충돌, 착지 y)도 여기서 계산. SDL 없이 포함되므로
+ *     puzzle_bench grid가 같은 코드를 기존 배열/사각형 검사와 비교.
+ *
+ */
+
+#include "../../core/common/constants/RuleConstants.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+
+class Block;
+
+class BlockGrid
+{
+public:
+    static constexpr int X_COUNT = Constants::Board::BOARD_X_COUNT;
+    static constexpr int Y_COUNT = Constants::Board::BOARD_Y_COUNT;
+
+    static_assert(Y_COUNT <= 16, "column bits must fit in 16 bits");
+
+    // 맨 위 두 행 (숨은 행 포함)
+    static constexpr uint16_t TOP_ROWS_MASK = static_cast<uint16_t>((1u << (Y_COUNT - 2)) | (1u << (Y_COUNT - 1)));
+
+    [[nodiscard]] static constexpr uint16_t GetRowBit(int y) { return static_cast<uint16_t>(1u << y); }
+
+    // 읽기 전용 행 (grid[y][x])
+    [[nodiscard]] Block* const* operator[](int y) const { return cells_[y]; }
+
+    [[nodiscard]] Block* Get(int x, int y) const { return cells_[y][x]; }
+
+    void Set(int x, int y, Block* block)
+    {
+        cells_[y][x] = block;
+
+        if (block)
+        {
+            column_bits_[x] |= GetRowBit(y);
+        }
+        else
+        {
+            column_bits_[x] &= static_cast<uint16_t>(~GetRowBit(y));
+        }
+    }
+
+    void Clear()
+    {
+        for (int y = 0; y < Y_COUNT; ++y)
+        {
+            for (int x = 0; x < X_COUNT; ++x)
+            {
+                cells_[y][x] = nullptr;
+            }
+        }
+
+        for (auto& bits : column_bits_)
+        {
+            bits = 0;
+        }
+    }
+
+    [[nodiscard]] uint16_t GetColumnBits(int x) const
+    {
+        assert(column_bits_[x] == ScanColumnBits(x) && "column bits out of sync with board");
+        return column_bits_[x];
+    }
+
+    // 가장 위 블록의 행 + 1 (빈 열은 0)
+    [[nodiscard]] int GetHeight(int x) const { return std::bit_width(GetColumnBits(x)); }
+
+    // 바닥에서부터 처음 만나는 빈 행 (skip_row 칸은 찬 것으로 취급, 열이 가득 차면 Y_COUNT)
+    [[nodiscard]] int GetLowestEmptyRow(int x, int skip_row = -1) const
+    {
+        const uint16_t bits = GetColumnBits(x) | (skip_row >= 0 ? GetRowBit(skip_row) : 0);
+        return std::countr_one(bits);
+    }
+
+    // 맨 위 두 칸이 모두 찬 열 (이 열로는 옆 이동 불가)
+    [[nodiscard]] bool IsTopFull(int x) const { return (GetColumnBits(x) & TOP_ROWS_MASK) == TOP_ROWS_MASK; }
+
+    // 맨 위 두 칸 중 하나라도 찬 열 (가운데 열이면 게임 오버)
+    [[nodiscard]] bool IsTopOccupied(int x) const { return (GetColumnBits(x) & TOP_ROWS_MASK) != 0; }
+
+    // 블록 중심이 있는 열 (수평 이동 중에도 가까운 열)
+    [[nodiscard]] static int GetColumnAt(float x)
+    {
+        return static_cast<int>(std::floor((x - Constants::Board::WIDTH_MARGIN + Constants::Block::SIZE / 2.0f) / Constants::Block::SIZE));
+    }
+
+    // 윗변이 y인 블록이 걸쳐 있는 행 (칸 경계에 맞으면 한 행, 아니면 위아래 두 행). 렌더링과 같이 정수 픽셀 기준
+    [[nodiscard]] static uint16_t GetOverlapRowBits(float y)
+    {
+        const float cellY = static_cast<float>(static_cast<int>(y)) / Constants::Block::SIZE;
+        uint16_t bits = 0;
+
+        for (const int cell : { static_cast<int>(std::floor(cellY)), static_cast<int>(std::ceil(cellY)) })
+        {
+            const int row = (Y_COUNT - 2) - cell;
+            if (row >= 0 && row < Y_COUNT)
+            {
+                bits |= GetRowBit(row);
+            }
+        }
+
+        return bits;
+    }
+
+    // column 열에서 윗변이 y인 블록과 겹치는 칸이 있는지 (보드 밖 열은 false)
+    [[nodiscard]] bool IsCellBlocked(int column, float y) const
+    {
+        if (column < 0 || column >= X_COUNT)
+        {
+            return false;
+        }
+
+        return (GetColumnBits(column) & GetOverlapRowBits(y)) != 0;
+    }
+
+    // 왼변이 x인 블록이 걸쳐 있는 열 중 가장 높이 쌓인 블록 바로 위 y. 행과 같이 정수 픽셀 기준
+    [[nodiscard]] float GetLandingY(float x) const
+    {
+        const float cellX = (static_cast<float>(static_cast<int>(x)) - Constants::Board::WIDTH_MARGIN) / Constants::Block::SIZE;
+        const int first = std::clamp(static_cast<int>(std::floor(cellX)), 0, X_COUNT - 1);
+        const int last = std::clamp(static_cast<int>(std::ceil(cellX)), 0, X_COUNT - 1);
+
+        int height = 0;
+        for (int column = first; column <= last; ++column)
+        {
+            height = std::max(height, GetHeight(column));
+        }
+
+        return GetRestY(height);
+    }
+
+    // 높이가 height인 열 위에 놓인 블록의 y (빈 열은 바닥)
+    [[nodiscard]] static float GetRestY(int height)
+    {
+        return static_cast<float>(Constants::Board::HEIGHT) - static_cast<float>(height + 1) * Constants::Block::SIZE;
+    }
+
+private:
+    [[nodiscard]] uint16_t ScanColumnBits(int x) const
+    {
+        uint16_t bits = 0;
+        for (int y = 0; y < Y_COUNT; ++y)
+        {
+            if (cells_[y][x])
+            {
+                bits |= GetRowBit(y);
+            }
+        }
+        return bits;
+    }
+
+private:
+    Block* cells_[Y_COUNT][X_COUNT]{};
+    uint16_t column_bits_[X_COUNT]{};
+};
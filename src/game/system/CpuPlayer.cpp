@@ -0,0 +1,260 @@
+#include "CpuPlayer.hpp"
+
+#include "../block/Block.hpp"
+#include "../block/GameGroupBlock.hpp"
+#include "../block/GroupBlock.hpp"
+
+#include "../../utils/Logger.hpp"
+
+#include <array>
+
+namespace
+{
+    // 난이도별 입력 간격 (초). 회전/이동 한 번마다 이만큼 기다림
+    constexpr std::array<float, 3> INPUT_INTERVALS = { 0.25f, 0.12f, 0.06f };
+
+    // 벽/블록에 막혀 목표에 못 가는 경우를 대비한 최대 입력 수 (넘으면 그 자리에서 내림)
+    constexpr uint8_t MAX_INPUTS = 16;
+
+    // 작업 스레드가 밀렸을 때 시간 예산 외에 더 기다리는 시간 (초)
+    constexpr float SEARCH_GRACE_TIME = 0.05f;
+
+    [[nodiscard]] PuyoRotation ToPuyoRotation(RotateState state)
+    {
+        // 화면 좌표는 아래로 증가하므로 Default는 회전 블록이 축 블록 아래에 있는 상태
+        switch (state)
+        {
+        case RotateState::Right:
+            return PuyoRotation::Right;
+        case RotateState::Top:
+            return PuyoRotation::Up;
+        case RotateState::Left:
+            return PuyoRotation::Left;
+        default:
+            return PuyoRotation::Down;
+        }
+    }
+
+    [[nodiscard]] PuyoCell ToPuyoCell(const std::shared_ptr<Block>& block)
+    {
+        return block ? static_cast<PuyoCell>(block->GetBlockType()) : PuyoCell::Empty;
+    }
+}
+
+CpuPlayer::CpuPlayer(PuyoCpuLevel level)
+    : level_(level)
+    , config_(PuyoBeamSearch::GetLevelConfig(level))
+    , table_(config_.table_kb > 0 ? std::make_shared<PuyoTranspositionTable>(size_t{ config_.table_kb } << 10) : nullptr)
+    , searcher_(GetWorkerPool(), table_)
+{
+}
+
+CpuPlayer::~CpuPlayer()
+{
+    searcher_.Cancel();
+}
+
+PuyoWorkerPool& CpuPlayer::GetWorkerPool()
+{
+    static PuyoWorkerPool pool;
+    return pool;
+}
+
+void CpuPlayer::Update(float deltaTime)
+{
+    LocalPlayer::Update(deltaTime);
+
+    if (state_info_.current_phase != GamePhase::Playing)
+    {
+        return;
+    }
+
+    UpdateSearch(deltaTime);
+    UpdateInput(deltaTime);
+}
+
+void CpuPlayer::PlayNextBlock()
+{
+    LocalPlayer::PlayNextBlock();
+
+    StartSearch();
+}
+
+void CpuPlayer::Release()
+{
+    searcher_.Cancel();
+    ResetControlState();
+
+    LocalPlayer::Release();
+}
+
+void CpuPlayer::Reset()
+{
+    searcher_.Cancel();
+    ResetControlState();
+
+    LocalPlayer::Reset();
+}
+
+void CpuPlayer::ResetControlState()
+{
+    target_.reset();
+    think_time_ = 0.0f;
+    input_timer_ = 0.0f;
+    input_count_ = 0;
+}
+
+void CpuPlayer::StartSearch()
+{
+    searcher_.Cancel();
+    ResetControlState();
+
+    if (!BuildSearchRequest(request_))
+    {
+        return;
+    }
+
+    if (!searcher_.Start(request_, config_))
+    {
+        LOGGER.Error("CpuPlayer::StartSearch - previous search is still running");
+    }
+}
+
+void CpuPlayer::UpdateSearch(float deltaTime)
+{
+    if (!searcher_.IsSearching())
+    {
+        return;
+    }
+
+    think_time_ += deltaTime;
+
+    PuyoSearchResult result;
+    if (!searcher_.TryGetResult(result))
+    {
+        const float budget = static_cast<float>(config_.time_budget_us) / 1'000'000.0f;
+        if (think_time_ < budget + SEARCH_GRACE_TIME)
+        {
+            return;
+        }
+
+        // 작업 스레드가 밀려 예산을 넘겼으면 탐색을 버리고 한 층(22개 배치)만 바로 계산
+        searcher_.Cancel();
+
+        PuyoBeamConfig fallback = config_;
+        fallback.beam_width = 1;
+        fallback.depth = 1;
+        result = PuyoBeamSearch::Search(request_, fallback, nullptr, nullptr, table_.get());
+
+        LOGGER.Warning("CpuPlayer search exceeded time budget ({:.3f}s), using single-layer result", think_time_);
+    }
+
+    // 게임 오버를 피할 배치가 없으면 현재 위치 그대로 내림
+    target_ = result.found ? std::optional<PuyoPlacement>(result.placement) : GetCurrentPlacement();
+}
+
+void CpuPlayer::UpdateInput(float deltaTime)
+{
+    if (!target_ || !control_block_ || control_block_->GetState() != BlockState::Playing)
+    {
+        return;
+    }
+
+    input_timer_ += deltaTime;
+    if (input_timer_ < INPUT_INTERVALS[static_cast<size_t>(level_)])
+    {
+        return;
+    }
+    input_timer_ = 0.0f;
+
+    const auto current = GetCurrentPlacement();
+    if (!current)
+    {
+        return;
+    }
+
+    if (input_count_ < MAX_INPUTS)
+    {
+        // 회전은 Default -> Right -> Top -> Left 순서로 한 단계씩. 벽에서 회전하면 축 블록이 밀리므로 열은 회전 후에 맞춤
+        if (current->rotation != target_->rotation)
+        {
+            ++input_count_;
+            RotateBlock(0, false);
+            return;
+        }
+
+        if (current->column != target_->column)
+        {
+            ++input_count_;
+            const auto direction = current->column < target_->column ? Constants::Direction::Right : Constants::Direction::Left;
+            MoveBlock(static_cast<uint8_t>(direction), 0);
+            return;
+        }
+    }
+
+    MoveBlock(static_cast<uint8_t>(Constants::Direction::Bottom), 0);
+}
+
+bool CpuPlayer::BuildSearchRequest(PuyoSearchRequest& request) const
+{
+    if (!control_block_ || control_block_->GetState() != BlockState::Playing)
+    {
+        return false;
+    }
+
+    const auto& blocks = control_block_->GetBlocks();
+    if (!blocks[Standard] || !blocks[Satellite])
+    {
+        return false;
+    }
+
+    request = PuyoSearchRequest{};
+
+    for (int y = 0; y < Constants::Board::BOARD_Y_COUNT; ++y)
+    {
+        for (int x = 0; x < Constants::Board::BOARD_X_COUNT; ++x)
+        {
+            if (const Block* block = board_blocks_[y][x])
+            {
+                request.board.Set(x, y, static_cast<PuyoCell>(block->GetBlockType()));
+            }
+        }
+    }
+
+    request.pairs[request.pair_count++] = { ToPuyoCell(blocks[Standard]), ToPuyoCell(blocks[Satellite]) };
+
+    for (const auto& next_block : next_blocks_)
+    {
+        if (request.pair_count >= PuyoSearchRequest::MAX_PAIRS)
+        {
+            break;
+        }
+
+        if (next_block)
+        {
+            const auto& next = next_block->GetBlocks();
+            request.pairs[request.pair_count++] = { ToPuyoCell(next[Standard]), ToPuyoCell(next[Satellite]) };
+        }
+    }
+
+    request.state.pending_garbage = score_info_.total_interrupt_block_count;
+    request.state.margin = GetMargin();
+
+    return true;
+}
+
+std::optional<PuyoPlacement> CpuPlayer::GetCurrentPlacement() const
+{
+    if (!control_block_)
+    {
+        return std::nullopt;
+    }
+
+    const auto& blocks = control_block_->GetBlocks();
+    if (!blocks[Standard])
+    {
+        return std::nullopt;
+    }
+
+    return PuyoPlacement{ static_cast<uint8_t>(blocks[Standard]->GetPosIdx_X()), ToPuyoRotation(control_block_->GetRotateState()) };
+}
@@ -0,0 +1,55 @@
+#pragma once
+/**
+ *
+ * 설명: CPU 플레이어 (빔 탐색으로 배치를 정하고 사람과 같은 MoveBlock/RotateBlock 경로로 조작)
+ *  1. 새 블록이 나오면 보드와 다음 블록을 PuyoSearchRequest로 복사해 작업 스레드 풀에서 탐색 시작.
+ *  2. Update에서는 결과를 폴링만 하므로 렌더 스레드가 탐색을 기다리지 않음.
+ *  3. 시간 예산 안에 결과가 오지 않으면 탐색을 버리고 한 층 탐색(22개 배치)으로 바로 결정.
+ *  4. 목표 회전/열에 도달할 때까지 입력 간격마다 한 번씩 회전/이동한 뒤 빠르게 내림.
+ *  5. 난이도 설정에 전치표 크기가 있으면 플레이어마다 전치표를 두고 턴이 바뀌어도 평가를 재사용.
+ *  6. 조작 블록의 이동/착지 처리(GameGroupBlock)가 로컬 플레이어 기준이므로 LocalPlayer 자리를 대신함.
+ *
+ */
+#include "LocalPlayer.hpp"
+#include "../../sim/PuyoBeamSearch.hpp"
+
+#include <memory>
+#include <optional>
+
+class CpuPlayer : public LocalPlayer
+{
+public:
+    explicit CpuPlayer(PuyoCpuLevel level = PuyoCpuLevel::Normal);
+    ~CpuPlayer() override;
+
+    void Update(float deltaTime) override;
+    void PlayNextBlock() override;
+    void Release() override;
+    void Reset() override;
+
+    [[nodiscard]] PuyoCpuLevel GetLevel() const { return level_; }
+
+private:
+    void StartSearch();
+    void UpdateSearch(float deltaTime);
+    void UpdateInput(float deltaTime);
+    void ResetControlState();
+
+    [[nodiscard]] bool BuildSearchRequest(PuyoSearchRequest& request) const;
+    [[nodiscard]] std::optional<PuyoPlacement> GetCurrentPlacement() const;
+
+    // 모든 CPU 플레이어가 함께 쓰는 작업 스레드 풀
+    [[nodiscard]] static PuyoWorkerPool& GetWorkerPool();
+
+private:
+    PuyoCpuLevel level_{ PuyoCpuLevel::Normal };
+    PuyoBeamConfig config_;
+    std::shared_ptr<PuyoTranspositionTable> table_;
+    PuyoBeamSearcher searcher_;
+    PuyoSearchRequest request_;
+
+    std::optional<PuyoPlacement> target_;
+    float think_time_{ 0.0f };
+    float input_timer_{ 0.0f };
+    uint8_t input_count_{ 0 };
+};
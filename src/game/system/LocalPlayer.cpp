@@ -19,17 +19,16 @@
 #include "../effect/BulletEffect.hpp"
 #include "../../texture/ImageTexture.hpp"
 #include "../../utils/Logger.hpp"
+#include "../../sim/PuyoRules.hpp"
 
 #include <algorithm>
-#include <random>
 
 LocalPlayer::~LocalPlayer()
 {
     Release();
 }
 
-bool LocalPlayer::Initialize(const std::span<const uint8_t>& blockType1, const std::span<const uint8_t>& blockType2,
-    uint8_t playerIdx, uint16_t characterIdx, const std::shared_ptr<GameBackground>& background)
+bool LocalPlayer::Initialize(uint32_t pieceSeed, uint8_t playerIdx, uint16_t characterIdx, const std::shared_ptr<GameBackground>& background)
 {
     Reset();
 
@@ -38,6 +37,7 @@ bool LocalPlayer::Initialize(const std::span<const uint8_t>& blockType1, const s
         player_id_ = playerIdx;
         character_id_ = characterIdx;
         background_ = background;
+        piece_sequence_.Reset(pieceSeed);
 
         InitializeNextBlocks();        
 
@@ -67,19 +67,8 @@ bool LocalPlayer::Initialize(const std::span<const uint8_t>& blockType1, const s
         state_info_.current_phase = GamePhase::Playing;
         state_info_.previous_phase = GamePhase::Playing;
 
-
-        std::array<uint8_t, 2> first_block_types{};
-        std::array<uint8_t, 2> second_block_types{};
-
-        auto& first_blocks = next_blocks_[0]->GetBlocks();
-        first_block_types[0] = static_cast<uint8_t>(first_blocks[0]->GetBlockType());
-        first_block_types[1] = static_cast<uint8_t>(first_blocks[1]->GetBlockType());
-
-        auto& second_blocks = next_blocks_[1]->GetBlocks();
-        second_block_types[0] = static_cast<uint8_t>(second_blocks[0]->GetBlockType());
-        second_block_types[1] = static_cast<uint8_t>(second_blocks[1]->GetBlockType());
-
-        NETWORK.GameInitialize(first_block_types, second_block_types);
+        // 블록 순서는 시드만 보내고 상대가 같은 순서를 생성
+        NETWORK.GameInitialize(piece_sequence_.GetSeed());
 
         return true;
     }
@@ -92,10 +81,10 @@ bool LocalPlayer::Initialize(const std::span<const uint8_t>& blockType1, const s
 
 void LocalPlayer::InitializeNextBlocks()
 {
-    auto nextBlock1 = std::make_shared<GroupBlock>();
-    auto nextBlock2 = std::make_shared<GroupBlock>();
+    auto nextBlock1 = CreateSequenceBlock();
+    auto nextBlock2 = CreateSequenceBlock();
 
-    if (nextBlock1->Create() == false || nextBlock2->Create() == false)
+    if (!nextBlock1 || !nextBlock2)
     {
         throw std::runtime_error("Failed to create next blocks");
     }
@@ -210,7 +199,7 @@ void LocalPlayer::UpdateShatteringPhase(float deltaTime)
 
                     CreateBlockClearEffect(std::shared_ptr<Block>(block, [](Block*) {}));
 
-                    board_blocks_[idx.y][idx.x] = nullptr;
+                    board_blocks_.Set(idx.x, idx.y, nullptr);
 
                     auto it = std::find_if(block_list_.begin(), block_list_.end(),
                         [block](const std::shared_ptr<Block>& ptr)
@@ -233,7 +222,7 @@ void LocalPlayer::UpdateShatteringPhase(float deltaTime)
                     {
                         SDL_Point iceIdx{ iceBlock->GetPosIdx_X(), iceBlock->GetPosIdx_Y() };
                         //LOGGER.Info("===========> iceblock position {} {}", iceIdx.x, iceIdx.y);
-                        board_blocks_[iceIdx.y][iceIdx.x] = nullptr;
+                        board_blocks_.Set(iceIdx.x, iceIdx.y, nullptr);
 
                         block_list_.remove(iceBlock);
                         indexList.push_back(iceIdx);
@@ -322,8 +311,10 @@ void LocalPlayer::CreateNextBlock()
         return;
     }
 
-    auto nextBlock = std::make_shared<GroupBlock>();
-    if (!nextBlock->Create())
+    const uint32_t piece_index = piece_sequence_.GetIndex();
+
+    auto nextBlock = CreateSequenceBlock();
+    if (!nextBlock)
     {
         LOGGER.Error("Failed to create next block");
         return;
@@ -343,18 +334,10 @@ void LocalPlayer::CreateNextBlock()
         game_board_->SetRenderTargetMark(false);
     }
 
+    // 상대는 인덱스로 같은 쌍을 만들어 다음 블록을 진행
     if (NETWORK.IsRunning())
     {
-        if (auto lastBlock = next_blocks_.back().get())
-        {
-            auto blocks = lastBlock->GetBlocks();
-            std::array<uint8_t, 2> blockTypes{
-                static_cast<uint8_t>(blocks[0]->GetBlockType()),
-                static_cast<uint8_t>(blocks[1]->GetBlockType())
-            };
-
-            NETWORK.AddNewBlock(blockTypes);
-        }
+        NETWORK.AddNewBlock(piece_index);
     }
 }
 
@@ -457,7 +440,7 @@ bool LocalPlayer::PushBlockInGame(GameGroupBlock* groupBlock)
 
             int xIdx = currentBlock->GetPosIdx_X();
             int yIdx = currentBlock->GetPosIdx_Y();
-            board_blocks_[yIdx][xIdx] = currentBlock.get();
+            board_blocks_.Set(xIdx, yIdx, currentBlock.get());
 
             UpdateLinkState(currentBlock.get());
         }
@@ -526,11 +509,12 @@ void LocalPlayer::DefenseInterruptBlockCount(int16_t count, float x, float y, ui
 }
 
 
-bool LocalPlayer::Restart(const std::span<const uint8_t>& blockType1, const std::span<const uint8_t>& blockType2)
+bool LocalPlayer::Restart(uint32_t pieceSeed)
 {
     Reset();
 
     try {
+        piece_sequence_.Reset(pieceSeed);
         InitializeNextBlocks();
 
         if (!InitializeGameBoard(Constants::Board::POSITION_X, Constants::Board::POSITION_Y))
@@ -587,28 +571,17 @@ void LocalPlayer::UpdateTargetPosIdx()
             int xIdx = block->GetPosIdx_X();
             BlockType blockType = block->GetBlockType();
 
-            for (int yIdx = 0; yIdx < Constants::Board::BOARD_Y_COUNT; ++yIdx)
-            {
-                if (checkIdxX == xIdx && checkIdxY == yIdx)
-                {
-                    continue;
-                }
-
-                if (yIdx < 0 || yIdx >= Constants::Board::BOARD_Y_COUNT)
-                {
-                    continue;
-                }
+            // 열의 가장 낮은 빈 행 (같은 열에 먼저 표시한 칸은 건너뜀)
+            const int yIdx = board_blocks_.GetLowestEmptyRow(xIdx, checkIdxX == xIdx ? checkIdxY : -1);
 
-                if (board_blocks_[yIdx][xIdx] == nullptr)
-                {
-                    markPositions[i].xPos = (xIdx * Constants::Block::SIZE) + renderPos;
-                    markPositions[i].yPos = ((Constants::Board::BOARD_Y_COUNT - 2 - yIdx) * Constants::Block::SIZE) + renderPos;
-                    markPositions[i].type = static_cast<uint8_t>(blockType);
+            if (yIdx < Constants::Board::BOARD_Y_COUNT)
+            {
+                markPositions[i].xPos = (xIdx * Constants::Block::SIZE) + renderPos;
+                markPositions[i].yPos = ((Constants::Board::BOARD_Y_COUNT - 2 - yIdx) * Constants::Block::SIZE) + renderPos;
+                markPositions[i].type = static_cast<uint8_t>(blockType);
 
-                    checkIdxX = xIdx;
-                    checkIdxY = yIdx;
-                    break;
-                }
+                checkIdxX = xIdx;
+                checkIdxY = yIdx;
             }
 
             currentIndex = (rotateState == RotateState::Default) ? 0 : 1;
@@ -851,21 +824,20 @@ void LocalPlayer::ResetComboState()
 
 void LocalPlayer::CalculateScore()
 {
-    uint8_t linkBonus = 0;
-    uint8_t blockCount = 0;
-    uint8_t typeBonus = GetTypeBonus(matched_blocks_.size());
-    short comboBonus = GetComboConstant(score_info_.combo_count);
+    uint32_t linkBonus = 0;
+    size_t blockCount = 0;
 
     for (const auto& group : matched_blocks_)
     {
         linkBonus += GetLinkBonus(group.size());
-        blockCount += static_cast<uint8_t>(group.size());
+        blockCount += group.size();
     }
 
-    int currentScore = ((blockCount * Constants::Game::Score::BASE_MATCH_SCORE) * (comboBonus + linkBonus + typeBonus + 1));
+    const uint32_t currentScore = PuyoRules::CalculateStepScore(score_info_.combo_count, matched_blocks_.size(), blockCount, linkBonus);
+    const auto conversion = PuyoRules::ConvertScoreToGarbage(currentScore, score_info_.rest_score, GetMargin());
 
-    score_info_.add_interrupt_block_count = (currentScore + score_info_.rest_score) / GetMargin();
-    score_info_.rest_score = (currentScore + score_info_.rest_score) % GetMargin();
+    score_info_.add_interrupt_block_count = conversion.produced;
+    score_info_.rest_score = conversion.rest_score;
     score_info_.total_score += currentScore;
 
     UpdateInterruptBlockState();
@@ -21,8 +21,7 @@ public:
     LocalPlayer() = default;
     ~LocalPlayer() override;
 
-    bool Initialize(const std::span<const uint8_t>& blockType1,
-        const std::span<const uint8_t>& blockType2,
+    bool Initialize(uint32_t pieceSeed,
         uint8_t playerIdx,
         uint16_t characterIdx,
         const std::shared_ptr<GameBackground>& background) override;
@@ -30,7 +29,7 @@ public:
     void Update(float deltaTime) override;
     void Release() override;
     void Reset() override;
-    bool Restart(const std::span<const uint8_t>& blockType1 = {}, const std::span<const uint8_t>& blockType2 = {}) override;
+    bool Restart(uint32_t pieceSeed) override;
     void CreateNextBlock() override;
     void PlayNextBlock() override;
     void MoveBlock(uint8_t moveType, float position) override;
@@ -21,7 +21,6 @@
 #include "../../utils/Logger.hpp"
 
 #include <algorithm>
-#include <random>
 
 RemotePlayer::RemotePlayer() : BasePlayer()
 {
@@ -32,8 +31,7 @@ RemotePlayer::~RemotePlayer()
     Release();
 }
 
-bool RemotePlayer::Initialize(const std::span<const uint8_t>& blockType1, const std::span<const uint8_t>& blockType2,
-    uint8_t playerIdx, uint16_t characterIdx, const std::shared_ptr<GameBackground>& background)
+bool RemotePlayer::Initialize(uint32_t pieceSeed, uint8_t playerIdx, uint16_t characterIdx, const std::shared_ptr<GameBackground>& background)
 {
     Reset();
 
@@ -42,8 +40,9 @@ bool RemotePlayer::Initialize(const std::span<const uint8_t>& blockType1, const
         player_id_ = playerIdx;
         character_id_ = characterIdx;
         background_ = background;
+        piece_sequence_.Reset(pieceSeed);
 
-        InitializeNextBlocks(blockType1, blockType2);
+        InitializeNextBlocks();
 
         if (!InitializeGameBoard(Constants::Board::PLAYER_POSITION_X, Constants::Board::POSITION_Y))
         {
@@ -79,13 +78,12 @@ bool RemotePlayer::Initialize(const std::span<const uint8_t>& blockType1, const
     }
 }
 
-void RemotePlayer::InitializeNextBlocks(const std::span<const uint8_t>& blockType1, const std::span<const uint8_t>& blockType2)
+void RemotePlayer::InitializeNextBlocks()
 {
-    auto next_block1 = std::make_unique<GroupBlock>();
-    auto next_block2 = std::make_unique<GroupBlock>();
+    auto next_block1 = CreateSequenceBlock();
+    auto next_block2 = CreateSequenceBlock();
 
-    if (!next_block1->Create(static_cast<BlockType>(blockType1[0]), static_cast<BlockType>(blockType1[1])) ||
-        !next_block2->Create(static_cast<BlockType>(blockType2[0]), static_cast<BlockType>(blockType2[1])))
+    if (!next_block1 || !next_block2)
     {
         throw std::runtime_error("Failed to create next blocks");
     }
@@ -105,13 +103,14 @@ void RemotePlayer::InitializeNextBlocks(const std::span<const uint8_t>& blockTyp
     }
 }
 
-bool RemotePlayer::Restart(const std::span<const uint8_t>& blockType1, const std::span<const uint8_t>& blockType2)
+bool RemotePlayer::Restart(uint32_t pieceSeed)
 {
     Reset();
 
     try
     {
-        InitializeNextBlocks(blockType1, blockType2);
+        piece_sequence_.Reset(pieceSeed);
+        InitializeNextBlocks();
 
         if (!InitializeGameBoard(Constants::Board::PLAYER_POSITION_X, Constants::Board::POSITION_Y))
         {
@@ -514,11 +513,11 @@ bool RemotePlayer::PushBlockInGame(const std::span<const float>& pos1, const std
         blocks[1]->SetPosIdx(x_idx_1, y_idx_1);
 
         block_list_.push_back(blocks[0]);
-        board_blocks_[y_idx_0][x_idx_0] = blocks[0].get();
+        board_blocks_.Set(x_idx_0, y_idx_0, blocks[0].get());
         UpdateLinkState(blocks[0].get());
 
         block_list_.push_back(blocks[1]);
-        board_blocks_[y_idx_1][x_idx_1] = blocks[1].get();
+        board_blocks_.Set(x_idx_1, y_idx_1, blocks[1].get());
         UpdateLinkState(blocks[1].get());
 
         control_block_->ResetBlock();
@@ -728,7 +727,7 @@ void RemotePlayer::DefenseInterruptBlockCount(int16_t count, float x, float y, u
     }
 }
 
-void RemotePlayer::AddNewBlock(const std::span<const uint8_t, 2>& block_type)
+void RemotePlayer::AddNewBlock(uint32_t piece_index)
 {
     // 최대 큐 크기 제한 상수 추가
     static constexpr size_t MAX_NEXT_BLOCKS = 3;
@@ -740,8 +739,15 @@ void RemotePlayer::AddNewBlock(const std::span<const uint8_t, 2>& block_type)
         next_blocks_.pop_front();
     }
 
-    auto next_block = std::make_shared<GroupBlock>();
-    if (!next_block->Create(static_cast<BlockType>(block_type[0]), static_cast<BlockType>(block_type[1])))
+    // 블록 색은 상대 시드로 직접 계산. 인덱스가 어긋났으면(패킷 유실 등) 상대 인덱스에 맞춤
+    if (piece_index != piece_sequence_.GetIndex())
+    {
+        LOGGER.Info("RemotePlayer::AddNewBlock - Piece index mismatch (local {}, remote {}), resyncing", piece_sequence_.GetIndex(), piece_index);
+        piece_sequence_.Seek(piece_index);
+    }
+
+    auto next_block = CreateSequenceBlock();
+    if (!next_block)
     {
         throw std::runtime_error("Failed to create next block");
     }
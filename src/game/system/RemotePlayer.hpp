@@ -23,15 +23,14 @@ public:
     RemotePlayer();
     ~RemotePlayer() override;
 
-    bool Initialize(const std::span<const uint8_t>& blocktype1,
-        const std::span<const uint8_t>& blocktype2,
+    bool Initialize(uint32_t pieceSeed,
         uint8_t playerIdx,
         uint16_t characterIdx,
         const std::shared_ptr<GameBackground>& background) override;
 
     void Release() override;
     void Reset() override;
-    bool Restart(const std::span<const uint8_t>& blockType1 = {}, const std::span<const uint8_t>& blockType2 = {}) override;
+    bool Restart(uint32_t pieceSeed) override;
     void CreateNextBlock() override;
     void PlayNextBlock() override;
     bool CheckGameBlockState() override;
@@ -43,7 +42,7 @@ public:
     void UpdateFallingBlock(uint8_t fallingIdx, bool falling) override;
     void ChangeBlockState(uint8_t state) override;
     bool PushBlockInGame(const std::span<const float>& pos1, const std::span<const float>& pos2);
-    void AddNewBlock(const std::span<const uint8_t, 2>& block_type);
+    void AddNewBlock(uint32_t piece_index);
     void AttackInterruptBlock(float x, float y, uint8_t type) override;
     void DefenseInterruptBlockCount(int16_t count, float x, float y, uint8_t type) override;
 
@@ -64,7 +63,7 @@ public:
 
 private:
     // ʱȭ ޼
-    void InitializeNextBlocks(const std::span<const uint8_t>& blockType1, const std::span<const uint8_t>& blockType2);
+    void InitializeNextBlocks();
 
     //    ޼
     void CreateFullRowInterruptBlocks(std::shared_ptr<ImageTexture>& texture);
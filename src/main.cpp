@@ -5,16 +5,132 @@
  * 2. <SDL3/SDL_main.h> ԵǾ մϴ.
  * 3. ȯ: SDL_APP_CONTINUE(), SDL_APP_FAILURE()
  * 4. https://github.com/libsdl-org/SDL/blob/main/docs/README-migration.md
+ * 5.   --cpu[=easy|normal|hard]   ÷̾ CPU ÷̾ ü
+ * 6.   --seed=N   õ带  ( / Ź )
+ * 7.   --relay=IP:ڵ  ȣƮ/ԽƮ  ߰ 带   ( ڵ尡   ¦ )
  * 
  */
 #define SDL_MAIN_USE_CALLBACKS 1
 
 #include <SDL3/SDL_main.h>
 #include "./core/GameApp.hpp"
+#include "./network/NetworkController.hpp"
+#include "./sim/PuyoBeamSearch.hpp"
+#include "./utils/Logger.hpp"
+#include "./utils/Random.hpp"
 
+#include <charconv>
+#include <optional>
+#include <string_view>
+
+namespace
+{
+	std::optional<PuyoCpuLevel> ParseCpuLevel(int argc, char* argv[])
+	{
+		for (int i = 1; i < argc; ++i)
+		{
+			const std::string_view arg = argv[i];
+
+			if (arg == "--cpu" || arg == "--cpu=normal")
+			{
+				return PuyoCpuLevel::Normal;
+			}
+
+			if (arg == "--cpu=easy")
+			{
+				return PuyoCpuLevel::Easy;
+			}
+
+			if (arg == "--cpu=hard")
+			{
+				return PuyoCpuLevel::Hard;
+			}
+		}
+
+		return std::nullopt;
+	}
+
+	std::optional<uint64_t> ParseSeed(int argc, char* argv[])
+	{
+		constexpr std::string_view SEED_PREFIX = "--seed=";
+
+		for (int i = 1; i < argc; ++i)
+		{
+			const std::string_view arg = argv[i];
+			if (!arg.starts_with(SEED_PREFIX))
+			{
+				continue;
+			}
+
+			uint64_t seed = 0;
+			const auto value = arg.substr(SEED_PREFIX.size());
+			if (std::from_chars(value.data(), value.data() + value.size(), seed).ec == std::errc{})
+			{
+				return seed;
+			}
+		}
+
+		return std::nullopt;
+	}
+
+	struct RelayOption
+	{
+		std::string_view ip;
+		uint32_t session_code{ 0 };
+	};
+
+	// --relay=IP:ڵ ( ڵ 0 ƴ 10)
+	std::optional<RelayOption> ParseRelay(int argc, char* argv[])
+	{
+		constexpr std::string_view RELAY_PREFIX = "--relay=";
+
+		for (int i = 1; i < argc; ++i)
+		{
+			const std::string_view arg = argv[i];
+			if (!arg.starts_with(RELAY_PREFIX))
+			{
+				continue;
+			}
+
+			const auto value = arg.substr(RELAY_PREFIX.size());
+			const auto separator = value.rfind(':');
+
+			RelayOption option;
+			if (separator != std::string_view::npos && separator > 0)
+			{
+				option.ip = value.substr(0, separator);
+
+				const auto code = value.substr(separator + 1);
+				const auto [ptr, ec] = std::from_chars(code.data(), code.data() + code.size(), option.session_code);
+				if (ec == std::errc{} && ptr == code.data() + code.size() && option.session_code != 0)
+				{
+					return option;
+				}
+			}
+
+			LOGGER.Warning("Invalid relay argument: {} (expected --relay=IP:code), connecting directly", arg);
+			return std::nullopt;
+		}
+
+		return std::nullopt;
+	}
+}
 
 SDL_AppResult SDL_AppInit(void** appState, int argc, char* argv[])
 {
+	GAME_APP.SetCpuLevel(ParseCpuLevel(argc, argv));
+
+	if (const auto seed = ParseSeed(argc, argv))
+	{
+		RandomService::SetSeed(*seed);
+	}
+
+	//  (ȣƮ) (ԽƮ)    ߰ 忡 
+	if (const auto relay = ParseRelay(argc, argv))
+	{
+		NETWORK.SetRelay(relay->ip, relay->session_code);
+	}
+
 	if (!GAME_APP.Initialize()) 
 	{
 		return SDL_APP_FAILURE;
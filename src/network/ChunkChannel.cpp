@@ -0,0 +1,314 @@
+#include "ChunkChannel.hpp"
+#include "packets/GamePackets.hpp"
+#include "packets/PacketSchema.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+static_assert(sizeof(MessageChunkPacket) == Constants::Network::MAX_PACKET_SIZE, "MessageChunkPacket must fill MAX_PACKET_SIZE");
+
+namespace
+{
+    constexpr size_t CHUNK_DATA_SIZE = sizeof(MessageChunkPacket::data);
+
+    // MessageChunkPacket의 헤더 필드 (생성자가 있는 패킷 구조체에 바이트를 덮어쓰지 않고 필드별로 읽음)
+    struct ChunkHeader
+    {
+        uint32_t size{ 0 };
+        uint32_t message_id{ 0 };
+        uint32_t total_size{ 0 };
+        uint32_t offset{ 0 };
+    };
+
+    [[nodiscard]] ChunkHeader LoadHeader(std::span<const char> packet)
+    {
+        constexpr size_t FIELD_OFFSET = sizeof(PacketBase);
+
+        ChunkHeader header;
+        (void)PacketWire::Load(packet.data(), header.size);
+        (void)PacketWire::Load(packet.data() + FIELD_OFFSET, header.message_id);
+        (void)PacketWire::Load(packet.data() + FIELD_OFFSET + sizeof(uint32_t), header.total_size);
+        (void)PacketWire::Load(packet.data() + FIELD_OFFSET + sizeof(uint32_t) * 2, header.offset);
+        return header;
+    }
+
+    [[nodiscard]] bool ReadHeader(std::span<const char> packet, ChunkHeader& header)
+    {
+        if (packet.size() <= MessageChunkPacket::HEADER_SIZE || packet.size() > sizeof(MessageChunkPacket))
+        {
+            return false;
+        }
+
+        header = LoadHeader(packet);
+        return header.size == packet.size();
+    }
+
+    [[nodiscard]] bool IsLastChunk(const ChunkHeader& header, size_t data_size)
+    {
+        return static_cast<uint64_t>(header.offset) + data_size >= header.total_size;
+    }
+}
+
+ChunkBufferPool::ChunkBufferPool(size_t max_pooled) : storage_(std::make_shared<Storage>())
+{
+    storage_->max_pooled = max_pooled;
+    storage_->free_buffers.reserve(max_pooled);
+}
+
+ChunkBufferPool::BufferPtr ChunkBufferPool::Acquire()
+{
+    std::unique_ptr<Buffer> buffer;
+    {
+        std::lock_guard lock(storage_->lock);
+        if (!storage_->free_buffers.empty())
+        {
+            buffer = std::move(storage_->free_buffers.back());
+            storage_->free_buffers.pop_back();
+        }
+    }
+
+    if (!buffer)
+    {
+        buffer = std::make_unique<Buffer>();
+    }
+
+    buffer->clear();
+
+    std::weak_ptr<Storage> weak_storage = storage_;
+    return BufferPtr(buffer.release(), [weak_storage](Buffer* released)
+        {
+            if (auto storage = weak_storage.lock())
+            {
+                std::lock_guard lock(storage->lock);
+                if (storage->free_buffers.size() < storage->max_pooled)
+                {
+                    storage->free_buffers.emplace_back(released);
+                    return;
+                }
+            }
+
+            delete released;
+        });
+}
+
+size_t ChunkBufferPool::GetPooledCount() const
+{
+    std::lock_guard lock(storage_->lock);
+    return storage_->free_buffers.size();
+}
+
+bool ChunkSender::NeedsChunking(std::span<const char> packet)
+{
+    if (packet.size() <= static_cast<size_t>(Constants::Network::MAX_PACKET_SIZE))
+    {
+        return false;
+    }
+
+    PacketBase header{};
+    std::memcpy(&header, packet.data(), sizeof(PacketBase));
+    return header.size == packet.size();
+}
+
+bool ChunkSender::Queue(std::span<const char> packet)
+{
+    if (!NeedsChunking(packet) ||
+        packet.size() > Constants::Network::MAX_CHUNKED_MESSAGE_SIZE ||
+        outgoing_.size() >= Constants::Network::CHUNK_MAX_QUEUED)
+    {
+        return false;
+    }
+
+    Outgoing message;
+    message.message_id = next_message_id_++;
+    message.data.assign(packet.begin(), packet.end());
+
+    outgoing_.push_back(std::move(message));
+    return true;
+}
+
+size_t ChunkSender::Pump(size_t max_chunks, std::vector<char>& out)
+{
+    size_t chunk_count = 0;
+
+    while (chunk_count < max_chunks && !outgoing_.empty())
+    {
+        Outgoing message = std::move(outgoing_.front());
+        outgoing_.pop_front();
+
+        const size_t data_size = (std::min)(CHUNK_DATA_SIZE, message.data.size() - message.offset);
+
+        MessageChunkPacket chunk;
+        chunk.size = static_cast<uint32_t>(MessageChunkPacket::HEADER_SIZE + data_size);
+        chunk.message_id = message.message_id;
+        chunk.total_size = static_cast<uint32_t>(message.data.size());
+        chunk.offset = static_cast<uint32_t>(message.offset);
+        std::memcpy(chunk.data.data(), message.data.data() + message.offset, data_size);
+
+        const char* bytes = reinterpret_cast<const char*>(&chunk);
+        out.insert(out.end(), bytes, bytes + chunk.size);
+
+        message.offset += data_size;
+        ++chunk_count;
+
+        // 남은 조각이 있으면 뒤로 보내 다른 메시지와 번갈아 전송
+        if (message.offset < message.data.size())
+        {
+            outgoing_.push_back(std::move(message));
+        }
+    }
+
+    return chunk_count;
+}
+
+ChunkAssembler::Result ChunkAssembler::OnChunk(std::span<const char> packet, ChunkBufferPool& pool, ChunkBufferPtr& completed, Clock::time_point now)
+{
+    Expire(now);
+
+    ChunkHeader header;
+    if (!ReadHeader(packet, header))
+    {
+        return Result::Invalid;
+    }
+
+    const uint32_t message_id = header.message_id;
+    const uint32_t data_size = header.size - static_cast<uint32_t>(MessageChunkPacket::HEADER_SIZE);
+
+    auto it = std::find_if(incoming_.begin(), incoming_.end(),
+        [message_id](const Incoming& incoming) { return incoming.message_id == message_id; });
+
+    if (it == incoming_.end())
+    {
+        // 폐기한 메시지의 나머지 조각은 마지막 조각까지 무시
+        if (auto discarded = std::find(discarded_.begin(), discarded_.end(), message_id); discarded != discarded_.end())
+        {
+            if (IsLastChunk(header, data_size))
+            {
+                discarded_.erase(discarded);
+            }
+
+            return Result::Pending;
+        }
+
+        // 새 메시지는 첫 조각부터 시작해야 하고 조각 전송이 필요한 크기여야 함
+        if (header.offset != 0 ||
+            header.total_size <= static_cast<uint32_t>(Constants::Network::MAX_PACKET_SIZE) ||
+            header.total_size > Constants::Network::MAX_CHUNKED_MESSAGE_SIZE ||
+            incoming_.size() >= Constants::Network::CHUNK_MAX_STREAMS)
+        {
+            return Result::Invalid;
+        }
+
+        // 버퍼는 조각이 도착하는 만큼만 키움 (첫 조각만 보내고 멈추는 접속이 전체 크기를 점유하지 못하도록)
+        Incoming incoming;
+        incoming.message_id = message_id;
+        incoming.total_size = header.total_size;
+        incoming.buffer = pool.Acquire();
+        incoming_.push_back(std::move(incoming));
+        it = incoming_.end() - 1;
+    }
+
+    if (header.total_size != it->total_size ||
+        header.offset != it->buffer->size() ||
+        data_size > header.total_size - header.offset ||
+        pending_bytes_ + data_size > Constants::Network::CHUNK_MAX_PENDING_BYTES)
+    {
+        Remove(it);
+        if (!IsLastChunk(header, data_size))
+        {
+            MarkDiscarded(message_id);
+        }
+        return Result::Invalid;
+    }
+
+    const char* data = packet.data() + MessageChunkPacket::HEADER_SIZE;
+    it->buffer->insert(it->buffer->end(), data, data + data_size);
+    it->last_chunk_time = now;
+    pending_bytes_ += data_size;
+
+    if (it->buffer->size() < it->total_size)
+    {
+        return Result::Pending;
+    }
+
+    pending_bytes_ -= it->buffer->size();
+    ChunkBufferPtr buffer = std::move(it->buffer);
+    incoming_.erase(it);
+
+    // 재조립 결과가 자기 크기를 정확히 가진, 조각이 아닌 유효한 패킷인지 확인
+    PacketBase inner{};
+    std::memcpy(&inner, buffer->data(), sizeof(PacketBase));
+
+    const auto inner_type = static_cast<PacketType>(inner.type);
+    if (inner.size != buffer->size() || !IsValidPacketType(inner_type) || IsChunkPacket(inner_type))
+    {
+        return Result::Invalid;
+    }
+
+    completed = std::move(buffer);
+    return Result::Complete;
+}
+
+void ChunkAssembler::Discard(std::span<const char> packet)
+{
+    if (packet.size() < MessageChunkPacket::HEADER_SIZE)
+    {
+        return;
+    }
+
+    const ChunkHeader header = LoadHeader(packet);
+    const uint32_t message_id = header.message_id;
+
+    auto it = std::find_if(incoming_.begin(), incoming_.end(),
+        [message_id](const Incoming& incoming) { return incoming.message_id == message_id; });
+
+    const bool erased = it != incoming_.end();
+    if (erased)
+    {
+        Remove(it);
+    }
+
+    // 첫 조각을 버린 경우도 이후 조각을 무시할 수 있도록 기록
+    if ((erased || header.offset == 0) && !IsLastChunk(header, packet.size() - MessageChunkPacket::HEADER_SIZE))
+    {
+        MarkDiscarded(message_id);
+    }
+}
+
+size_t ChunkAssembler::Expire(Clock::time_point now)
+{
+    size_t expired = 0;
+
+    for (auto it = incoming_.begin(); it != incoming_.end();)
+    {
+        if (now - it->last_chunk_time < std::chrono::milliseconds(Constants::Network::CHUNK_REASSEMBLY_TIMEOUT))
+        {
+            ++it;
+            continue;
+        }
+
+        // 늦게 도착하는 나머지 조각은 잘못된 조각으로 처리하지 않고 무시
+        MarkDiscarded(it->message_id);
+        pending_bytes_ -= it->buffer ? it->buffer->size() : 0;
+        it = incoming_.erase(it);
+        ++expired;
+    }
+
+    return expired;
+}
+
+void ChunkAssembler::Remove(std::vector<Incoming>::iterator it)
+{
+    pending_bytes_ -= it->buffer ? it->buffer->size() : 0;
+    incoming_.erase(it);
+}
+
+void ChunkAssembler::MarkDiscarded(uint32_t message_id)
+{
+    // 오래된 기록부터 제거
+    if (discarded_.size() >= Constants::Network::CHUNK_MAX_STREAMS)
+    {
+        discarded_.erase(discarded_.begin());
+    }
+
+    discarded_.push_back(message_id);
+}
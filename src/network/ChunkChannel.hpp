@@ -0,0 +1,129 @@
+#pragma once
+/*
+ *
+ * 설명: MAX_PACKET_SIZE를 넘는 패킷의 조각 전송/재조립
+ *  1. 송신: 완전한 패킷 하나를 MessageChunkPacket 조각으로 나누고, 송신 한 번에 작은 패킷 뒤에 최대 CHUNK_SEND_BUDGET개만 붙임.
+ *     대기 메시지가 여럿이면 조각 단위로 돌아가며 전송해 큰 메시지 하나가 다른 메시지를 막지 않도록 함.
+ *  2. 수신: 메시지 id별로 풀에서 받은 버퍼에 조각을 이어 붙이고, 완성되면 원본 패킷 그대로 전달.
+ *     버퍼는 받은 만큼만 커지고, 접속당 재조립 중인 바이트는 CHUNK_MAX_PENDING_BYTES로 제한.
+ *     CHUNK_REASSEMBLY_TIMEOUT 동안 다음 조각이 오지 않은 메시지는 폐기.
+ *  3. TCP 위에서 동작하므로 같은 메시지의 조각은 순서대로 도착한다고 가정 (순서가 어긋나면 잘못된 조각).
+ *  4. 동기화는 사용하는 쪽 책임 (버퍼 풀만 스레드 안전).
+ *
+ */
+
+#include "../core/common/constants/NetworkConstants.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <vector>
+
+// 재조립 버퍼 풀 (반환된 버퍼의 용량을 그대로 재사용)
+class ChunkBufferPool
+{
+public:
+    using Buffer = std::vector<char>;
+    using BufferPtr = std::shared_ptr<Buffer>;
+
+    explicit ChunkBufferPool(size_t max_pooled = Constants::Network::CHUNK_POOL_SIZE);
+
+    ChunkBufferPool(const ChunkBufferPool&) = delete;
+    ChunkBufferPool& operator=(const ChunkBufferPool&) = delete;
+
+    // 빈 버퍼 (반환된 버퍼의 용량은 유지). 마지막 참조가 사라지면 풀로 돌아감 (풀이 먼저 사라졌으면 삭제)
+    [[nodiscard]] BufferPtr Acquire();
+    [[nodiscard]] size_t GetPooledCount() const;
+
+private:
+    struct Storage
+    {
+        std::mutex lock;
+        std::vector<std::unique_ptr<Buffer>> free_buffers;
+        size_t max_pooled{ 0 };
+    };
+
+    std::shared_ptr<Storage> storage_;
+};
+
+using ChunkBufferPtr = ChunkBufferPool::BufferPtr;
+
+class ChunkSender
+{
+public:
+    // 헤더 크기가 데이터 전체와 일치하는 MAX_PACKET_SIZE 초과 패킷인지 (여러 패킷을 이어 붙인 데이터는 제외)
+    [[nodiscard]] static bool NeedsChunking(std::span<const char> packet);
+
+    // 전송 대기열에 추가 (크기 초과, 대기열 초과 시 false)
+    [[nodiscard]] bool Queue(std::span<const char> packet);
+
+    // 대기 메시지를 돌아가며 최대 max_chunks개의 조각 패킷을 out 뒤에 이어 붙임. 추가한 조각 수 반환
+    size_t Pump(size_t max_chunks, std::vector<char>& out);
+
+    void Clear() { outgoing_.clear(); }
+
+    [[nodiscard]] bool IsEmpty() const { return outgoing_.empty(); }
+    [[nodiscard]] size_t GetQueuedCount() const { return outgoing_.size(); }
+
+private:
+    struct Outgoing
+    {
+        uint32_t message_id{ 0 };
+        std::vector<char> data;
+        size_t offset{ 0 };
+    };
+
+    std::deque<Outgoing> outgoing_;
+    uint32_t next_message_id_{ 1 };
+};
+
+class ChunkAssembler
+{
+public:
+    enum class Result : uint8_t
+    {
+        Pending,        // 조각 수신, 아직 미완성
+        Complete,       // completed에 원본 패킷이 채워짐
+        Invalid         // 잘못된 조각 (해당 메시지는 폐기)
+    };
+
+    using Clock = std::chrono::steady_clock;
+
+    [[nodiscard]] Result OnChunk(std::span<const char> packet, ChunkBufferPool& pool, ChunkBufferPtr& completed, Clock::time_point now = Clock::now());
+
+    // 속도 제한 등으로 조각 하나를 버렸을 때 해당 메시지 전체를 폐기
+    void Discard(std::span<const char> packet);
+
+    // 마지막 조각 이후 CHUNK_REASSEMBLY_TIMEOUT이 지난 메시지 폐기. 폐기한 메시지 수 반환
+    size_t Expire(Clock::time_point now);
+
+    void Reset()
+    {
+        incoming_.clear();
+        discarded_.clear();
+        pending_bytes_ = 0;
+    }
+
+    [[nodiscard]] size_t GetPendingCount() const { return incoming_.size(); }
+    [[nodiscard]] size_t GetPendingBytes() const { return pending_bytes_; }
+
+private:
+    struct Incoming
+    {
+        uint32_t message_id{ 0 };
+        uint32_t total_size{ 0 };
+        ChunkBufferPtr buffer;          // 받은 조각까지만 채워짐 (size == 받은 바이트 수)
+        Clock::time_point last_chunk_time{};
+    };
+
+    void Remove(std::vector<Incoming>::iterator it);
+    void MarkDiscarded(uint32_t message_id);
+
+    // CHUNK_MAX_STREAMS 이하이므로 선형 검색
+    std::vector<Incoming> incoming_;
+    std::vector<uint32_t> discarded_;
+    size_t pending_bytes_{ 0 };
+};
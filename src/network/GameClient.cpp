@@ -19,6 +19,8 @@ bool GameClient::Start(HWND hwnd)
         SDL_LOG_ERROR(SDL_LOG_CATEGORY_APPLICATION, "NetClient Start failed");
         return false;
     }
+
+    SetSendCork(Constants::Network::SEND_CORK_ENABLED);
     return true;
 }
 
@@ -73,33 +75,24 @@ void GameClient::DecideCharacter(uint8_t x, uint8_t y)
     SendPacketInternal(packet);
 }
 
-void GameClient::AddNewBlock(std::span<const uint8_t> block)
+void GameClient::AddNewBlock(uint32_t piece_index)
 {
     AddNewBlockPacket packet;
 
     packet.player_id = GAME_APP.GetPlayerManager().GetMyPlayer()->GetId();
-    std::copy_n(block.begin(), std::min<size_t>(block.size(), 2), packet.block_type.begin());
+    packet.piece_index = piece_index;
 
     SendPacketInternal(packet);
 }
 
-void GameClient::GameInitialize(std::span<const uint8_t> block1, std::span<const uint8_t> block2) 
+void GameClient::GameInitialize(uint32_t piece_seed) 
 {
     if (const auto& myPlayer = GAME_APP.GetPlayerManager().GetMyPlayer(); myPlayer != nullptr)
     {
         InitializePlayerPacket packet;
         packet.player_id = myPlayer->GetId();
         packet.character_idx = myPlayer->GetCharacterId();
-
-        if (block1.size() >= 2) 
-        {
-            std::copy_n(block1.data(), 2, packet.block_type1.begin());
-        }
-
-        if (block2.size() >= 2) 
-        {
-            std::copy_n(block2.data(), 2, packet.block_type2.begin());
-        }
+        packet.piece_seed = piece_seed;
 
         SendPacketInternal(packet);
     }
@@ -255,20 +248,11 @@ void GameClient::LoseGame()
     SendPacketInternal(packet);
 }
 
-void GameClient::ReStartGame(std::span<const uint8_t> block1, std::span<const uint8_t> block2) {
+void GameClient::ReStartGame(uint32_t piece_seed) {
 
     RestartGamePacket packet;
     packet.player_id = GAME_APP.GetPlayerManager().GetMyPlayer()->GetId();
-
-    if (block1.size() >= 2) 
-    {
-        std::copy_n(block1.data(), 2, packet.block1.begin());
-    }
-
-    if (block2.size() >= 2) 
-    {
-        std::copy_n(block2.data(), 2, packet.block2.begin());
-    }
+    packet.piece_seed = piece_seed;
 
     SendPacketInternal(packet);
 }
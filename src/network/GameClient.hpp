@@ -9,6 +9,7 @@
 #include "CriticalSection.hpp"
 #include "../network/packets/PacketBase.hpp"
 #include "../network/packets/GamePackets.hpp"
+#include "../network/packets/GamePacketSchemas.hpp"
 
 #include <concepts>
 
@@ -31,8 +32,8 @@ public:
     void ChatMessage(std::string_view msg);
     void ChangeCharSelect(uint8_t x, uint8_t y);
     void DecideCharacter(uint8_t x, uint8_t y);
-    void GameInitialize(std::span<const uint8_t> block1, std::span<const uint8_t> block2);
-    void AddNewBlock(std::span<const uint8_t> block);
+    void GameInitialize(uint32_t piece_seed);
+    void AddNewBlock(uint32_t piece_index);
     void MoveBlock(uint8_t moveType, float position);
     void RotateBlock(uint8_t rotateType, bool isHorizontalMoving);
     void CheckBlockState();
@@ -49,7 +50,7 @@ public:
     void AddInterruptBlock(uint8_t yRowCnt, uint8_t xCnt, std::span<const uint8_t> xIdx);
     void StopComboAttack();
     void LoseGame();
-    void ReStartGame(std::span<const uint8_t> block1, std::span<const uint8_t> block2);
+    void ReStartGame(uint32_t piece_seed);
 
 protected:
     void ProcessPacket(std::span<const char> packet) override;
@@ -59,7 +60,7 @@ private:
     template<std::derived_from<PacketBase> T>
     void SendPacketInternal(const T& packet)
     {
-        auto packetBytes = packet.ToBytes();
+        const auto packetBytes = ToWireBytes(packet);
         SendData(std::span<const char>(packetBytes.data(), packetBytes.size()));
     }
 
@@ -8,7 +8,6 @@
 #include "../utils/Logger.hpp"
 
 #include "./packets/PacketType.hpp"
-#include "./packets/processors/IPacketProcessor.hpp"
 #include "./packets/processors/LobbyPacketProcessors.hpp"
 #include "./packets/processors/CharacterSelectPacketProcessors.hpp"
 #include "./packets/processors/BlockPacketProcessors.hpp"
@@ -16,13 +15,12 @@
 #include "./packets/processors/GameInitPacketProcessors.hpp"
 
 #include <format>
-#include <unordered_map>
+#include <variant>
 
 
 
 GameServer::GameServer()
 {
-    InitializePacketProcessors();
 }
 
 
@@ -30,45 +28,6 @@ GameServer::~GameServer()
 {
 }
 
-
-void GameServer::InitializePacketProcessors()
-{
-    // κ  μ
-    packet_processors_.emplace(PacketType::ConnectLobby,std::make_unique<ConnectLobbyProcessor>());
-    packet_processors_.emplace(PacketType::ChatMessage,std::make_unique<ChatMessageProcessor>());
-
-    // ĳ   μ
-    packet_processors_.emplace(PacketType::ChangeCharSelect, std::make_unique<ChangeCharSelectProcessor>());
-    packet_processors_.emplace(PacketType::DecideCharSelect, std::make_unique<DecideCharacterProcessor>());
-
-    //    μ
-    packet_processors_.emplace(PacketType::AddNewBlock, std::make_unique<AddNewBlockProcessor>());
-    packet_processors_.emplace(PacketType::UpdateBlockFalling, std::make_unique<BlockFallingProcessor>());
-    packet_processors_.emplace(PacketType::ChangeBlockState, std::make_unique<ChangeBlockStateProcessor>());
-    packet_processors_.emplace(PacketType::PushBlockInGame, std::make_unique<PushBlockProcessor>());
-    packet_processors_.emplace(PacketType::CheckBlockState, std::make_unique<CheckBlockStateProcessor>());
-    packet_processors_.emplace(PacketType::UpdateBlockRotate, std::make_unique<BlockRotateProcessor>());
-    packet_processors_.emplace(PacketType::UpdateBlockMove, std::make_unique<BlockMoveProcessor>());
-    packet_processors_.emplace(PacketType::SyncBlockPositionY, std::make_unique<SyncPositionYProcessor>());
-
-    //   μ
-    packet_processors_.emplace(PacketType::AttackInterruptBlock, std::make_unique<AttackInterruptProcessor>());
-    packet_processors_.emplace(PacketType::DefenseInterruptBlock, std::make_unique<DefenseInterruptProcessor>());
-    packet_processors_.emplace(PacketType::AddInterruptBlock, std::make_unique<AddInterruptBlockProcessor>());
-    packet_processors_.emplace(PacketType::StopComboAttack, std::make_unique<StopComboProcessor>());
-    packet_processors_.emplace(PacketType::LoseGame, std::make_unique<LoseGameProcessor>());
-
-    //  ʱȭ  μ
-    packet_processors_.emplace(PacketType::InitializePlayer, std::make_unique<InitializePlayerProcessor>());
-    packet_processors_.emplace(PacketType::RestartGame, std::make_unique<RestartGameProcessor>());
-
-    //  μ ʱȭ
-    for (auto& [_, processor] : packet_processors_) 
-    {
-        processor->Initialize();
-    }
-}
-
 void GameServer::Update()
 {
     ProcessEvent event;
@@ -81,72 +40,89 @@ void GameServer::Update()
             break;
 
         case ProcessEvent::Type::Packet:
-            if (!event.packet_data.empty()) {
-                ProcessPacket(event);
-            }
+            ProcessPacket(event);
             break;
         }
     }
 }
 
-void GameServer::ProcessPacket(const ProcessEvent& event)
+void GameServer::FlushTick()
 {
-    if (event.packet_data.empty() || event.packet_data.size() < sizeof(PacketBase))
-    {
-        LOGGER.Warning("Invalid packet data");
-        return;
-    }
+    //  ƽ   ۽ ͸ Ŭ̾Ʈ   
+    FlushSend();
+    LogSendStats();
+}
 
-    // Ŷ ⺻  б
-    const PacketBase* basePacket = reinterpret_cast<const PacketBase*>(event.packet_data.data());
-    PacketType packetType = static_cast<PacketType>(basePacket->type);
+void GameServer::LogSendStats()
+{
+    const auto now = std::chrono::steady_clock::now();
+    const auto elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(now - last_stats_time_).count();
 
-    // Ŷ Ÿ 
-    if (!IsValidPacketType(packetType))
+    if (elapsed_ms < Constants::Network::SEND_STATS_INTERVAL)
     {
-        LOGGER.Warning("Invalid packet type: {}", static_cast<int>(packetType));
         return;
     }
 
-    // Ŷ ũ 
-    if (event.packet_data.size() != basePacket->size)
+    const SendStats stats = GetSendStats();
+    const double seconds = static_cast<double>(elapsed_ms) / 1000.0;
+    const uint64_t messages = stats.message_count - last_send_stats_.message_count;
+    const uint64_t sends = stats.send_call_count - last_send_stats_.send_call_count;
+    const uint64_t delay_us = stats.total_delay_us - last_send_stats_.total_delay_us;
+
+    if (messages > 0)
     {
-        LOGGER.Warning("Invalid packet size. Expected: {}, Actual: {}",
-            basePacket->size, event.packet_data.size());
-        return;
+        LOGGER.Debug("Send stats (cork: {}) msg/s: {:.1f}, send/s: {:.1f}, avg delay: {}us, max delay: {}us",
+            IsSendCorked(), messages / seconds, sends / seconds, delay_us / messages, stats.max_delay_us);
     }
 
-    // μ ã
-    auto it = packet_processors_.find(packetType);
-    if (it == packet_processors_.end())
+    last_send_stats_ = stats;
+    last_stats_time_ = now;
+}
+
+void GameServer::ProcessPacket(const ProcessEvent& event)
+{
+    // /ũ/ ˻ FilterPacket Ƿ ڵ Ÿ ٷ б
+    // (variant 湮 SchemaPackets   ġ ̺)
+    std::visit([&event](const auto& packet)
     {
-        LOGGER.Warning("No processor found for packet type: {}", static_cast<int>(packetType));
-        return;
-    }
+        using Packet = std::decay_t<decltype(packet)>;
 
-    // Ŷ ó
-    it->second->Process(*basePacket, event.client_info);
+        if constexpr (requires { ServerPacket::Process(packet, event.client_info); })
+        {
+            ServerPacket::Process(packet, event.client_info);
+        }
+        else if constexpr (HasPacketSchema<Packet>)
+        {
+            LOGGER.Warning("No processor found for packet type: {}", static_cast<int>(PacketSchema<Packet>::TYPE));
+        }
+        else
+        {
+            LOGGER.Warning("No processor found for packet without schema");
+        }
+    }, event.packet);
 }
 
 bool GameServer::StartServer() 
 {
     //  ÷̾  (ID: 1)
-    unique_player_id_ = 1;
+    ResetSessions();
 
     auto& playerManager = GAME_APP.GetPlayerManager();
-    auto player = playerManager.CreatePlayer(GenerateUniqueId(), nullptr);
+    auto player = playerManager.CreatePlayer(AllocatePlayerId(), nullptr);
     if (!player) 
     {
         return false;
     }
 
     playerManager.SetMyPlayer(player);
+
+    SetSendCork(Constants::Network::SEND_CORK_ENABLED);
     return NetServer::StartServer();
 }
 
 bool GameServer::ExitServer() 
 {
-    unique_player_id_ = 1;
+    ResetSessions();
 
     GAME_APP.GetPlayerManager().Release();
     return NetServer::ExitServer();
@@ -156,7 +132,32 @@ bool GameServer::ConnectProcess(ClientInfo* client)
 {
     // ο Ŭ̾Ʈ ӽ ID ο
     GiveIdPacket packet;
-    packet.player_id = GenerateUniqueId();
+    {
+        CriticalSection::Lock lock(session_lock_);
+
+        packet.player_id = AllocatePlayerId();
+        if (packet.player_id == 0)
+        {
+            LOGGER.Warning("No player id available");
+        }
+        else
+        {
+            client->session_id = sessions_.Insert(packet.player_id);
+            if (client->session_id == INVALID_SLOT_ID)
+            {
+                LOGGER.Warning("No session slot available");
+                assigned_player_ids_.reset(packet.player_id);
+                packet.player_id = 0;
+            }
+        }
+    }
+
+    // Ҵ翡 ϸ ̹  id  ̹Ƿ Ӹ 
+    if (packet.player_id == 0)
+    {
+        CloseSocket(client);
+        return false;
+    }
 
     auto packetBytes = packet.ToBytes();
     auto packet_data = std::span<const char>{ packetBytes.data(), packetBytes.size() };
@@ -167,7 +168,8 @@ bool GameServer::ConnectProcess(ClientInfo* client)
 
 bool GameServer::DisconnectProcess(ClientInfo* client) 
 {
-    if (!client) 
+    // ۽/ Ϸ а ĵ ÷̾ ſ ̺Ʈ  
+    if (!ClaimClose(client)) 
     {
         return false;
     }
@@ -176,12 +178,55 @@ bool GameServer::DisconnectProcess(ClientInfo* client)
 
 
     uint8_t player_id = GAME_APP.GetPlayerManager().RemovePlayerInRoom(client);
+    ReleaseSession(client);
 
     msg_queue_.push(ProcessEvent(player_id));
 
     return true;
 }
 
+uint8_t GameServer::AllocatePlayerId()
+{
+    CriticalSection::Lock lock(session_lock_);
+
+    //   id  ȯϸ ã ( ݳ id    ڿ ٽ )
+    const size_t id_count = assigned_player_ids_.size() - 1;
+    for (size_t step = 0; step < id_count; ++step)
+    {
+        const size_t id = (next_player_id_ - 1 + step) % id_count + 1;
+        if (assigned_player_ids_.test(id) == false)
+        {
+            assigned_player_ids_.set(id);
+            next_player_id_ = static_cast<uint8_t>(id % id_count + 1);
+            return static_cast<uint8_t>(id);
+        }
+    }
+
+    return 0;
+}
+
+void GameServer::ReleaseSession(ClientInfo* client)
+{
+    CriticalSection::Lock lock(session_lock_);
+
+    if (const uint8_t* player_id = sessions_.Find(client->session_id))
+    {
+        assigned_player_ids_.reset(*player_id);
+        sessions_.Erase(client->session_id);
+    }
+
+    client->session_id = INVALID_SLOT_ID;
+}
+
+void GameServer::ResetSessions()
+{
+    CriticalSection::Lock lock(session_lock_);
+
+    sessions_.Clear();
+    assigned_player_ids_.reset();
+    next_player_id_ = 1;
+}
+
 void GameServer::ProcessDisconnectEvent(uint8_t player_id) 
 {
     if (player_id == 0) 
@@ -224,13 +269,9 @@ void GameServer::ProcessDisconnectEvent(uint8_t player_id)
     }
 }
 
-bool GameServer::PacketProcess(ClientInfo* client, std::span<const char> packet_data) 
+bool GameServer::PacketProcess(ClientInfo* client, std::span<const char> packet, const DecodedPacket& decoded) 
 {
-    ProcessEvent event;
-    event.packet_data = packet_data;
-    event.client_info = client;
-
-    msg_queue_.push(event);
+    msg_queue_.push(ProcessEvent(decoded, client));
 
     return true;
 }
@@ -295,7 +336,7 @@ void GameServer::StartGame()
     BroadcastPacket(packet);
 }
 
-void GameServer::ReStartGame(std::span<const uint8_t> block1, std::span<const uint8_t> block2, uint8_t map_idx)
+void GameServer::ReStartGame(uint32_t piece_seed, uint8_t map_idx)
 {
     CriticalSection::Lock lock(critical_section_);
 
@@ -309,14 +350,12 @@ void GameServer::ReStartGame(std::span<const uint8_t> block1, std::span<const ui
     RestartGamePacket packet;
     packet.player_id = myPlayer->GetId();
     packet.map_id = map_idx;
-
-    std::copy_n(block1.begin(), packet.block1.size(), packet.block1.begin());
-    std::copy_n(block2.begin(), packet.block2.size(), packet.block2.begin());
+    packet.piece_seed = piece_seed;
 
     BroadcastPacket(packet);
 }
 
-void GameServer::GameInitialize(std::span<const uint8_t> block1, std::span<const uint8_t> block2, uint8_t map_idx)
+void GameServer::GameInitialize(uint32_t piece_seed, uint8_t map_idx)
 {
     CriticalSection::Lock lock(critical_section_);
 
@@ -331,9 +370,7 @@ void GameServer::GameInitialize(std::span<const uint8_t> block1, std::span<const
     packet.player_id = myPlayer->GetId();
     packet.character_id = myPlayer->GetCharacterId();
     packet.map_id = map_idx;
-
-    std::copy_n(block1.begin(), packet.block1.size(), packet.block1.begin());
-    std::copy_n(block2.begin(), packet.block2.size(), packet.block2.begin());
+    packet.piece_seed = piece_seed;
 
     BroadcastPacket(packet);
 }
@@ -356,7 +393,7 @@ void GameServer::LoseGame()
 
 
 //   
-void GameServer::AddNewBlock(std::span<const uint8_t> block)
+void GameServer::AddNewBlock(uint32_t piece_index)
 {
     CriticalSection::Lock lock(critical_section_);
 
@@ -368,9 +405,7 @@ void GameServer::AddNewBlock(std::span<const uint8_t> block)
 
     AddNewBlockPacket packet;
     packet.player_id = myPlayer->GetId();
-
-    std::copy_n(block.begin(), packet.block_type.size(), packet.block_type.begin());
-        
+    packet.piece_index = piece_index;
 
     BroadcastPacket(packet);
 }
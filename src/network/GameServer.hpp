@@ -8,13 +8,15 @@
 #include "./NetServer.hpp"
 #include "./CriticalSection.hpp"
 #include "./packets/GamePackets.hpp"
-#include "./packets/processors/IPacketProcessor.hpp"
+#include "./packets/GamePacketSchemas.hpp"
 #include "./packets/PacketType.hpp"
 #include "../core/GameApp.hpp"
 #include "../core/manager/PlayerManager.hpp"
 #include "../network/player/Player.hpp"
 #include "../utils/Logger.hpp"
+#include "../utils/SlotMap.hpp"
 
+#include <bitset>
 #include <queue>
 #include <memory>
 #include <unordered_map>
@@ -32,15 +34,15 @@ struct ProcessEvent
     };
 
     Type event_type{ Type::Packet };
-    std::span<const char> packet_data;
+    DecodedPacket packet;           //  ۴ ǹǷ ڵ  
     ClientInfo* client_info{ nullptr };
     uint8_t player_id{ 0 };
 
     ProcessEvent() = default;
 
     // Ŷ ̺Ʈ 
-    ProcessEvent(std::span<const char> data, ClientInfo* client)
-        : event_type(Type::Packet), packet_data(data), client_info(client) {
+    ProcessEvent(const DecodedPacket& decoded, ClientInfo* client)
+        : event_type(Type::Packet), packet(decoded), client_info(client) {
     }
 
     //   ̺Ʈ 
@@ -55,13 +57,11 @@ public:
     GameServer();
     ~GameServer() override;
 
-    using PacketProcessorPtr = std::unique_ptr<IPacketProcessor>;
-    using PacketProcessorMap = std::unordered_map<PacketType, std::unique_ptr<IPacketProcessor>>;
-
     //  
     bool StartServer();
     bool ExitServer();
     void Update();
+    void FlushTick();
 
     // Ŷ   Լ
     template<typename PacketType> requires std::derived_from<PacketType, PacketBase>
@@ -70,8 +70,8 @@ public:
 
     //  /ʱȭ 
     void StartGame();
-    void GameInitialize(std::span<const uint8_t> block1, std::span<const uint8_t> block2, uint8_t map_idx);
-    void ReStartGame(std::span<const uint8_t> block1, std::span<const uint8_t> block2, uint8_t map_idx);
+    void GameInitialize(uint32_t piece_seed, uint8_t map_idx);
+    void ReStartGame(uint32_t piece_seed, uint8_t map_idx);
     void LoseGame();
 
     // ĳ  
@@ -81,7 +81,7 @@ public:
 
 
     //   
-    void AddNewBlock(std::span<const uint8_t> block);
+    void AddNewBlock(uint32_t piece_index);
     void MoveBlock(uint8_t moveType, float position);
     void RotateBlock(uint8_t rotateType, bool bHorizontalMoving);
     void CheckBlockState();
@@ -102,35 +102,45 @@ protected:
     // NetServer ̽ 
     bool ConnectProcess(ClientInfo* client) override;
     bool DisconnectProcess(ClientInfo* client) override;        
-    bool PacketProcess(ClientInfo* client, std::span<const char> packet) override;
+    bool PacketProcess(ClientInfo* client, std::span<const char> packet, const DecodedPacket& decoded) override;
 
         
 private:
 
     void ProcessPacket(const ProcessEvent& event);
-    void InitializePacketProcessors();        
     void ProcessDisconnectEvent(uint8_t player_id);
-    uint8_t GenerateUniqueId() { return unique_player_id_++; }
+    void LogSendStats();
+
+    //    (/Ŀ/ 忡 )
+    [[nodiscard]] uint8_t AllocatePlayerId();
+    void ReleaseSession(ClientInfo* client);
+    void ResetSessions();
 
     CriticalSection critical_section_{};
-    uint8_t unique_player_id_{ 1 };  // 0  ڽ
+
+    //  id -> Ŷ ϴ player_id. player_id   ȣ  ȯϸ  ȣ  (0 ̻)
+    CriticalSection session_lock_{};
+    SlotMap<uint8_t> sessions_{};
+    std::bitset<256> assigned_player_ids_{};
+    uint8_t next_player_id_{ 1 };
     Concurrency::concurrent_queue<ProcessEvent> msg_queue_{};
-    PacketProcessorMap packet_processors_{};
+
+    SendStats last_send_stats_{};
+    std::chrono::steady_clock::time_point last_stats_time_{ std::chrono::steady_clock::now() };
 };
 
 template<typename PacketType> requires std::derived_from<PacketType, PacketBase>
 void GameServer::BroadcastPacket(const PacketType& packet, uint8_t exclude_id)
 {
-    auto& playerManager = GAME_APP.GetPlayerManager();
-    PlayerManager::PlayerMap players = playerManager.GetPlayers();
+    // Խõ  /  ȸ
+    const auto roster = GAME_APP.GetPlayerManager().GetRoster();
+    const auto packetBytes = ToWireBytes(packet);
+    const auto packet_data = std::span<const char>{ packetBytes.data(), packetBytes.size() };
 
-    for (auto it = players.begin(); it != players.end(); ++it)
+    for (const auto& player : *roster)
     {
-        const auto& player = it->second;
         if (player && player->GetId() != exclude_id)
         {
-            auto packetBytes = packet.ToBytes();
-            auto packet_data = std::span<const char>{ packetBytes.data(), packetBytes.size()};
 
             if (SendMsg(player->GetNetInfo(), packet_data) == false)
             {
@@ -5,6 +5,7 @@
 #include <format>
 #include <span>
 #include "NetworkController.hpp"
+#include "RelayHandshake.hpp"
 #include "../utils/Logger.hpp"
 
 NetClient::~NetClient()
@@ -34,7 +35,12 @@ bool NetClient::Start(HWND hwnd)
             throw NetworkException("InitSocket Failed");
         }
 
-        if (Connect(NETWORK.GetAddress(), Constants::Network::NET_PORT) == false)
+        const uint32_t relay_session_code = NETWORK.GetRelaySessionCode();
+        const bool connected = relay_session_code != 0 ?
+            Connect(NETWORK.GetRelayAddress(), Constants::Network::RELAY_PORT, relay_session_code) :
+            Connect(NETWORK.GetAddress(), Constants::Network::NET_PORT);
+
+        if (connected == false)
         {
             throw NetworkException("Connect Failed");
             return false;
@@ -42,6 +48,7 @@ bool NetClient::Start(HWND hwnd)
 
         recv_remain_size_ = 0;
         msg_buffer_.fill(0);
+        chunk_assembler_.Reset();
 
         polling_thread_running_ = true;
         event_polling_thread_ = std::thread(&NetClient::EventPollingThreadFunc, this);
@@ -76,7 +83,7 @@ bool NetClient::InitSocket()
     return true;
 }
 
-bool NetClient::Connect(std::string_view ip, uint16_t port)
+bool NetClient::Connect(std::string_view ip, uint16_t port, uint32_t relay_session_code)
 {
     sockaddr_in server_addr{};
     server_addr.sin_family = AF_INET;
@@ -101,6 +108,12 @@ bool NetClient::Connect(std::string_view ip, uint16_t port)
         throw NetworkException("connect Failed: Error code " + std::to_string(errorCode));
     }
 
+    // ߰    ¦  ںʹ   ϰ 
+    if (relay_session_code != 0 && JoinRelay(socket_.get(), relay_session_code, Constants::Network::RELAY_PAIR_TIMEOUT) == false)
+    {
+        throw NetworkException("JoinRelay Failed");
+    }
+
     if (event_handle_ != WSA_INVALID_EVENT) 
     {
         WSACloseEvent(event_handle_);
@@ -130,11 +143,82 @@ void NetClient::SendData(std::span<const char> data)
         return;
     }
 
-    const int result = send(socket_.get(), data.data(), static_cast<int>(data.size()), 0);
+    if (ChunkSender::NeedsChunking(data))
+    {
+        CriticalSection::Lock lock(send_lock_);
+        if (chunk_sender_.Queue(data) == false)
+        {
+            LOGGER.Warning("Chunked send rejected. size: {}, queued: {}", data.size(), chunk_sender_.GetQueuedCount());
+        }
+        return;
+    }
+
+    {
+        CriticalSection::Lock lock(send_lock_);
+        send_buffer_.insert(send_buffer_.end(), data.begin(), data.end());
+    }
+
+    // ŷ  ƴϾ ռ    ڿ ̾   
+    if (!send_cork_)
+    {
+        FlushSend();
+    }
+}
+
+void NetClient::FlushSend()
+{
+    if (!is_connected_)
+    {
+        return;
+    }
+
+    bool send_failed = false;
+    {
+        CriticalSection::Lock lock(send_lock_);
+        if (send_buffer_.empty() && chunk_sender_.IsEmpty())
+        {
+            return;
+        }
+
+        // 뷮 ޽   Ŷ ڿ  ŭ ٿ Է Ŷ и ʵ 
+        // (۽ ۰  ¸    ʰ  ͺ )
+        if (!send_blocked_)
+        {
+            chunk_sender_.Pump(Constants::Network::CHUNK_SEND_BUDGET, send_buffer_);
+        }
+
+        // ƽ   Ŷ   
+        send_blocked_ = false;
+        size_t offset = 0;
+        while (offset < send_buffer_.size())
+        {
+            const int result = send(socket_.get(), send_buffer_.data() + offset, static_cast<int>(send_buffer_.size() - offset), 0);
+
+            if (result == SOCKET_ERROR)
+            {
+                // ŷ ̹Ƿ ۽ ۰  WSAEWOULDBLOCK.  ʹ  ÷ÿ ̾ 
+                if (WSAGetLastError() == WSAEWOULDBLOCK)
+                {
+                    send_blocked_ = true;
+                }
+                else
+                {
+                    LogError(L"send Failed");
+                    send_failed = true;
+                }
+                break;
+            }
+
+            offset += static_cast<size_t>(result);
+        }
 
-    if (result == SOCKET_ERROR)
+        send_buffer_.erase(send_buffer_.begin(), send_buffer_.begin() + offset);
+    }
+
+    if (send_failed)
     {
-        LogError(L"send Failed");
+        Disconnect();
+        ProcessConnectExit();
     }
 }
 
@@ -167,6 +251,13 @@ void NetClient::Disconnect(bool force)
         return;
     }
 
+    {
+        CriticalSection::Lock lock(send_lock_);
+        send_buffer_.clear();
+        send_blocked_ = false;
+        chunk_sender_.Clear();
+    }
+
     linger optLinger = { force ? 1U : 0U, 0U };
 
     shutdown(socket_.get(), SD_BOTH);
@@ -246,8 +337,28 @@ bool NetClient::ProcessRecv(WPARAM wParam, LPARAM lParam)
                 break; //    ʿ
             }
 
-            // Ŷ ó
-            ProcessPacket(std::span<const char>(packet, packetBase.size));
+            // Ŷ ó (  Ŷ ϼǾ    )
+            if (IsChunkPacket(static_cast<PacketType>(packetBase.type)))
+            {
+                ChunkBufferPtr message;
+                const auto result = chunk_assembler_.OnChunk(std::span<const char>(packet, packetBase.size), chunk_pool_, message);
+
+                if (result == ChunkAssembler::Result::Invalid)
+                {
+                    LOGGER.Error("Invalid message chunk");
+                    recv_remain_size_ = 0;
+                    return false;
+                }
+
+                if (result == ChunkAssembler::Result::Complete)
+                {
+                    ProcessPacket(std::span<const char>(message->data(), message->size()));
+                }
+            }
+            else
+            {
+                ProcessPacket(std::span<const char>(packet, packetBase.size));
+            }
 
             //     ũ Ʈ
             recv_remain_size_ -= packetBase.size;
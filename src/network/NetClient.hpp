@@ -6,6 +6,8 @@
  */
 
 #include "NetCommon.hpp"
+#include "CriticalSection.hpp"
+#include "ChunkChannel.hpp"
 #include "../core/common/constants/Constants.hpp"
 
 #include <string>
@@ -29,10 +31,17 @@ public:
     virtual void Exit();
 
 
-    [[nodiscard]] bool Connect(std::string_view ip, uint16_t port);
+    // relay_session_code 0 ƴϸ ip/port ߰   ¦   
+    [[nodiscard]] bool Connect(std::string_view ip, uint16_t port, uint32_t relay_session_code = 0);
     void Disconnect(bool force = false);
 
+    // MAX_PACKET_SIZE Ѵ Ŷ   FlushSend  Ŷ ڿ ݾ 
     void SendData(std::span<const char> data);
+
+    // ۽ ŷ  (ŷ ߿ FlushSend    send )
+    //  ۽ ۰     ʹ  ξٰ  FlushSend ̾ 
+    void SetSendCork(bool enable) { send_cork_ = enable; }
+    void FlushSend();
     [[nodiscard]] bool ProcessRecv(WPARAM wParam, LPARAM lParam);    
     
 protected:
@@ -65,6 +74,16 @@ private:
 
     std::atomic<bool> is_connected_{ false };
 
+    CriticalSection send_lock_;
+    std::vector<char> send_buffer_;     //     (send_lock_ ȣ)
+    bool send_blocked_{ false };        //  ÷ð WSAEWOULDBLOCK  (send_lock_ ȣ)
+    std::atomic<bool> send_cork_{ false };
+    ChunkSender chunk_sender_;          // send_lock_ ȣ
+
+    //  忡 
+    ChunkBufferPool chunk_pool_;
+    ChunkAssembler chunk_assembler_;
+
     WSAEVENT event_handle_{ WSA_INVALID_EVENT };
 
     std::thread event_polling_thread_;
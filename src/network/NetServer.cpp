@@ -1,11 +1,56 @@
 #include "NetServer.hpp"
 
+#include <algorithm>
 #include <format>
 #include <process.h>
+#include "RelayHandshake.hpp"
+#include "packets/GamePacketSchemas.hpp"
 #include "../utils/Logger.hpp"
 
-NetServer::NetServer() :
-    clients_(std::make_unique<ClientInfo[]>(Constants::Network::MAX_CLIENT))
+namespace
+{
+    // sends[first]  ϳ ۷ ħ (gather   Ѵ  ޽)
+    void CoalesceSends(std::vector<std::shared_ptr<SendQueueData>>& sends, size_t first)
+    {
+        if (first + 1 >= sends.size())
+        {
+            return;
+        }
+
+        size_t bytes = 0;
+        for (size_t i = first; i < sends.size(); ++i)
+        {
+            bytes += sends[i]->buffer.size();
+        }
+
+        std::vector<char> buffer;
+        buffer.reserve(bytes);
+
+        auto merged = std::make_shared<SendQueueData>(std::move(buffer));
+        merged->enqueue_time = sends[first]->enqueue_time;
+        merged->message_count = 0;
+
+        for (size_t i = first; i < sends.size(); ++i)
+        {
+            merged->buffer.insert(merged->buffer.end(), sends[i]->buffer.begin(), sends[i]->buffer.end());
+            merged->message_count += sends[i]->message_count;
+        }
+
+        sends.resize(first);
+        sends.push_back(std::move(merged));
+    }
+
+    // send_lock ȿ ȣ:   ְ (ߴٸ)  
+    bool IsSameConnection(const ClientInfo& client, uint32_t connection_id)
+    {
+        return client.socket.is_valid() &&
+            (connection_id == NetServer::ANY_CONNECTION || client.connection_id == connection_id);
+    }
+}
+
+NetServer::NetServer(size_t max_client) :
+    clients_(std::make_unique<ClientInfo[]>(max_client)),
+    max_client_(max_client)
 {
 }
 
@@ -23,7 +68,7 @@ bool NetServer::StartServer()
             throw NetworkException("InitSocket Failed");
         }
 
-        if (BindAndListen(Constants::Network::NET_PORT) == false)
+        if (relay_session_code_ == 0 && BindAndListen(Constants::Network::NET_PORT) == false)
         {
             throw NetworkException("BindAndListen Failed");
         }
@@ -74,7 +119,7 @@ bool NetServer::BindAndListen(uint16_t port)
         throw NetworkException("bind Failed");
     }
 
-    if (listen(listen_socket_.get(), 5) == SOCKET_ERROR)
+    if (listen(listen_socket_.get(), SOMAXCONN) == SOCKET_ERROR)
     {
         throw NetworkException("listen Failed");
     }
@@ -197,6 +242,16 @@ unsigned int NetServer::WorkerThread()
         if (!result || (result && bytes_transferred == 0)) 
         {
             DisconnectProcess(client);
+
+            // ϰų  ݾ ҵ ۼŵ ⼭ ؾ    
+            if (overlapped_ex->operation == OperationType::Send)
+            {
+                ReleaseSend(client);
+            }
+            else if (overlapped_ex->operation == OperationType::Receive)
+            {
+                client->receiving = false;
+            }
             continue;
         }
 
@@ -204,7 +259,14 @@ unsigned int NetServer::WorkerThread()
         switch (overlapped_ex->operation) 
         {
         case OperationType::Receive:
+            client->recv_posted = false;
             ProcessRecv(client, overlapped_ex, bytes_transferred);
+
+            //      ʾ    
+            if (!client->recv_posted)
+            {
+                client->receiving = false;
+            }
             break;
         case OperationType::Send:
             ProcessSend(client, overlapped_ex, bytes_transferred);
@@ -217,9 +279,6 @@ unsigned int NetServer::WorkerThread()
 
 unsigned int NetServer::AccepterThread() 
 {
-    sockaddr_in client_addr{};
-    int addr_len = sizeof(client_addr);
-
     while (accepter_running_) 
     {
         ClientInfo* client = GetEmptyClientInfo();
@@ -227,27 +286,45 @@ unsigned int NetServer::AccepterThread()
             continue;
         }
 
-        client->socket = Socket(accept(listen_socket_.get(),
-            reinterpret_cast<sockaddr*>(&client_addr), &addr_len));
-
-        if (client->socket.is_valid() == false) 
+        Socket socket = AcceptClientSocket();
+        if (socket.is_valid() == false) 
         {
             continue;
         }
 
+        {
+            // ٸ 尡  ȿ connection_id  ϹǷ ϰ Բ ü (0 ANY_CONNECTION)
+            CriticalSection::Lock lock(client->send_lock);
+            client->socket = std::move(socket);
+            client->closing = false;
+
+            if (++connection_serial_ == ANY_CONNECTION)
+            {
+                ++connection_serial_;
+            }
+            client->connection_id = connection_serial_;
+        }
+
         if (BindIOCP(client) == false) 
         {
+            CriticalSection::Lock lock(client->send_lock);
+            client->socket.close();
             continue;
         }
 
         client->recv_buffer.Reset();
+        client->rate_limiter.Reset();
+        client->chunk_assembler.Reset();
+
+        // ù  ٷ  Ŀ ݾƵ  ߳ ʵ  
+        ++client_count_;
 
         if (BindRecv(client, 0, 0) == false)
         {
+            CloseSocket(client);
             continue;
         }
 
-        ++client_count_;
         ConnectProcess(client);
     }
 
@@ -261,6 +338,9 @@ void NetServer::ProcessRecv(ClientInfo* client, OverlappedEx* overlapped, DWORD
 
     overlapped->receive_size += bytes;
 
+    //    ޽   ȸ (  ޽  ٷ ȯ)
+    client->chunk_assembler.Expire(ChunkAssembler::Clock::now());
+
     char* processed_pos = client->recv_buffer.GetProcessedPos();
     if (!processed_pos) 
     {
@@ -281,12 +361,19 @@ void NetServer::ProcessRecv(ClientInfo* client, OverlappedEx* overlapped, DWORD
     int packet_size = 0;
     memcpy(&packet_size, processed_pos, Constants::Network::PACKET_SIZE_LEN);
 
+    if (packet_size <= 0 || static_cast<size_t>(packet_size) > client->recv_buffer.GetBufferSize())
+    {
+        LogError(L"Invalid packet size");
+        DisconnectProcess(client);
+        return;
+    }
+
     int remain_size = overlapped->receive_size;
 
     if (packet_size <= remain_size) 
     {
-        if (!PacketProcess(client, std::span<const char>(overlapped->begin_buf, packet_size))) {
-            CloseSocket(client);
+        if (!FilterPacket(client, std::span<const char>(overlapped->begin_buf, packet_size))) {
+            DisconnectProcess(client);
             return;
         }
 
@@ -304,7 +391,7 @@ void NetServer::ProcessRecv(ClientInfo* client, OverlappedEx* overlapped, DWORD
                 {
              
                     LogError(L"Invalid packet size");
-                    CloseSocket(client);
+                    DisconnectProcess(client);
                     return;
                 }
 
@@ -313,9 +400,9 @@ void NetServer::ProcessRecv(ClientInfo* client, OverlappedEx* overlapped, DWORD
                 //  Ŷ ŵ 
                 if (packet_size <= remain_size) 
                 {
-                    if (!PacketProcess(client, std::span<const char>(processed_pos, packet_size))) 
+                    if (!FilterPacket(client, std::span<const char>(processed_pos, packet_size))) 
                     {
-                        CloseSocket(client);
+                        DisconnectProcess(client);
                         return;
                     }
 
@@ -341,60 +428,165 @@ void NetServer::ProcessRecv(ClientInfo* client, OverlappedEx* overlapped, DWORD
     }
 }
 
-void NetServer::ProcessSend(ClientInfo* client, OverlappedEx* overlapped, DWORD bytes) 
+bool NetServer::FilterPacket(ClientInfo* client, std::span<const char> packet)
 {
-    if (!client || !overlapped) 
+    RateLimiter::Verdict verdict = RateLimiter::Verdict::Accept;
+    DecodedPacket decoded;
+    bool is_chunk = false;
+
+    // (ũ + Ÿ)   ų    Ÿ, Ű   ʵ ť   ź
+    if (packet.size() < Constants::Network::PACKET_SIZE_LEN + sizeof(uint16_t))
     {
-        return;
+        verdict = client->rate_limiter.AddStrike();
     }
+    else
+    {
+        uint16_t type = 0;
+        memcpy(&type, packet.data() + Constants::Network::PACKET_SIZE_LEN, sizeof(uint16_t));
 
-    uint16_t packet_type = 0;
-    if (overlapped->wsa_buf.buf && overlapped->wsa_buf.len >= Constants::Network::PACKET_SIZE_LEN + sizeof(uint16_t)) 
+        const auto packet_type = static_cast<PacketType>(type);
+        is_chunk = IsChunkPacket(packet_type);
+
+        // ū  Ȯϰ  Ŷ ڵ (ӵ ʰ Ŷ ڵ   )
+        verdict = IsValidPacketType(packet_type) ? client->rate_limiter.Check(packet_type) : client->rate_limiter.AddStrike();
+        if (verdict == RateLimiter::Verdict::Accept && DecodeAnyPacket(packet, decoded) == false)
+        {
+            verdict = client->rate_limiter.AddStrike();
+        }
+    }
+
+    switch (verdict)
+    {
+    case RateLimiter::Verdict::Accept:
+        return is_chunk ? ProcessChunk(client, packet) : PacketProcess(client, packet, decoded);
+
+    case RateLimiter::Verdict::Drop:
+        //  ϳ    Ƿ ޽ ü 
+        if (is_chunk)
+        {
+            client->chunk_assembler.Discard(packet);
+        }
+        return true;
+
+    case RateLimiter::Verdict::Disconnect:
+    default:
+        LOGGER.Warning("Rate limit exceeded. strikes: {}, dropped: {}", 
+            client->rate_limiter.GetStrikeCount(), client->rate_limiter.GetDroppedCount());
+        return false;
+    }
+}
+
+bool NetServer::ProcessChunk(ClientInfo* client, std::span<const char> packet)
+{
+    ChunkBufferPtr message;
+
+    switch (client->chunk_assembler.OnChunk(packet, chunk_pool_, message))
     {
-        memcpy(&packet_type, overlapped->wsa_buf.buf + Constants::Network::PACKET_SIZE_LEN, sizeof(uint16_t));
+    case ChunkAssembler::Result::Pending:
+        return true;
+
+    case ChunkAssembler::Result::Complete:
+        break;
+
+    case ChunkAssembler::Result::Invalid:
+    default:
+        LOGGER.Warning("Invalid message chunk. pending: {}", client->chunk_assembler.GetPendingCount());
+        return client->rate_limiter.AddStrike() != RateLimiter::Verdict::Disconnect;
+    }
+
+    //  Ŷ  Ÿ з Ŷ Ű    ˻ (Ŷ  Ȯ)
+    if (message->size() < sizeof(PacketBase))
+    {
+        return client->rate_limiter.AddStrike() != RateLimiter::Verdict::Disconnect;
+    }
+
+    PacketBase header{};
+    memcpy(&header, message->data(), sizeof(PacketBase));
+
+    switch (client->rate_limiter.Check(static_cast<PacketType>(header.type)))
+    {
+    case RateLimiter::Verdict::Accept:
+        break;
+
+    case RateLimiter::Verdict::Drop:
+        return true;
+
+    case RateLimiter::Verdict::Disconnect:
+    default:
+        return false;
+    }
+
+    DecodedPacket decoded;
+    if (DecodeAnyPacket(*message, decoded) == false)
+    {
+        return client->rate_limiter.AddStrike() != RateLimiter::Verdict::Disconnect;
+    }
+
+    return LargePacketProcess(client, std::move(message), decoded);
+}
+
+bool NetServer::LargePacketProcess(ClientInfo* client, ChunkBufferPtr packet, const DecodedPacket& decoded)
+{
+    return PacketProcess(client, std::span<const char>(packet->data(), packet->size()), decoded);
+}
+
+void NetServer::ProcessSend(ClientInfo* client, OverlappedEx* overlapped, DWORD bytes) 
+{
+    if (!client || !overlapped) 
+    {
+        return;
     }
 
     //  Ϸ Ʈ  
     overlapped->remain_size += bytes;
 
-    //  Ϸ ͸ ť 
-    std::shared_ptr<SendQueueData> temp_buffer;
-    client->send_queue.try_pop(temp_buffer);
-
-    //   Ͱ  ó
-    if (!client->send_queue.empty())
+    bool flush_next = false;
     {
-        std::shared_ptr<SendQueueData> next_data;
-        if (client->send_queue.try_pop(next_data))
+        CriticalSection::Lock lock(client->send_lock);
+
+        //  Ϸ  
+        client->inflight_sends.clear();
+        client->send_bufs.clear();
+        client->sending = false;
+
+        if (!client->socket.is_valid())
         {
-            //   ͷ  ü 
-            client->send_overlapped.operation = OperationType::Send;
-            client->send_overlapped.remain_size = 0;
-            client->send_overlapped.packet_size = static_cast<int>(next_data->buffer.size());
-            client->send_overlapped.wsa_buf.buf = next_data->buffer.data();
-            client->send_overlapped.wsa_buf.len = static_cast<ULONG>(next_data->buffer.size());
-            client->send_overlapped.begin_buf = next_data->buffer.data();
+            return;
+        }
 
-            ZeroMemory(&client->send_overlapped.overlapped, sizeof(OVERLAPPED));
+        //  ߿ ÷ û ־ų ŷ  ƴϸ  ͸ ̾ 
+        // (뷮 ޽  ŷ  ۽ ϷḶ ̾ )
+        flush_next = (!client->pending_sends.empty() && (client->flush_requested || !send_cork_)) || !client->chunk_sender.IsEmpty();
+    }
 
-            //   
-            DWORD sent_bytes = 0;
-            WSASend(
-                client->socket.get(),
-                &client->send_overlapped.wsa_buf,
-                1,
-                &sent_bytes,
-                0,
-                &client->send_overlapped.overlapped,
-                nullptr
-            );
+    if (flush_next)
+    {
+        if (FlushClient(client) == false)
+        {
+            LOGGER.Error("FlushClient Failed");
         }
     }
 }
 
+void NetServer::ReleaseSend(ClientInfo* client)
+{
+    CriticalSection::Lock lock(client->send_lock);
+
+    client->inflight_sends.clear();
+    client->send_bufs.clear();
+    client->sending = false;
+}
+
 bool NetServer::BindRecv(ClientInfo* client, char* processed_pos, int remain_size) 
 {
-    if (!client || !client->socket.is_valid())
+    if (!client)
+    {
+        return false;
+    }
+
+    // ٸ 尡  ݴ ߿ ų  ڵ WSARecv ʵ  ȿ Ȯ
+    CriticalSection::Lock lock(client->send_lock);
+    if (!client->socket.is_valid())
     {
         return false;
     }
@@ -454,43 +646,158 @@ bool NetServer::BindRecv(ClientInfo* client, char* processed_pos, int remain_siz
         return false;
     }
 
+    client->receiving = true;
+    client->recv_posted = true;
     return true;
 }
 
-bool NetServer::SendMsg(ClientInfo* client, std::span<const char> msg)
+bool NetServer::SendMsg(ClientInfo* client, std::span<const char> msg, uint32_t connection_id)
 {
-    if (!client || !client->socket.is_valid() || msg.empty())
+    if (!client || msg.empty())
     {
         return false;
     }
 
-    //   
-    auto send_data = std::make_shared<SendQueueData>(msg);
+    {
+        CriticalSection::Lock lock(client->send_lock);
+        if (!IsSameConnection(*client, connection_id))
+        {
+            return false;
+        }
 
-    //  ü 
-    client->send_overlapped.operation = OperationType::Send;
-    client->send_overlapped.remain_size = 0;
-    client->send_overlapped.packet_size = static_cast<int>(send_data->buffer.size());
-    client->send_overlapped.wsa_buf.buf = send_data->buffer.data();
-    client->send_overlapped.wsa_buf.len = static_cast<ULONG>(send_data->buffer.size());
-    client->send_overlapped.begin_buf = send_data->buffer.data();
+        if (ChunkSender::NeedsChunking(msg))
+        {
+            if (client->chunk_sender.Queue(msg) == false)
+            {
+                LOGGER.Warning("Chunked send rejected. size: {}, queued: {}", msg.size(), client->chunk_sender.GetQueuedCount());
+                return false;
+            }
+        }
+        else
+        {
+            client->pending_sends.push_back(std::make_shared<SendQueueData>(msg));
+        }
+    }
 
-    client->send_queue.push(send_data);
+    // ŷ ̸ ƽ   FlushSend   
+    if (send_cork_)
+    {
+        return true;
+    }
 
-    ZeroMemory(&client->send_overlapped.overlapped, sizeof(OVERLAPPED));
+    return FlushClient(client, connection_id);
+}
 
-    DWORD sent_bytes = 0;
-    const int result = WSASend(
-        client->socket.get(),
-        &client->send_overlapped.wsa_buf,
-        1,
-        &sent_bytes,
-        0,
-        &client->send_overlapped.overlapped,
-        nullptr
-    );
+void NetServer::FlushSend()
+{
+    for (size_t i = 0; i < max_client_; ++i)
+    {
+        if (clients_[i].socket.is_valid())
+        {
+            if (FlushClient(&clients_[i]) == false)
+            {
+                LOGGER.Error("FlushClient Failed");
+            }
+        }
+    }
+}
+
+bool NetServer::FlushClient(ClientInfo* client, uint32_t connection_id)
+{
+    if (!client)
+    {
+        return false;
+    }
 
-    if (result == SOCKET_ERROR && WSAGetLastError() != ERROR_IO_PENDING && WSAGetLastError() != WSAEWOULDBLOCK)
+    bool send_failed = false;
+    {
+        CriticalSection::Lock lock(client->send_lock);
+
+        if (!IsSameConnection(*client, connection_id))
+        {
+            return false;
+        }
+
+        if (client->pending_sends.empty() && client->chunk_sender.IsEmpty())
+        {
+            client->flush_requested = false;
+            return true;
+        }
+
+        //   Ϸ ʾ Ϸ (ProcessSend) ̾ 
+        if (client->sending)
+        {
+            client->flush_requested = true;
+            return true;
+        }
+
+        // gather      ޽ ϳ   ޽  ̹ ۿ 
+        // (  ڸ 뷮 ޽  )
+        CoalesceSends(client->pending_sends, Constants::Network::MAX_SEND_GATHER_COUNT - 2);
+
+        client->inflight_sends.swap(client->pending_sends);
+        client->pending_sends.clear();
+
+        // 뷮 ޽   Ŷ ڿ  ŭ ٿ Է Ŷ и ʵ 
+        if (!client->chunk_sender.IsEmpty())
+        {
+            std::vector<char> chunks;
+            chunks.reserve(Constants::Network::CHUNK_SEND_BUDGET * Constants::Network::MAX_PACKET_SIZE);
+            client->chunk_sender.Pump(Constants::Network::CHUNK_SEND_BUDGET, chunks);
+
+            client->inflight_sends.push_back(std::make_shared<SendQueueData>(std::move(chunks)));
+        }
+
+        client->flush_requested = !client->chunk_sender.IsEmpty();
+
+        //   ޽ ϳ gather  
+        size_t total_bytes = 0;
+        client->send_bufs.clear();
+        for (const auto& data : client->inflight_sends)
+        {
+            WSABUF wsa_buf{};
+            wsa_buf.buf = data->buffer.data();
+            wsa_buf.len = static_cast<ULONG>(data->buffer.size());
+            client->send_bufs.push_back(wsa_buf);
+            total_bytes += data->buffer.size();
+        }
+
+        //  ü 
+        client->send_overlapped.operation = OperationType::Send;
+        client->send_overlapped.remain_size = 0;
+        client->send_overlapped.packet_size = static_cast<int>(total_bytes);
+        client->send_overlapped.wsa_buf = client->send_bufs.front();
+        client->send_overlapped.begin_buf = client->send_bufs.front().buf;
+
+        ZeroMemory(&client->send_overlapped.overlapped, sizeof(OVERLAPPED));
+
+        client->sending = true;
+
+        DWORD sent_bytes = 0;
+        const int result = WSASend(
+            client->socket.get(),
+            client->send_bufs.data(),
+            static_cast<DWORD>(client->send_bufs.size()),
+            &sent_bytes,
+            0,
+            &client->send_overlapped.overlapped,
+            nullptr
+        );
+
+        if (result == SOCKET_ERROR && WSAGetLastError() != ERROR_IO_PENDING && WSAGetLastError() != WSAEWOULDBLOCK)
+        {
+            client->sending = false;
+            client->inflight_sends.clear();
+            client->send_bufs.clear();
+            send_failed = true;
+        }
+        else
+        {
+            RecordSend(client->inflight_sends, total_bytes);
+        }
+    }
+
+    if (send_failed)
     {
         LogError(L"WSASend()");
         DisconnectProcess(client);
@@ -500,38 +807,84 @@ bool NetServer::SendMsg(ClientInfo* client, std::span<const char> msg)
     return true;
 }
 
+void NetServer::RecordSend(const std::vector<std::shared_ptr<SendQueueData>>& batch, size_t bytes)
+{
+    const auto now = std::chrono::steady_clock::now();
+
+    CriticalSection::Lock lock(stats_lock_);
+
+    send_stats_.send_call_count += 1;
+    send_stats_.send_bytes += bytes;
+
+    for (const auto& data : batch)
+    {
+        const auto delay = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(now - data->enqueue_time).count());
+        send_stats_.message_count += data->message_count;
+        send_stats_.total_delay_us += delay * data->message_count;
+        send_stats_.max_delay_us = (std::max)(send_stats_.max_delay_us, delay);
+    }
+}
+
+SendStats NetServer::GetSendStats() const
+{
+    CriticalSection::Lock lock(stats_lock_);
+    return send_stats_;
+}
+
+bool NetServer::ClaimClose(ClientInfo* client)
+{
+    return client && client->closing.exchange(true) == false;
+}
+
 void NetServer::CloseSocket(ClientInfo* client, bool force) 
 {
-    if (!client || !client->socket.is_valid()) 
+    if (!client) 
     {
         return;
     }
 
-    linger opt_linger = 
     {
-        force ? 1U : 0U,  // l_onoff
-        0U               // l_linger
-    };
-
-    // socketClose  
-    shutdown(client->socket.get(), SD_BOTH);
-    setsockopt(client->socket.get(),
-        SOL_SOCKET,
-        SO_LINGER,
-        reinterpret_cast<char*>(&opt_linger),
-        sizeof(opt_linger));
+        // ȿ Ȯΰ ݱ⸦   ȿ ó  尡 ÿ  ʵ 
+        // (FlushClient/BindRecv   ȿ  ȮϹǷ  ڵ ۼ )
+        CriticalSection::Lock lock(client->send_lock);
+        if (!client->socket.is_valid())
+        {
+            return;
+        }
 
-    //  ʱȭ
-    client->recv_buffer.Reset();
+        client->closing = true;
 
-    std::shared_ptr<SendQueueData> dummy;
-    while (client->send_queue.try_pop(dummy)) {}
+        linger opt_linger = 
+        {
+            force ? 1U : 0U,  // l_onoff
+            0U               // l_linger
+        };
+
+        // socketClose  
+        shutdown(client->socket.get(), SD_BOTH);
+        setsockopt(client->socket.get(),
+            SOL_SOCKET,
+            SO_LINGER,
+            reinterpret_cast<char*>(&opt_linger),
+            sizeof(opt_linger));
+
+        client->pending_sends.clear();
+        client->chunk_sender.Clear();
+        client->flush_requested = false;
+
+        //   WSASend  closesocket ڿ Ŀ ۿ  ü ϹǷ
+        // Ϸ(Ǵ )  Ŀ 尡   ReleaseSend  (  Ե  )
+        if (!client->sending)
+        {
+            client->inflight_sends.clear();
+            client->send_bufs.clear();
+            ZeroMemory(&client->send_overlapped, sizeof(OverlappedEx));
+        }
 
-    //  ü ʱȭ
-    ZeroMemory(&client->recv_overlapped, sizeof(OverlappedEx));
-    ZeroMemory(&client->send_overlapped, sizeof(OverlappedEx));
+        //  ۿ  ü ɷ ִ WSARecv Ϸ()       ʱȭ
+        client->socket.close();
+    }
 
-    client->socket.close();
     --client_count_;
 }
 
@@ -539,7 +892,7 @@ bool NetServer::ExitServer()
 {
     DestroyThread();
 
-    for (size_t i = 0; i < Constants::Network::MAX_CLIENT; ++i) 
+    for (size_t i = 0; i < max_client_; ++i) 
     {
         if (clients_[i].socket.is_valid()) 
         {
@@ -579,6 +932,11 @@ void NetServer::DestroyThread() {
             listen_socket_.close();
         }
 
+        // ߰ 忡 ¦ ٸ ̸  
+        if (const SOCKET relay_socket = relay_pending_socket_.load(); relay_socket != INVALID_SOCKET) {
+            shutdown(relay_socket, SD_BOTH);
+        }
+
         if (accepter_thread_) {
             WaitForSingleObject(accepter_thread_, INFINITE);
             CloseHandle(accepter_thread_);
@@ -587,13 +945,49 @@ void NetServer::DestroyThread() {
     }
 }
 
+Socket NetServer::AcceptClientSocket()
+{
+    if (relay_session_code_ == 0)
+    {
+        sockaddr_in client_addr{};
+        int addr_len = sizeof(client_addr);
+
+        return Socket(accept(listen_socket_.get(), reinterpret_cast<sockaddr*>(&client_addr), &addr_len));
+    }
+
+    // ߰ : ԽƮ ¦    ó 
+    Socket socket(WSASocket(AF_INET, SOCK_STREAM, IPPROTO_TCP, nullptr, 0, WSA_FLAG_OVERLAPPED));
+    if (!socket.is_valid())
+    {
+        return Socket();
+    }
+
+    relay_pending_socket_ = socket.get();
+    const bool paired = ConnectRelay(socket.get(), relay_address_, Constants::Network::RELAY_PORT, relay_session_code_, Constants::Network::RELAY_PAIR_TIMEOUT);
+    relay_pending_socket_ = INVALID_SOCKET;
+
+    if (!paired)
+    {
+        // ߰ 忡    ٰ õ
+        Sleep(1000);
+        return Socket();
+    }
+
+    return socket;
+}
+
 ClientInfo* NetServer::GetEmptyClientInfo() 
 {
-    for (size_t i = 0; i < Constants::Network::MAX_CLIENT; ++i)
+    for (size_t i = 0; i < max_client_; ++i)
     {
         if (!clients_[i].socket.is_valid()) 
         {
-            return &clients_[i];
+            //   ۼ Ϸ      ǳʶ
+            CriticalSection::Lock lock(clients_[i].send_lock);
+            if (!clients_[i].sending && !clients_[i].receiving)
+            {
+                return &clients_[i];
+            }
         }
     }
     return nullptr;
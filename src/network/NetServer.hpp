@@ -3,22 +3,48 @@
  *
  * : TCP  IOCP Ͽ 񵿱 I/O 
  *  1. Ŀ   带  ۾ и.
+ *  2. ̹  RateLimiter Ŷ ˻ ť  źϰ,  Ŷ   ڵ DecodedPacket .
+ *  3. ŷ Ȱȭ  SendMsg ۸ ϰ FlushSend Ŭ̾Ʈ   WSASend(gather) .
+ *     gather  Ѵ  ޽ ϳ ۷ ġ,   WSASend ۴ Ϸ(Ǵ )  .
+ *  4. MAX_PACKET_SIZE Ѵ Ŷ   ۽Ÿ  Ŷ ڿ CHUNK_SEND_BUDGET ϰ,   Ǯ ۿ .
+ *  5. ߰ 忡     尡 ߰     ԽƮ ¦ .
  *
  */
 
 #include "NetCommon.hpp"
 #include "RingBuffer.hpp"
+#include "CriticalSection.hpp"
+#include "RateLimiter.hpp"
+#include "ChunkChannel.hpp"
+#include "packets/GamePacketSchemas.hpp"
+#include "../utils/SlotMap.hpp"
 
 #include <array>
+#include <atomic>
+#include <chrono>
 #include <concurrent_queue.h>
 #include <memory>
 #include <span>
+#include <string>
 
 struct SendQueueData
 {
     std::vector<char> buffer;
+    std::chrono::steady_clock::time_point enqueue_time;
+    uint32_t message_count{ 1 };     //  ۸ ģ ޽  (enqueue_time    ޽ )
 
-    SendQueueData(std::span<const char> data) : buffer(data.begin(), data.end()) {}
+    SendQueueData(std::span<const char> data) : buffer(data.begin(), data.end()), enqueue_time(std::chrono::steady_clock::now()) {}
+    explicit SendQueueData(std::vector<char>&& data) : buffer(std::move(data)), enqueue_time(std::chrono::steady_clock::now()) {}
+};
+
+// ۽    (ŷ / 񱳿)
+struct SendStats
+{
+    uint64_t message_count{ 0 };      // SendMsg ȣ 
+    uint64_t send_call_count{ 0 };    // WSASend ȣ  (׸Ʈ  ٻġ)
+    uint64_t send_bytes{ 0 };
+    uint64_t total_delay_us{ 0 };     // SendMsg ~ WSASend   ð 
+    uint64_t max_delay_us{ 0 };
 };
 
 
@@ -29,7 +55,24 @@ struct ClientInfo
     OverlappedEx send_overlapped;
 
     RingBuffer  recv_buffer;
-    Concurrency::concurrent_queue<std::shared_ptr<SendQueueData>> send_queue;
+    RateLimiter rate_limiter;   // Ŀ 忡 
+    ChunkAssembler chunk_assembler;   // Ŀ 忡 
+    uint32_t connection_id{ 0 };  // Ӹ ϴ Ϸùȣ (  п)
+    SlotId session_id{ INVALID_SLOT_ID };  //  (GameServer/DedicatedServer) οϴ  id
+
+    //  ڵ ۽  ( ,  , Ŀ ,  忡 )
+    //  ü/ݱ WSASend/WSARecv ȣ  send_lock ȿ 
+    CriticalSection send_lock;
+    std::vector<std::shared_ptr<SendQueueData>> pending_sends;   //  ÷ 
+    std::vector<std::shared_ptr<SendQueueData>> inflight_sends;  // WSASend Ϸ  ( ݾƵ Ϸ  )
+    std::vector<WSABUF> send_bufs;
+    ChunkSender chunk_sender;   // 뷮 ޽  ⿭
+    bool sending{ false };
+    bool flush_requested{ false };
+
+    std::atomic<bool> closing{ false };     //  ó  (Ӹ  忡 ʱȭ)
+    std::atomic<bool> receiving{ false };   // WSARecv ɷ ְų ϷḦ ó  (    )
+    bool recv_posted{ false };              // Ŀ  : ̹  ó ߿  WSARecv ɾ
 
     ClientInfo() 
     {
@@ -43,7 +86,7 @@ struct ClientInfo
 class NetServer 
 {
 public:
-    NetServer();
+    explicit NetServer(size_t max_client = Constants::Network::MAX_CLIENT);
     virtual ~NetServer();
     NetServer(const NetServer&) = delete;
     NetServer& operator=(const NetServer&) = delete;
@@ -51,13 +94,35 @@ public:
     [[nodiscard]] bool StartServer();
     bool ExitServer();
 
-    [[nodiscard]] bool SendMsg(ClientInfo* client, std::span<const char> msg);
+    // connection_id ָ  ȿ   ٸ ӿ   
+    // ( ó   񵿱 ޴ ʿ )
+    static constexpr uint32_t ANY_CONNECTION = 0;
+
+    [[nodiscard]] bool SendMsg(ClientInfo* client, std::span<const char> msg, uint32_t connection_id = ANY_CONNECTION);
+
+    // ۽ ŷ 
+    void SetSendCork(bool enable) { send_cork_ = enable; }
+    [[nodiscard]] bool IsSendCorked() const { return send_cork_; }
+    void FlushSend();
+    [[nodiscard]] bool FlushClient(ClientInfo* client, uint32_t connection_id = ANY_CONNECTION);
+    [[nodiscard]] SendStats GetSendStats() const;
+
+    [[nodiscard]] size_t GetMaxClient() const { return max_client_; }
+
+    // StartServer   (session_code 0̸   )
+    void SetRelay(std::string_view ip, uint32_t session_code) { relay_address_ = ip; relay_session_code_ = session_code; }
 
 protected:
     virtual bool ConnectProcess(ClientInfo* client) = 0;
     virtual bool DisconnectProcess(ClientInfo* client) = 0;
-    virtual bool PacketProcess(ClientInfo* client, std::span<const char> packet) = 0;    
+    // decoded FilterPacket ˻縦 ģ  (Ű  Ÿ̸ monostate, packet  Ʈ)
+    virtual bool PacketProcess(ClientInfo* client, std::span<const char> packet, const DecodedPacket& decoded) = 0;
+
+    //   뷮 Ŷ. ⺻  PacketProcess ͸  ϴ 쿡 
+    virtual bool LargePacketProcess(ClientInfo* client, ChunkBufferPtr packet, const DecodedPacket& decoded);
 
+    //  (Ŀ/)        true.  ̺Ʈ   ȣ
+    [[nodiscard]] bool ClaimClose(ClientInfo* client);
     void CloseSocket(ClientInfo* client, bool force = false);
 
 private:
@@ -78,11 +143,16 @@ private:
     unsigned int WorkerThread();
     unsigned int AccepterThread();
     void DestroyThread();
+    [[nodiscard]] Socket AcceptClientSocket();
 
     //  ۼ ó
     [[nodiscard]] bool BindRecv(ClientInfo* client, char* processed_pos, int remain_size);
     void ProcessRecv(ClientInfo* client, OverlappedEx* overlapped, DWORD bytes);
+    [[nodiscard]] bool FilterPacket(ClientInfo* client, std::span<const char> packet);
+    [[nodiscard]] bool ProcessChunk(ClientInfo* client, std::span<const char> packet);
     void ProcessSend(ClientInfo* client, OverlappedEx* overlapped, DWORD bytes);
+    void ReleaseSend(ClientInfo* client);
+    void RecordSend(const std::vector<std::shared_ptr<SendQueueData>>& batch, size_t bytes);
 
     [[nodiscard]] ClientInfo* GetEmptyClientInfo();
     void LogError(std::wstring_view msg) const;
@@ -96,9 +166,21 @@ private:
     std::array<HANDLE, MAX_WORKER_THREAD_COUNT> worker_threads_{};
 
     std::unique_ptr<ClientInfo[]> clients_;
-    size_t client_count_{ 0 };
+    size_t max_client_{ 0 };
+    std::atomic<size_t> client_count_{ 0 };
+    uint32_t connection_serial_{ 0 };
 
     std::atomic<bool> worker_running_{ false };
     std::atomic<bool> accepter_running_{ false };
+    std::atomic<bool> send_cork_{ false };
+
+    std::string relay_address_;
+    uint32_t relay_session_code_{ 0 };
+    std::atomic<SOCKET> relay_pending_socket_{ INVALID_SOCKET };    // ¦ ٸ ߰  (   )
+
+    ChunkBufferPool chunk_pool_;
+
+    mutable CriticalSection stats_lock_;
+    SendStats send_stats_{};
 };
 
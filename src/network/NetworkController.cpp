@@ -9,6 +9,7 @@
 #include "../game/map/GameBackground.hpp"
 
 #include "./packets/PacketBase.hpp"
+#include "../utils/Logger.hpp"
 
 NetworkController& NetworkController::Instance() 
 {
@@ -44,9 +45,20 @@ void NetworkController::Shutdown()
 
 bool NetworkController::Start() 
 {
+    if (relay_session_code_ != 0)
+    {
+        LOGGER.Info("Connecting through relay {} (session {})", relay_address_, relay_session_code_);
+    }
+
     if (role_ == NetworkRole::Server) 
     {
-        return server_ && server_->StartServer();
+        if (!server_)
+        {
+            return false;
+        }
+
+        server_->SetRelay(relay_address_, relay_session_code_);
+        return server_->StartServer();
     }
     else if (role_ == NetworkRole::Client) 
     {
@@ -98,8 +110,20 @@ void NetworkController::Update()
     }
 }
 
+void NetworkController::FlushSend()
+{
+    if (role_ == NetworkRole::Server && server_)
+    {
+        server_->FlushTick();
+    }
+    else if (role_ == NetworkRole::Client && client_)
+    {
+        client_->FlushSend();
+    }
+}
+
 //    Լ 
-void NetworkController::GameInitialize(std::span<const uint8_t> block1, std::span<const uint8_t> block2) 
+void NetworkController::GameInitialize(uint32_t piece_seed) 
 {
         
     if (role_ == NetworkRole::Server && server_) 
@@ -108,13 +132,13 @@ void NetworkController::GameInitialize(std::span<const uint8_t> block1, std::spa
         {
             if (auto* background = game_state->GetBackGround()) 
             {
-                server_->GameInitialize(block1, block2, background->GetMapIndex());
+                server_->GameInitialize(piece_seed, background->GetMapIndex());
             }
         }
     }
     else if (role_ == NetworkRole::Client && client_) 
     {
-        client_->GameInitialize(block1, block2);
+        client_->GameInitialize(piece_seed);
     }
 }
 
@@ -151,15 +175,15 @@ void NetworkController::DecideCharacter(uint8_t x, uint8_t y)
 }
 
 //   
-void NetworkController::AddNewBlock(std::span<const uint8_t> block) 
+void NetworkController::AddNewBlock(uint32_t piece_index) 
 {
     if (role_ == NetworkRole::Server && server_) 
     {
-        server_->AddNewBlock(block);
+        server_->AddNewBlock(piece_index);
     }
     else if (role_ == NetworkRole::Client && client_) 
     {
-        client_->AddNewBlock(block);
+        client_->AddNewBlock(piece_index);
     }
 }
 
@@ -225,7 +249,7 @@ void NetworkController::AddInterruptBlock(uint8_t y_row_count, uint8_t x_count,
 }
 
 //   
-void NetworkController::ReStartGame(std::span<const uint8_t> block1, std::span<const uint8_t> block2) 
+void NetworkController::ReStartGame(uint32_t piece_seed) 
 {
     if (role_ == NetworkRole::Server && server_) 
     {
@@ -233,13 +257,13 @@ void NetworkController::ReStartGame(std::span<const uint8_t> block1, std::span<c
         {
             if (auto* background = game_state->GetBackGround()) 
             {
-                server_->ReStartGame(block1, block2, background->GetMapIndex());
+                server_->ReStartGame(piece_seed, background->GetMapIndex());
             }
         }
     }
     else if (role_ == NetworkRole::Client && client_) 
     {
-        client_->ReStartGame(block1, block2);
+        client_->ReStartGame(piece_seed);
     }
 }
 
@@ -12,6 +12,7 @@
 
 
 #include "packets/PacketBase.hpp"
+#include "packets/GamePacketSchemas.hpp"
 #include "GameClient.hpp"
 #include "NetCommon.hpp"
 #include <Windows.h>
@@ -38,6 +39,7 @@ public:
     bool Start();
     void Stop();
     void Update();
+    void FlushSend();
 
     // /Ŭ̾Ʈ  Ȯ
     [[nodiscard]] bool IsServer() const { return role_ == NetworkRole::Server; }
@@ -48,6 +50,11 @@ public:
     void SetAddress(std::string_view ip) { ip_address_ = ip; }
     [[nodiscard]] std::string_view GetAddress() const { return ip_address_; }
 
+    // ߰   (session_code 0̸  )
+    void SetRelay(std::string_view ip, uint32_t session_code) { relay_address_ = ip; relay_session_code_ = session_code; }
+    [[nodiscard]] std::string_view GetRelayAddress() const { return relay_address_; }
+    [[nodiscard]] uint32_t GetRelaySessionCode() const { return relay_session_code_; }
+
     void SendData(std::span<const char> data);
 
     //  ó
@@ -59,12 +66,12 @@ public:
     //    Լ
     void StartCharacterSelect();
     void StartGame();
-    void GameInitialize(std::span<const uint8_t> block1, std::span<const uint8_t> block2);
+    void GameInitialize(uint32_t piece_seed);
     void ChangeCharSelect(uint8_t x, uint8_t y);
     void DecideCharacter(uint8_t x, uint8_t y);
 
     //   Լ
-    void AddNewBlock(std::span<const uint8_t> block);
+    void AddNewBlock(uint32_t piece_index);
     void MoveBlock(uint8_t move_type, float position);
     void RotateBlock(uint8_t rotate_type, bool horizontal_moving);
     void CheckBlockState();
@@ -80,7 +87,7 @@ public:
     void AddInterruptBlock(uint8_t y_row_count, uint8_t x_count, std::span<const uint8_t> xIdx);
     void StopComboAttack();
     void LoseGame();
-    void ReStartGame(std::span<const uint8_t> block1, std::span<const uint8_t> block2);
+    void ReStartGame(uint32_t piece_seed);
 
     // ä
     void ChatMessage(std::string_view msg);    
@@ -101,6 +108,8 @@ private:
     NetworkRole role_{ NetworkRole::None };
     bool is_running_{ false };
     std::string ip_address_;
+    std::string relay_address_;
+    uint32_t relay_session_code_{ 0 };
 };
 
 template<typename T> requires std::is_base_of_v<PacketBase, T>
@@ -110,7 +119,7 @@ void NetworkController::SendData(const T& packet)
     {
         if (client_)
         {
-            auto packetBytes = packet.ToBytes();
+            const auto packetBytes = ToWireBytes(packet);
             client_->SendData(std::span<const char>(packetBytes.data(), packetBytes.size()));
         }
     }
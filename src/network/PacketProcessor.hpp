@@ -6,6 +6,7 @@
 
 #include "packets/PacketType.hpp"
 #include "packets/PacketBase.hpp"
+#include "packets/GamePacketSchemas.hpp"
 
 class PacketProcessor
 {
@@ -29,12 +30,24 @@ void PacketProcessor::RegisterHandler(PacketType type, std::function<void(uint8_
 {
     handlers_[type] = [handler](uint8_t connectionId, std::span<const char> data)
         {
-            if (data.size() < sizeof(T))
+            // 스키마가 있으면 크기/필드 범위를 검사하며 복사본으로 디코드
+            if constexpr (HasPacketSchema<T>)
             {
-                return;
+                T packet;
+                if (DecodePacket(data, packet))
+                {
+                    handler(connectionId, &packet);
+                }
             }
+            else
+            {
+                if (data.size() < sizeof(T))
+                {
+                    return;
+                }
 
-            const T* packet = reinterpret_cast<const T*>(data.data());
-            handler(connectionId, packet);
+                const T* packet = reinterpret_cast<const T*>(data.data());
+                handler(connectionId, packet);
+            }
         };
 }
\ No newline at end of file
@@ -0,0 +1,109 @@
+#include "RateLimiter.hpp"
+#include "../core/common/constants/NetworkConstants.hpp"
+
+#include <algorithm>
+
+namespace
+{
+    struct BucketConfig
+    {
+        float capacity;
+        float refill_per_sec;
+    };
+
+    constexpr std::array<BucketConfig, static_cast<size_t>(PacketClass::Max)> CLASS_BUCKET_CONFIGS =
+    { {
+        { Constants::Network::RATE_CONTROL_BURST, Constants::Network::RATE_CONTROL_PER_SEC },
+        { Constants::Network::RATE_CHAT_BURST, Constants::Network::RATE_CHAT_PER_SEC },
+        { Constants::Network::RATE_BLOCK_BURST, Constants::Network::RATE_BLOCK_PER_SEC },
+        { Constants::Network::RATE_COMBAT_BURST, Constants::Network::RATE_COMBAT_PER_SEC },
+        { Constants::Network::RATE_BULK_BURST, Constants::Network::RATE_BULK_PER_SEC },
+    } };
+}
+
+void TokenBucket::Reset(float capacity, float refill_per_sec, Clock::time_point now)
+{
+    capacity_ = capacity;
+    refill_per_sec_ = refill_per_sec;
+    tokens_ = capacity;
+    last_refill_ = now;
+}
+
+bool TokenBucket::TryConsume(Clock::time_point now, float cost)
+{
+    const float elapsed = std::chrono::duration<float>(now - last_refill_).count();
+    last_refill_ = now;
+
+    tokens_ = (std::min)(capacity_, tokens_ + elapsed * refill_per_sec_);
+
+    if (tokens_ < cost)
+    {
+        return false;
+    }
+
+    tokens_ -= cost;
+    return true;
+}
+
+void RateLimiter::Reset()
+{
+    const auto now = Clock::now();
+
+    connection_bucket_.Reset(Constants::Network::RATE_CONNECTION_BURST, Constants::Network::RATE_CONNECTION_PER_SEC, now);
+
+    for (size_t i = 0; i < class_buckets_.size(); ++i)
+    {
+        class_buckets_[i].Reset(CLASS_BUCKET_CONFIGS[i].capacity, CLASS_BUCKET_CONFIGS[i].refill_per_sec, now);
+    }
+
+    strike_count_ = 0;
+    dropped_count_ = 0;
+    last_strike_time_ = now;
+}
+
+RateLimiter::Verdict RateLimiter::Check(PacketType type)
+{
+    const auto now = Clock::now();
+    const PacketClass packet_class = GetPacketClass(type);
+    auto& class_bucket = class_buckets_[static_cast<size_t>(packet_class)];
+
+    // 분류별 버킷을 먼저 확인해 한 종류의 폭주가 접속 전체 토큰을 소모하지 않도록 함
+    // (대용량 조각은 접속 전체 버킷에서 제외해 스냅샷 전송 중에도 입력 패킷이 밀리지 않도록 함)
+    if (class_bucket.TryConsume(now) == false ||
+        (packet_class != PacketClass::Bulk && connection_bucket_.TryConsume(now) == false))
+    {
+        if (IsStatefulPacketClass(packet_class))
+        {
+            return Verdict::Disconnect;
+        }
+
+        ++dropped_count_;
+        return AddStrike(now);
+    }
+
+    return Verdict::Accept;
+}
+
+RateLimiter::Verdict RateLimiter::AddStrike()
+{
+    return AddStrike(Clock::now());
+}
+
+RateLimiter::Verdict RateLimiter::AddStrike(Clock::time_point now)
+{
+    // 일정 시간 위반이 없었으면 스트라이크 초기화
+    const auto since_last = std::chrono::duration_cast<std::chrono::milliseconds>(now - last_strike_time_).count();
+    if (since_last >= Constants::Network::RATE_STRIKE_RESET_TIME)
+    {
+        strike_count_ = 0;
+    }
+
+    last_strike_time_ = now;
+
+    if (++strike_count_ >= Constants::Network::RATE_MAX_STRIKES)
+    {
+        return Verdict::Disconnect;
+    }
+
+    return Verdict::Drop;
+}
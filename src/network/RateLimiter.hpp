@@ -0,0 +1,108 @@
+#pragma once
+/*
+ *
+ * 설명: 접속별 토큰 버킷 기반 수신 패킷 속도 제한
+ *  1. 접속 전체 버킷과 패킷 분류(채팅/블록 조작/전투/기타)별 버킷을 함께 검사.
+ *     대용량 메시지 조각은 전용 버킷만 사용해 입력 패킷의 토큰을 소모하지 않음.
+ *  2. 토큰이 부족하거나 잘못된 패킷이면 스트라이크를 누적하고, 한도를 넘으면 연결 종료를 요청.
+ *  3. 블록 조작/전투 패킷은 상대 화면의 상태를 바꾸므로 하나만 빠져도 동기화가 깨짐. 초과 시 버리지 않고 바로 연결 종료.
+ *
+ */
+
+#include "./packets/PacketType.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+enum class PacketClass : uint8_t
+{
+    Control,
+    Chat,
+    BlockOperation,
+    Combat,
+    Bulk,
+    Max
+};
+
+[[nodiscard]] constexpr PacketClass GetPacketClass(PacketType type)
+{
+    if (IsChatPacket(type))
+    {
+        return PacketClass::Chat;
+    }
+
+    if (IsBlockOperationPacket(type))
+    {
+        return PacketClass::BlockOperation;
+    }
+
+    if (IsCombatPacket(type))
+    {
+        return PacketClass::Combat;
+    }
+
+    if (IsChunkPacket(type))
+    {
+        return PacketClass::Bulk;
+    }
+
+    return PacketClass::Control;
+}
+
+// 버리면 상대와 상태가 어긋나는 분류 (속도 초과 시 Drop 대신 Disconnect)
+[[nodiscard]] constexpr bool IsStatefulPacketClass(PacketClass packet_class)
+{
+    return packet_class == PacketClass::BlockOperation || packet_class == PacketClass::Combat;
+}
+
+class TokenBucket
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    void Reset(float capacity, float refill_per_sec, Clock::time_point now);
+    [[nodiscard]] bool TryConsume(Clock::time_point now, float cost = 1.0f);
+
+private:
+    float capacity_{ 0.0f };
+    float refill_per_sec_{ 0.0f };
+    float tokens_{ 0.0f };
+    Clock::time_point last_refill_{};
+};
+
+class RateLimiter
+{
+public:
+    enum class Verdict : uint8_t
+    {
+        Accept,
+        Drop,
+        Disconnect
+    };
+
+    using Clock = TokenBucket::Clock;
+
+    RateLimiter() { Reset(); }
+
+    void Reset();
+
+    // 프레이밍 직후, 디코딩 이전에 호출. 큐잉/디스패치 이전에 패킷 수용 여부를 결정
+    [[nodiscard]] Verdict Check(PacketType type);
+
+    // 잘못된 형식의 패킷 등 즉시 거부 대상에 대한 스트라이크
+    [[nodiscard]] Verdict AddStrike();
+
+    [[nodiscard]] uint32_t GetStrikeCount() const { return strike_count_; }
+    [[nodiscard]] uint64_t GetDroppedCount() const { return dropped_count_; }
+
+private:
+    [[nodiscard]] Verdict AddStrike(Clock::time_point now);
+
+    TokenBucket connection_bucket_;
+    std::array<TokenBucket, static_cast<size_t>(PacketClass::Max)> class_buckets_;
+
+    uint32_t strike_count_{ 0 };
+    uint64_t dropped_count_{ 0 };
+    Clock::time_point last_strike_time_{};
+};
@@ -0,0 +1,72 @@
+#include "RelayHandshake.hpp"
+#include "packets/GamePackets.hpp"
+#include "../utils/Logger.hpp"
+
+#include <string>
+
+bool JoinRelay(SOCKET socket, uint32_t session_code, int timeout_ms)
+{
+    RelayJoinPacket request;
+    request.session_code = session_code;
+
+    if (send(socket, reinterpret_cast<const char*>(&request), sizeof(RelayJoinPacket), 0) != sizeof(RelayJoinPacket))
+    {
+        LOGGER.Error("Relay join send failed. error: {}", WSAGetLastError());
+        return false;
+    }
+
+    // 짝이 성사될 때까지 기다린 뒤 수신 제한 시간은 원래대로 되돌림
+    DWORD timeout = static_cast<DWORD>(timeout_ms);
+    setsockopt(socket, SOL_SOCKET, SO_RCVTIMEO, reinterpret_cast<const char*>(&timeout), sizeof(timeout));
+
+    RelayJoinPacket response;
+    int received = 0;
+
+    while (received < static_cast<int>(sizeof(RelayJoinPacket)))
+    {
+        const int result = recv(socket, reinterpret_cast<char*>(&response) + received, static_cast<int>(sizeof(RelayJoinPacket)) - received, 0);
+        if (result <= 0)
+        {
+            LOGGER.Warning("Relay join timed out or closed. session: {}", session_code);
+            return false;
+        }
+
+        received += result;
+    }
+
+    timeout = 0;
+    setsockopt(socket, SOL_SOCKET, SO_RCVTIMEO, reinterpret_cast<const char*>(&timeout), sizeof(timeout));
+
+    if (response.type != static_cast<uint16_t>(PacketType::RelayJoin) || response.session_code != session_code || response.result != 1)
+    {
+        LOGGER.Warning("Relay join rejected. session: {}", session_code);
+        return false;
+    }
+
+    return true;
+}
+
+bool ConnectRelay(SOCKET socket, std::string_view ip, uint16_t port, uint32_t session_code, int timeout_ms)
+{
+    BOOL no_delay = TRUE;
+    setsockopt(socket, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char*>(&no_delay), sizeof(no_delay));
+
+    sockaddr_in relay_addr{};
+    relay_addr.sin_family = AF_INET;
+    relay_addr.sin_port = htons(port);
+
+    const std::string address(ip);
+    if (inet_pton(AF_INET, address.c_str(), &relay_addr.sin_addr) <= 0)
+    {
+        LOGGER.Error("Invalid relay address: {}", address);
+        return false;
+    }
+
+    if (connect(socket, reinterpret_cast<sockaddr*>(&relay_addr), sizeof(relay_addr)) == SOCKET_ERROR)
+    {
+        LOGGER.Error("Relay connect failed. error: {}", WSAGetLastError());
+        return false;
+    }
+
+    return JoinRelay(socket, session_code, timeout_ms);
+}
@@ -0,0 +1,20 @@
+#pragma once
+/*
+ *
+ * 설명: 중계 노드(puzzle_relay) 접속 절차
+ *  1. 호스트와 게스트 모두 중계 노드로 나가는 연결을 만들고 같은 session_code로 RelayJoinPacket 전송.
+ *  2. 중계 노드가 짝을 지으면 result 1로 응답하고, 이후 스트림은 가공 없이 상대에게 그대로 전달됨.
+ *  3. 응답을 기다리는 동안 블로킹되므로 WSAEventSelect/IOCP 등록 전에 호출.
+ *
+ */
+
+#include "NetCommon.hpp"
+
+#include <cstdint>
+#include <string_view>
+
+// 연결된 소켓으로 짝 요청 후 응답 대기 (timeout_ms 안에 짝이 성사되지 않으면 false)
+[[nodiscard]] bool JoinRelay(SOCKET socket, uint32_t session_code, int timeout_ms);
+
+// 중계 노드에 접속 후 짝 요청 (대기 중 다른 스레드에서 shutdown하면 즉시 실패로 반환)
+[[nodiscard]] bool ConnectRelay(SOCKET socket, std::string_view ip, uint16_t port, uint32_t session_code, int timeout_ms);
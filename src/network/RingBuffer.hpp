@@ -7,7 +7,7 @@
 #include <vector>
 #include <cstring>
 #include <mutex>
-#include "../core/common/constants/Constants.hpp"
+#include "../core/common/constants/NetworkConstants.hpp"
 #include "CriticalSection.hpp"
 
 class RingBuffer 
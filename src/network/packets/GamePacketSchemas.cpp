@@ -0,0 +1,88 @@
+#include "GamePacketSchemas.hpp"
+
+#include <array>
+#include <cstring>
+
+namespace
+{
+    struct SchemaEntry
+    {
+        uint16_t wire_size{ 0 };
+        bool (*decode)(std::span<const char>, DecodedPacket&) { nullptr };
+    };
+
+    using SchemaTable = std::array<SchemaEntry, static_cast<size_t>(PacketType::Max)>;
+
+    template<typename T>
+    [[nodiscard]] bool DecodeAs(std::span<const char> packet, DecodedPacket& decoded)
+    {
+        return DecodePacket(packet, decoded.emplace<T>());
+    }
+
+    template<typename T>
+    constexpr void AddEntry(SchemaTable& table)
+    {
+        static_assert(PacketSchema<T>::WIRE_SIZE == sizeof(T), "packet schema does not match the packed struct layout");
+        static_assert(PacketSchema<T>::WIRE_SIZE <= Constants::Network::MAX_PACKET_SIZE, "schema packet exceeds MAX_PACKET_SIZE");
+
+        auto& entry = table[static_cast<size_t>(PacketSchema<T>::TYPE)];
+
+        // 같은 타입에 스키마가 두 개 등록되면 상수 평가 실패로 컴파일 오류
+        if (entry.decode != nullptr)
+        {
+            throw "duplicate packet schema";
+        }
+
+        entry.wire_size = static_cast<uint16_t>(PacketSchema<T>::WIRE_SIZE);
+        entry.decode = &DecodeAs<T>;
+    }
+
+    template<typename... Packets>
+    constexpr SchemaTable MakeSchemaTable(PacketList<Packets...>)
+    {
+        SchemaTable table{};
+        (AddEntry<Packets>(table), ...);
+        return table;
+    }
+
+    constexpr SchemaTable SCHEMA_TABLE = MakeSchemaTable(SchemaPackets{});
+}
+
+size_t GetPacketWireSize(PacketType type)
+{
+    const auto index = static_cast<size_t>(type);
+    return index < SCHEMA_TABLE.size() ? SCHEMA_TABLE[index].wire_size : 0;
+}
+
+bool DecodeAnyPacket(std::span<const char> packet, DecodedPacket& decoded)
+{
+    decoded.emplace<std::monostate>();
+
+    if (packet.size() < sizeof(PacketBase))
+    {
+        return false;
+    }
+
+    PacketBase header{};
+    std::memcpy(&header, packet.data(), sizeof(PacketBase));
+
+    const auto type = static_cast<PacketType>(header.type);
+    if (header.size != packet.size() || !IsValidPacketType(type))
+    {
+        return false;
+    }
+
+    const SchemaEntry& entry = SCHEMA_TABLE[header.type];
+    if (entry.decode == nullptr)
+    {
+        return true;
+    }
+
+    if (entry.decode(packet, decoded) == false)
+    {
+        decoded.emplace<std::monostate>();
+        return false;
+    }
+
+    return true;
+}
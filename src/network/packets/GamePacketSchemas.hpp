@@ -0,0 +1,274 @@
+#pragma once
+/*
+ *
+ * 설명: GamePackets.hpp 패킷들의 와이어 스키마 선언과 타입별 검증 테이블
+ *  1. 구조체는 메모리 표현, 스키마는 와이어 표현. 크기가 어긋나면 컴파일 오류.
+ *  2. 수신 경로는 DecodeAnyPacket으로 헤더/크기/필드 범위를 한 번 검사하며 DecodedPacket으로 디코딩하고, 핸들러는 디코딩된 값을 받음.
+ *  3. MessageChunkPacket처럼 크기가 가변인 패킷은 스키마 없이 헤더만 검사 (조각 검증은 ChunkAssembler 담당).
+ *  4. SchemaPackets 목록 하나로 검증 테이블과 DecodedPacket variant(디스패치 대상)를 함께 생성.
+ *
+ */
+
+#include "PacketSchema.hpp"
+#include "GamePackets.hpp"
+#include "../../core/common/constants/NetworkConstants.hpp"
+#include "../../core/common/constants/RuleConstants.hpp"
+
+#include <concepts>
+#include <span>
+#include <variant>
+
+namespace PacketRange
+{
+    constexpr uint8_t MAX_BLOCK_TYPE = 7;           // BlockType::Ice
+    constexpr uint8_t MAX_BLOCK_STATE = 5;          // BlockState::PlayOut
+    constexpr uint8_t MAX_DIRECTION = 3;            // Constants::Direction::Bottom
+    constexpr uint8_t MAX_ROTATE_STATE = 3;         // RotateState::Left
+    constexpr uint8_t MAX_GROUP_BLOCK_INDEX = 1;    // BlockIndex::Satellite
+    constexpr uint16_t MAX_CHARACTER_ID = Constants::CharacterSelect::CHARACTER_GRID_WIDTH * Constants::CharacterSelect::CHARACTER_GRID_HEIGHT - 1;
+    constexpr uint8_t MAX_INTERRUPT_X_COUNT = sizeof(AddInterruptBlockPacket::x_indices);
+}
+
+// 채팅
+template<> struct PacketSchema<ChatMessagePacket> : PacketWire::Schema<PacketType::ChatMessage,
+    Field<&ChatMessagePacket::player_id>,
+    Field<&ChatMessagePacket::message>> {};
+
+// 캐릭터 선택
+template<> struct PacketSchema<ChangeCharSelectPacket> : PacketWire::Schema<PacketType::ChangeCharSelect,
+    Field<&ChangeCharSelectPacket::player_id>,
+    RangeField<&ChangeCharSelectPacket::x_pos, 0, Constants::CharacterSelect::CHARACTER_GRID_WIDTH - 1>,
+    RangeField<&ChangeCharSelectPacket::y_pos, 0, Constants::CharacterSelect::CHARACTER_GRID_HEIGHT - 1>> {};
+
+template<> struct PacketSchema<DecideCharacterPacket> : PacketWire::Schema<PacketType::DecideCharSelect,
+    Field<&DecideCharacterPacket::player_id>,
+    RangeField<&DecideCharacterPacket::x_pos, 0, Constants::CharacterSelect::CHARACTER_GRID_WIDTH - 1>,
+    RangeField<&DecideCharacterPacket::y_pos, 0, Constants::CharacterSelect::CHARACTER_GRID_HEIGHT - 1>> {};
+
+template<> struct PacketSchema<StartCharSelectPacket> : PacketWire::Schema<PacketType::StartCharSelect> {};
+
+// 게임 시작/초기화
+template<> struct PacketSchema<StartGamePacket> : PacketWire::Schema<PacketType::StartGame> {};
+
+template<> struct PacketSchema<GameInitPacket> : PacketWire::Schema<PacketType::InitializeGame,
+    Field<&GameInitPacket::player_id>,
+    Field<&GameInitPacket::map_id>,
+    RangeField<&GameInitPacket::character_id, 0, PacketRange::MAX_CHARACTER_ID>,
+    Field<&GameInitPacket::piece_seed>> {};
+
+template<> struct PacketSchema<InitializePlayerPacket> : PacketWire::Schema<PacketType::InitializePlayer,
+    Field<&InitializePlayerPacket::player_id>,
+    RangeField<&InitializePlayerPacket::character_idx, 0, PacketRange::MAX_CHARACTER_ID>,
+    Field<&InitializePlayerPacket::piece_seed>> {};
+
+template<> struct PacketSchema<RestartGamePacket> : PacketWire::Schema<PacketType::RestartGame,
+    Field<&RestartGamePacket::player_id>,
+    Field<&RestartGamePacket::map_id>,
+    Field<&RestartGamePacket::piece_seed>> {};
+
+template<> struct PacketSchema<GameOverPacket> : PacketWire::Schema<PacketType::GameOver> {};
+
+// 블록 조작
+template<> struct PacketSchema<AddNewBlockPacket> : PacketWire::Schema<PacketType::AddNewBlock,
+    Field<&AddNewBlockPacket::player_id>,
+    Field<&AddNewBlockPacket::piece_index>> {};
+
+template<> struct PacketSchema<MoveBlockPacket> : PacketWire::Schema<PacketType::UpdateBlockMove,
+    Field<&MoveBlockPacket::player_id>,
+    RangeField<&MoveBlockPacket::move_type, 0, PacketRange::MAX_DIRECTION>,
+    FiniteField<&MoveBlockPacket::position>> {};
+
+template<> struct PacketSchema<RotateBlockPacket> : PacketWire::Schema<PacketType::UpdateBlockRotate,
+    Field<&RotateBlockPacket::player_id>,
+    RangeField<&RotateBlockPacket::rotate_type, 0, PacketRange::MAX_ROTATE_STATE>,
+    Field<&RotateBlockPacket::is_horizontal_moving>> {};
+
+template<> struct PacketSchema<CheckBlockStatePacket> : PacketWire::Schema<PacketType::CheckBlockState,
+    Field<&CheckBlockStatePacket::player_id>> {};
+
+template<> struct PacketSchema<UpdateBlockPosPacket> : PacketWire::Schema<PacketType::UpdateBlockPos,
+    Field<&UpdateBlockPosPacket::player_id>,
+    FiniteField<&UpdateBlockPosPacket::position1>,
+    FiniteField<&UpdateBlockPosPacket::position2>> {};
+
+template<> struct PacketSchema<FallingBlockPacket> : PacketWire::Schema<PacketType::UpdateBlockFalling,
+    Field<&FallingBlockPacket::player_id>,
+    RangeField<&FallingBlockPacket::falling_index, 0, PacketRange::MAX_GROUP_BLOCK_INDEX>,
+    Field<&FallingBlockPacket::is_falling>> {};
+
+template<> struct PacketSchema<ChangeBlockStatePacket> : PacketWire::Schema<PacketType::ChangeBlockState,
+    Field<&ChangeBlockStatePacket::player_id>,
+    RangeField<&ChangeBlockStatePacket::state, 0, PacketRange::MAX_BLOCK_STATE>> {};
+
+template<> struct PacketSchema<PushBlockPacket> : PacketWire::Schema<PacketType::PushBlockInGame,
+    Field<&PushBlockPacket::player_id>,
+    FiniteField<&PushBlockPacket::position1>,
+    FiniteField<&PushBlockPacket::position2>> {};
+
+template<> struct PacketSchema<SyncBlockPositionYPacket> : PacketWire::Schema<PacketType::SyncBlockPositionY,
+    Field<&SyncBlockPositionYPacket::player_id>,
+    FiniteField<&SyncBlockPositionYPacket::position_y>,
+    FiniteField<&SyncBlockPositionYPacket::velocity>> {};
+
+// 공격/방어
+template<> struct PacketSchema<AttackInterruptPacket> : PacketWire::Schema<PacketType::AttackInterruptBlock,
+    Field<&AttackInterruptPacket::player_id>,
+    Field<&AttackInterruptPacket::count>,
+    FiniteField<&AttackInterruptPacket::position_x>,
+    FiniteField<&AttackInterruptPacket::position_y>,
+    RangeField<&AttackInterruptPacket::block_type, 0, PacketRange::MAX_BLOCK_TYPE>> {};
+
+template<> struct PacketSchema<DefenseInterruptPacket> : PacketWire::Schema<PacketType::DefenseInterruptBlock,
+    Field<&DefenseInterruptPacket::player_id>,
+    Field<&DefenseInterruptPacket::count>,
+    FiniteField<&DefenseInterruptPacket::position_x>,
+    FiniteField<&DefenseInterruptPacket::position_y>,
+    RangeField<&DefenseInterruptPacket::block_type, 0, PacketRange::MAX_BLOCK_TYPE>> {};
+
+// x_count는 x_indices 중 사용하는 개수이므로 배열 크기를 넘을 수 없음
+template<> struct PacketSchema<AddInterruptBlockPacket> : PacketWire::Schema<PacketType::AddInterruptBlock,
+    Field<&AddInterruptBlockPacket::player_id>,
+    RangeField<&AddInterruptBlockPacket::y_row_count, 0, Constants::Board::BOARD_Y_COUNT>,
+    RangeField<&AddInterruptBlockPacket::x_count, 0, PacketRange::MAX_INTERRUPT_X_COUNT>,
+    RangeField<&AddInterruptBlockPacket::x_indices, 0, Constants::Board::BOARD_X_COUNT - 1>> {};
+
+template<> struct PacketSchema<StopComboPacket> : PacketWire::Schema<PacketType::StopComboAttack,
+    Field<&StopComboPacket::player_id>> {};
+
+template<> struct PacketSchema<DefenseResultInterruptBlockCountPacket> : PacketWire::Schema<PacketType::DefenseResultInterruptBlockCount,
+    Field<&DefenseResultInterruptBlockCountPacket::player_id>,
+    Field<&DefenseResultInterruptBlockCountPacket::count>> {};
+
+template<> struct PacketSchema<AttackResultPlayerInterruptBlocCountPacket> : PacketWire::Schema<PacketType::AttackResultPlayerInterruptBlocCount,
+    Field<&AttackResultPlayerInterruptBlocCountPacket::player_id>,
+    Field<&AttackResultPlayerInterruptBlocCountPacket::count>,
+    Field<&AttackResultPlayerInterruptBlocCountPacket::attackerCount>> {};
+
+template<> struct PacketSchema<ComboPacket> : PacketWire::Schema<PacketType::ComboUpdate,
+    Field<&ComboPacket::player_id>,
+    Field<&ComboPacket::combo_count>,
+    FiniteField<&ComboPacket::combo_position_x>,
+    FiniteField<&ComboPacket::combo_position_y>,
+    Field<&ComboPacket::is_continue>> {};
+
+template<> struct PacketSchema<LoseGamePacket> : PacketWire::Schema<PacketType::LoseGame,
+    Field<&LoseGamePacket::player_id>> {};
+
+// 연결/플레이어
+template<> struct PacketSchema<GiveIdPacket> : PacketWire::Schema<PacketType::GiveId,
+    Field<&GiveIdPacket::player_id>> {};
+
+template<> struct PacketSchema<ConnectLobbyPacket> : PacketWire::Schema<PacketType::ConnectLobby,
+    Field<&ConnectLobbyPacket::id>> {};
+
+template<> struct PacketSchema<RelayJoinPacket> : PacketWire::Schema<PacketType::RelayJoin,
+    Field<&RelayJoinPacket::session_code>,
+    RangeField<&RelayJoinPacket::result, 0, 1>> {};
+
+template<> struct PacketSchema<RemovePlayerPacket> : PacketWire::Schema<PacketType::RemovePlayer,
+    Field<&RemovePlayerPacket::player_id>> {};
+
+template<> struct PacketSchema<PlayerInfoPacket> : PacketWire::Schema<PacketType::PlayerInfo,
+    Field<&PlayerInfoPacket::player_id>,
+    Field<&PlayerInfoPacket::character_id>> {};
+
+template<> struct PacketSchema<AddPlayerPacket> : PacketWire::Schema<PacketType::AddPlayer,
+    Field<&AddPlayerPacket::player_id>,
+    RangeField<&AddPlayerPacket::character_id, 0, PacketRange::MAX_CHARACTER_ID>> {};
+
+template<> struct PacketSchema<RemovePlayerInRoomPacket> : PacketWire::Schema<PacketType::RemovePlayerInRoom,
+    Field<&RemovePlayerInRoomPacket::id>> {};
+
+// 전용 서버 방/매치메이킹
+template<> struct PacketSchema<CreateRoomPacket> : PacketWire::Schema<PacketType::CreateRoom,
+    Field<&CreateRoomPacket::room_id>> {};
+
+template<> struct PacketSchema<JoinRoomPacket> : PacketWire::Schema<PacketType::JoinRoom,
+    Field<&JoinRoomPacket::room_id>,
+    RangeField<&JoinRoomPacket::result, 0, 1>> {};
+
+template<> struct PacketSchema<LeaveRoomPacket> : PacketWire::Schema<PacketType::LeaveRoom,
+    Field<&LeaveRoomPacket::room_id>> {};
+
+template<> struct PacketSchema<QueueMatchPacket> : PacketWire::Schema<PacketType::QueueMatch,
+    RangeField<&QueueMatchPacket::rating, 0, Constants::Network::MATCH_MAX_RATING>,
+    RangeField<&QueueMatchPacket::cancel, 0, 1>> {};
+
+template<typename... Packets>
+struct PacketList {};
+
+// 스키마를 가진 패킷 목록 (검증 테이블과 DecodedPacket 생성용)
+using SchemaPackets = PacketList<
+    ChatMessagePacket,
+    ChangeCharSelectPacket,
+    DecideCharacterPacket,
+    StartCharSelectPacket,
+    StartGamePacket,
+    GameInitPacket,
+    InitializePlayerPacket,
+    RestartGamePacket,
+    GameOverPacket,
+    AddNewBlockPacket,
+    MoveBlockPacket,
+    RotateBlockPacket,
+    CheckBlockStatePacket,
+    UpdateBlockPosPacket,
+    FallingBlockPacket,
+    ChangeBlockStatePacket,
+    PushBlockPacket,
+    SyncBlockPositionYPacket,
+    AttackInterruptPacket,
+    DefenseInterruptPacket,
+    AddInterruptBlockPacket,
+    StopComboPacket,
+    DefenseResultInterruptBlockCountPacket,
+    AttackResultPlayerInterruptBlocCountPacket,
+    ComboPacket,
+    LoseGamePacket,
+    GiveIdPacket,
+    ConnectLobbyPacket,
+    RelayJoinPacket,
+    RemovePlayerPacket,
+    PlayerInfoPacket,
+    AddPlayerPacket,
+    RemovePlayerInRoomPacket,
+    CreateRoomPacket,
+    JoinRoomPacket,
+    LeaveRoomPacket,
+    QueueMatchPacket>;
+
+namespace PacketWire
+{
+    template<typename List>
+    struct DecodedVariant;
+
+    template<typename... Packets>
+    struct DecodedVariant<PacketList<Packets...>>
+    {
+        using Type = std::variant<std::monostate, Packets...>;
+    };
+}
+
+// 수신 필터에서 한 번 디코딩한 패킷 (monostate: 스키마가 없는 타입, 헤더만 검사됨)
+using DecodedPacket = PacketWire::DecodedVariant<SchemaPackets>::Type;
+
+// 스키마로 정해지는 타입별 와이어 크기 (0: 스키마 없음)
+[[nodiscard]] size_t GetPacketWireSize(PacketType type);
+
+// 헤더 크기/타입과 스키마 필드 범위를 검사하며 디코딩 (수신 직후, 디스패치 이전에 한 번만 호출)
+// 실패하면 decoded는 monostate
+[[nodiscard]] bool DecodeAnyPacket(std::span<const char> packet, DecodedPacket& decoded);
+
+// 송신용 바이트열. 스키마가 있으면 리틀 엔디언으로 인코딩, 없으면 메모리 표현 그대로
+template<std::derived_from<PacketBase> T>
+[[nodiscard]] auto ToWireBytes(const T& packet)
+{
+    if constexpr (HasPacketSchema<T>)
+    {
+        return EncodePacket(packet);
+    }
+    else
+    {
+        return packet.ToBytes();
+    }
+}
@@ -60,8 +60,7 @@ struct GameInitPacket : PacketBase
     uint8_t player_id{};
     uint8_t map_id{};
     uint16_t character_id{};
-    std::array<uint8_t, 2> block1{};
-    std::array<uint8_t, 2> block2{};
+    uint32_t piece_seed{};      //    õ (PuyoPieceSequence)
 
     GameInitPacket()
     {
@@ -250,8 +249,7 @@ struct RestartGamePacket : PacketBase
 {
     uint8_t player_id{};
     uint8_t map_id{};
-    std::array<uint8_t, 2> block1{};
-    std::array<uint8_t, 2> block2{};
+    uint32_t piece_seed{};
 
     RestartGamePacket()
     {
@@ -264,8 +262,7 @@ struct InitializePlayerPacket : PacketBase
 {
     uint8_t player_id{};
     uint16_t character_idx{};
-    std::array<uint8_t, 2> block_type1{};
-    std::array<uint8_t, 2> block_type2{};
+    uint32_t piece_seed{};
 
     InitializePlayerPacket()
     {
@@ -277,7 +274,7 @@ struct InitializePlayerPacket : PacketBase
 struct AddNewBlockPacket : PacketBase
 {
     uint8_t player_id{};
-    std::array<uint8_t, 2> block_type{};  //  Ÿ 2
+    uint32_t piece_index{};     //     ε (  õ  )
 
     AddNewBlockPacket()
     {
@@ -367,6 +364,84 @@ struct RemovePlayerInRoomPacket : PacketBase
     }
 };
 
+//     (room_id 0 ڵ )
+struct CreateRoomPacket : PacketBase
+{
+    uint32_t room_id{};
+
+    CreateRoomPacket()
+    {
+        type = static_cast<uint16_t>(PacketType::CreateRoom);
+        size = sizeof(CreateRoomPacket);
+    }
+};
+
+struct JoinRoomPacket : PacketBase
+{
+    uint32_t room_id{};
+    uint8_t result{};   //   1: , 0: 
+
+    JoinRoomPacket()
+    {
+        type = static_cast<uint16_t>(PacketType::JoinRoom);
+        size = sizeof(JoinRoomPacket);
+    }
+};
+
+struct LeaveRoomPacket : PacketBase
+{
+    uint32_t room_id{};
+
+    LeaveRoomPacket()
+    {
+        type = static_cast<uint16_t>(PacketType::LeaveRoom);
+        size = sizeof(LeaveRoomPacket);
+    }
+};
+
+// ġŷ ⿭ / (  JoinRoomPacket)
+struct QueueMatchPacket : PacketBase
+{
+    uint16_t rating{};
+    uint8_t cancel{};
+
+    QueueMatchPacket()
+    {
+        type = static_cast<uint16_t>(PacketType::QueueMatch);
+        size = sizeof(QueueMatchPacket);
+    }
+};
+
+// ߰   ( session_code ¦ ,   result 1: ¦ )
+struct RelayJoinPacket : PacketBase
+{
+    uint32_t session_code{};
+    uint8_t result{};
+
+    RelayJoinPacket()
+    {
+        type = static_cast<uint16_t>(PacketType::RelayJoin);
+        size = sizeof(RelayJoinPacket);
+    }
+};
+
+// MAX_PACKET_SIZE Ѵ Ŷ  ( ũ = HEADER_SIZE +   )
+struct MessageChunkPacket : PacketBase
+{
+    static constexpr size_t HEADER_SIZE = sizeof(PacketBase) + sizeof(uint32_t) * 3;
+
+    uint32_t message_id{};
+    uint32_t total_size{};      //  Ŷ ü ũ
+    uint32_t offset{};          //  Ŷ ȿ   ġ
+    std::array<char, 256 - HEADER_SIZE> data{};
+
+    MessageChunkPacket()
+    {
+        type = static_cast<uint16_t>(PacketType::MessageChunk);
+        size = sizeof(MessageChunkPacket);
+    }
+};
+
 struct ConnectLobbyPacket : PacketBase
 {
     uint8_t id{};
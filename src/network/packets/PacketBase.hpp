@@ -1,6 +1,7 @@
 #pragma once
 #include "PacketType.hpp"
 #include <cstdint>
+#include <cstring>
 #include <vector>
 #include <string_view>
 
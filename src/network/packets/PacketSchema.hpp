@@ -0,0 +1,234 @@
+#pragma once
+/*
+ *
+ * 설명: 패킷 스키마 선언용 컴파일 타임 필드 목록
+ *  1. PacketSchema<T> 특수화에 필드(멤버 포인터)와 범위 조건을 한 번 나열하면 와이어 크기, 인코더/디코더, 검증기가 생성됨.
+ *  2. 와이어 형식은 리틀 엔디언 고정. 리틀 엔디언 환경에서는 필드마다 memcpy 한 번으로 끝나고 바이트 교환은 컴파일되지 않음.
+ *  3. 범위 조건이 없는 필드는 디코드 시 검사 코드가 생성되지 않음 (bool은 항상 0/1 검사).
+ *  4. 와이어 크기와 패킹된 구조체 크기가 다르면 컴파일 오류 (필드 누락/추가 방지).
+ *
+ */
+
+#include "PacketBase.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+
+namespace PacketWire
+{
+    template<typename T>
+    concept Scalar = std::is_arithmetic_v<T>;
+
+    template<Scalar T>
+    void Store(char* out, T value)
+    {
+        std::array<char, sizeof(T)> bytes{};
+        std::memcpy(bytes.data(), &value, sizeof(T));
+
+        if constexpr (std::endian::native == std::endian::big && sizeof(T) > 1)
+        {
+            std::reverse(bytes.begin(), bytes.end());
+        }
+
+        std::memcpy(out, bytes.data(), sizeof(T));
+    }
+
+    // bool은 0/1 이외의 값을 거부
+    template<Scalar T>
+    [[nodiscard]] bool Load(const char* in, T& value)
+    {
+        if constexpr (std::is_same_v<T, bool>)
+        {
+            const auto byte = static_cast<uint8_t>(*in);
+            value = byte != 0;
+            return byte <= 1;
+        }
+        else
+        {
+            std::array<char, sizeof(T)> bytes{};
+            std::memcpy(bytes.data(), in, sizeof(T));
+
+            if constexpr (std::endian::native == std::endian::big && sizeof(T) > 1)
+            {
+                std::reverse(bytes.begin(), bytes.end());
+            }
+
+            std::memcpy(&value, bytes.data(), sizeof(T));
+            return true;
+        }
+    }
+
+    template<auto Member>
+    struct MemberInfo;
+
+    template<typename C, typename M, M C::* Member>
+    struct MemberInfo<Member>
+    {
+        using Class = C;
+        using Type = M;
+    };
+
+    // 스칼라 또는 스칼라 std::array
+    template<typename T>
+    struct ElementInfo
+    {
+        using Element = T;
+        static constexpr size_t COUNT = 1;
+    };
+
+    template<typename E, size_t N>
+    struct ElementInfo<std::array<E, N>>
+    {
+        using Element = E;
+        static constexpr size_t COUNT = N;
+    };
+
+    // 필드 검사 조건
+    struct NoCheck
+    {
+        template<typename T>
+        [[nodiscard]] static constexpr bool Accept(T) { return true; }
+    };
+
+    template<auto Min, auto Max>
+    struct RangeCheck
+    {
+        // NaN도 비교에서 실패하므로 함께 거부됨
+        template<typename T>
+        [[nodiscard]] static constexpr bool Accept(T value) { return value >= static_cast<T>(Min) && value <= static_cast<T>(Max); }
+    };
+
+    struct FiniteCheck
+    {
+        template<typename T>
+        [[nodiscard]] static bool Accept(T value) { return std::isfinite(value); }
+    };
+
+    template<auto Member, typename Check>
+    struct FieldSpec
+    {
+        using Class = typename MemberInfo<Member>::Class;
+        using Type = typename MemberInfo<Member>::Type;
+        using Element = typename ElementInfo<Type>::Element;
+
+        static_assert(Scalar<Element>, "packet fields must be arithmetic or std::array of arithmetic");
+
+        static constexpr size_t COUNT = ElementInfo<Type>::COUNT;
+        static constexpr size_t SIZE = sizeof(Element) * COUNT;
+
+        static void Encode(const Class& packet, char* out)
+        {
+            if constexpr (COUNT == 1)
+            {
+                Store<Element>(out, packet.*Member);
+            }
+            else
+            {
+                for (size_t i = 0; i < COUNT; ++i)
+                {
+                    Store<Element>(out + i * sizeof(Element), (packet.*Member)[i]);
+                }
+            }
+        }
+
+        [[nodiscard]] static bool Decode(const char* in, Class& packet)
+        {
+            for (size_t i = 0; i < COUNT; ++i)
+            {
+                Element value{};
+                if (!Load(in + i * sizeof(Element), value) || !Check::Accept(value))
+                {
+                    return false;
+                }
+
+                if constexpr (COUNT == 1)
+                {
+                    packet.*Member = value;
+                }
+                else
+                {
+                    (packet.*Member)[i] = value;
+                }
+            }
+
+            return true;
+        }
+    };
+
+    template<PacketType Type, typename... Fields>
+    struct Schema
+    {
+        static constexpr bool DEFINED = true;
+        static constexpr PacketType TYPE = Type;
+        static constexpr size_t WIRE_SIZE = sizeof(PacketBase) + (size_t{ 0 } + ... + Fields::SIZE);
+
+        template<typename T>
+        static void Encode(const T& packet, std::span<char, WIRE_SIZE> out)
+        {
+            Store<uint32_t>(out.data(), static_cast<uint32_t>(WIRE_SIZE));
+            Store<uint16_t>(out.data() + sizeof(uint32_t), static_cast<uint16_t>(TYPE));
+
+            size_t offset = sizeof(PacketBase);
+            ((Fields::Encode(packet, out.data() + offset), offset += Fields::SIZE), ...);
+        }
+
+        // 크기/타입/필드 범위를 모두 통과해야 true (실패 시 packet 내용은 일부만 채워질 수 있음)
+        template<typename T>
+        [[nodiscard]] static bool Decode(std::span<const char> in, T& packet)
+        {
+            uint32_t size = 0;
+            uint16_t type = 0;
+
+            if (in.size() != WIRE_SIZE ||
+                !Load(in.data(), size) || size != WIRE_SIZE ||
+                !Load(in.data() + sizeof(uint32_t), type) || type != static_cast<uint16_t>(TYPE))
+            {
+                return false;
+            }
+
+            size_t offset = sizeof(PacketBase);
+            return ((Fields::Decode(in.data() + offset, packet) && (offset += Fields::SIZE, true)) && ...);
+        }
+    };
+}
+
+// 필드 선언 (멤버 포인터, 범위 조건)
+template<auto Member>
+using Field = PacketWire::FieldSpec<Member, PacketWire::NoCheck>;
+
+template<auto Member, auto Min, auto Max>
+using RangeField = PacketWire::FieldSpec<Member, PacketWire::RangeCheck<Min, Max>>;
+
+template<auto Member>
+using FiniteField = PacketWire::FieldSpec<Member, PacketWire::FiniteCheck>;
+
+// 패킷별 스키마 (특수화가 없으면 DEFINED == false)
+template<typename T>
+struct PacketSchema
+{
+    static constexpr bool DEFINED = false;
+};
+
+template<typename T>
+concept HasPacketSchema = PacketSchema<T>::DEFINED;
+
+template<typename T> requires HasPacketSchema<T>
+[[nodiscard]] std::array<char, PacketSchema<T>::WIRE_SIZE> EncodePacket(const T& packet)
+{
+    std::array<char, PacketSchema<T>::WIRE_SIZE> bytes{};
+    PacketSchema<T>::Encode(packet, std::span<char, PacketSchema<T>::WIRE_SIZE>(bytes));
+    return bytes;
+}
+
+template<typename T> requires HasPacketSchema<T>
+[[nodiscard]] bool DecodePacket(std::span<const char> data, T& packet)
+{
+    return PacketSchema<T>::Decode(data, packet);
+}
@@ -9,6 +9,14 @@ enum class PacketType : uint16_t
     // /ʱȭ  (1-99)
     GiveId = 1,
     ConnectLobby = 2,
+    RelayJoin = 3,
+    MessageChunk = 4,
+
+    //    
+    CreateRoom = 10,
+    JoinRoom = 11,
+    LeaveRoom = 12,
+    QueueMatch = 13,
 
     //÷̾ 
     RemovePlayer = 50,
@@ -73,6 +81,11 @@ enum class PacketType : uint16_t
     return type >= PacketType::GiveId && type < PacketType::ChatMessage;
 }
 
+[[nodiscard]] constexpr bool IsChunkPacket(PacketType type)
+{
+    return type == PacketType::MessageChunk;
+}
+
 [[nodiscard]] constexpr bool IsChatPacket(PacketType type) 
 {
     return type >= PacketType::ChatMessage && type < PacketType::StartCharSelect;
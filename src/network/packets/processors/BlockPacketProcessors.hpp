@@ -1,11 +1,10 @@
 #pragma once
 /*
  *
- * : Block ó  Ŷ Ŭ 
+ * : Block ó  Ŷ ڵ鷯 (ServerPacket::Process ε)
  *
  */
 
-#include "IPacketProcessor.hpp"
 #include "../GamePackets.hpp"
 #include "../../../core/GameApp.hpp"
 #include "../../../core/manager/StateManager.hpp"
@@ -17,61 +16,41 @@
 
 #include <span>
 
+struct ClientInfo;
 
-class AddNewBlockProcessor : public IPacketProcessor 
+namespace ServerPacket
 {
-public:
-    void Initialize() override {}
-
-    void Process(const PacketBase& packet, struct ClientInfo* client) override 
+    inline void Process(const AddNewBlockPacket& block_packet, ClientInfo* client)
     {
-        const auto& block_packet = static_cast<const AddNewBlockPacket&>(packet);
-
-        if (GAME_APP.GetStateManager().GetCurrentStateID() != StateManager::StateID::Game) 
+        if (GAME_APP.GetStateManager().GetCurrentStateID() != StateManager::StateID::Game)
         {
             return;
         }
 
         auto& playerManager = GAME_APP.GetPlayerManager();
         {
-            CriticalSection::Lock lock(playerManager.GetCriticalSection());
-            
-            for (const auto& [_, player] : playerManager.GetPlayers())
+            const auto roster = playerManager.GetRoster();
+
+            for (const auto& player : *roster)
             {
-                if (player->GetId() != block_packet.player_id) 
+                if (player->GetId() != block_packet.player_id)
                 {
                     NETWORK.SendToClient(player->GetNetInfo(), block_packet);
                 }
             }
         }
 
-        if (auto gameState = static_cast<GameState*>(GAME_APP.GetStateManager().GetCurrentState().get())) 
+        if (auto gameState = static_cast<GameState*>(GAME_APP.GetStateManager().GetCurrentState().get()))
         {
             if (const auto& remotePlayer = gameState->GetRemotePlayer())
-            {   
-                std::span<const uint8_t, 2> blockType{ block_packet.block_type };
-                remotePlayer->AddNewBlock(blockType);
+            {
+                remotePlayer->AddNewBlock(block_packet.piece_index);
             }
         }
     }
 
-    void Release() override {}
-
-    [[nodiscard]] PacketType GetPacketType() const override 
+    inline void Process(const FallingBlockPacket& fall_packet, ClientInfo* client)
     {
-        return PacketType::AddNewBlock;
-    }
-};
-
-class BlockFallingProcessor : public IPacketProcessor 
-{
-public:
-    void Initialize() override {}
-
-    void Process(const PacketBase& packet, struct ClientInfo* client) override 
-    {
-        const auto& fall_packet = static_cast<const FallingBlockPacket&>(packet);
-
         if (GAME_APP.GetStateManager().GetCurrentStateID() != StateManager::StateID::Game)
         {
             return;
@@ -79,17 +58,17 @@ public:
 
         auto& playerManager = GAME_APP.GetPlayerManager();
         {
-            CriticalSection::Lock lock(playerManager.GetCriticalSection());
-            for (const auto& [_, player] : playerManager.GetPlayers())
+            const auto roster = playerManager.GetRoster();
+            for (const auto& player : *roster)
             {
-                if (player->GetId() != fall_packet.player_id) 
+                if (player->GetId() != fall_packet.player_id)
                 {
                     NETWORK.SendToClient(player->GetNetInfo(), fall_packet);
                 }
             }
         }
 
-        if (auto gameState = static_cast<GameState*>(GAME_APP.GetStateManager().GetCurrentState().get())) 
+        if (auto gameState = static_cast<GameState*>(GAME_APP.GetStateManager().GetCurrentState().get()))
         {
             if (const auto& remotePlayer = gameState->GetRemotePlayer())
             {
@@ -98,24 +77,9 @@ public:
         }
     }
 
-    void Release() override {}
-
-    [[nodiscard]] PacketType GetPacketType() const override 
-    {
-        return PacketType::UpdateBlockFalling;
-    }
-};
-
-class ChangeBlockStateProcessor : public IPacketProcessor 
-{
-public:
-    void Initialize() override {}
-
-    void Process(const PacketBase& packet, struct ClientInfo* client) override 
+    inline void Process(const ChangeBlockStatePacket& state_packet, ClientInfo* client)
     {
-        const auto& state_packet = static_cast<const ChangeBlockStatePacket&>(packet);
-
-        if (GAME_APP.GetStateManager().GetCurrentStateID() != StateManager::StateID::Game) 
+        if (GAME_APP.GetStateManager().GetCurrentStateID() != StateManager::StateID::Game)
         {
             return;
         }
@@ -123,10 +87,10 @@ public:
         // ٸ ÷̾鿡   εĳƮ
         auto& playerManager = GAME_APP.GetPlayerManager();
         {
-            CriticalSection::Lock lock(playerManager.GetCriticalSection());
-            for (const auto& [_, player] : playerManager.GetPlayers())
+            const auto roster = playerManager.GetRoster();
+            for (const auto& player : *roster)
             {
-                if (player->GetId() != state_packet.player_id) 
+                if (player->GetId() != state_packet.player_id)
                 {
                     NETWORK.SendToClient(player->GetNetInfo(), state_packet);
                 }
@@ -134,7 +98,7 @@ public:
         }
 
         //   Ʈ
-        if (auto gameState = static_cast<GameState*>( GAME_APP.GetStateManager().GetCurrentState().get())) 
+        if (auto gameState = static_cast<GameState*>( GAME_APP.GetStateManager().GetCurrentState().get()))
         {
             if (const auto& remotePlayer = gameState->GetRemotePlayer())
             {
@@ -143,23 +107,8 @@ public:
         }
     }
 
-    void Release() override {}
-
-    [[nodiscard]] PacketType GetPacketType() const override 
+    inline void Process(const PushBlockPacket& pushPacket, ClientInfo* client)
     {
-        return PacketType::ChangeBlockState;
-    }
-};
-
-class PushBlockProcessor : public IPacketProcessor
-{
-public:
-    void Initialize() override {}
-
-    void Process(const PacketBase& packet, struct ClientInfo* client) override 
-    {
-        const auto& pushPacket = static_cast<const PushBlockPacket&>(packet);
-
         if (GAME_APP.GetStateManager().GetCurrentStateID() != StateManager::StateID::Game)
         {
             return;
@@ -168,8 +117,8 @@ public:
         // ٸ ÷̾鿡  Ǫ εĳƮ
         auto& playerManager = GAME_APP.GetPlayerManager();
         {
-            CriticalSection::Lock lock(playerManager.GetCriticalSection());
-            for (const auto& [_, player] : playerManager.GetPlayers())
+            const auto roster = playerManager.GetRoster();
+            for (const auto& player : *roster)
             {
                 if (player->GetId() != pushPacket.player_id)
                 {
@@ -190,23 +139,8 @@ public:
         }
     }
 
-    void Release() override {}
-
-    [[nodiscard]] PacketType GetPacketType() const override 
-    {
-        return PacketType::PushBlockInGame;
-    }
-};
-
-class CheckBlockStateProcessor : public IPacketProcessor 
-{
-public:
-    void Initialize() override {}
-
-    void Process(const PacketBase& packet, struct ClientInfo* client) override 
+    inline void Process(const CheckBlockStatePacket& check_packet, ClientInfo* client)
     {
-        const auto& check_packet = static_cast<const CheckBlockStatePacket&>(packet);
-
         if (GAME_APP.GetStateManager().GetCurrentStateID() != StateManager::StateID::Game)
         {
             return;
@@ -215,10 +149,10 @@ public:
         // ٸ ÷̾鿡 üũ  
         auto& playerManager = GAME_APP.GetPlayerManager();
         {
-            CriticalSection::Lock lock(playerManager.GetCriticalSection());
-            for (const auto& [_, player] : playerManager.GetPlayers())
+            const auto roster = playerManager.GetRoster();
+            for (const auto& player : *roster)
             {
-                if (player->GetId() != check_packet.player_id) 
+                if (player->GetId() != check_packet.player_id)
                 {
                     NETWORK.SendToClient(player->GetNetInfo(), check_packet);
                 }
@@ -235,23 +169,9 @@ public:
         }
     }
 
-    void Release() override {}
-
-    [[nodiscard]] PacketType GetPacketType() const override 
-    {
-        return PacketType::CheckBlockState;
-    }
-};
-
-class BlockRotateProcessor : public IPacketProcessor {
-public:
-    void Initialize() override {}
-
-    void Process(const PacketBase& packet, struct ClientInfo* client) override 
+    inline void Process(const RotateBlockPacket& rotate_packet, ClientInfo* client)
     {
-        const auto& rotate_packet = static_cast<const RotateBlockPacket&>(packet);
-
-        if (GAME_APP.GetStateManager().GetCurrentStateID() != StateManager::StateID::Game) 
+        if (GAME_APP.GetStateManager().GetCurrentStateID() != StateManager::StateID::Game)
         {
             return;
         }
@@ -259,10 +179,10 @@ public:
         // ٸ ÷̾鿡 ȸ  
         auto& playerManager = GAME_APP.GetPlayerManager();
         {
-            CriticalSection::Lock lock(playerManager.GetCriticalSection());
-            for (const auto& [_, player] : playerManager.GetPlayers())
+            const auto roster = playerManager.GetRoster();
+            for (const auto& player : *roster)
             {
-                if (player->GetId() != rotate_packet.player_id) 
+                if (player->GetId() != rotate_packet.player_id)
                 {
                     NETWORK.SendToClient(player->GetNetInfo(), rotate_packet);
                 }
@@ -279,113 +199,13 @@ public:
         }
     }
 
-    void Release() override {}
-
-    [[nodiscard]] PacketType GetPacketType() const override {
-        return PacketType::UpdateBlockRotate;
-    }
-};
-
-//class ComboProcessor : public IPacketProcessor 
-//{
-//public:
-//    void Initialize() override {}
-
-//    void Process(const PacketBase& packet, struct ClientInfo* client) override 
-//    {
-//        const auto& combo_packet = static_cast<const ComboPacket&>(packet);
-
-//        if (GAME_APP.GetStateManager().GetCurrentStateID() != StateManager::StateID::Game) {
-//            return;
-//        }
-
-//        if (auto gameState = static_cast<GameState*>(GAME_APP.GetStateManager().GetCurrentState().get())) 
-//        {
-//            gameState->ProcessCombo(combo_packet.combo_count);
-
-//            // ٸ ÷̾鿡 ޺  
-//            auto& player_manager = GAME_APP.GetPlayerManager();
-//            {
-//                CriticalSection::Lock lock(playerManager.GetCriticalSection());
-
-//                for (const auto& [_, player] : player_manager.GetPlayers()) 
-//                {
-//                    if (player->GetId() != combo_packet.player_id) 
-//                    {
-//                        NETWORK.SendToClient(player->GetNetInfo(), combo_packet);
-//                    }
-//                }
-//            }
-//        }
-//    }
-
-//    void Release() override {}
-
-//    [[nodiscard]] PacketType GetPacketType() const override 
-//    {
-//        return PacketType::ComboUpdate;
-//    }
-//};
-
-
-class BlockFallProcessor : public IPacketProcessor 
-{
-public:
-    void Initialize() override {}
-
-    void Process(const PacketBase& packet, struct ClientInfo* client) override 
+    inline void Process(const MoveBlockPacket& move_packet, ClientInfo* client)
     {
-        const auto& fall_packet = static_cast<const FallingBlockPacket&>(packet);
-
-        if (GAME_APP.GetStateManager().GetCurrentStateID() != StateManager::StateID::Game) 
-        {
-            return;
-        }
-
-        // ٸ ÷̾鿡    
-        auto& playerManager = GAME_APP.GetPlayerManager();
-        {
-            CriticalSection::Lock lock(playerManager.GetCriticalSection());
-
-            for (const auto& [_, player] : playerManager.GetPlayers())
-            {
-                if (player->GetId() != fall_packet.player_id) 
-                {
-                    NETWORK.SendToClient(player->GetNetInfo(), fall_packet);
-                }
-            }
-        }
-
-        //   Ʈ
-        if (auto gameState = static_cast<GameState*>(GAME_APP.GetStateManager().GetCurrentState().get())) 
-        {
-            if (const auto& remotePlayer = gameState->GetRemotePlayer())
-            {
-                remotePlayer->UpdateFallingBlock(fall_packet.falling_index, fall_packet.is_falling);
-            }
-        }
-    }
-
-    void Release() override {}
-
-    [[nodiscard]] PacketType GetPacketType() const override {
-        return PacketType::UpdateBlockFalling;
-    }
-};
-
-class BlockMoveProcessor : public IPacketProcessor
-{
-public:
-    void Initialize() override {}
-
-    void Process(const PacketBase& packet, struct ClientInfo* client) override {
-        const auto& move_packet = static_cast<const MoveBlockPacket&>(packet);
-
         // ٸ ÷̾鿡 εĳƮ
         auto& playerManager = GAME_APP.GetPlayerManager();
         {
-            CriticalSection::Lock lock(playerManager.GetCriticalSection());
-            for (const auto& [_, player] : playerManager.GetPlayers())
+            const auto roster = playerManager.GetRoster();
+            for (const auto& player : *roster)
             {
                 if (player->GetId() != move_packet.player_id)
                 {
@@ -404,23 +224,8 @@ public:
         }
     }
 
-    void Release() override {}
-
-    [[nodiscard]] PacketType GetPacketType() const override
-    {
-        return PacketType::UpdateBlockMove;
-    }
-};
-
-class SyncPositionYProcessor : public IPacketProcessor
-{
-public:
-    void Initialize() override {}
-
-    void Process(const PacketBase& packet, struct ClientInfo* client) override
+    inline void Process(const SyncBlockPositionYPacket& sync_packet, ClientInfo* client)
     {
-        const auto& sync_packet = static_cast<const SyncBlockPositionYPacket&>(packet);
-
         if (GAME_APP.GetStateManager().GetCurrentStateID() != StateManager::StateID::Game)
         {
             return;
@@ -429,8 +234,8 @@ public:
         //  ÷̾ 
         auto& playerManager = GAME_APP.GetPlayerManager();
         {
-            CriticalSection::Lock lock(playerManager.GetCriticalSection());
-            for (const auto& [_, player] : playerManager.GetPlayers())
+            const auto roster = playerManager.GetRoster();
+            for (const auto& player : *roster)
             {
                 if (player->GetId() != sync_packet.player_id)
                 {
@@ -448,11 +253,4 @@ public:
             }
         }
     }
-
-    void Release() override {}
-
-    [[nodiscard]] PacketType GetPacketType() const override
-    {
-        return PacketType::SyncBlockPositionY;
-    }
-};
\ No newline at end of file
+}
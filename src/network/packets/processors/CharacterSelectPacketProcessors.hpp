@@ -1,11 +1,10 @@
 #pragma once
 /*
  *
- * : ĳ   ó  Ŷ Ŭ 
+ * : ĳ   ó  Ŷ ڵ鷯 (ServerPacket::Process ε)
  *
  */
 
-#include "IPacketProcessor.hpp"
 #include "../GamePackets.hpp"
 #include "../../CriticalSection.hpp"
 #include "../../../core/GameApp.hpp"
@@ -17,16 +16,12 @@
 #include "../../../game/system/BasePlayer.hpp"
 #include "../../../game/system/RemotePlayer.hpp"
 
+struct ClientInfo;
 
-class ChangeCharSelectProcessor : public IPacketProcessor
+namespace ServerPacket
 {
-public:
-    void Initialize() override {}
-
-    void Process(const PacketBase& packet, struct ClientInfo* client) override 
+    inline void Process(const ChangeCharSelectPacket& select_packet, ClientInfo* client)
     {
-        const auto& select_packet = static_cast<const ChangeCharSelectPacket&>(packet);
-
         auto& state_manager = GAME_APP.GetStateManager();
         if (state_manager.GetCurrentStateID() != StateManager::StateID::CharSelect)
         {
@@ -36,11 +31,11 @@ public:
         // ٸ ÷̾鿡   εĳƮ
         auto& playerManager = GAME_APP.GetPlayerManager();
         {
-            CriticalSection::Lock lock(playerManager.GetCriticalSection());
+            const auto roster = playerManager.GetRoster();
 
-            for (const auto& [_, player] : playerManager.GetPlayers())
+            for (const auto& player : *roster)
             {
-                if (player->GetId() != select_packet.player_id) 
+                if (player->GetId() != select_packet.player_id)
                 {
                     NETWORK.SendToClient(player->GetNetInfo(), select_packet);
                 }
@@ -53,40 +48,25 @@ public:
         }
     }
 
-    void Release() override {}
-
-    [[nodiscard]] PacketType GetPacketType() const override 
+    inline void Process(const DecideCharacterPacket& decide_packet, ClientInfo* client)
     {
-        return PacketType::ChangeCharSelect;
-    }
-};
-
-class DecideCharacterProcessor : public IPacketProcessor 
-{
-public:
-    void Initialize() override {}
-
-    void Process(const PacketBase& packet, struct ClientInfo* client) override 
-    {
-        const auto& decide_packet = static_cast<const DecideCharacterPacket&>(packet);
-
-        if (GAME_APP.GetStateManager().GetCurrentStateID() != StateManager::StateID::CharSelect) 
+        if (GAME_APP.GetStateManager().GetCurrentStateID() != StateManager::StateID::CharSelect)
         {
             return;
         }
 
         auto& playerManager = GAME_APP.GetPlayerManager();
         {
-            CriticalSection::Lock lock(playerManager.GetCriticalSection());
+            const auto roster = playerManager.GetRoster();
 
             if (auto player = playerManager.FindPlayer(decide_packet.player_id))
             {
                 player->SetCharacterId(decide_packet.y_pos * 7 + decide_packet.x_pos);
             }
 
-            for (const auto& [_, player] : playerManager.GetPlayers())
+            for (const auto& player : *roster)
             {
-                if (player->GetId() != decide_packet.player_id) 
+                if (player->GetId() != decide_packet.player_id)
                 {
                     NETWORK.SendToClient(player->GetNetInfo(), decide_packet);
                 }
@@ -94,16 +74,9 @@ public:
         }
 
         // ĳ   Ʈ
-        if (auto charSelect = static_cast<CharacterSelectState*>(GAME_APP.GetStateManager().GetCurrentState().get())) 
+        if (auto charSelect = static_cast<CharacterSelectState*>(GAME_APP.GetStateManager().GetCurrentState().get()))
         {
             charSelect->SetEnemyDecide(decide_packet.x_pos, decide_packet.y_pos);
         }
     }
-
-    void Release() override {}
-
-    [[nodiscard]] PacketType GetPacketType() const override 
-    {
-        return PacketType::DecideCharSelect;
-    }
-};
+}
@@ -1,11 +1,10 @@
 #pragma once
 /*
  *
- * :    Ŷ Ŭ 
+ * :    Ŷ ڵ鷯 (ServerPacket::Process ε)
  *
  */
 
-#include "IPacketProcessor.hpp"
 #include "../PacketBase.hpp"
 #include "../GamePackets.hpp"
 #include "../../CriticalSection.hpp"
@@ -19,22 +18,19 @@
 #include "../../../game/system/RemotePlayer.hpp"
 #include "../../../game/system/LocalPlayer.hpp"
 
-class AttackInterruptProcessor : public IPacketProcessor 
-{
-public:
-    void Initialize() override {}
+struct ClientInfo;
 
-    void Process(const PacketBase& packet, struct ClientInfo* client) override 
+namespace ServerPacket
+{
+    inline void Process(const AttackInterruptPacket& attack_packet, ClientInfo* client)
     {
-        const auto& attack_packet = static_cast<const AttackInterruptPacket&>(packet);
-
         if (GAME_APP.GetStateManager().GetCurrentStateID() != StateManager::StateID::Game)
         {
             return;
         }
 
         //   ¿  ó
-        if (auto gameState = static_cast<GameState*>(GAME_APP.GetStateManager().GetCurrentState().get())) 
+        if (auto gameState = static_cast<GameState*>(GAME_APP.GetStateManager().GetCurrentState().get()))
         {
             if (const auto& localPlayer = gameState->GetLocalPlayer())
             {
@@ -55,8 +51,8 @@ public:
                 //  Ŭ̾Ʈ 
                 auto& playerManager = GAME_APP.GetPlayerManager();
                 {
-                    CriticalSection::Lock lock(playerManager.GetCriticalSection());
-                    for (const auto& [_, player] : playerManager.GetPlayers()) 
+                    const auto roster = playerManager.GetRoster();
+                    for (const auto& player : *roster)
                     {
                         NETWORK.SendToClient(player->GetNetInfo(), resultPacket);
                     }
@@ -65,22 +61,8 @@ public:
         }
     }
 
-    void Release() override {}
-
-    [[nodiscard]] PacketType GetPacketType() const override 
+    inline void Process(const DefenseInterruptPacket& defense_packet, ClientInfo* client)
     {
-        return PacketType::AttackInterruptBlock;
-    }
-};
-
-class DefenseInterruptProcessor : public IPacketProcessor
-{
-public:
-    void Initialize() override {}
-
-    void Process(const PacketBase& packet, struct ClientInfo* client) override {
-        const auto& defense_packet = static_cast<const DefenseInterruptPacket&>(packet);
-
         if (GAME_APP.GetStateManager().GetCurrentStateID() != StateManager::StateID::Game) {
             return;
         }
@@ -89,7 +71,7 @@ public:
         if (!gameState) return;
 
         //    ó
-        if (const auto& localPlayer = gameState->GetLocalPlayer()) 
+        if (const auto& localPlayer = gameState->GetLocalPlayer())
         {
             localPlayer->DefenseInterruptBlockCount(
                 defense_packet.count,
@@ -105,32 +87,17 @@ public:
 
             //  Ŭ̾Ʈ 
             auto& playerManager = GAME_APP.GetPlayerManager();
-            CriticalSection::Lock lock(playerManager.GetCriticalSection());
-            for (const auto& [_, player] : playerManager.GetPlayers())
+            const auto roster = playerManager.GetRoster();
+            for (const auto& player : *roster)
             {
                 NETWORK.SendToClient(player->GetNetInfo(), result_packet);
             }
         }
     }
 
-    void Release() override {}
 
-    [[nodiscard]] PacketType GetPacketType() const override
+    inline void Process(const AddInterruptBlockPacket& interrupt_packet, ClientInfo* client)
     {
-        return PacketType::DefenseInterruptBlock;
-    }
-};
-
-
-class AddInterruptBlockProcessor : public IPacketProcessor 
-{
-public:
-    void Initialize() override {}
-
-    void Process(const PacketBase& packet, struct ClientInfo* client) override 
-    {
-        const auto& interrupt_packet = static_cast<const AddInterruptBlockPacket&>(packet);
-
         if (GAME_APP.GetStateManager().GetCurrentStateID() != StateManager::StateID::Game) {
             return;
         }
@@ -139,7 +106,7 @@ public:
         if (!gameState) return;
 
         //  ÷̾   ߰
-        if (const auto& remotePlayer = gameState->GetRemotePlayer()) 
+        if (const auto& remotePlayer = gameState->GetRemotePlayer())
         {
             std::span<const uint8_t> indices(
                 interrupt_packet.x_indices.data(),
@@ -150,23 +117,9 @@ public:
         }
     }
 
-    void Release() override {}
-
-    [[nodiscard]] PacketType GetPacketType() const override 
+    inline void Process(const StopComboPacket& combo_packet, ClientInfo* client)
     {
-        return PacketType::AddInterruptBlock;
-    }
-};
-
-class StopComboProcessor : public IPacketProcessor {
-public:
-    void Initialize() override {}
-
-    void Process(const PacketBase& packet, struct ClientInfo* client) override 
-    {
-        const auto& combo_packet = static_cast<const StopComboPacket&>(packet);
-
-        if (GAME_APP.GetStateManager().GetCurrentStateID() != StateManager::StateID::Game) 
+        if (GAME_APP.GetStateManager().GetCurrentStateID() != StateManager::StateID::Game)
         {
             return;
         }
@@ -174,10 +127,10 @@ public:
         // ٸ ÷̾鿡 ޺  
         auto& playerManager = GAME_APP.GetPlayerManager();
         {
-            CriticalSection::Lock lock(playerManager.GetCriticalSection());
-            for (const auto& [_, player] : playerManager.GetPlayers())
+            const auto roster = playerManager.GetRoster();
+            for (const auto& player : *roster)
             {
-                if (player->GetId() != combo_packet.player_id) 
+                if (player->GetId() != combo_packet.player_id)
                 {
                     NETWORK.SendToClient(player->GetNetInfo(), combo_packet);
                 }
@@ -185,28 +138,15 @@ public:
         }
 
         // ޺  
-        if (auto gameState = static_cast<GameState*>(GAME_APP.GetStateManager().GetCurrentState().get())) 
+        if (auto gameState = static_cast<GameState*>(GAME_APP.GetStateManager().GetCurrentState().get()))
         {
-			gameState->GetLocalPlayer()->SetComboAttackState(false);
+    			gameState->GetLocalPlayer()->SetComboAttackState(false);
         }
     }
 
-    void Release() override {}
-
-    [[nodiscard]] PacketType GetPacketType() const override {
-        return PacketType::StopComboAttack;
-    }
-};
-
-class LoseGameProcessor : public IPacketProcessor 
-{
-public:
-    void Initialize() override {}
-
-    void Process(const PacketBase& packet, struct ClientInfo* client) override {
-        const auto& lose_packet = static_cast<const LoseGamePacket&>(packet);
-
-        if (GAME_APP.GetStateManager().GetCurrentStateID() != StateManager::StateID::Game) 
+    inline void Process(const LoseGamePacket& lose_packet, ClientInfo* client)
+    {
+        if (GAME_APP.GetStateManager().GetCurrentStateID() != StateManager::StateID::Game)
         {
             return;
         }
@@ -214,11 +154,11 @@ public:
         // ٸ ÷̾鿡   
         auto& playerManager = GAME_APP.GetPlayerManager();
         {
-            CriticalSection::Lock lock(playerManager.GetCriticalSection());
+            const auto roster = playerManager.GetRoster();
 
-            for (const auto& [_, player] : playerManager.GetPlayers())
+            for (const auto& player : *roster)
             {
-                if (player->GetId() != lose_packet.player_id) 
+                if (player->GetId() != lose_packet.player_id)
                 {
                     NETWORK.SendToClient(player->GetNetInfo(), lose_packet);
                 }
@@ -232,7 +172,7 @@ public:
 
             const auto& remotePlayer = gameState->GetRemotePlayer();
             const auto& localPlayer = gameState->GetLocalPlayer();
-            
+
             if (lose_packet.player_id == remotePlayer->GetPlayerID())
             {
                 remotePlayer->LoseGame(false);
@@ -242,14 +182,7 @@ public:
             {
                 remotePlayer->LoseGame(true);
                 localPlayer->LoseGame(false);
-            }            
+            }
         }
     }
-
-    void Release() override {}
-
-    [[nodiscard]] PacketType GetPacketType() const override 
-    {
-        return PacketType::LoseGame;
-    }
-};
+}
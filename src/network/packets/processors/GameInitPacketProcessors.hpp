@@ -1,11 +1,10 @@
 #pragma once
 /*
  *
- * :  ʱȭ    Ŭ 
+ * :  ʱȭ    Ŷ ڵ鷯 (ServerPacket::Process ε)
  *
  */
 
-#include "IPacketProcessor.hpp"
 #include "../GamePackets.hpp"
 #include "../../CriticalSection.hpp"
 #include "../../../core/GameApp.hpp"
@@ -16,16 +15,12 @@
 #include "../../../network/NetworkController.hpp"
 #include "../../../network/player/Player.hpp"
 
+struct ClientInfo;
 
-class InitializePlayerProcessor : public IPacketProcessor 
+namespace ServerPacket
 {
-public:
-    void Initialize() override {}
-
-    void Process(const PacketBase& packet, struct ClientInfo* client) override 
+    inline void Process(const InitializePlayerPacket& init_packet, ClientInfo* client)
     {
-        const auto& init_packet = static_cast<const InitializePlayerPacket&>(packet);
-
         if (GAME_APP.GetStateManager().GetCurrentStateID() != StateManager::StateID::Game)
         {
             return;
@@ -34,16 +29,16 @@ public:
         // ÷̾ ĳ ID 
         auto& playerManager = GAME_APP.GetPlayerManager();
         {
-            CriticalSection::Lock lock(playerManager.GetCriticalSection());
+            const auto roster = playerManager.GetRoster();
             if (auto player = playerManager.FindPlayer(init_packet.player_id))
             {
                 player->SetCharacterId(init_packet.character_idx);
             }
 
             // ٸ ÷̾鿡 εĳƮ
-            for (const auto& [_, player] : playerManager.GetPlayers())
+            for (const auto& player : *roster)
             {
-                if (player->GetId() != init_packet.player_id) 
+                if (player->GetId() != init_packet.player_id)
                 {
                     NETWORK.SendToClient(player->GetNetInfo(), init_packet);
                 }
@@ -53,31 +48,13 @@ public:
         //  ÷̾ 
         if (auto gameState = dynamic_cast<GameState*>(GAME_APP.GetStateManager().GetCurrentState().get()))
         {
-            std::span<const uint8_t, 2> blockType1{ init_packet.block_type1 };
-            std::span<const uint8_t, 2> blockType2{ init_packet.block_type2 };
-
-            gameState->CreateGamePlayer(blockType1, blockType2, init_packet.player_id, init_packet.character_idx);
+            gameState->CreateGamePlayer(init_packet.piece_seed, init_packet.player_id, init_packet.character_idx);
         }
     }
 
-    void Release() override {}
-
-    [[nodiscard]] PacketType GetPacketType() const override 
-    {
-        return PacketType::InitializePlayer;
-    }
-};
-
-class RestartGameProcessor : public IPacketProcessor 
-{
-public:
-    void Initialize() override {}
-
-    void Process(const PacketBase& packet, struct ClientInfo* client) override 
+    inline void Process(const RestartGamePacket& restart_packet, ClientInfo* client)
     {
-        const auto& restart_packet = static_cast<const RestartGamePacket&>(packet);
-
-        if (GAME_APP.GetStateManager().GetCurrentStateID() != StateManager::StateID::Game) 
+        if (GAME_APP.GetStateManager().GetCurrentStateID() != StateManager::StateID::Game)
         {
             return;
         }
@@ -85,10 +62,10 @@ public:
         // ٸ ÷̾鿡 εĳƮ
         auto& playerManager = GAME_APP.GetPlayerManager();
         {
-            CriticalSection::Lock lock(playerManager.GetCriticalSection());
-            for (const auto& [_, player] : playerManager.GetPlayers())
+            const auto roster = playerManager.GetRoster();
+            for (const auto& player : *roster)
             {
-                if (player->GetId() != restart_packet.player_id) 
+                if (player->GetId() != restart_packet.player_id)
                 {
                     NETWORK.SendToClient(player->GetNetInfo(), restart_packet);
                 }
@@ -96,26 +73,15 @@ public:
         }
 
         //  
-        if (auto game_state = static_cast<GameState*>(GAME_APP.GetStateManager().GetCurrentState().get())) 
+        if (auto game_state = static_cast<GameState*>(GAME_APP.GetStateManager().GetCurrentState().get()))
         {
             if (const auto& remotePlayer = game_state->GetRemotePlayer())
             {
-                std::span<const uint8_t, 2> blockType1{ restart_packet.block1 };
-                std::span<const uint8_t, 2> blockType2{ restart_packet.block2 };
-
-                remotePlayer->Restart(blockType1, blockType2);
+                remotePlayer->Restart(restart_packet.piece_seed);
 
                 // α 
                 LOGGER.Info("Game restarted by player {}", restart_packet.player_id);
             }
         }
     }
-
-    void Release() override {}
-
-    [[nodiscard]] PacketType GetPacketType() const override 
-    {
-        return PacketType::RestartGame;
-    }
-};
-
+}
@@ -1,11 +1,10 @@
 #pragma once
 /*
  *
- * : κ ó  Ŷ Ŭ 
+ * : κ ó  Ŷ ڵ鷯 (ServerPacket::Process ε)
  *
  */
 
-#include "IPacketProcessor.hpp"
 #include "../GamePackets.hpp"
 #include "../../CriticalSection.hpp"
 #include "../../../core/GameApp.hpp"
@@ -18,37 +17,14 @@
 #include "../../../ui/EditBox.hpp"
 #include "../../../utils/StringUtils.hpp"
 
+#include <memory>
 
-// κ  Ŷ μ
-class ConnectLobbyProcessor : public IPacketProcessor 
-{
-public:
-    void Initialize() override {}
-
-    void Process(const PacketBase& packet, struct ClientInfo* client) override 
-    {
-        const auto& lobby_packet = static_cast<const ConnectLobbyPacket&>(packet);
-
-        auto new_player = GAME_APP.GetPlayerManager().CreatePlayer(lobby_packet.id, client);
+struct ClientInfo;
 
-        if (new_player != nullptr) 
-        {
-            NotifyExistingPlayers(new_player);
-            SendPlayerList(new_player);
-            BroadcastNewPlayerMessage();
-        }
-    }
-
-    void Release() override {}
-
-    [[nodiscard]] PacketType GetPacketType() const override 
-    { 
-        return PacketType::ConnectLobby; 
-    }
-
-private:
-
-    void NotifyExistingPlayers(const std::shared_ptr<Player>& newPlayer)
+namespace ServerPacket
+{
+    //  ÷̾  ÷̾鿡 ˸
+    inline void NotifyExistingPlayers(const std::shared_ptr<Player>& newPlayer)
     {
         if (!newPlayer)
         {
@@ -56,13 +32,13 @@ private:
         }
 
         auto& playerManager = GAME_APP.GetPlayerManager();
-        CriticalSection::Lock lock(playerManager.GetCriticalSection());
+        const auto roster = playerManager.GetRoster();
 
         AddPlayerPacket packet;
         packet.player_id = newPlayer->GetId();
         packet.character_id = newPlayer->GetCharacterId();
 
-        for (const auto& [_, player] : playerManager.GetPlayers())
+        for (const auto& player : *roster)
         {
             if (player != newPlayer && player->GetNetInfo())
             {
@@ -71,7 +47,8 @@ private:
         }
     }
 
-    void SendPlayerList(const std::shared_ptr<Player>& newPlayer)
+    //  ÷̾   ÷̾ 
+    inline void SendPlayerList(const std::shared_ptr<Player>& newPlayer)
     {
         if (!newPlayer)
         {
@@ -79,9 +56,9 @@ private:
         }
 
         auto& playerManager = GAME_APP.GetPlayerManager();
-        CriticalSection::Lock lock(playerManager.GetCriticalSection());
+        const auto roster = playerManager.GetRoster();
 
-        for (const auto& [_, player] : playerManager.GetPlayers())
+        for (const auto& player : *roster)
         {
             if (player->GetId() != newPlayer->GetId())
             {
@@ -90,11 +67,11 @@ private:
                 packet.character_id = player->GetCharacterId();
 
                 NETWORK.SendToClient(newPlayer->GetNetInfo(), packet);
-            }        
+            }
         }
-    }   
+    }
 
-    void BroadcastNewPlayerMessage()
+    inline void BroadcastNewPlayerMessage()
     {
         if (GAME_APP.GetStateManager().GetCurrentStateID() != StateManager::StateID::Room)
         {
@@ -112,18 +89,21 @@ private:
             }
         }
     }
-};
 
-class ChatMessageProcessor : public IPacketProcessor 
-{
-public:
-    void Initialize() override {}
-
-    void Process(const PacketBase& packet, struct ClientInfo* client) override
+    inline void Process(const ConnectLobbyPacket& lobby_packet, ClientInfo* client)
     {
-        const auto& chat_packet = static_cast<const ChatMessagePacket&>(packet);
+        auto new_player = GAME_APP.GetPlayerManager().CreatePlayer(lobby_packet.id, client);
 
-           
+        if (new_player != nullptr)
+        {
+            NotifyExistingPlayers(new_player);
+            SendPlayerList(new_player);
+            BroadcastNewPlayerMessage();
+        }
+    }
+
+    inline void Process(const ChatMessagePacket& chat_packet, ClientInfo* client)
+    {
         if (auto roomState = dynamic_cast<RoomState*>(GAME_APP.GetStateManager().GetCurrentState().get()))
         {
             if (const auto edit_box = roomState->GetChatBox())
@@ -135,19 +115,12 @@ public:
 
         auto& playerManager = GAME_APP.GetPlayerManager();
         {
-            CriticalSection::Lock lock(playerManager.GetCriticalSection());
+            const auto roster = playerManager.GetRoster();
 
-            for (const auto& [_, player] : playerManager.GetPlayers())
+            for (const auto& player : *roster)
             {
                 NETWORK.SendToClient(player->GetNetInfo(), chat_packet);
             }
         }
     }
-
-    void Release() override {}
-
-    [[nodiscard]] PacketType GetPacketType() const override 
-    {
-        return PacketType::ChatMessage;
-    }
-};
+}
@@ -5,6 +5,8 @@
  *
  */
 
+#include "../../utils/SlotMap.hpp"
+
 #include <cstdint>
 
 struct ClientInfo;
@@ -23,6 +25,10 @@ public:
     void SetId(uint8_t id) noexcept { id_ = id; }
     [[nodiscard]] uint8_t GetId() const noexcept { return id_; }
 
+    // PlayerManager οϴ 32Ʈ  id (Ŷ player_id ġ   ȣ)
+    void SetSessionId(SlotId id) noexcept { session_id_ = id; }
+    [[nodiscard]] SlotId GetSessionId() const noexcept { return session_id_; }
+
     void SetCharacterId(uint16_t id) noexcept { character_id_ = id; }
     [[nodiscard]] uint16_t GetCharacterId() const noexcept { return character_id_; }
 
@@ -34,6 +40,7 @@ public:
 
 private:
     uint8_t id_{ 0 };
+    SlotId session_id_{ INVALID_SLOT_ID };
     uint16_t character_id_{ 0 };
     ClientInfo* net_info_{ nullptr };
 };
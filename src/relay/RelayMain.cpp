@@ -0,0 +1,103 @@
+/*
+ *
+ * 설명: 중계 노드 진입점 (콘솔)
+ *  사용법: puzzle_relay.exe [포트] [워커 스레드 수 (0: 자동)]
+ *
+ */
+
+#include "RelayNode.hpp"
+#include "../utils/Logger.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <Windows.h>
+
+namespace
+{
+    std::atomic<bool> g_running{ true };
+
+    BOOL WINAPI ConsoleCtrlHandler(DWORD ctrl_type)
+    {
+        switch (ctrl_type)
+        {
+        case CTRL_C_EVENT:
+        case CTRL_BREAK_EVENT:
+        case CTRL_CLOSE_EVENT:
+            g_running = false;
+            return TRUE;
+        default:
+            return FALSE;
+        }
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    uint16_t port = Constants::Network::RELAY_PORT;
+    size_t worker_count = 0;
+
+    try
+    {
+        if (argc > 1)
+        {
+            port = static_cast<uint16_t>(std::stoul(argv[1]));
+        }
+
+        if (argc > 2)
+        {
+            worker_count = std::stoul(argv[2]);
+        }
+    }
+    catch (const std::exception&)
+    {
+        port = Constants::Network::RELAY_PORT;
+        worker_count = 0;
+    }
+
+    if (LOGGER.Initialize() == false)
+    {
+        return 1;
+    }
+
+    LOGGER.SetLogToConsole(true);
+    SetConsoleCtrlHandler(ConsoleCtrlHandler, TRUE);
+
+    RelayNode relay(Constants::Network::RELAY_MAX_LINK, worker_count);
+    if (relay.Start(port) == false)
+    {
+        LOGGER.Shutdown();
+        return 1;
+    }
+
+    // 중계는 워커 스레드가 처리하므로 메인 스레드는 대기 링크 정리와 통계 출력만 담당
+    using clock = std::chrono::steady_clock;
+    auto next_report = clock::now() + std::chrono::milliseconds(Constants::Network::SEND_STATS_INTERVAL);
+    uint64_t last_bytes = 0;
+
+    while (g_running)
+    {
+        relay.Update();
+
+        const auto now = clock::now();
+        if (now >= next_report)
+        {
+            const RelayStats stats = relay.GetStats();
+            const double seconds = Constants::Network::SEND_STATS_INTERVAL / 1000.0;
+
+            LOGGER.Info("links: {}, pending: {}, pairs: {}, forwarded: {:.1f} KB/s",
+                stats.link_count, stats.pending_count, stats.pair_count, static_cast<double>(stats.forwarded_bytes - last_bytes) / 1024.0 / seconds);
+
+            last_bytes = stats.forwarded_bytes;
+            next_report = now + std::chrono::milliseconds(Constants::Network::SEND_STATS_INTERVAL);
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+
+    relay.Stop();
+    LOGGER.Shutdown();
+
+    return 0;
+}
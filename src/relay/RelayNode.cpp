@@ -0,0 +1,629 @@
+#include "RelayNode.hpp"
+#include "../utils/Logger.hpp"
+
+#include <algorithm>
+#include <bit>
+
+namespace
+{
+    constexpr uint32_t ALL_SLOTS = (1u << Constants::Network::RELAY_SLOT_COUNT) - 1;
+
+    static_assert(Constants::Network::RELAY_SLOT_COUNT < 32, "slot mask is 32 bits");
+    static_assert(sizeof(RelayJoinPacket) <= Constants::Network::RELAY_SLOT_SIZE, "handshake must fit in a slot");
+}
+
+RelayNode::RelayNode(size_t max_link, size_t worker_count) :
+    max_link_(max_link),
+    worker_count_(worker_count > 0 ? worker_count : std::max<size_t>(std::thread::hardware_concurrency(), 1))
+{
+}
+
+RelayNode::~RelayNode()
+{
+    Stop();
+}
+
+bool RelayNode::Start(uint16_t port)
+{
+    listen_socket_ = Socket(WSASocket(AF_INET, SOCK_STREAM, IPPROTO_TCP, nullptr, 0, WSA_FLAG_OVERLAPPED));
+    if (!listen_socket_.is_valid())
+    {
+        LOGGER.Error("Relay listen socket failed. error: {}", WSAGetLastError());
+        return false;
+    }
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+
+    if (bind(listen_socket_.get(), reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == SOCKET_ERROR ||
+        listen(listen_socket_.get(), SOMAXCONN) == SOCKET_ERROR)
+    {
+        LOGGER.Error("Relay bind/listen failed. port: {}, error: {}", port, WSAGetLastError());
+        listen_socket_.close();
+        return false;
+    }
+
+    iocp_handle_ = CreateIoCompletionPort(INVALID_HANDLE_VALUE, nullptr, 0, static_cast<DWORD>(worker_count_));
+    if (!iocp_handle_)
+    {
+        LOGGER.Error("Relay IOCP create failed");
+        listen_socket_.close();
+        return false;
+    }
+
+    running_ = true;
+
+    for (size_t i = 0; i < worker_count_; ++i)
+    {
+        worker_threads_.emplace_back(&RelayNode::WorkerLoop, this);
+    }
+
+    accept_thread_ = std::thread(&RelayNode::AcceptLoop, this);
+    next_sweep_time_ = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+
+    LOGGER.Info("RelayNode started. port: {}, workers: {}, max link: {}", port, worker_count_, max_link_);
+    return true;
+}
+
+void RelayNode::Stop()
+{
+    if (running_.exchange(false) == false)
+    {
+        return;
+    }
+
+    listen_socket_.close();
+    if (accept_thread_.joinable())
+    {
+        accept_thread_.join();
+    }
+
+    // 워커 종료 후에는 완료 통지가 오지 않으므로 소켓을 바로 닫고 링크 정리
+    for (size_t i = 0; i < worker_threads_.size(); ++i)
+    {
+        PostQueuedCompletionStatus(iocp_handle_, 0, 0, nullptr);
+    }
+
+    for (auto& thread : worker_threads_)
+    {
+        thread.join();
+    }
+
+    worker_threads_.clear();
+
+    for (auto& link : links_)
+    {
+        link->socket.close();
+    }
+
+    CloseHandle(iocp_handle_);
+    iocp_handle_ = nullptr;
+
+    pending_.clear();
+    free_links_.clear();
+    links_.clear();
+    pair_count_ = 0;
+}
+
+void RelayNode::Update()
+{
+    const auto now = std::chrono::steady_clock::now();
+    if (now < next_sweep_time_)
+    {
+        return;
+    }
+
+    next_sweep_time_ = now + std::chrono::seconds(1);
+
+    std::vector<PendingEntry> expired;
+    {
+        CriticalSection::Lock lock(pairing_lock_);
+
+        for (auto it = pending_.begin(); it != pending_.end();)
+        {
+            if (now - it->second.join_time >= std::chrono::milliseconds(Constants::Network::RELAY_PAIR_TIMEOUT))
+            {
+                expired.push_back(it->second);
+                it = pending_.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
+    // 대기 중인 링크는 접속 종료 감지용 수신이 걸려 있으므로 취소 완료 통지에서 회수됨
+    for (const auto& entry : expired)
+    {
+        CriticalSection::Lock lock(entry.link->lock);
+
+        if (entry.link->generation == entry.generation && !entry.link->closing && !entry.link->peer)
+        {
+            Close(*entry.link);
+        }
+    }
+}
+
+RelayStats RelayNode::GetStats()
+{
+    RelayStats stats;
+
+    {
+        CriticalSection::Lock lock(pool_lock_);
+        stats.link_count = links_.size() - free_links_.size();
+    }
+
+    {
+        CriticalSection::Lock lock(pairing_lock_);
+        stats.pending_count = pending_.size();
+    }
+
+    stats.pair_count = pair_count_.load(std::memory_order_relaxed);
+    stats.forwarded_bytes = forwarded_bytes_.load(std::memory_order_relaxed);
+
+    return stats;
+}
+
+void RelayNode::AcceptLoop()
+{
+    while (running_)
+    {
+        Socket socket(accept(listen_socket_.get(), nullptr, nullptr));
+        if (!socket.is_valid())
+        {
+            continue;
+        }
+
+        RelayLink* link = AcquireLink();
+        if (!link)
+        {
+            LOGGER.Warning("Relay link pool exhausted");
+            continue;
+        }
+
+        BOOL no_delay = TRUE;
+        setsockopt(socket.get(), IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char*>(&no_delay), sizeof(no_delay));
+
+        if (CreateIoCompletionPort(reinterpret_cast<HANDLE>(socket.get()), iocp_handle_, 0, 0) != iocp_handle_)
+        {
+            ReleaseLink(*link);
+            continue;
+        }
+
+        link->socket = std::move(socket);
+
+        if (PostHandshakeRecv(*link) == false)
+        {
+            ReleaseLink(*link);
+        }
+    }
+}
+
+void RelayNode::WorkerLoop()
+{
+    while (true)
+    {
+        DWORD bytes = 0;
+        ULONG_PTR key = 0;
+        LPOVERLAPPED overlapped = nullptr;
+
+        const BOOL result = GetQueuedCompletionStatus(iocp_handle_, &bytes, &key, &overlapped, INFINITE);
+        if (!overlapped)
+        {
+            // 종료 통지
+            return;
+        }
+
+        HandleCompletion(*reinterpret_cast<RelayIo*>(overlapped), bytes, result != FALSE);
+    }
+}
+
+void RelayNode::HandleCompletion(RelayIo& io, DWORD bytes, bool success)
+{
+    RelayLink& link = *io.link;
+
+    if (io.type == RelayIoType::Handshake)
+    {
+        HandleHandshake(link, bytes, success);
+        return;
+    }
+
+    std::array<RelayLink*, 2> release{};
+    size_t release_count = 0;
+
+    {
+        CriticalSection::Lock lock(link.lock_owner->lock);
+
+        --link.pending_io;
+
+        if (!success || bytes == 0)
+        {
+            Close(link);
+        }
+        else if (link.closing == false)
+        {
+            if (io.type == RelayIoType::Recv)
+            {
+                OnRecv(link, bytes);
+            }
+            else
+            {
+                OnSend(link, bytes);
+            }
+        }
+
+        release_count = CollectRelease(link, release);
+    }
+
+    // 잠금을 소유한 링크까지 회수할 수 있으므로 잠금을 푼 뒤 처리
+    if (release_count == 2)
+    {
+        pair_count_.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    for (size_t i = 0; i < release_count; ++i)
+    {
+        ReleaseLink(*release[i]);
+    }
+}
+
+void RelayNode::HandleHandshake(RelayLink& link, DWORD bytes, bool success)
+{
+    // 짝을 찾기 전이므로 이 링크에 접근하는 스레드는 하나뿐
+    --link.pending_io;
+
+    if (!success || bytes == 0)
+    {
+        ReleaseLink(link);
+        return;
+    }
+
+    link.handshake_received += bytes;
+    if (link.handshake_received < sizeof(RelayJoinPacket))
+    {
+        if (PostHandshakeRecv(link) == false)
+        {
+            ReleaseLink(link);
+        }
+        return;
+    }
+
+    if (link.handshake.type != static_cast<uint16_t>(PacketType::RelayJoin) || link.handshake.size != sizeof(RelayJoinPacket))
+    {
+        LOGGER.Warning("Relay handshake rejected. type: {}", link.handshake.type);
+        ReleaseLink(link);
+        return;
+    }
+
+    link.session_code = link.handshake.session_code;
+    TryPair(link);
+}
+
+void RelayNode::TryPair(RelayLink& link)
+{
+    bool release = false;
+
+    {
+        // 잠금 순서: 링크 -> pairing_lock_ (대기 링크의 잠금은 pairing_lock_을 놓은 뒤 획득)
+        CriticalSection::Lock self_lock(link.lock);
+
+        while (true)
+        {
+            PendingEntry waiting;
+            {
+                CriticalSection::Lock lock(pairing_lock_);
+
+                auto it = pending_.find(link.session_code);
+                if (it == pending_.end())
+                {
+                    pending_.emplace(link.session_code, PendingEntry{ &link, link.generation, std::chrono::steady_clock::now() });
+
+                    // 상대를 기다리는 동안 접속 종료를 감지하기 위해 수신을 걸어 둠 (짝이 지어지면 그대로 중계 수신이 됨)
+                    PostRecv(link);
+                    release = link.closing && link.pending_io == 0;
+                    break;
+                }
+
+                waiting = it->second;
+                pending_.erase(it);
+            }
+
+            CriticalSection::Lock waiting_lock(waiting.link->lock);
+
+            // 대기 목록에서 꺼낸 사이 종료/재사용되었으면 다음 대기자 확인
+            if (waiting.link->generation != waiting.generation || waiting.link->closing || waiting.link->peer)
+            {
+                continue;
+            }
+
+            Pair(*waiting.link, link);
+            break;
+        }
+    }
+
+    if (release)
+    {
+        ReleaseLink(link);
+    }
+}
+
+void RelayNode::Pair(RelayLink& waiting, RelayLink& joined)
+{
+    // 이후 두 링크의 완료 통지는 모두 waiting의 잠금으로 직렬화
+    joined.lock_owner = &waiting;
+    waiting.peer = &joined;
+    joined.peer = &waiting;
+
+    // 각 방향의 첫 송신으로 짝 성사 응답을 보내 이후 중계 데이터보다 먼저 도착하도록 함
+    waiting.notice.session_code = waiting.session_code;
+    waiting.notice.result = 1;
+    joined.notice.session_code = joined.session_code;
+    joined.notice.result = 1;
+
+    PushChunk(waiting, reinterpret_cast<const char*>(&waiting.notice), sizeof(RelayJoinPacket), -1);
+    PushChunk(joined, reinterpret_cast<const char*>(&joined.notice), sizeof(RelayJoinPacket), -1);
+
+    StartSend(waiting);
+    StartSend(joined);
+    PostRecv(joined);
+
+    pair_count_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void RelayNode::OnRecv(RelayLink& link, DWORD bytes)
+{
+    // 짝이 지어지기 전에 데이터를 보내면 규약 위반
+    if (!link.peer)
+    {
+        Close(link);
+        return;
+    }
+
+    const int slot = link.recv_slot;
+    link.recv_slot = -1;
+
+    PushChunk(link, link.GetSlot(slot), bytes, slot);
+
+    if (!link.sending)
+    {
+        StartSend(link);
+    }
+
+    PostRecv(link);
+}
+
+void RelayNode::OnSend(RelayLink& link, DWORD bytes)
+{
+    RelayChunk& chunk = link.chunks[link.chunk_head];
+    chunk.sent += bytes;
+    link.sending = false;
+
+    forwarded_bytes_.fetch_add(bytes, std::memory_order_relaxed);
+
+    // 일부만 전송된 경우 나머지 재전송
+    if (chunk.sent < chunk.size)
+    {
+        StartSend(link);
+        return;
+    }
+
+    if (chunk.slot >= 0)
+    {
+        link.busy_slots &= ~(1u << chunk.slot);
+    }
+
+    link.chunk_head = (link.chunk_head + 1) % link.chunks.size();
+    --link.chunk_count;
+
+    if (link.recv_stalled)
+    {
+        link.recv_stalled = false;
+        PostRecv(link);
+    }
+
+    if (link.chunk_count > 0 && !link.closing)
+    {
+        StartSend(link);
+    }
+}
+
+void RelayNode::PushChunk(RelayLink& link, const char* data, uint32_t size, int slot)
+{
+    // 슬롯 수 + 제어 패킷 1개를 넘지 않으므로 가득 차는 경우는 없음
+    const size_t tail = (link.chunk_head + link.chunk_count) % link.chunks.size();
+    link.chunks[tail] = RelayChunk{ data, size, 0, slot };
+    ++link.chunk_count;
+}
+
+void RelayNode::StartSend(RelayLink& link)
+{
+    if (link.sending || link.chunk_count == 0 || link.closing || !link.peer)
+    {
+        return;
+    }
+
+    RelayChunk& chunk = link.chunks[link.chunk_head];
+
+    WSABUF buf;
+    buf.buf = const_cast<char*>(chunk.data + chunk.sent);
+    buf.len = chunk.size - chunk.sent;
+
+    ZeroMemory(&link.send_io.overlapped, sizeof(WSAOVERLAPPED));
+    link.send_io.type = RelayIoType::Send;
+
+    // 받은 슬롯을 복사 없이 상대 소켓으로 전송
+    if (WSASend(link.peer->socket.get(), &buf, 1, nullptr, 0, &link.send_io.overlapped, nullptr) == SOCKET_ERROR &&
+        WSAGetLastError() != WSA_IO_PENDING)
+    {
+        Close(link);
+        return;
+    }
+
+    ++link.pending_io;
+    link.sending = true;
+}
+
+void RelayNode::PostRecv(RelayLink& link)
+{
+    if (link.closing || link.recv_slot >= 0)
+    {
+        return;
+    }
+
+    const uint32_t free_slots = ~link.busy_slots & ALL_SLOTS;
+    if (free_slots == 0)
+    {
+        // 상대가 느려 모든 슬롯이 송신 대기 중 (송신 완료 시 재개)
+        link.recv_stalled = true;
+        return;
+    }
+
+    const int slot = std::countr_zero(free_slots);
+
+    WSABUF buf;
+    buf.buf = link.GetSlot(slot);
+    buf.len = static_cast<ULONG>(Constants::Network::RELAY_SLOT_SIZE);
+
+    ZeroMemory(&link.recv_io.overlapped, sizeof(WSAOVERLAPPED));
+    link.recv_io.type = RelayIoType::Recv;
+
+    DWORD flags = 0;
+    if (WSARecv(link.socket.get(), &buf, 1, nullptr, &flags, &link.recv_io.overlapped, nullptr) == SOCKET_ERROR &&
+        WSAGetLastError() != WSA_IO_PENDING)
+    {
+        Close(link);
+        return;
+    }
+
+    link.busy_slots |= 1u << slot;
+    link.recv_slot = slot;
+    ++link.pending_io;
+}
+
+bool RelayNode::PostHandshakeRecv(RelayLink& link)
+{
+    WSABUF buf;
+    buf.buf = reinterpret_cast<char*>(&link.handshake) + link.handshake_received;
+    buf.len = static_cast<ULONG>(sizeof(RelayJoinPacket) - link.handshake_received);
+
+    ZeroMemory(&link.recv_io.overlapped, sizeof(WSAOVERLAPPED));
+    link.recv_io.type = RelayIoType::Handshake;
+
+    // 요청 크기만큼만 받아 짝이 지어지기 전의 데이터가 섞이지 않도록 함
+    DWORD flags = 0;
+    if (WSARecv(link.socket.get(), &buf, 1, nullptr, &flags, &link.recv_io.overlapped, nullptr) == SOCKET_ERROR &&
+        WSAGetLastError() != WSA_IO_PENDING)
+    {
+        return false;
+    }
+
+    ++link.pending_io;
+    return true;
+}
+
+void RelayNode::Close(RelayLink& link)
+{
+    if (link.closing)
+    {
+        return;
+    }
+
+    // 걸려 있는 I/O를 모두 취소하고, 소켓은 양쪽 완료 통지가 끝난 뒤 회수 시점에 닫음
+    link.closing = true;
+    CancelIoEx(reinterpret_cast<HANDLE>(link.socket.get()), nullptr);
+
+    if (link.peer)
+    {
+        if (!link.peer->closing)
+        {
+            link.peer->closing = true;
+            CancelIoEx(reinterpret_cast<HANDLE>(link.peer->socket.get()), nullptr);
+        }
+        return;
+    }
+
+    CriticalSection::Lock lock(pairing_lock_);
+
+    auto it = pending_.find(link.session_code);
+    if (it != pending_.end() && it->second.link == &link && it->second.generation == link.generation)
+    {
+        pending_.erase(it);
+    }
+}
+
+size_t RelayNode::CollectRelease(RelayLink& link, std::array<RelayLink*, 2>& out) const
+{
+    if (!link.closing || link.pending_io > 0)
+    {
+        return 0;
+    }
+
+    if (!link.peer)
+    {
+        out[0] = &link;
+        return 1;
+    }
+
+    if (!link.peer->closing || link.peer->pending_io > 0)
+    {
+        return 0;
+    }
+
+    out[0] = &link;
+    out[1] = link.peer;
+    return 2;
+}
+
+RelayLink* RelayNode::AcquireLink()
+{
+    RelayLink* link = nullptr;
+    {
+        CriticalSection::Lock lock(pool_lock_);
+
+        if (!free_links_.empty())
+        {
+            link = free_links_.back();
+            free_links_.pop_back();
+        }
+        else if (links_.size() < max_link_)
+        {
+            links_.push_back(std::make_unique<RelayLink>());
+            link = links_.back().get();
+            link->slots = std::make_unique<char[]>(Constants::Network::RELAY_SLOT_COUNT * Constants::Network::RELAY_SLOT_SIZE);
+        }
+    }
+
+    return link;
+}
+
+void RelayNode::ReleaseLink(RelayLink& link)
+{
+    {
+        CriticalSection::Lock lock(link.lock);
+
+        // 대기 목록에 남은 이전 항목이 회수된 링크를 가리키지 않도록 세대 증가
+        ++link.generation;
+
+        link.socket.close();
+        link.lock_owner = &link;
+        link.peer = nullptr;
+        link.session_code = 0;
+        link.pending_io = 0;
+        link.closing = false;
+        link.busy_slots = 0;
+        link.recv_slot = -1;
+        link.recv_stalled = false;
+        link.chunk_head = 0;
+        link.chunk_count = 0;
+        link.sending = false;
+        link.handshake = RelayJoinPacket{};
+        link.handshake_received = 0;
+        link.notice = RelayJoinPacket{};
+    }
+
+    CriticalSection::Lock lock(pool_lock_);
+    free_links_.push_back(&link);
+}
@@ -0,0 +1,166 @@
+#pragma once
+/*
+ *
+ * 설명: NAT 뒤의 P2P 호스트를 위한 중계 노드
+ *  1. 양쪽 피어가 나가는 연결로 접속해 RelayJoinPacket(session_code)을 보내면 같은 코드끼리 짝을 지음.
+ *  2. 짝이 지어진 뒤에는 패킷을 해석하지 않고 바이트 스트림을 그대로 전달.
+ *     수신 버퍼(슬롯)를 그대로 상대 소켓의 WSASend에 넘기므로 사용자 영역 복사가 없음.
+ *  3. 방향마다 슬롯 RELAY_SLOT_COUNT개를 돌려 쓰며, 모든 슬롯이 송신 대기 중이면 수신을 멈춰 느린 상대에 맞춤.
+ *  4. 짝 단위로 하나의 잠금(먼저 기다린 쪽 링크의 잠금)을 공유하고, 양쪽의 I/O가 모두 끝난 뒤 링크를 회수.
+ *
+ */
+
+#include "../network/NetCommon.hpp"
+#include "../network/CriticalSection.hpp"
+#include "../network/packets/GamePackets.hpp"
+#include "../core/common/constants/NetworkConstants.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+struct RelayLink;
+
+enum class RelayIoType : uint8_t
+{
+    Handshake,
+    Recv,
+    Send
+};
+
+struct RelayIo
+{
+    WSAOVERLAPPED overlapped{};     // 첫 멤버 (OVERLAPPED* -> RelayIo* 변환)
+    RelayLink* link{ nullptr };
+    RelayIoType type{ RelayIoType::Recv };
+};
+
+// 상대에게 보낼 데이터 조각 (slot이 -1이면 링크가 가진 제어 패킷)
+struct RelayChunk
+{
+    const char* data{ nullptr };
+    uint32_t size{ 0 };
+    uint32_t sent{ 0 };
+    int slot{ -1 };
+};
+
+// 접속 하나. 송신 상태는 "이 링크가 받은 데이터를 상대에게 보내는 방향" 기준
+struct RelayLink
+{
+    Socket socket;
+    CriticalSection lock;
+    RelayLink* lock_owner{ this };  // 짝이 지어지면 먼저 기다린 쪽의 잠금을 공유
+    RelayLink* peer{ nullptr };
+    uint32_t generation{ 0 };       // 회수 시 증가 (대기 목록의 오래된 항목 구분)
+    uint32_t session_code{ 0 };
+
+    RelayIo recv_io;
+    RelayIo send_io;
+    int pending_io{ 0 };
+    bool closing{ false };
+
+    std::unique_ptr<char[]> slots;  // RELAY_SLOT_COUNT * RELAY_SLOT_SIZE
+    uint32_t busy_slots{ 0 };       // 수신 중이거나 송신 대기 중인 슬롯 비트
+    int recv_slot{ -1 };
+    bool recv_stalled{ false };
+
+    std::array<RelayChunk, Constants::Network::RELAY_SLOT_COUNT + 1> chunks{};
+    size_t chunk_head{ 0 };
+    size_t chunk_count{ 0 };
+    bool sending{ false };
+
+    RelayJoinPacket handshake;      // 접속 직후 수신하는 요청
+    uint32_t handshake_received{ 0 };
+    RelayJoinPacket notice;         // 상대에게 보내는 짝 성사 응답
+
+    RelayLink()
+    {
+        recv_io.link = this;
+        send_io.link = this;
+    }
+
+    [[nodiscard]] char* GetSlot(int index) { return slots.get() + static_cast<size_t>(index) * Constants::Network::RELAY_SLOT_SIZE; }
+};
+
+struct RelayStats
+{
+    size_t link_count{ 0 };
+    size_t pending_count{ 0 };
+    size_t pair_count{ 0 };
+    uint64_t forwarded_bytes{ 0 };
+};
+
+class RelayNode
+{
+public:
+    // worker_count가 0이면 하드웨어 스레드 수 사용
+    explicit RelayNode(size_t max_link = Constants::Network::RELAY_MAX_LINK, size_t worker_count = 0);
+    ~RelayNode();
+
+    RelayNode(const RelayNode&) = delete;
+    RelayNode& operator=(const RelayNode&) = delete;
+
+    [[nodiscard]] bool Start(uint16_t port = Constants::Network::RELAY_PORT);
+    void Stop();
+
+    // 메인 스레드: 짝을 찾지 못하고 오래 기다린 링크 정리
+    void Update();
+
+    [[nodiscard]] RelayStats GetStats();
+
+private:
+    struct PendingEntry
+    {
+        RelayLink* link{ nullptr };
+        uint32_t generation{ 0 };
+        std::chrono::steady_clock::time_point join_time{};
+    };
+
+    void AcceptLoop();
+    void WorkerLoop();
+
+    void HandleCompletion(RelayIo& io, DWORD bytes, bool success);
+    void HandleHandshake(RelayLink& link, DWORD bytes, bool success);
+    void TryPair(RelayLink& link);
+    void Pair(RelayLink& waiting, RelayLink& joined);
+
+    // 아래 함수들은 짝의 잠금을 잡은 상태에서 호출
+    void OnRecv(RelayLink& link, DWORD bytes);
+    void OnSend(RelayLink& link, DWORD bytes);
+    void PushChunk(RelayLink& link, const char* data, uint32_t size, int slot);
+    void StartSend(RelayLink& link);
+    void PostRecv(RelayLink& link);
+    [[nodiscard]] bool PostHandshakeRecv(RelayLink& link);
+    void Close(RelayLink& link);
+    [[nodiscard]] size_t CollectRelease(RelayLink& link, std::array<RelayLink*, 2>& out) const;
+
+    [[nodiscard]] RelayLink* AcquireLink();
+    void ReleaseLink(RelayLink& link);
+
+private:
+    WSASession wsa_session_;
+    Socket listen_socket_;
+    HANDLE iocp_handle_{ nullptr };
+
+    size_t max_link_{ 0 };
+    size_t worker_count_{ 0 };
+    std::thread accept_thread_;
+    std::vector<std::thread> worker_threads_;
+    std::atomic<bool> running_{ false };
+
+    CriticalSection pool_lock_;
+    std::vector<std::unique_ptr<RelayLink>> links_;
+    std::vector<RelayLink*> free_links_;
+
+    CriticalSection pairing_lock_;
+    std::unordered_map<uint32_t, PendingEntry> pending_;
+    std::chrono::steady_clock::time_point next_sweep_time_{};
+
+    std::atomic<size_t> pair_count_{ 0 };
+    std::atomic<uint64_t> forwarded_bytes_{ 0 };
+};
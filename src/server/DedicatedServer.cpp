@@ -0,0 +1,758 @@
+#include "DedicatedServer.hpp"
+#include "../network/packets/GamePackets.hpp"
+#include "../utils/Logger.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+#include <variant>
+
+namespace
+{
+    size_t ResolveShardCount(size_t shard_count)
+    {
+        if (shard_count > 0)
+        {
+            return shard_count;
+        }
+
+        // IOCP 워커와 라우터 스레드 몫을 남겨 둠
+        const size_t hardware = std::thread::hardware_concurrency();
+        return hardware > 2 ? hardware - 2 : 1;
+    }
+}
+
+DedicatedServer::DedicatedServer(size_t max_client, size_t shard_count) :
+    NetServer(max_client),
+    room_manager_(ResolveShardCount(shard_count)),
+    timer_epoch_(std::chrono::steady_clock::now()),
+    idle_timers_(Constants::Network::SERVER_TIMER_TICK)
+{
+    sessions_.Reserve(max_client);
+    idle_timers_.Reserve(max_client);
+
+    const size_t count = ResolveShardCount(shard_count);
+    shards_.reserve(count);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        shards_.push_back(std::make_unique<RoomShard>(static_cast<uint16_t>(i), *this));
+    }
+}
+
+DedicatedServer::~DedicatedServer()
+{
+    Stop();
+}
+
+bool DedicatedServer::Start()
+{
+    SetSendCork(Constants::Network::SEND_CORK_ENABLED);
+
+    for (auto& shard : shards_)
+    {
+        shard->Start();
+    }
+
+    if (NetServer::StartServer() == false)
+    {
+        LOGGER.Error("DedicatedServer start failed");
+        Stop();
+        return false;
+    }
+
+    next_balance_time_ = std::chrono::steady_clock::now() + std::chrono::milliseconds(Constants::Network::SHARD_BALANCE_INTERVAL);
+
+    LOGGER.Info("DedicatedServer started. port: {}, max client: {}, shards: {}", Constants::Network::NET_PORT, GetMaxClient(), shards_.size());
+    return true;
+}
+
+void DedicatedServer::Stop()
+{
+    NetServer::ExitServer();
+
+    // 더 이상 이벤트가 들어오지 않으므로 샤드를 정지하고 방 데이터 정리
+    for (auto& shard : shards_)
+    {
+        shard->Stop();
+    }
+
+    sessions_.Clear();
+    room_manager_.Release();
+    matchmaker_.Clear();
+    match_pairs_.clear();
+    flush_clients_.clear();
+    idle_timers_.Clear();
+
+    ServerEvent event;
+    while (event_queue_.try_pop(event)) {}
+}
+
+void DedicatedServer::Update()
+{
+    now_ms_ = GetElapsedMs();
+
+    ServerEvent event;
+    while (event_queue_.try_pop(event))
+    {
+        switch (event.event_type)
+        {
+        case ServerEvent::Type::Connect:
+            HandleConnect(event);
+            break;
+
+        case ServerEvent::Type::Packet:
+            HandlePacket(event);
+            break;
+
+        case ServerEvent::Type::Disconnect:
+            HandleDisconnect(event);
+            break;
+        }
+    }
+
+    DrainShardResults();
+    UpdateMatchmaking();
+    BalanceShards();
+    UpdateTimers();
+
+    for (auto& shard : shards_)
+    {
+        shard->PumpOverflow();
+    }
+
+    // 방 안의 패킷은 각 샤드가 플러시하고, 라우터는 직접 보낸 패킷만 플러시
+    for (ClientInfo* client : flush_clients_)
+    {
+        if (FlushClient(client) == false)
+        {
+            LOGGER.Warning("Router flush failed");
+        }
+    }
+
+    flush_clients_.clear();
+}
+
+void DedicatedServer::LogShardStats() const
+{
+    for (const auto& shard : shards_)
+    {
+        LOGGER.Info("shard {}: rooms {}, processed {}", shard->GetIndex(), room_manager_.GetShardRoomCount(shard->GetIndex()), shard->GetProcessedCount());
+    }
+
+    LOGGER.Info("matchmaking queue: {}", matchmaker_.GetQueuedCount());
+}
+
+bool DedicatedServer::ConnectProcess(ClientInfo* client)
+{
+    event_queue_.push(ServerEvent(ServerEvent::Type::Connect, client));
+    return true;
+}
+
+bool DedicatedServer::DisconnectProcess(ClientInfo* client)
+{
+    // 워커(송수신 실패)와 라우터(세션 만료, 테이블 초과)가 동시에 끊어도 한 번만 처리
+    if (!ClaimClose(client))
+    {
+        return false;
+    }
+
+    // 소켓을 닫기 전에 이벤트를 적재해야 슬롯 재사용 시 connection_id로 구분 가능
+    event_queue_.push(ServerEvent(ServerEvent::Type::Disconnect, client));
+    CloseSocket(client);
+
+    return true;
+}
+
+bool DedicatedServer::PacketProcess(ClientInfo* client, std::span<const char> packet, const DecodedPacket& decoded)
+{
+    event_queue_.push(ServerEvent(ServerEvent::Type::Packet, client, packet, decoded));
+    return true;
+}
+
+void DedicatedServer::HandleConnect(const ServerEvent& event)
+{
+    Session session;
+    session.client = event.client_info;
+    session.connection_id = event.connection_id;
+    session.auto_join = true;
+
+    const SlotId session_id = sessions_.Insert(session);
+    Session* inserted = sessions_.Find(session_id);
+    if (!inserted)
+    {
+        LOGGER.Warning("Session table full. connection: {}", event.connection_id);
+        DisconnectProcess(event.client_info);
+        return;
+    }
+
+    inserted->session_id = session_id;
+    inserted->last_activity = now_ms_;
+    inserted->idle_timer = idle_timers_.Schedule(Constants::Network::SESSION_IDLE_TIMEOUT, session_id);
+    event.client_info->session_id = session_id;
+
+    // 방 지정 없이 접속한 기존 클라이언트를 위해 참가 가능한 방에 자동 배정
+    if (JoinRoom(event.client_info, *inserted, FindOrCreateJoinableRoom()) == false)
+    {
+        LOGGER.Warning("Auto join failed. session: {}", session_id);
+    }
+}
+
+void DedicatedServer::HandleDisconnect(const ServerEvent& event)
+{
+    Session* session = FindSession(event);
+    if (!session)
+    {
+        return;
+    }
+
+    matchmaker_.Cancel(session->session_id);
+    idle_timers_.Cancel(session->idle_timer);
+    LeaveRoom(event.client_info, *session);
+
+    sessions_.Erase(session->session_id);
+    event.client_info->session_id = INVALID_SLOT_ID;
+}
+
+void DedicatedServer::HandlePacket(ServerEvent& event)
+{
+    Session* session = FindSession(event);
+    if (!session || event.packet_data.size() < sizeof(PacketBase))
+    {
+        return;
+    }
+
+    // 유휴 타이머는 다시 예약하지 않고 만료 시점에 마지막 수신 시각으로 판단
+    session->last_activity = now_ms_;
+
+    // 크기/범위 검사는 FilterPacket에서 끝났으므로 분기용 타입만 읽음
+    PacketBase header{};
+    std::memcpy(&header, event.packet_data.data(), sizeof(PacketBase));
+
+    const auto packet_type = static_cast<PacketType>(header.type);
+
+    switch (packet_type)
+    {
+    case PacketType::CreateRoom:
+    case PacketType::JoinRoom:
+    case PacketType::LeaveRoom:
+    case PacketType::QueueMatch:
+        HandleRoomRequest(event.client_info, *session, packet_type, event.packet);
+        break;
+
+    default:
+        // 세션이 속한 방의 샤드로 라우팅 (패킷 버퍼는 복사 없이 이동)
+        if (RoomEntry* entry = room_manager_.FindRoom(session->room_id))
+        {
+            ShardMessage message;
+            message.type = ShardMessage::Type::Packet;
+            message.room_id = entry->room_id;
+            message.client = event.client_info;
+            message.connection_id = session->connection_id;
+            message.session_id = session->session_id;
+            message.packet_data = std::move(event.packet_data);
+            message.packet = std::move(event.packet);
+
+            PostToRoom(*entry, std::move(message));
+        }
+        break;
+    }
+}
+
+void DedicatedServer::HandleRoomRequest(ClientInfo* client, Session& session, PacketType type, const DecodedPacket& packet)
+{
+    // 방을 직접 고르면 매치메이킹 대기는 취소
+    if (type != PacketType::QueueMatch)
+    {
+        matchmaker_.Cancel(session.session_id);
+    }
+
+    switch (type)
+    {
+    case PacketType::CreateRoom:
+    {
+        LeaveRoom(client, session);
+
+        session.auto_join = false;
+        RoomEntry* entry = CreateRoom();
+        if (JoinRoom(client, session, entry) == false)
+        {
+            SendJoinResult(session, 0, false);
+        }
+        break;
+    }
+
+    case PacketType::JoinRoom:
+    {
+        const auto* request = std::get_if<JoinRoomPacket>(&packet);
+        if (!request)
+        {
+            return;
+        }
+
+        if (request->room_id != 0 && request->room_id == session.room_id)
+        {
+            SendJoinResult(session, session.room_id, true);
+            return;
+        }
+
+        LeaveRoom(client, session);
+
+        session.auto_join = false;
+        RoomEntry* entry = request->room_id == 0 ? FindOrCreateJoinableRoom() : room_manager_.FindRoom(request->room_id);
+        if (JoinRoom(client, session, entry) == false)
+        {
+            SendJoinResult(session, request->room_id, false);
+        }
+        break;
+    }
+
+    case PacketType::LeaveRoom:
+        LeaveRoom(client, session);
+        break;
+
+    case PacketType::QueueMatch:
+    {
+        const auto* request = std::get_if<QueueMatchPacket>(&packet);
+        if (!request)
+        {
+            return;
+        }
+
+        if (request->cancel != 0)
+        {
+            matchmaker_.Cancel(session.session_id);
+            return;
+        }
+
+        // 대기 중에는 자동 배정된 방에서 빠져 있음 (결과는 매치 성사 시 JoinRoomPacket으로 전달)
+        LeaveRoom(client, session);
+        session.auto_join = false;
+
+        const uint16_t rating = request->rating != 0 ? request->rating : Constants::Network::MATCH_DEFAULT_RATING;
+        matchmaker_.Enqueue(session.session_id, rating, std::chrono::steady_clock::now(), match_pairs_);
+
+        // 즉시 성사된 매치는 바로 시작. 틱 끝까지 미루면 그 사이 같은 세션의 CreateRoom/JoinRoom이
+        // 이미 빠진 티켓을 취소하지 못해 방에 들어간 뒤 매치 방으로 다시 참가하게 됨
+        StartPendingMatches();
+        break;
+    }
+
+    default:
+        break;
+    }
+}
+
+void DedicatedServer::DrainShardResults()
+{
+    ShardResult result;
+
+    for (auto& shard : shards_)
+    {
+        while (shard->TryPopResult(result))
+        {
+            switch (result.type)
+            {
+            case ShardResult::Type::Joined:
+            case ShardResult::Type::JoinFailed:
+                HandleJoinResult(result);
+                break;
+
+            case ShardResult::Type::StateChanged:
+                if (RoomEntry* entry = room_manager_.FindRoom(result.room_id))
+                {
+                    room_manager_.SetWaiting(*entry, result.joinable);
+                }
+                break;
+
+            case ShardResult::Type::RoomDetached:
+                HandleRoomDetached(result);
+                break;
+
+            default:
+                break;
+            }
+        }
+    }
+}
+
+void DedicatedServer::HandleJoinResult(ShardResult& result)
+{
+    // 세대가 다르면 이미 종료된 세션 (슬롯이 재사용되어도 조회되지 않음)
+    Session* session = sessions_.Find(result.session_id);
+
+    // 참가 요청 이후 다른 방으로 옮겼거나 접속이 끊긴 경우 (Leave는 이미 전달됨)
+    if (!session || session->room_id != result.room_id)
+    {
+        return;
+    }
+
+    if (result.type == ShardResult::Type::Joined)
+    {
+        session->player_id = result.player_id;
+        session->join_retry = 0;
+
+        if (!session->auto_join)
+        {
+            SendJoinResult(*session, result.room_id, true);
+        }
+        return;
+    }
+
+    // 라우터가 예상한 것과 달리 방이 꽉 찼거나 게임 중이었던 경우
+    if (RoomEntry* entry = room_manager_.FindRoom(result.room_id))
+    {
+        RemoveMember(*entry);
+    }
+
+    session->room_id = 0;
+    session->player_id = 0;
+
+    if (session->auto_join && session->join_retry < Constants::Network::MAX_AUTO_JOIN_RETRY)
+    {
+        ++session->join_retry;
+        if (JoinRoom(session->client, *session, FindOrCreateJoinableRoom()))
+        {
+            return;
+        }
+    }
+
+    if (session->auto_join)
+    {
+        LOGGER.Warning("Auto join failed. session: {}", result.session_id);
+    }
+    else
+    {
+        SendJoinResult(*session, result.room_id, false);
+    }
+}
+
+void DedicatedServer::HandleRoomDetached(ShardResult& result)
+{
+    RoomEntry* entry = room_manager_.FindRoom(result.room_id);
+    if (!entry || !result.room || result.target_shard >= shards_.size())
+    {
+        return;
+    }
+
+    RoomShard& target = *shards_[result.target_shard];
+
+    ShardMessage adopt;
+    adopt.type = ShardMessage::Type::AdoptRoom;
+    adopt.room_id = result.room_id;
+    adopt.room = std::move(result.room);
+    target.Post(std::move(adopt));
+
+    // 이관 중에 쌓인 메시지를 원래 순서대로 새 샤드에 전달
+    for (auto& message : entry->pending)
+    {
+        target.Post(std::move(message));
+    }
+
+    entry->pending.clear();
+    room_manager_.EndMigration(*entry, result.target_shard);
+
+    if (entry->member_count == 0)
+    {
+        ShardMessage destroy;
+        destroy.type = ShardMessage::Type::DestroyRoom;
+        destroy.room_id = entry->room_id;
+        target.Post(std::move(destroy));
+
+        room_manager_.RemoveRoom(result.room_id);
+    }
+}
+
+void DedicatedServer::BalanceShards()
+{
+    const auto now = std::chrono::steady_clock::now();
+    if (shards_.size() < 2 || now < next_balance_time_)
+    {
+        return;
+    }
+
+    next_balance_time_ = now + std::chrono::milliseconds(Constants::Network::SHARD_BALANCE_INTERVAL);
+
+    uint16_t target_shard = 0;
+    RoomEntry* entry = room_manager_.BeginMigration(target_shard);
+    if (!entry)
+    {
+        return;
+    }
+
+    ShardMessage detach;
+    detach.type = ShardMessage::Type::DetachRoom;
+    detach.room_id = entry->room_id;
+    detach.target_shard = target_shard;
+    shards_[entry->shard]->Post(std::move(detach));
+
+    LOGGER.Info("Room {} migrating. shard {} -> {}", entry->room_id, entry->shard, target_shard);
+}
+
+void DedicatedServer::UpdateMatchmaking()
+{
+    // 허용 범위 확장으로 성사된 매치 (Enqueue에서 즉시 성사된 매치는 요청 처리 중에 시작)
+    matchmaker_.Update(std::chrono::steady_clock::now(), match_pairs_);
+    StartPendingMatches();
+}
+
+void DedicatedServer::StartPendingMatches()
+{
+    // StartMatch가 남은 세션을 다시 등록하면서 새 매치가 추가될 수 있으므로 인덱스로 순회
+    for (size_t index = 0; index < match_pairs_.size(); ++index)
+    {
+        const MatchPair pair = match_pairs_[index];
+        StartMatch(pair);
+    }
+
+    match_pairs_.clear();
+}
+
+void DedicatedServer::StartMatch(const MatchPair& pair)
+{
+    // 대기열의 세션은 종료/방 선택 시 취소되므로 여기서는 항상 유효해야 함
+    Session* first = sessions_.Find(pair.first);
+    Session* second = sessions_.Find(pair.second);
+    if (!first || !second)
+    {
+        LOGGER.Warning("Match dropped. session: {}, {}", pair.first, pair.second);
+
+        // 남은 쪽은 대기열에서 빠진 상태이므로 기다린 시간을 유지한 채 다시 등록
+        const auto now = std::chrono::steady_clock::now();
+        if (first)
+        {
+            matchmaker_.Enqueue(pair.first, pair.first_rating, now - pair.first_wait, match_pairs_);
+        }
+        else if (second)
+        {
+            matchmaker_.Enqueue(pair.second, pair.second_rating, now - pair.second_wait, match_pairs_);
+        }
+        return;
+    }
+
+    // 매치 대상은 대기 등록 시 방에서 빠졌지만, 남아 있으면 room_id를 덮어써 이전 방의 인원이 남지 않도록 먼저 퇴장
+    LeaveRoom(first->client, *first);
+    LeaveRoom(second->client, *second);
+
+    RoomEntry* entry = CreateRoom();
+    if (!entry)
+    {
+        SendJoinResult(*first, 0, false);
+        SendJoinResult(*second, 0, false);
+        return;
+    }
+
+    // 참가 결과(JoinRoomPacket)는 샤드 결과를 받은 뒤 각 세션에 전송
+    // 한쪽만 들어가면 대전이 성립하지 않으므로 먼저 들어간 쪽을 되돌리고 둘 다 실패로 알림
+    // (먼저 보낸 참가의 샤드 결과는 room_id가 달라져 HandleJoinResult에서 무시됨)
+    const uint32_t room_id = entry->room_id;
+    if (JoinRoom(first->client, *first, entry) == false)
+    {
+        LOGGER.Warning("Match join failed. room: {}", room_id);
+        RemoveMember(*entry);   // 아무도 들어가지 않은 새 방 정리
+        SendJoinResult(*first, room_id, false);
+        SendJoinResult(*second, room_id, false);
+        return;
+    }
+
+    if (JoinRoom(second->client, *second, entry) == false)
+    {
+        LOGGER.Warning("Match join failed. room: {}", room_id);
+        LeaveRoom(first->client, *first);
+        SendJoinResult(*first, room_id, false);
+        SendJoinResult(*second, room_id, false);
+        return;
+    }
+
+    LOGGER.Info("Match started. room: {}, rating: {} vs {}", entry->room_id, pair.first_rating, pair.second_rating);
+}
+
+void DedicatedServer::UpdateTimers()
+{
+    const auto now = std::chrono::steady_clock::now();
+    if (now >= next_shard_tick_time_)
+    {
+        next_shard_tick_time_ = now + std::chrono::milliseconds(Constants::Network::SHARD_TICK_INTERVAL);
+
+        for (auto& shard : shards_)
+        {
+            ShardMessage tick;
+            tick.type = ShardMessage::Type::Tick;
+            shard->Post(std::move(tick));
+        }
+    }
+
+    expired_sessions_.clear();
+    idle_timers_.Advance(now_ms_, expired_sessions_);
+
+    for (const SlotId session_id : expired_sessions_)
+    {
+        ExpireIdleSession(session_id);
+    }
+}
+
+void DedicatedServer::ExpireIdleSession(SlotId session_id)
+{
+    // 종료된 세션의 타이머는 취소되지만, 세대가 다르면 조회되지 않으므로 함께 걸러짐
+    Session* session = sessions_.Find(session_id);
+    if (!session)
+    {
+        return;
+    }
+
+    session->idle_timer = INVALID_TIMER_ID;
+
+    const uint64_t timeout = Constants::Network::SESSION_IDLE_TIMEOUT;
+    const uint64_t idle_time = now_ms_ - std::min(session->last_activity, now_ms_);
+    if (idle_time < timeout)
+    {
+        session->idle_timer = idle_timers_.Schedule(timeout - idle_time, session_id);
+        return;
+    }
+
+    LOGGER.Info("Session {} idle timeout", session_id);
+
+    // 세션 정리는 Disconnect 이벤트에서 처리
+    DisconnectProcess(session->client);
+}
+
+uint64_t DedicatedServer::GetElapsedMs() const
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - timer_epoch_).count());
+}
+
+Session* DedicatedServer::FindSession(const ServerEvent& event)
+{
+    if (!event.client_info)
+    {
+        return nullptr;
+    }
+
+    Session* session = sessions_.Find(event.client_info->session_id);
+    if (!session || session->client != event.client_info || session->connection_id != event.connection_id)
+    {
+        // 이미 종료되었거나 ClientInfo 슬롯이 다른 접속에 재사용된 경우
+        return nullptr;
+    }
+
+    return session;
+}
+
+RoomEntry* DedicatedServer::CreateRoom()
+{
+    RoomEntry* entry = room_manager_.CreateRoom();
+    if (!entry)
+    {
+        return nullptr;
+    }
+
+    ShardMessage message;
+    message.type = ShardMessage::Type::CreateRoom;
+    message.room_id = entry->room_id;
+    shards_[entry->shard]->Post(std::move(message));
+
+    return entry;
+}
+
+RoomEntry* DedicatedServer::FindOrCreateJoinableRoom()
+{
+    // 참가 가능한 방을 찾고 없으면 새로 생성
+    if (RoomEntry* entry = room_manager_.FindJoinableRoom())
+    {
+        return entry;
+    }
+
+    return CreateRoom();
+}
+
+bool DedicatedServer::JoinRoom(ClientInfo* client, Session& session, RoomEntry* entry)
+{
+    if (!entry)
+    {
+        return false;
+    }
+
+    // 결과는 샤드에서 비동기로 돌아오지만 이후 패킷이 같은 방으로 가도록 즉시 기록
+    room_manager_.AddMember(*entry);
+    session.room_id = entry->room_id;
+    session.player_id = 0;
+
+    ShardMessage message;
+    message.type = ShardMessage::Type::Join;
+    message.room_id = entry->room_id;
+    message.client = client;
+    message.connection_id = session.connection_id;
+    message.session_id = session.session_id;
+
+    PostToRoom(*entry, std::move(message));
+    return true;
+}
+
+void DedicatedServer::LeaveRoom(ClientInfo* client, Session& session)
+{
+    if (session.room_id == 0)
+    {
+        return;
+    }
+
+    if (RoomEntry* entry = room_manager_.FindRoom(session.room_id))
+    {
+        ShardMessage message;
+        message.type = ShardMessage::Type::Leave;
+        message.room_id = entry->room_id;
+        message.client = client;
+        message.connection_id = session.connection_id;
+        message.session_id = session.session_id;
+
+        PostToRoom(*entry, std::move(message));
+        RemoveMember(*entry);
+    }
+
+    session.room_id = 0;
+    session.player_id = 0;
+}
+
+void DedicatedServer::RemoveMember(RoomEntry& entry)
+{
+    room_manager_.RemoveMember(entry);
+
+    // 이관 중인 방은 이관이 끝난 뒤 HandleRoomDetached에서 정리
+    if (entry.member_count > 0 || entry.migrating)
+    {
+        return;
+    }
+
+    ShardMessage destroy;
+    destroy.type = ShardMessage::Type::DestroyRoom;
+    destroy.room_id = entry.room_id;
+    shards_[entry.shard]->Post(std::move(destroy));
+
+    room_manager_.RemoveRoom(entry.room_id);
+}
+
+void DedicatedServer::PostToRoom(RoomEntry& entry, ShardMessage&& message)
+{
+    if (entry.migrating)
+    {
+        entry.pending.push_back(std::move(message));
+        return;
+    }
+
+    shards_[entry.shard]->Post(std::move(message));
+}
+
+void DedicatedServer::SendJoinResult(const Session& session, uint32_t room_id, bool success)
+{
+    JoinRoomPacket packet;
+    packet.room_id = room_id;
+    packet.result = success ? 1 : 0;
+
+    // 종료 이벤트를 처리하기 전에 슬롯이 새 접속에 재사용됐을 수 있으므로 connection_id로 확인
+    if (SendMsg(session.client, std::span<const char>(reinterpret_cast<const char*>(&packet), packet.size), session.connection_id) == false)
+    {
+        LOGGER.Warning("SendJoinResult failed. room: {}", room_id);
+        return;
+    }
+
+    flush_clients_.push_back(session.client);
+}
@@ -0,0 +1,141 @@
+#pragma once
+/*
+ *
+ * 설명: 창/렌더러 없이 동작하는 전용 서버
+ *  1. IOCP 스레드는 이벤트를 큐에 적재만 하고, Update(라우터 스레드)가 세션과 방 디렉터리를 단독 소유.
+ *     세션은 32비트 세션 id(슬롯 인덱스 + 세대)로 식별하므로 종료된 세션에 대한 늦은 샤드 결과는 조회에서 걸러짐.
+ *  2. 방 로직은 코어별로 고정된 RoomShard 스레드에서 처리. 라우터는 세션이 속한 방의 샤드로 메시지를 전달.
+ *  3. 샤드 간 방 개수가 벌어지면 방을 분리/재등록하는 방식으로 이관 (이관 중 메시지는 보관 후 순서대로 재전달).
+ *  4. QueueMatch 요청은 레이팅 대기열(Matchmaker)에 등록하고, 성사되면 새 방을 만들어 두 세션을 참가시킴.
+ *  5. 세션 유휴 타임아웃은 라우터의 타이밍 휠로 관리. 수신 시각만 기록하고, 만료 시 남은 시간이 있으면 다시 예약.
+ *
+ */
+
+#include "Matchmaker.hpp"
+#include "RoomManager.hpp"
+#include "RoomShard.hpp"
+#include "../network/NetServer.hpp"
+#include "../utils/SlotMap.hpp"
+#include "../utils/TimingWheel.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <concurrent_queue.h>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+struct ServerEvent
+{
+    enum class Type : uint8_t
+    {
+        Connect,
+        Packet,
+        Disconnect
+    };
+
+    Type event_type{ Type::Packet };
+    ClientInfo* client_info{ nullptr };
+    uint32_t connection_id{ 0 };
+    std::vector<char> packet_data;  // 수신 링버퍼가 재사용되므로 복사해서 보관 (방으로 그대로 중계)
+    DecodedPacket packet;           // FilterPacket에서 검사/디코딩된 값
+
+    ServerEvent() = default;
+
+    ServerEvent(Type type, ClientInfo* client, std::span<const char> data = {}, const DecodedPacket& decoded = {})
+        : event_type(type), client_info(client), connection_id(client ? client->connection_id : 0), packet_data(data.begin(), data.end()), packet(decoded) {
+    }
+};
+
+struct Session
+{
+    SlotId session_id{ INVALID_SLOT_ID };
+    ClientInfo* client{ nullptr };
+    uint32_t connection_id{ 0 };
+    uint32_t room_id{ 0 };
+    uint8_t player_id{ 0 };
+    bool auto_join{ false };    // 접속 시 자동 배정 (실패 시 다른 방으로 재시도, 결과 패킷 없음)
+    int join_retry{ 0 };
+    uint64_t last_activity{ 0 };            // 마지막 수신 시각(ms)
+    TimerId idle_timer{ INVALID_TIMER_ID };
+};
+
+class DedicatedServer final : public NetServer
+{
+public:
+    // shard_count가 0이면 하드웨어 스레드 수에서 IOCP/라우터 몫을 뺀 값 사용
+    explicit DedicatedServer(size_t max_client = Constants::Network::DEDICATED_MAX_CLIENT, size_t shard_count = 0);
+    ~DedicatedServer() override;
+
+    DedicatedServer(const DedicatedServer&) = delete;
+    DedicatedServer& operator=(const DedicatedServer&) = delete;
+
+    [[nodiscard]] bool Start();
+    void Stop();
+    void Update();
+
+    [[nodiscard]] size_t GetSessionCount() const { return sessions_.Size(); }
+    [[nodiscard]] size_t GetRoomCount() const { return room_manager_.GetRoomCount(); }
+    [[nodiscard]] size_t GetShardCount() const { return shards_.size(); }
+
+    void LogShardStats() const;
+
+protected:
+    // NetServer 인터페이스 구현
+    bool ConnectProcess(ClientInfo* client) override;
+    bool DisconnectProcess(ClientInfo* client) override;
+    bool PacketProcess(ClientInfo* client, std::span<const char> packet, const DecodedPacket& decoded) override;
+
+private:
+    void HandleConnect(const ServerEvent& event);
+    void HandleDisconnect(const ServerEvent& event);
+    void HandlePacket(ServerEvent& event);
+    void HandleRoomRequest(ClientInfo* client, Session& session, PacketType type, const DecodedPacket& packet);
+
+    // 샤드 결과 처리
+    void DrainShardResults();
+    void HandleJoinResult(ShardResult& result);
+    void HandleRoomDetached(ShardResult& result);
+    void BalanceShards();
+
+    // 매치메이킹
+    void UpdateMatchmaking();
+    void StartPendingMatches();
+    void StartMatch(const MatchPair& pair);
+
+    // 타이머 (세션 유휴 타임아웃, 샤드 Tick)
+    void UpdateTimers();
+    void ExpireIdleSession(SlotId session_id);
+    [[nodiscard]] uint64_t GetElapsedMs() const;
+
+    [[nodiscard]] Session* FindSession(const ServerEvent& event);
+    [[nodiscard]] RoomEntry* CreateRoom();
+    [[nodiscard]] RoomEntry* FindOrCreateJoinableRoom();
+    [[nodiscard]] bool JoinRoom(ClientInfo* client, Session& session, RoomEntry* entry);
+    void LeaveRoom(ClientInfo* client, Session& session);
+    void RemoveMember(RoomEntry& entry);
+    void PostToRoom(RoomEntry& entry, ShardMessage&& message);
+    void SendJoinResult(const Session& session, uint32_t room_id, bool success);
+
+private:
+    Concurrency::concurrent_queue<ServerEvent> event_queue_{};
+    SlotMap<Session> sessions_{};
+
+    std::vector<std::unique_ptr<RoomShard>> shards_;
+    RoomManager room_manager_;
+
+    Matchmaker matchmaker_;
+    std::vector<MatchPair> match_pairs_;    // 성사된 매치 (같은 이벤트/Update 안에서 바로 비움)
+
+    // 라우터가 직접 보낸 패킷의 수신자 (틱 끝에서 플러시)
+    std::vector<ClientInfo*> flush_clients_;
+    std::chrono::steady_clock::time_point next_balance_time_{};
+
+    std::chrono::steady_clock::time_point timer_epoch_{};
+    std::chrono::steady_clock::time_point next_shard_tick_time_{};
+    uint64_t now_ms_{ 0 };                  // 이번 Update 시작 시각 (timer_epoch_ 기준)
+    TimingWheel<SlotId> idle_timers_;
+    std::vector<SlotId> expired_sessions_;
+};
@@ -0,0 +1,200 @@
+#include "Matchmaker.hpp"
+
+#include <algorithm>
+
+bool Matchmaker::Enqueue(SlotId session_id, uint16_t rating, Clock::time_point now, std::vector<MatchPair>& out)
+{
+    if (session_id == INVALID_SLOT_ID)
+    {
+        return false;
+    }
+
+    // 다시 요청하면 기존 티켓을 버리고 새로 대기
+    Cancel(session_id);
+
+    Ticket ticket;
+    ticket.session_id = session_id;
+    ticket.rating = std::min(rating, Constants::Network::MATCH_MAX_RATING);
+    ticket.seq = next_seq_++;
+    ticket.enqueue_time = now;
+
+    if (const Ticket* partner = FindPartner(ticket, GetWindow(ticket, now)))
+    {
+        const Ticket matched = *partner;
+        Remove(matched);
+        tickets_.erase(matched.session_id);
+
+        EmitPair(matched, ticket, now, out);
+        return true;
+    }
+
+    tickets_.emplace(session_id, ticket);
+    Insert(ticket);
+    ScheduleRetry(ticket, now);
+
+    return false;
+}
+
+bool Matchmaker::Cancel(SlotId session_id)
+{
+    auto it = tickets_.find(session_id);
+    if (it == tickets_.end())
+    {
+        return false;
+    }
+
+    // 재시도 예약은 seq가 달라지므로 Update에서 무시됨
+    Remove(it->second);
+    tickets_.erase(it);
+
+    return true;
+}
+
+void Matchmaker::Update(Clock::time_point now, std::vector<MatchPair>& out)
+{
+    while (!retries_.empty() && retries_.top().time <= now)
+    {
+        const Retry retry = retries_.top();
+        retries_.pop();
+
+        auto it = tickets_.find(retry.session_id);
+        if (it == tickets_.end() || it->second.seq != retry.seq)
+        {
+            continue;
+        }
+
+        const Ticket ticket = it->second;
+
+        // 자기 자신이 검색되지 않도록 잠시 빼 두고 검색
+        Remove(ticket);
+
+        if (const Ticket* partner = FindPartner(ticket, GetWindow(ticket, now)))
+        {
+            const Ticket matched = *partner;
+            Remove(matched);
+            tickets_.erase(matched.session_id);
+            tickets_.erase(ticket.session_id);
+
+            EmitPair(matched, ticket, now, out);
+            continue;
+        }
+
+        Insert(ticket);
+        ScheduleRetry(ticket, now);
+    }
+}
+
+void Matchmaker::Clear()
+{
+    for (auto& bucket : buckets_)
+    {
+        bucket.clear();
+    }
+
+    tickets_.clear();
+    retries_ = {};
+}
+
+size_t Matchmaker::GetBucketIndex(uint16_t rating)
+{
+    return std::min<size_t>(rating / Constants::Network::MATCH_BUCKET_WIDTH, BUCKET_COUNT - 1);
+}
+
+uint16_t Matchmaker::GetWindow(const Ticket& ticket, Clock::time_point now)
+{
+    const auto waited = std::chrono::duration_cast<std::chrono::milliseconds>(now - ticket.enqueue_time).count();
+    const auto steps = std::max<int64_t>(waited, 0) / Constants::Network::MATCH_WIDEN_INTERVAL;
+    const int64_t window = Constants::Network::MATCH_BASE_WINDOW + steps * Constants::Network::MATCH_WINDOW_STEP;
+
+    return static_cast<uint16_t>(std::min<int64_t>(window, Constants::Network::MATCH_MAX_WINDOW));
+}
+
+const Matchmaker::Ticket* Matchmaker::FindPartner(const Ticket& ticket, uint16_t window) const
+{
+    const uint16_t low = ticket.rating > window ? static_cast<uint16_t>(ticket.rating - window) : 0;
+    const uint16_t high = static_cast<uint16_t>(std::min<uint32_t>(ticket.rating + window, Constants::Network::MATCH_MAX_RATING));
+
+    const BucketKey* best = nullptr;
+    uint16_t best_diff = UINT16_MAX;
+
+    const auto consider = [&](const BucketKey& key)
+        {
+            const uint16_t diff = static_cast<uint16_t>(key.rating > ticket.rating ? key.rating - ticket.rating : ticket.rating - key.rating);
+            if (diff > window)
+            {
+                return;
+            }
+
+            // 차이가 같으면 먼저 대기한 티켓 우선
+            if (diff < best_diff || (diff == best_diff && key.seq < best->seq))
+            {
+                best = &key;
+                best_diff = diff;
+            }
+        };
+
+    // 구간 안에서 정렬되어 있으므로 lower_bound 위치의 앞뒤만 보면 해당 구간의 최근접 후보
+    for (size_t index = GetBucketIndex(low); index <= GetBucketIndex(high); ++index)
+    {
+        const auto& bucket = buckets_[index];
+        if (bucket.empty())
+        {
+            continue;
+        }
+
+        auto it = bucket.lower_bound(BucketKey{ ticket.rating, 0, INVALID_SLOT_ID });
+        if (it != bucket.end())
+        {
+            consider(*it);
+        }
+
+        if (it != bucket.begin())
+        {
+            // 같은 레이팅이 여러 개면 가장 오래 기다린 티켓을 선택
+            auto prev = std::prev(it);
+            prev = bucket.lower_bound(BucketKey{ prev->rating, 0, INVALID_SLOT_ID });
+            consider(*prev);
+        }
+    }
+
+    if (!best)
+    {
+        return nullptr;
+    }
+
+    auto it = tickets_.find(best->session_id);
+    return it != tickets_.end() ? &it->second : nullptr;
+}
+
+void Matchmaker::Insert(const Ticket& ticket)
+{
+    buckets_[GetBucketIndex(ticket.rating)].insert(BucketKey{ ticket.rating, ticket.seq, ticket.session_id });
+}
+
+void Matchmaker::Remove(const Ticket& ticket)
+{
+    buckets_[GetBucketIndex(ticket.rating)].erase(BucketKey{ ticket.rating, ticket.seq, ticket.session_id });
+}
+
+void Matchmaker::ScheduleRetry(const Ticket& ticket, Clock::time_point now)
+{
+    // 허용 범위가 최대에 도달한 뒤에도 같은 주기로 재검색 (새로 들어온 티켓은 자기 기본 범위로만 검색하므로)
+    const auto interval = std::chrono::milliseconds(Constants::Network::MATCH_WIDEN_INTERVAL);
+    const auto waited = std::max(now - ticket.enqueue_time, Clock::duration::zero());
+    const auto steps = std::chrono::duration_cast<std::chrono::milliseconds>(waited) / interval;
+
+    retries_.push(Retry{ ticket.enqueue_time + interval * (steps + 1), ticket.session_id, ticket.seq });
+}
+
+void Matchmaker::EmitPair(const Ticket& ticket, const Ticket& partner, Clock::time_point now, std::vector<MatchPair>& out)
+{
+    MatchPair pair;
+    pair.first = ticket.session_id;
+    pair.second = partner.session_id;
+    pair.first_rating = ticket.rating;
+    pair.second_rating = partner.rating;
+    pair.first_wait = now - ticket.enqueue_time;
+    pair.second_wait = now - partner.enqueue_time;
+
+    out.push_back(pair);
+}
@@ -0,0 +1,102 @@
+#pragma once
+/*
+ *
+ * 설명: 레이팅 기반 매치메이킹 대기열 (라우터 스레드 전용)
+ *  1. 대기 티켓을 레이팅 구간(MATCH_BUCKET_WIDTH) 별 정렬 집합에 보관.
+ *  2. 허용 레이팅 차이는 대기 시간에 따라 MATCH_WINDOW_STEP씩 확장되며, 확장 시점마다 해당 티켓만 재검색.
+ *  3. 상대 검색은 허용 범위에 걸친 구간들에서 lower_bound로 가장 가까운 레이팅을 찾음 (구간 수는 상수, O(log n)).
+ *
+ */
+
+#include "../core/common/constants/NetworkConstants.hpp"
+#include "../utils/SlotMap.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <queue>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+struct MatchPair
+{
+    SlotId first{ INVALID_SLOT_ID };
+    SlotId second{ INVALID_SLOT_ID };
+    uint16_t first_rating{ 0 };
+    uint16_t second_rating{ 0 };
+    std::chrono::steady_clock::duration first_wait{};
+    std::chrono::steady_clock::duration second_wait{};
+};
+
+class Matchmaker
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    Matchmaker() = default;
+    ~Matchmaker() = default;
+
+    Matchmaker(const Matchmaker&) = delete;
+    Matchmaker& operator=(const Matchmaker&) = delete;
+
+    // 즉시 상대를 찾으면 out에 추가하고 true 반환, 아니면 대기열에 등록
+    bool Enqueue(SlotId session_id, uint16_t rating, Clock::time_point now, std::vector<MatchPair>& out);
+    bool Cancel(SlotId session_id);
+
+    // 허용 범위가 넓어진 티켓들을 재검색해 성사된 매치를 out에 추가
+    void Update(Clock::time_point now, std::vector<MatchPair>& out);
+
+    void Clear();
+
+    [[nodiscard]] size_t GetQueuedCount() const { return tickets_.size(); }
+    [[nodiscard]] bool IsQueued(SlotId session_id) const { return tickets_.contains(session_id); }
+
+private:
+    static constexpr size_t BUCKET_COUNT = Constants::Network::MATCH_MAX_RATING / Constants::Network::MATCH_BUCKET_WIDTH + 1;
+
+    struct Ticket
+    {
+        SlotId session_id{ INVALID_SLOT_ID };
+        uint16_t rating{ 0 };
+        uint64_t seq{ 0 };
+        Clock::time_point enqueue_time{};
+    };
+
+    // 구간 내 정렬 키 (같은 레이팅이면 먼저 등록한 티켓 우선)
+    struct BucketKey
+    {
+        uint16_t rating{ 0 };
+        uint64_t seq{ 0 };
+        SlotId session_id{ INVALID_SLOT_ID };
+
+        [[nodiscard]] bool operator<(const BucketKey& other) const
+        {
+            return rating != other.rating ? rating < other.rating : seq < other.seq;
+        }
+    };
+
+    struct Retry
+    {
+        Clock::time_point time{};
+        SlotId session_id{ INVALID_SLOT_ID };
+        uint64_t seq{ 0 };
+
+        [[nodiscard]] bool operator>(const Retry& other) const { return time > other.time; }
+    };
+
+    [[nodiscard]] static size_t GetBucketIndex(uint16_t rating);
+    [[nodiscard]] static uint16_t GetWindow(const Ticket& ticket, Clock::time_point now);
+
+    [[nodiscard]] const Ticket* FindPartner(const Ticket& ticket, uint16_t window) const;
+    void Insert(const Ticket& ticket);
+    void Remove(const Ticket& ticket);
+    void ScheduleRetry(const Ticket& ticket, Clock::time_point now);
+    void EmitPair(const Ticket& ticket, const Ticket& partner, Clock::time_point now, std::vector<MatchPair>& out);
+
+private:
+    std::array<std::set<BucketKey>, BUCKET_COUNT> buckets_{};
+    std::unordered_map<SlotId, Ticket> tickets_{};
+    std::priority_queue<Retry, std::vector<Retry>, std::greater<Retry>> retries_{};
+    uint64_t next_seq_{ 1 };
+};
@@ -0,0 +1,310 @@
+#include "Room.hpp"
+#include "../utils/Logger.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <variant>
+
+Room::Room(uint32_t room_id, NetServer& server, size_t capacity) :
+    room_id_(room_id),
+    server_(server),
+    capacity_(capacity)
+{
+    members_.reserve(capacity_);
+}
+
+uint8_t Room::Join(ClientInfo* client, uint32_t connection_id)
+{
+    if (!client || !IsJoinable() || FindMember(client, connection_id))
+    {
+        return 0;
+    }
+
+    RoomMember member;
+    member.client = client;
+    member.connection_id = connection_id;
+    member.player_id = GenerateMemberId();
+
+    // 기존 참가자에게 새 참가자 통보
+    AddPlayerPacket add_packet;
+    add_packet.player_id = member.player_id;
+    add_packet.character_id = member.character_id;
+    Broadcast(add_packet);
+
+    members_.push_back(member);
+
+    // 방 안에서 사용할 id 전달 (P2P 호스트의 GiveId와 동일한 흐름 유지)
+    GiveIdPacket id_packet;
+    id_packet.player_id = member.player_id;
+    Send(member, id_packet);
+
+    if (IsFull())
+    {
+        ChangeState(MatchState::CharSelect);
+    }
+
+    return member.player_id;
+}
+
+void Room::Leave(ClientInfo* client, uint32_t connection_id)
+{
+    RoomMember* member = FindMember(client, connection_id);
+    if (!member)
+    {
+        return;
+    }
+
+    const uint8_t player_id = member->player_id;
+    members_.erase(members_.begin() + (member - members_.data()));
+
+    RemovePlayerInRoomPacket packet;
+    packet.id = player_id;
+    Broadcast(packet);
+
+    // 진행 중인 매치는 종료하고 다시 대기 상태로
+    ChangeState(MatchState::Waiting);
+}
+
+void Room::HandlePacket(ClientInfo* client, uint32_t connection_id, std::span<const char> packet, const DecodedPacket& decoded)
+{
+    RoomMember* member = FindMember(client, connection_id);
+    if (!member || packet.size() < sizeof(PacketBase))
+    {
+        return;
+    }
+
+    PacketBase header{};
+    std::memcpy(&header, packet.data(), sizeof(PacketBase));
+    const auto packet_type = static_cast<PacketType>(header.type);
+
+    switch (packet_type)
+    {
+    case PacketType::ConnectLobby:
+        SendPlayerList(*member);
+        break;
+
+    case PacketType::ChatMessage:
+        Broadcast(packet);
+        break;
+
+    case PacketType::ChangeCharSelect:
+        if (state_ == MatchState::CharSelect)
+        {
+            if (const auto* change_packet = std::get_if<ChangeCharSelectPacket>(&decoded))
+            {
+                HandleChangeCharacter(*member, *change_packet, packet);
+            }
+        }
+        break;
+
+    case PacketType::DecideCharSelect:
+        if (state_ == MatchState::CharSelect)
+        {
+            if (const auto* decide_packet = std::get_if<DecideCharacterPacket>(&decoded))
+            {
+                HandleDecideCharacter(*member, *decide_packet, packet);
+            }
+        }
+        break;
+
+    case PacketType::RestartGame:
+        if (state_ == MatchState::Finished)
+        {
+            ChangeState(MatchState::Playing);
+        }
+        [[fallthrough]];
+
+    case PacketType::InitializePlayer:
+        if (state_ == MatchState::Playing)
+        {
+            Broadcast(packet, member);
+        }
+        break;
+
+    case PacketType::LoseGame:
+        if (state_ == MatchState::Playing)
+        {
+            Broadcast(packet, member);
+            ChangeState(MatchState::Finished);
+        }
+        break;
+
+    default:
+        if ((IsBlockOperationPacket(packet_type) || IsCombatPacket(packet_type)) && state_ == MatchState::Playing)
+        {
+            Broadcast(packet, member);
+        }
+        else
+        {
+            LOGGER.Warning("Room {} dropped packet type {} in state {}", room_id_, header.type, static_cast<int>(state_));
+        }
+        break;
+    }
+}
+
+void Room::Flush()
+{
+    for (const auto& member : members_)
+    {
+        if (server_.FlushClient(member.client, member.connection_id) == false)
+        {
+            LOGGER.Warning("Room {} flush failed", room_id_);
+        }
+    }
+}
+
+void Room::ForceDecideAll()
+{
+    if (state_ != MatchState::CharSelect)
+    {
+        return;
+    }
+
+    for (auto& member : members_)
+    {
+        if (member.decided)
+        {
+            continue;
+        }
+
+        member.decided = true;
+
+        DecideCharacterPacket packet;
+        packet.player_id = member.player_id;
+        packet.x_pos = static_cast<uint8_t>(member.character_id % Constants::Game::CHARACTER_GRID_WIDTH);
+        packet.y_pos = static_cast<uint8_t>(member.character_id / Constants::Game::CHARACTER_GRID_WIDTH);
+        Broadcast(packet, &member);
+    }
+
+    LOGGER.Info("Room {} character select timed out", room_id_);
+    ChangeState(MatchState::Playing);
+}
+
+void Room::HandleChangeCharacter(RoomMember& member, const ChangeCharSelectPacket& change_packet, std::span<const char> packet)
+{
+    if (member.decided)
+    {
+        return;
+    }
+
+    // 제한 시간 초과 시 확정할 캐릭터
+    member.character_id = static_cast<uint16_t>(change_packet.y_pos * Constants::Game::CHARACTER_GRID_WIDTH + change_packet.x_pos);
+
+    Broadcast(packet, &member);
+}
+
+void Room::HandleDecideCharacter(RoomMember& member, const DecideCharacterPacket& decide_packet, std::span<const char> packet)
+{
+    member.character_id = static_cast<uint16_t>(decide_packet.y_pos * Constants::Game::CHARACTER_GRID_WIDTH + decide_packet.x_pos);
+    member.decided = true;
+
+    Broadcast(packet, &member);
+
+    const bool all_decided = std::all_of(members_.begin(), members_.end(),
+        [](const RoomMember& m) { return m.decided; });
+
+    if (all_decided && IsFull())
+    {
+        ChangeState(MatchState::Playing);
+    }
+}
+
+void Room::ChangeState(MatchState state)
+{
+    if (state_ == state)
+    {
+        return;
+    }
+
+    state_ = state;
+
+    switch (state_)
+    {
+    case MatchState::Waiting:
+        for (auto& member : members_)
+        {
+            member.decided = false;
+        }
+        break;
+
+    case MatchState::CharSelect:
+    {
+        StartCharSelectPacket packet;
+        Broadcast(packet);
+        break;
+    }
+
+    case MatchState::Playing:
+    {
+        StartGamePacket packet;
+        Broadcast(packet);
+        break;
+    }
+
+    case MatchState::Finished:
+        break;
+    }
+}
+
+void Room::SendPlayerList(const RoomMember& member)
+{
+    for (const auto& other : members_)
+    {
+        if (&other != &member)
+        {
+            AddPlayerPacket packet;
+            packet.player_id = other.player_id;
+            packet.character_id = other.character_id;
+
+            Send(member, packet);
+        }
+    }
+}
+
+RoomMember* Room::FindMember(ClientInfo* client, uint32_t connection_id)
+{
+    auto it = std::find_if(members_.begin(), members_.end(),
+        [client, connection_id](const RoomMember& member)
+        {
+            return member.client == client && member.connection_id == connection_id;
+        });
+
+    return it != members_.end() ? &(*it) : nullptr;
+}
+
+uint8_t Room::GenerateMemberId() const
+{
+    // 비어 있는 가장 작은 id 사용 (1부터 시작)
+    for (uint8_t id = 1; id != 0; ++id)
+    {
+        const bool used = std::any_of(members_.begin(), members_.end(),
+            [id](const RoomMember& member) { return member.player_id == id; });
+
+        if (!used)
+        {
+            return id;
+        }
+    }
+
+    return 0;
+}
+
+void Room::Send(const RoomMember& member, std::span<const char> packet)
+{
+    // 퇴장 통지 전에 슬롯이 새 접속에 재사용됐으면 NetServer가 connection_id 불일치로 거부
+    if (server_.SendMsg(member.client, packet, member.connection_id) == false)
+    {
+        LOGGER.Warning("Room {} send failed", room_id_);
+    }
+}
+
+void Room::Broadcast(std::span<const char> packet, const RoomMember* exclude)
+{
+    for (const auto& member : members_)
+    {
+        if (&member != exclude)
+        {
+            Send(member, packet);
+        }
+    }
+}
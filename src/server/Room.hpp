@@ -0,0 +1,107 @@
+#pragma once
+/*
+ *
+ * 설명: 전용 서버의 방 단위 매치 상태
+ *  1. 방마다 독립된 참가자 목록과 매치 진행 상태를 가지며 GAME_APP에 의존하지 않음.
+ *  2. 게임 진행 패킷은 같은 방의 다른 참가자에게만 중계.
+ *  3. 참가자는 ClientInfo 슬롯과 connection_id로 구분. 퇴장 통지가 도착하기 전에 슬롯이
+ *     새 접속에 재사용돼도 송신은 NetServer가 잠금 안에서 connection_id를 비교해 걸러냄.
+ *
+ */
+
+#include "../network/NetServer.hpp"
+#include "../network/packets/GamePackets.hpp"
+#include "../network/packets/GamePacketSchemas.hpp"
+#include "../core/common/constants/NetworkConstants.hpp"
+#include "../core/common/constants/RuleConstants.hpp"
+
+#include <concepts>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+enum class MatchState : uint8_t
+{
+    Waiting,        // 참가자 대기
+    CharSelect,     // 캐릭터 선택 중
+    Playing,        // 게임 진행 중
+    Finished        // 승패 결정, 재시작 대기
+};
+
+struct RoomMember
+{
+    ClientInfo* client{ nullptr };
+    uint32_t connection_id{ 0 };
+    uint8_t player_id{ 0 };
+    uint16_t character_id{ 0 };
+    bool decided{ false };
+};
+
+class Room
+{
+public:
+    Room(uint32_t room_id, NetServer& server, size_t capacity = Constants::Network::ROOM_CAPACITY);
+    ~Room() = default;
+
+    Room(const Room&) = delete;
+    Room& operator=(const Room&) = delete;
+
+    // 참가/퇴장 (성공 시 방 안에서의 플레이어 id, 실패 시 0)
+    [[nodiscard]] uint8_t Join(ClientInfo* client, uint32_t connection_id);
+    void Leave(ClientInfo* client, uint32_t connection_id);
+
+    // packet은 중계용 원본 바이트, decoded는 수신 필터에서 검사/디코딩된 값
+    void HandlePacket(ClientInfo* client, uint32_t connection_id, std::span<const char> packet, const DecodedPacket& decoded);
+
+    // 캐릭터 선택 제한 시간 초과: 확정하지 않은 참가자는 마지막으로 고르던 캐릭터로 확정하고 게임 시작
+    void ForceDecideAll();
+
+    // 코킹된 송신 데이터를 참가자별로 전송
+    void Flush();
+
+    [[nodiscard]] uint32_t GetId() const { return room_id_; }
+    [[nodiscard]] MatchState GetState() const { return state_; }
+    [[nodiscard]] size_t GetMemberCount() const { return members_.size(); }
+    [[nodiscard]] bool IsFull() const { return members_.size() >= capacity_; }
+    [[nodiscard]] bool IsEmpty() const { return members_.empty(); }
+    [[nodiscard]] bool IsJoinable() const { return state_ == MatchState::Waiting && !IsFull(); }
+
+private:
+    [[nodiscard]] RoomMember* FindMember(ClientInfo* client, uint32_t connection_id);
+    [[nodiscard]] uint8_t GenerateMemberId() const;
+
+    void ChangeState(MatchState state);
+    void HandleChangeCharacter(RoomMember& member, const ChangeCharSelectPacket& change_packet, std::span<const char> packet);
+    void HandleDecideCharacter(RoomMember& member, const DecideCharacterPacket& decide_packet, std::span<const char> packet);
+    void SendPlayerList(const RoomMember& member);
+
+    template<typename T> requires std::derived_from<T, PacketBase>
+    void Send(const RoomMember& member, const T& packet);
+    void Send(const RoomMember& member, std::span<const char> packet);
+    void Broadcast(std::span<const char> packet, const RoomMember* exclude = nullptr);
+
+    template<typename T> requires std::derived_from<T, PacketBase>
+    void Broadcast(const T& packet, const RoomMember* exclude = nullptr);
+
+private:
+    uint32_t room_id_{ 0 };
+    NetServer& server_;
+    size_t capacity_{ 0 };
+
+    MatchState state_{ MatchState::Waiting };
+    std::vector<RoomMember> members_;
+};
+
+template<typename T> requires std::derived_from<T, PacketBase>
+void Room::Send(const RoomMember& member, const T& packet)
+{
+    const auto bytes = ToWireBytes(packet);
+    Send(member, std::span<const char>(bytes.data(), bytes.size()));
+}
+
+template<typename T> requires std::derived_from<T, PacketBase>
+void Room::Broadcast(const T& packet, const RoomMember* exclude)
+{
+    const auto bytes = ToWireBytes(packet);
+    Broadcast(std::span<const char>(bytes.data(), bytes.size()), exclude);
+}
@@ -0,0 +1,138 @@
+#include "RoomManager.hpp"
+#include "../core/common/constants/NetworkConstants.hpp"
+
+#include <algorithm>
+
+RoomManager::RoomManager(size_t shard_count) :
+    shard_room_counts_(std::max<size_t>(shard_count, 1), 0)
+{
+}
+
+RoomEntry* RoomManager::CreateRoom()
+{
+    // 0은 자동 배정 요청에 사용하므로 건너뜀
+    if (next_room_id_ == 0)
+    {
+        ++next_room_id_;
+    }
+
+    const uint32_t room_id = next_room_id_++;
+    auto [it, inserted] = rooms_.try_emplace(room_id);
+    if (!inserted)
+    {
+        return nullptr;
+    }
+
+    const auto least = std::min_element(shard_room_counts_.begin(), shard_room_counts_.end());
+    ++(*least);
+
+    RoomEntry& entry = it->second;
+    entry.room_id = room_id;
+    entry.shard = static_cast<uint16_t>(least - shard_room_counts_.begin());
+
+    joinable_rooms_.insert(room_id);
+    return &entry;
+}
+
+RoomEntry* RoomManager::FindRoom(uint32_t room_id)
+{
+    auto it = rooms_.find(room_id);
+    return it != rooms_.end() ? &it->second : nullptr;
+}
+
+RoomEntry* RoomManager::FindJoinableRoom()
+{
+    if (joinable_rooms_.empty())
+    {
+        return nullptr;
+    }
+
+    return FindRoom(*joinable_rooms_.begin());
+}
+
+void RoomManager::AddMember(RoomEntry& entry)
+{
+    ++entry.member_count;
+    Refresh(entry);
+}
+
+void RoomManager::RemoveMember(RoomEntry& entry)
+{
+    if (entry.member_count > 0)
+    {
+        --entry.member_count;
+    }
+
+    Refresh(entry);
+}
+
+void RoomManager::SetWaiting(RoomEntry& entry, bool waiting)
+{
+    entry.waiting = waiting;
+    Refresh(entry);
+}
+
+void RoomManager::RemoveRoom(uint32_t room_id)
+{
+    auto it = rooms_.find(room_id);
+    if (it == rooms_.end())
+    {
+        return;
+    }
+
+    --shard_room_counts_[it->second.shard];
+    joinable_rooms_.erase(room_id);
+    rooms_.erase(it);
+}
+
+RoomEntry* RoomManager::BeginMigration(uint16_t& target_shard)
+{
+    const auto [least, most] = std::minmax_element(shard_room_counts_.begin(), shard_room_counts_.end());
+    if (*most - *least <= Constants::Network::SHARD_BALANCE_THRESHOLD)
+    {
+        return nullptr;
+    }
+
+    const auto source_shard = static_cast<uint16_t>(most - shard_room_counts_.begin());
+    target_shard = static_cast<uint16_t>(least - shard_room_counts_.begin());
+
+    for (auto& [room_id, entry] : rooms_)
+    {
+        if (entry.shard == source_shard && !entry.migrating)
+        {
+            // 이관이 끝나기 전에도 새 방이 다시 몰리지 않도록 개수는 미리 옮겨 둠
+            --shard_room_counts_[source_shard];
+            ++shard_room_counts_[target_shard];
+
+            entry.migrating = true;
+            return &entry;
+        }
+    }
+
+    return nullptr;
+}
+
+void RoomManager::EndMigration(RoomEntry& entry, uint16_t target_shard)
+{
+    entry.shard = target_shard;
+    entry.migrating = false;
+}
+
+void RoomManager::Release()
+{
+    rooms_.clear();
+    joinable_rooms_.clear();
+    std::fill(shard_room_counts_.begin(), shard_room_counts_.end(), 0);
+}
+
+void RoomManager::Refresh(RoomEntry& entry)
+{
+    if (entry.waiting && entry.member_count < static_cast<size_t>(Constants::Network::ROOM_CAPACITY))
+    {
+        joinable_rooms_.insert(entry.room_id);
+    }
+    else
+    {
+        joinable_rooms_.erase(entry.room_id);
+    }
+}
@@ -0,0 +1,66 @@
+#pragma once
+/*
+ *
+ * 설명: 전용 서버의 방 디렉터리 (라우터 스레드 전용)
+ *  1. 방 객체는 각 샤드가 소유하고, 여기서는 방 id -> 소속 샤드/참가 인원/참가 가능 여부만 관리.
+ *  2. 참가 인원은 라우터가 Join/Leave를 보낼 때 갱신하므로 샤드 응답을 기다리지 않고 배정 가능.
+ *  3. 샤드 간 방 개수 차이를 계산해 이관할 방을 선택.
+ *
+ */
+
+#include "RoomShard.hpp"
+
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+struct RoomEntry
+{
+    uint32_t room_id{ 0 };
+    uint16_t shard{ 0 };
+    size_t member_count{ 0 };
+    bool waiting{ true };       // 샤드가 보고한 방 상태가 Waiting인지
+    bool migrating{ false };    // 이관 중 (샤드에 보낼 메시지를 pending에 보관)
+    std::vector<ShardMessage> pending;
+};
+
+class RoomManager
+{
+public:
+    explicit RoomManager(size_t shard_count);
+    ~RoomManager() = default;
+
+    RoomManager(const RoomManager&) = delete;
+    RoomManager& operator=(const RoomManager&) = delete;
+
+    // 방 개수가 가장 적은 샤드에 새 방 배정
+    [[nodiscard]] RoomEntry* CreateRoom();
+    [[nodiscard]] RoomEntry* FindRoom(uint32_t room_id);
+
+    [[nodiscard]] RoomEntry* FindJoinableRoom();
+
+    void AddMember(RoomEntry& entry);
+    void RemoveMember(RoomEntry& entry);
+    void SetWaiting(RoomEntry& entry, bool waiting);
+    void RemoveRoom(uint32_t room_id);
+
+    // 방 개수 차이가 기준을 넘으면 가장 붐비는 샤드의 방 하나를 가장 한가한 샤드로 이관 시작
+    [[nodiscard]] RoomEntry* BeginMigration(uint16_t& target_shard);
+    void EndMigration(RoomEntry& entry, uint16_t target_shard);
+
+    void Release();
+
+    [[nodiscard]] size_t GetRoomCount() const { return rooms_.size(); }
+    [[nodiscard]] size_t GetShardRoomCount(uint16_t shard) const { return shard_room_counts_[shard]; }
+
+private:
+    void Refresh(RoomEntry& entry);
+
+private:
+    uint32_t next_room_id_{ 1 };
+
+    std::unordered_map<uint32_t, RoomEntry> rooms_;
+    std::unordered_set<uint32_t> joinable_rooms_;
+    std::vector<size_t> shard_room_counts_;
+};
@@ -0,0 +1,353 @@
+#include "RoomShard.hpp"
+#include "../utils/Logger.hpp"
+
+#include <Windows.h>
+
+RoomShard::RoomShard(uint16_t index, NetServer& server) :
+    index_(index),
+    server_(server),
+    inbound_(Constants::Network::SHARD_QUEUE_CAPACITY),
+    results_(Constants::Network::SHARD_QUEUE_CAPACITY),
+    timer_epoch_(std::chrono::steady_clock::now()),
+    timers_(Constants::Network::SERVER_TIMER_TICK)
+{
+}
+
+RoomShard::~RoomShard()
+{
+    Stop();
+}
+
+void RoomShard::Start()
+{
+    if (running_.exchange(true))
+    {
+        return;
+    }
+
+    thread_ = std::thread(&RoomShard::Run, this);
+
+    // 스레드 하나를 코어 하나에 고정
+    if (index_ < sizeof(DWORD_PTR) * 8)
+    {
+        SetThreadAffinityMask(thread_.native_handle(), DWORD_PTR{ 1 } << index_);
+    }
+}
+
+void RoomShard::Stop()
+{
+    if (running_.exchange(false) == false)
+    {
+        return;
+    }
+
+    Wake();
+
+    if (thread_.joinable())
+    {
+        thread_.join();
+    }
+
+    rooms_.clear();
+    reported_states_.clear();
+    dirty_rooms_.clear();
+    timers_.Clear();
+    char_select_timers_.clear();
+}
+
+void RoomShard::Post(ShardMessage&& message)
+{
+    // 순서 보장을 위해 대기열이 비어 있을 때만 큐에 직접 적재
+    if (inbound_overflow_.empty() && inbound_.TryPush(std::move(message)))
+    {
+        Wake();
+        return;
+    }
+
+    inbound_overflow_.push_back(std::move(message));
+}
+
+void RoomShard::PumpOverflow()
+{
+    bool pushed = false;
+
+    while (!inbound_overflow_.empty())
+    {
+        if (inbound_.TryPush(std::move(inbound_overflow_.front())) == false)
+        {
+            break;
+        }
+
+        inbound_overflow_.pop_front();
+        pushed = true;
+    }
+
+    if (pushed)
+    {
+        Wake();
+    }
+}
+
+void RoomShard::Wake()
+{
+    wake_seq_.fetch_add(1, std::memory_order_release);
+    wake_seq_.notify_one();
+}
+
+void RoomShard::Run()
+{
+    ShardMessage message;
+
+    while (running_.load(std::memory_order_acquire))
+    {
+        const uint32_t seq = wake_seq_.load(std::memory_order_acquire);
+
+        // 이전에 적재하지 못한 결과 재시도
+        while (!result_overflow_.empty() && results_.TryPush(std::move(result_overflow_.front())))
+        {
+            result_overflow_.pop_front();
+        }
+
+        uint64_t processed = 0;
+        while (inbound_.TryPop(message))
+        {
+            Handle(message);
+            ++processed;
+        }
+
+        // 한 번에 처리한 패킷들의 송신을 방 단위로 묶어서 전송
+        FlushDirtyRooms();
+
+        if (processed > 0)
+        {
+            processed_count_.fetch_add(processed, std::memory_order_relaxed);
+            continue;
+        }
+
+        if (!result_overflow_.empty())
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        wake_seq_.wait(seq, std::memory_order_acquire);
+    }
+}
+
+void RoomShard::Handle(ShardMessage& message)
+{
+    switch (message.type)
+    {
+    case ShardMessage::Type::CreateRoom:
+        rooms_.try_emplace(message.room_id, std::make_unique<Room>(message.room_id, server_));
+        break;
+
+    case ShardMessage::Type::DestroyRoom:
+        if (Room* room = FindRoom(message.room_id))
+        {
+            dirty_rooms_.erase(room);
+        }
+        reported_states_.erase(message.room_id);
+        CancelCharSelectTimer(message.room_id);
+        rooms_.erase(message.room_id);
+        break;
+
+    case ShardMessage::Type::AdoptRoom:
+        if (message.room)
+        {
+            const uint32_t room_id = message.room->GetId();
+            reported_states_[room_id] = message.room->GetState();
+
+            // 이관 받은 방의 카운트다운은 처음부터 다시 시작
+            UpdateCharSelectTimer(*message.room);
+            rooms_[room_id] = std::move(message.room);
+        }
+        break;
+
+    case ShardMessage::Type::DetachRoom:
+        HandleDetach(message);
+        break;
+
+    case ShardMessage::Type::Join:
+        HandleJoin(message);
+        break;
+
+    case ShardMessage::Type::Leave:
+        if (Room* room = FindRoom(message.room_id))
+        {
+            room->Leave(message.client, message.connection_id);
+            dirty_rooms_.insert(room);
+            ReportState(*room);
+        }
+        break;
+
+    case ShardMessage::Type::Packet:
+        if (Room* room = FindRoom(message.room_id))
+        {
+            room->HandlePacket(message.client, message.connection_id, message.packet_data, message.packet);
+            dirty_rooms_.insert(room);
+            ReportState(*room);
+        }
+        break;
+
+    case ShardMessage::Type::Tick:
+        AdvanceTimers();
+        break;
+
+    default:
+        break;
+    }
+}
+
+void RoomShard::HandleJoin(ShardMessage& message)
+{
+    ShardResult result;
+    result.room_id = message.room_id;
+    result.client = message.client;
+    result.session_id = message.session_id;
+    result.type = ShardResult::Type::JoinFailed;
+
+    if (Room* room = FindRoom(message.room_id))
+    {
+        result.player_id = room->Join(message.client, message.connection_id);
+        if (result.player_id != 0)
+        {
+            result.type = ShardResult::Type::Joined;
+            dirty_rooms_.insert(room);
+        }
+
+        ReportState(*room);
+    }
+
+    PushResult(std::move(result));
+}
+
+void RoomShard::HandleDetach(ShardMessage& message)
+{
+    auto it = rooms_.find(message.room_id);
+    if (it == rooms_.end())
+    {
+        return;
+    }
+
+    // 분리 전에 남은 송신 데이터를 모두 전송
+    it->second->Flush();
+    dirty_rooms_.erase(it->second.get());
+    reported_states_.erase(message.room_id);
+    CancelCharSelectTimer(message.room_id);
+
+    ShardResult result;
+    result.type = ShardResult::Type::RoomDetached;
+    result.room_id = message.room_id;
+    result.target_shard = message.target_shard;
+    result.room = std::move(it->second);
+
+    rooms_.erase(it);
+    PushResult(std::move(result));
+}
+
+void RoomShard::ReportState(Room& room)
+{
+    auto [it, inserted] = reported_states_.try_emplace(room.GetId(), room.GetState());
+    if (!inserted && it->second == room.GetState())
+    {
+        return;
+    }
+
+    it->second = room.GetState();
+    UpdateCharSelectTimer(room);
+
+    ShardResult result;
+    result.type = ShardResult::Type::StateChanged;
+    result.room_id = room.GetId();
+    result.joinable = room.GetState() == MatchState::Waiting;
+    PushResult(std::move(result));
+}
+
+void RoomShard::PushResult(ShardResult&& result)
+{
+    if (result_overflow_.empty() && results_.TryPush(std::move(result)))
+    {
+        return;
+    }
+
+    result_overflow_.push_back(std::move(result));
+}
+
+void RoomShard::FlushDirtyRooms()
+{
+    for (Room* room : dirty_rooms_)
+    {
+        room->Flush();
+    }
+
+    dirty_rooms_.clear();
+}
+
+void RoomShard::AdvanceTimers()
+{
+    expired_rooms_.clear();
+    timers_.Advance(GetElapsedMs(), expired_rooms_);
+
+    for (const uint32_t room_id : expired_rooms_)
+    {
+        char_select_timers_.erase(room_id);
+
+        Room* room = FindRoom(room_id);
+        if (!room || room->GetState() != MatchState::CharSelect)
+        {
+            continue;
+        }
+
+        room->ForceDecideAll();
+        dirty_rooms_.insert(room);
+        ReportState(*room);
+    }
+}
+
+void RoomShard::UpdateCharSelectTimer(const Room& room)
+{
+    if (room.GetState() != MatchState::CharSelect)
+    {
+        CancelCharSelectTimer(room.GetId());
+        return;
+    }
+
+    if (char_select_timers_.contains(room.GetId()))
+    {
+        return;
+    }
+
+    // 지연 시간은 마지막 Tick 기준이므로 최대 SHARD_TICK_INTERVAL만큼 일찍 만료될 수 있음 (제한 시간에 비해 무시할 수준)
+    const TimerId timer_id = timers_.Schedule(Constants::Network::CHAR_SELECT_TIMEOUT, room.GetId());
+    if (timer_id == INVALID_TIMER_ID)
+    {
+        LOGGER.Warning("Room {} char select timer schedule failed", room.GetId());
+        return;
+    }
+
+    char_select_timers_.emplace(room.GetId(), timer_id);
+}
+
+void RoomShard::CancelCharSelectTimer(uint32_t room_id)
+{
+    auto it = char_select_timers_.find(room_id);
+    if (it == char_select_timers_.end())
+    {
+        return;
+    }
+
+    timers_.Cancel(it->second);
+    char_select_timers_.erase(it);
+}
+
+uint64_t RoomShard::GetElapsedMs() const
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - timer_epoch_).count());
+}
+
+Room* RoomShard::FindRoom(uint32_t room_id)
+{
+    auto it = rooms_.find(room_id);
+    return it != rooms_.end() ? it->second.get() : nullptr;
+}
@@ -0,0 +1,140 @@
+#pragma once
+/*
+ *
+ * 설명: 방 샤드 (스레드 하나가 소속 방들의 상태를 단독 소유)
+ *  1. 라우터(DedicatedServer::Update)가 유일한 생산자인 SPSC 큐로 패킷/명령을 순서대로 수신.
+ *  2. 처리 결과(참가 결과, 방 상태 변화, 방 이관)는 샤드가 유일한 생산자인 SPSC 큐로 라우터에 반환.
+ *  3. 방 데이터는 샤드 스레드에서만 접근하므로 잠금이 없음.
+ *  4. 방 타이머(캐릭터 선택 제한 시간)는 샤드별 타이밍 휠로 관리하고, 라우터가 주기적으로 보내는 Tick에서 만료 처리.
+ *
+ */
+
+#include "Room.hpp"
+#include "SpscQueue.hpp"
+#include "../utils/TimingWheel.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// 라우터 -> 샤드
+struct ShardMessage
+{
+    enum class Type : uint8_t
+    {
+        None,
+        CreateRoom,
+        DestroyRoom,
+        AdoptRoom,      // 이관 받은 방 등록
+        DetachRoom,     // 다른 샤드로 이관하기 위해 방 분리
+        Join,
+        Leave,
+        Packet,
+        Tick            // 타이머 진행
+    };
+
+    Type type{ Type::None };
+    uint32_t room_id{ 0 };
+    ClientInfo* client{ nullptr };
+    uint32_t connection_id{ 0 };
+    SlotId session_id{ INVALID_SLOT_ID };
+    uint16_t target_shard{ 0 };
+    std::unique_ptr<Room> room;
+    std::vector<char> packet_data;
+    DecodedPacket packet;           // 라우터가 받은 디코딩 결과 (packet_data는 중계용 원본)
+};
+
+// 샤드 -> 라우터
+struct ShardResult
+{
+    enum class Type : uint8_t
+    {
+        None,
+        Joined,
+        JoinFailed,
+        StateChanged,
+        RoomDetached
+    };
+
+    Type type{ Type::None };
+    uint32_t room_id{ 0 };
+    ClientInfo* client{ nullptr };
+    SlotId session_id{ INVALID_SLOT_ID };
+    uint8_t player_id{ 0 };
+    bool joinable{ false };
+    uint16_t target_shard{ 0 };
+    std::unique_ptr<Room> room;
+};
+
+class RoomShard
+{
+public:
+    RoomShard(uint16_t index, NetServer& server);
+    ~RoomShard();
+
+    RoomShard(const RoomShard&) = delete;
+    RoomShard& operator=(const RoomShard&) = delete;
+
+    void Start();
+    void Stop();
+
+    // 라우터 스레드 전용. 큐가 가득 차면 라우터 측 대기열에 보관 후 PumpOverflow에서 재시도
+    void Post(ShardMessage&& message);
+    void PumpOverflow();
+
+    // 라우터 스레드 전용
+    [[nodiscard]] bool TryPopResult(ShardResult& result) { return results_.TryPop(result); }
+
+    [[nodiscard]] uint16_t GetIndex() const { return index_; }
+    [[nodiscard]] uint64_t GetProcessedCount() const { return processed_count_.load(std::memory_order_relaxed); }
+
+private:
+    void Run();
+    void Handle(ShardMessage& message);
+    void HandleJoin(ShardMessage& message);
+    void HandleDetach(ShardMessage& message);
+    void ReportState(Room& room);
+    void PushResult(ShardResult&& result);
+    void FlushDirtyRooms();
+    void Wake();
+
+    // 방 타이머
+    void AdvanceTimers();
+    void UpdateCharSelectTimer(const Room& room);
+    void CancelCharSelectTimer(uint32_t room_id);
+    [[nodiscard]] uint64_t GetElapsedMs() const;
+
+    [[nodiscard]] Room* FindRoom(uint32_t room_id);
+
+private:
+    uint16_t index_{ 0 };
+    NetServer& server_;
+
+    SpscQueue<ShardMessage> inbound_;
+    SpscQueue<ShardResult> results_;
+
+    // 라우터 측 대기열 (라우터 스레드만 접근)
+    std::deque<ShardMessage> inbound_overflow_;
+
+    // 샤드 스레드 전용 상태
+    std::deque<ShardResult> result_overflow_;
+    std::unordered_map<uint32_t, std::unique_ptr<Room>> rooms_;
+    std::unordered_map<uint32_t, MatchState> reported_states_;
+    std::unordered_set<Room*> dirty_rooms_;
+
+    std::chrono::steady_clock::time_point timer_epoch_{};
+    TimingWheel<uint32_t> timers_;      // 만료 시 방 id
+    std::unordered_map<uint32_t, TimerId> char_select_timers_;
+    std::vector<uint32_t> expired_rooms_;
+
+    std::thread thread_;
+    std::atomic<bool> running_{ false };
+    std::atomic<uint32_t> wake_seq_{ 0 };
+    std::atomic<uint64_t> processed_count_{ 0 };
+};
@@ -0,0 +1,106 @@
+/*
+ *
+ * 설명: 전용 서버 진입점 (콘솔, 창/렌더러 없음)
+ *  사용법: puzzle_server.exe [최대 접속 수] [방 샤드 수 (0: 자동)]
+ *
+ */
+
+#include "DedicatedServer.hpp"
+#include "../utils/Logger.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <Windows.h>
+
+namespace
+{
+    std::atomic<bool> g_running{ true };
+
+    BOOL WINAPI ConsoleCtrlHandler(DWORD ctrl_type)
+    {
+        switch (ctrl_type)
+        {
+        case CTRL_C_EVENT:
+        case CTRL_BREAK_EVENT:
+        case CTRL_CLOSE_EVENT:
+            g_running = false;
+            return TRUE;
+        default:
+            return FALSE;
+        }
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    size_t max_client = Constants::Network::DEDICATED_MAX_CLIENT;
+    size_t shard_count = 0;
+
+    try
+    {
+        if (argc > 1)
+        {
+            max_client = std::stoul(argv[1]);
+        }
+
+        if (argc > 2)
+        {
+            shard_count = std::stoul(argv[2]);
+        }
+    }
+    catch (const std::exception&)
+    {
+        max_client = Constants::Network::DEDICATED_MAX_CLIENT;
+        shard_count = 0;
+    }
+
+    if (LOGGER.Initialize() == false)
+    {
+        return 1;
+    }
+
+    LOGGER.SetLogToConsole(true);
+    SetConsoleCtrlHandler(ConsoleCtrlHandler, TRUE);
+
+    DedicatedServer server(max_client, shard_count);
+    if (server.Start() == false)
+    {
+        LOGGER.Shutdown();
+        return 1;
+    }
+
+    // 클라이언트와 동일한 주기로 고정 틱 처리
+    using clock = std::chrono::steady_clock;
+    const auto tick = std::chrono::duration_cast<clock::duration>(std::chrono::duration<float>(Constants::Network::SERVER_TICK_TIME));
+    auto next_tick = clock::now();
+    auto next_report = next_tick + std::chrono::milliseconds(Constants::Network::SEND_STATS_INTERVAL);
+
+    while (g_running)
+    {
+        server.Update();
+
+        const auto now = clock::now();
+        if (now >= next_report)
+        {
+            LOGGER.Info("sessions: {}, rooms: {}", server.GetSessionCount(), server.GetRoomCount());
+            server.LogShardStats();
+            next_report = now + std::chrono::milliseconds(Constants::Network::SEND_STATS_INTERVAL);
+        }
+
+        next_tick += tick;
+        if (next_tick < now)
+        {
+            // 처리 지연이 누적되면 따라잡지 않고 기준 시각을 재설정
+            next_tick = now;
+        }
+
+        std::this_thread::sleep_until(next_tick);
+    }
+
+    server.Stop();
+    LOGGER.Shutdown();
+
+    return 0;
+}
@@ -0,0 +1,91 @@
+#pragma once
+/*
+ *
+ * 설명: 단일 생산자/단일 소비자 고정 크기 락프리 링 큐
+ *  1. 생산자는 tail, 소비자는 head만 갱신하며 서로의 인덱스는 캐시해 두고 필요할 때만 다시 읽음.
+ *  2. 용량은 2의 거듭제곱으로 올림. 가득 차면 TryPush가 false를 반환 (재시도는 호출 측 책임).
+ *
+ */
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+template<typename T>
+class SpscQueue
+{
+public:
+    explicit SpscQueue(size_t capacity)
+        : capacity_(std::bit_ceil(capacity < 2 ? size_t{ 2 } : capacity)),
+          mask_(capacity_ - 1),
+          slots_(std::make_unique<T[]>(capacity_))
+    {
+    }
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    // 생산자 스레드 전용
+    [[nodiscard]] bool TryPush(T&& value)
+    {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+
+        if (tail - cached_head_ >= capacity_)
+        {
+            cached_head_ = head_.load(std::memory_order_acquire);
+            if (tail - cached_head_ >= capacity_)
+            {
+                return false;
+            }
+        }
+
+        slots_[tail & mask_] = std::move(value);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // 소비자 스레드 전용
+    [[nodiscard]] bool TryPop(T& value)
+    {
+        const size_t head = head_.load(std::memory_order_relaxed);
+
+        if (head == cached_tail_)
+        {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            if (head == cached_tail_)
+            {
+                return false;
+            }
+        }
+
+        value = std::move(slots_[head & mask_]);
+        slots_[head & mask_] = T{};
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    [[nodiscard]] size_t GetCapacity() const { return capacity_; }
+
+    // 근사치 (다른 스레드에서 읽으면 즉시 변할 수 있음)
+    [[nodiscard]] size_t GetSizeApprox() const
+    {
+        return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+    }
+
+private:
+    static constexpr size_t CACHE_LINE = std::hardware_destructive_interference_size;
+
+    const size_t capacity_;
+    const size_t mask_;
+    std::unique_ptr<T[]> slots_;
+
+    // 생산자/소비자가 쓰는 값을 서로 다른 캐시 라인에 배치해 false sharing 방지
+    alignas(CACHE_LINE) std::atomic<size_t> head_{ 0 };
+    size_t cached_tail_{ 0 };
+
+    alignas(CACHE_LINE) std::atomic<size_t> tail_{ 0 };
+    size_t cached_head_{ 0 };
+};
@@ -0,0 +1,375 @@
+#include "PuyoBeamSearch.hpp"
+#include "PuyoZobrist.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <vector>
+
+namespace
+{
+    using SearchClock = std::chrono::steady_clock;
+
+    // 평가 가중치 (점수 단위에 맞춤. 3연쇄 잠재력 ~ 실제 3연쇄 점수 정도)
+    constexpr float POTENTIAL_WEIGHT = 120.0f;
+    constexpr float CONNECTION_WEIGHT = 10.0f;
+    constexpr float BUMP_WEIGHT = 3.0f;
+    constexpr float DANGER_WEIGHT = 400.0f;
+    constexpr int DANGER_HEIGHT = PuyoBoard::HEIGHT - 4;
+    constexpr float SMALL_CHAIN_WEIGHT = 0.2f;
+
+    constexpr float NO_VALUE = -std::numeric_limits<float>::infinity();
+
+    constexpr std::array<PuyoBeamConfig, 3> LEVEL_CONFIGS =
+    { {
+        { 4, 1, 10'000, 1, 0 },           // Easy
+        { 16, 2, 40'000, 3, 4096 },       // Normal
+        { 64, 3, 120'000, 5, 16384 },     // Hard
+    } };
+
+    struct BeamNode
+    {
+        PuyoBoard board;
+        uint64_t hash{ 0 };         // board의 Zobrist 키
+        float path_value{ 0.0f };   // 경로에서 터뜨린 연쇄의 평가 합
+        float value{ NO_VALUE };    // path_value + Evaluate(board). NO_VALUE면 배치 불가/게임 오버
+        uint8_t root{ 0 };          // 첫 배치의 PLACEMENTS 인덱스
+        uint8_t first_chain{ 0 };
+        uint8_t best_chain{ 0 };
+    };
+
+    [[nodiscard]] uint8_t RunChain(PuyoBoard& board)
+    {
+        PuyoChainState state;
+        PuyoChainResult result;
+        PuyoSimulator::ResolveChain(board, state, result);
+        return result.chain_count;
+    }
+
+    [[nodiscard]] float GetFireValue(const PuyoChainResult& chain, uint8_t min_fire_chain)
+    {
+        if (chain.chain_count == 0)
+        {
+            return 0.0f;
+        }
+
+        const auto score = static_cast<float>(chain.score);
+        return chain.chain_count >= min_fire_chain ? score : score * SMALL_CHAIN_WEIGHT;
+    }
+
+    [[nodiscard]] bool IsStopped(const std::atomic<bool>* cancel, SearchClock::time_point deadline)
+    {
+        return (cancel && cancel->load(std::memory_order_relaxed)) || SearchClock::now() >= deadline;
+    }
+
+    // 정적 평가 (전치표에 있으면 재사용)
+    [[nodiscard]] float EvaluateCached(const PuyoBoard& board, uint64_t hash, PuyoTranspositionTable* table, uint32_t& hits)
+    {
+        PuyoTTEntry entry;
+        if (table && table->Probe(hash, entry))
+        {
+            ++hits;
+            return entry.value;
+        }
+
+        entry.value = PuyoBeamSearch::Evaluate(board);
+        if (table)
+        {
+            table->Store(hash, entry);
+        }
+
+        return entry.value;
+    }
+
+    // parent에서 22개 배치를 모두 시뮬레이션해 out[0..PLACEMENT_COUNT)에 기록. 평가한 보드 수 반환
+    uint32_t ExpandNode(const BeamNode& parent, const PuyoPair& pair, const PuyoChainState& state, uint8_t min_fire_chain, bool is_root,
+        PuyoTranspositionTable* table, uint32_t& hits, BeamNode* out)
+    {
+        std::array<PuyoSimResult, PuyoSimulator::PLACEMENT_COUNT> results;
+        PuyoSimulator::SimulateAll(parent.board, pair, results, state);
+
+        uint32_t evaluated = 0;
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            const auto& simulated = results[i];
+            if (!simulated.placed || simulated.game_over)
+            {
+                continue;
+            }
+
+            const uint8_t chain = simulated.chain.chain_count;
+
+            auto& child = out[i];
+            child.board = simulated.board;
+            child.hash = PuyoZobrist::HashResult(parent.hash, parent.board, pair, PuyoSimulator::PLACEMENTS[i], simulated);
+            child.path_value = parent.path_value + GetFireValue(simulated.chain, min_fire_chain);
+            child.value = child.path_value + EvaluateCached(child.board, child.hash, table, hits);
+            child.root = is_root ? static_cast<uint8_t>(i) : parent.root;
+            child.first_chain = is_root ? chain : parent.first_chain;
+            child.best_chain = std::max(parent.best_chain, chain);
+
+            ++evaluated;
+        }
+
+        return evaluated;
+    }
+
+    // 평가값 상위 width개만 남김 (같은 보드가 다른 순서로 만들어진 경우 하나만 유지)
+    void SelectBeam(std::vector<BeamNode>& nodes, size_t width)
+    {
+        std::erase_if(nodes, [](const BeamNode& node) { return node.value == NO_VALUE; });
+
+        std::sort(nodes.begin(), nodes.end(), [](const BeamNode& a, const BeamNode& b) { return a.value > b.value; });
+
+        size_t kept = 0;
+        for (size_t i = 0; i < nodes.size() && kept < width; ++i)
+        {
+            if (kept > 0 && nodes[kept - 1].hash == nodes[i].hash && nodes[kept - 1].value == nodes[i].value && nodes[kept - 1].board == nodes[i].board)
+            {
+                continue;
+            }
+
+            if (kept != i)
+            {
+                nodes[kept] = nodes[i];
+            }
+            ++kept;
+        }
+
+        nodes.resize(kept);
+    }
+}
+
+namespace PuyoBeamSearch
+{
+    PuyoBeamConfig GetLevelConfig(PuyoCpuLevel level)
+    {
+        const auto index = static_cast<size_t>(level);
+        return index < LEVEL_CONFIGS.size() ? LEVEL_CONFIGS[index] : LEVEL_CONFIGS.front();
+    }
+
+    uint8_t GetPotentialChain(const PuyoBoard& board)
+    {
+        uint8_t best = 0;
+
+        for (int x = 0; x < PuyoBoard::WIDTH; ++x)
+        {
+            const int height = board.GetHeight(x);
+            if (height + 2 > PuyoBoard::HEIGHT)
+            {
+                continue;
+            }
+
+            // 떨어뜨린 블록과 맞닿는 색만 시도
+            uint32_t colors = 0;
+            const auto add_color = [&board, &colors](int cx, int cy)
+                {
+                    if (PuyoBoard::IsInside(cx, cy) && IsPuyoColor(board.Get(cx, cy)))
+                    {
+                        colors |= 1u << static_cast<uint8_t>(board.Get(cx, cy));
+                    }
+                };
+
+            add_color(x, height - 1);
+            add_color(x - 1, height);
+            add_color(x + 1, height);
+            add_color(x - 1, height + 1);
+            add_color(x + 1, height + 1);
+
+            for (uint8_t cell = static_cast<uint8_t>(PuyoCell::Red); cell <= static_cast<uint8_t>(PuyoCell::Purple); ++cell)
+            {
+                if ((colors & (1u << cell)) == 0)
+                {
+                    continue;
+                }
+
+                PuyoBoard dropped = board;
+                dropped.Set(x, height, static_cast<PuyoCell>(cell));
+
+                uint8_t chain = RunChain(dropped);
+                if (chain == 0)
+                {
+                    // 터질 그룹이 없었으면 보드는 그대로이므로 하나 더 얹어 봄
+                    dropped.Set(x, height + 1, static_cast<PuyoCell>(cell));
+                    chain = RunChain(dropped);
+                }
+
+                best = std::max(best, chain);
+            }
+        }
+
+        return best;
+    }
+
+    float Evaluate(const PuyoBoard& board)
+    {
+        const auto potential = static_cast<float>(GetPotentialChain(board));
+        float value = POTENTIAL_WEIGHT * potential * potential;
+
+        PuyoColorBoards boards;
+        board.GetColorBoards(boards);
+
+        int connections = 0;
+        for (const auto& color : boards.colors)
+        {
+            connections += color.CountAdjacentPairs();
+        }
+        value += CONNECTION_WEIGHT * static_cast<float>(connections);
+
+        std::array<int, PuyoBoard::WIDTH> heights{};
+        for (int x = 0; x < PuyoBoard::WIDTH; ++x)
+        {
+            heights[x] = board.GetHeight(x);
+        }
+
+        for (int x = 0; x + 1 < PuyoBoard::WIDTH; ++x)
+        {
+            const int diff = heights[x] - heights[x + 1];
+            value -= BUMP_WEIGHT * static_cast<float>(diff * diff);
+        }
+
+        // 출현 위치(2, 3열)가 높아질수록 크게 감점
+        for (int x = 2; x <= 3; ++x)
+        {
+            const int over = heights[x] - DANGER_HEIGHT;
+            if (over > 0)
+            {
+                value -= DANGER_WEIGHT * static_cast<float>(over * over);
+            }
+        }
+
+        return value;
+    }
+
+    PuyoSearchResult Search(const PuyoSearchRequest& request, const PuyoBeamConfig& config, PuyoWorkerPool* pool, const std::atomic<bool>* cancel,
+        PuyoTranspositionTable* table)
+    {
+        const auto start = SearchClock::now();
+        const auto deadline = start + std::chrono::microseconds(config.time_budget_us);
+
+        PuyoSearchResult result;
+
+        const size_t depth = std::min<size_t>({ config.depth, request.pair_count, PuyoSearchRequest::MAX_PAIRS });
+        const size_t width = std::max<size_t>(config.beam_width, 1);
+
+        std::vector<BeamNode> beam(1);
+        beam.front().board = request.board;
+        beam.front().hash = PuyoZobrist::Hash(request.board);
+
+        if (table)
+        {
+            table->NewSearch();
+        }
+
+        std::vector<BeamNode> children;
+        std::atomic<bool> aborted{ false };
+        std::atomic<uint32_t> nodes{ 0 };
+        std::atomic<uint32_t> table_hits{ 0 };
+
+        for (size_t layer = 0; layer < depth; ++layer)
+        {
+            const bool is_root = layer == 0;
+            children.assign(beam.size() * PuyoSimulator::PLACEMENT_COUNT, BeamNode{});
+
+            // 첫 층은 항상 끝까지 진행 (22개뿐이고 결과가 없으면 배치할 곳이 없음)
+            const auto expand = [&](size_t index)
+                {
+                    if (!is_root && (aborted.load(std::memory_order_relaxed) || IsStopped(cancel, deadline)))
+                    {
+                        aborted.store(true, std::memory_order_relaxed);
+                        return;
+                    }
+
+                    uint32_t hits = 0;
+                    nodes.fetch_add(ExpandNode(beam[index], request.pairs[layer], request.state, config.min_fire_chain, is_root, table, hits,
+                        &children[index * PuyoSimulator::PLACEMENT_COUNT]), std::memory_order_relaxed);
+                    table_hits.fetch_add(hits, std::memory_order_relaxed);
+                };
+
+            if (pool && beam.size() > 1)
+            {
+                pool->ParallelFor(beam.size(), expand);
+            }
+            else
+            {
+                for (size_t i = 0; i < beam.size(); ++i)
+                {
+                    expand(i);
+                }
+            }
+
+            if (aborted.load(std::memory_order_relaxed))
+            {
+                result.timed_out = true;
+                break;
+            }
+
+            SelectBeam(children, width);
+            if (children.empty())
+            {
+                // 이 층의 모든 배치가 게임 오버면 이전 층의 최선 배치 사용
+                break;
+            }
+
+            beam.swap(children);
+            result.depth_reached = static_cast<uint8_t>(layer + 1);
+        }
+
+        if (result.depth_reached > 0)
+        {
+            const auto& best = beam.front();
+
+            result.placement = PuyoSimulator::PLACEMENTS[best.root];
+            result.value = best.value;
+            result.chain_count = best.first_chain;
+            result.best_chain = best.best_chain;
+            result.found = true;
+        }
+
+        result.nodes = nodes.load(std::memory_order_relaxed);
+        result.table_hits = table_hits.load(std::memory_order_relaxed);
+        result.elapsed_us = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(SearchClock::now() - start).count());
+
+        return result;
+    }
+}
+
+bool PuyoBeamSearcher::Start(const PuyoSearchRequest& request, const PuyoBeamConfig& config)
+{
+    if (task_)
+    {
+        return false;
+    }
+
+    auto task = std::make_shared<Task>();
+    task_ = task;
+
+    pool_.Submit([task, request, config, pool = &pool_, table = table_]()
+        {
+            task->result = PuyoBeamSearch::Search(request, config, pool, &task->cancel, table.get());
+            task->done.store(true, std::memory_order_release);
+        });
+
+    return true;
+}
+
+bool PuyoBeamSearcher::TryGetResult(PuyoSearchResult& result)
+{
+    if (!task_ || !task_->done.load(std::memory_order_acquire))
+    {
+        return false;
+    }
+
+    result = task_->result;
+    task_.reset();
+    return true;
+}
+
+void PuyoBeamSearcher::Cancel()
+{
+    if (task_)
+    {
+        task_->cancel.store(true, std::memory_order_relaxed);
+        task_.reset();
+    }
+}
@@ -0,0 +1,119 @@
+#pragma once
+/*
+ *
+ * 설명: CPU 상대용 빔 탐색 (현재 블록 + 다음 블록들의 배치 순서 탐색)
+ *  1. 한 층마다 빔에 남은 보드에서 22개 배치를 모두 시뮬레이션(PuyoSimulator::SimulateAll)하고
+ *     평가값 상위 beam_width개만 다음 층으로 넘김. 결과는 최선 경로의 첫 배치.
+ *  2. 한 층의 노드 확장은 PuyoWorkerPool::ParallelFor로 나눠 처리 (노드마다 결과 칸이 정해져 있어 잠금 없음).
+ *  3. 시간 예산(time_budget_us)이 지나거나 취소되면 마지막으로 끝난 층의 최선 배치를 반환.
+ *  4. 난이도는 빔 폭과 깊이로 조절 (GetLevelConfig).
+ *  5. PuyoBeamSearcher는 작업 스레드에서 탐색하고 결과를 폴링만 하므로 호출 스레드가 기다리지 않음.
+ *  6. 전치표를 주면 보드의 Zobrist 키로 정적 평가를 저장/재사용 (다른 배치 순서로 같은 보드가 나오거나,
+ *     이전 턴에 두 번째 층에서 본 보드가 이번 턴 첫 층에 다시 나오는 경우).
+ *
+ */
+
+#include "PuyoSimulator.hpp"
+#include "PuyoTranspositionTable.hpp"
+#include "PuyoWorkerPool.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+enum class PuyoCpuLevel : uint8_t
+{
+    Easy,
+    Normal,
+    Hard
+};
+
+struct PuyoBeamConfig
+{
+    uint16_t beam_width{ 16 };
+    uint8_t depth{ 2 };                 // 탐색할 블록 수 (요청의 pair_count를 넘지 않음)
+    uint32_t time_budget_us{ 40'000 };
+    uint8_t min_fire_chain{ 3 };        // 이보다 짧은 연쇄는 점수를 낮춰 평가 (연쇄를 쌓도록 유도)
+    uint32_t table_kb{ 0 };             // 탐색을 소유한 쪽이 만들 전치표 메모리 상한 (0이면 사용 안 함)
+};
+
+struct PuyoSearchRequest
+{
+    static constexpr size_t MAX_PAIRS = 3;  // 조작 중인 블록 + 다음 블록 2개
+
+    PuyoBoard board;
+    std::array<PuyoPair, MAX_PAIRS> pairs{};
+    uint8_t pair_count{ 0 };
+    PuyoChainState state;
+};
+
+struct PuyoSearchResult
+{
+    PuyoPlacement placement;
+    float value{ 0.0f };
+    uint8_t chain_count{ 0 };       // 첫 배치로 바로 터지는 연쇄 수
+    uint8_t best_chain{ 0 };        // 최선 경로에서 가장 긴 연쇄
+    uint8_t depth_reached{ 0 };     // 끝까지 탐색한 층 수
+    uint32_t nodes{ 0 };            // 평가한 보드 수
+    uint32_t table_hits{ 0 };       // 그중 전치표에서 가져온 평가 수
+    uint32_t elapsed_us{ 0 };
+    bool found{ false };            // 게임 오버가 아닌 배치가 하나도 없으면 false
+    bool timed_out{ false };
+};
+
+namespace PuyoBeamSearch
+{
+    [[nodiscard]] PuyoBeamConfig GetLevelConfig(PuyoCpuLevel level);
+
+    // 보드 정적 평가 (연쇄 잠재력, 같은 색 연결, 높이/출현 위치 위험도)
+    [[nodiscard]] float Evaluate(const PuyoBoard& board);
+
+    // 한 열에 한 색을 1~2개 떨어뜨려 터지는 가장 긴 연쇄 수
+    [[nodiscard]] uint8_t GetPotentialChain(const PuyoBoard& board);
+
+    // 동기 탐색. pool이 있으면 층마다 노드 확장을 작업 스레드에 나눔. table이 있으면 정적 평가를 재사용
+    [[nodiscard]] PuyoSearchResult Search(const PuyoSearchRequest& request, const PuyoBeamConfig& config,
+        PuyoWorkerPool* pool = nullptr, const std::atomic<bool>* cancel = nullptr, PuyoTranspositionTable* table = nullptr);
+}
+
+// 작업 스레드에서 탐색을 진행하고 결과는 폴링으로 가져가는 비동기 래퍼
+class PuyoBeamSearcher
+{
+public:
+    // 전치표는 취소된 탐색이 작업 스레드에서 끝날 때까지 살아 있어야 하므로 공유 소유
+    explicit PuyoBeamSearcher(PuyoWorkerPool& pool, std::shared_ptr<PuyoTranspositionTable> table = nullptr)
+        : pool_(pool)
+        , table_(std::move(table))
+    {
+    }
+
+    ~PuyoBeamSearcher() { Cancel(); }
+
+    PuyoBeamSearcher(const PuyoBeamSearcher&) = delete;
+    PuyoBeamSearcher& operator=(const PuyoBeamSearcher&) = delete;
+
+    // 이전 탐색이 진행 중이면 false
+    bool Start(const PuyoSearchRequest& request, const PuyoBeamConfig& config);
+
+    // 결과가 준비됐으면 꺼내고 true (기다리지 않음)
+    bool TryGetResult(PuyoSearchResult& result);
+
+    // 진행 중인 탐색을 버림 (작업 스레드는 다음 노드에서 멈춤)
+    void Cancel();
+
+    // 결과를 가져가거나 취소하기 전까지 true
+    [[nodiscard]] bool IsSearching() const { return task_ != nullptr; }
+
+private:
+    struct Task
+    {
+        std::atomic<bool> cancel{ false };
+        std::atomic<bool> done{ false };
+        PuyoSearchResult result;
+    };
+
+    PuyoWorkerPool& pool_;
+    std::shared_ptr<PuyoTranspositionTable> table_;
+    std::shared_ptr<Task> task_;
+};
@@ -0,0 +1,76 @@
+#include "PuyoBitboard.hpp"
+
+namespace
+{
+    constexpr PuyoBitboard BOARD_MASK = PuyoBitboard::Full();
+
+    static_assert(Constants::Game::MIN_MATCH_COUNT == 4, "FindVanishCells assumes groups of 4");
+
+    // 4개 이상 연결된 그룹에 속한 셀 전체를 flood fill 없이 계산
+    //  - 같은 색 이웃이 3개 이상인 셀, 또는 이웃이 2개 이상인 셀끼리 붙어 있으면 4개 이상 그룹에 속함 (격자에는 삼각형이 없음)
+    //  - 4개 이상 그룹의 셀은 모두 위 조건을 만족하거나 그런 셀의 이웃이므로 한 번 확장하면 그룹 전체가 됨
+    [[nodiscard]] constexpr PuyoBitboard FindVanishCells(const PuyoBitboard& color)
+    {
+        constexpr int SHIFT = PuyoBitboard::COLUMN_BITS;
+
+        // 각 방향에 같은 색 이웃이 있는 셀
+        const PuyoBitboard below{ color.lo & (color.lo << 1), color.hi & (color.hi << 1) };
+        const PuyoBitboard above{ color.lo & (color.lo >> 1), color.hi & (color.hi >> 1) };
+        const PuyoBitboard left{ color.lo & (color.lo << SHIFT), color.hi & ((color.hi << SHIFT) | (color.lo >> (64 - SHIFT))) };
+        const PuyoBitboard right{ color.lo & ((color.lo >> SHIFT) | (color.hi << (64 - SHIFT))), color.hi & (color.hi >> SHIFT) };
+
+        const PuyoBitboard vertical_both = below & above;
+        const PuyoBitboard vertical_any = below | above;
+        const PuyoBitboard horizontal_both = left & right;
+        const PuyoBitboard horizontal_any = left | right;
+
+        const PuyoBitboard three = (vertical_both & horizontal_any) | (horizontal_both & vertical_any);
+        const PuyoBitboard two = vertical_both | horizontal_both | (vertical_any & horizontal_any);
+        const PuyoBitboard two_pair = two & two.Neighbors();
+
+        return (three | two_pair).Expand() & color;
+    }
+}
+
+uint8_t FindPuyoGroups(std::span<const PuyoBitboard> colors, const PuyoBitboard& garbage, PuyoGroups& groups)
+{
+    groups.count = 0;
+    groups.cleared = PuyoBitboard{};
+    groups.garbage = PuyoBitboard{};
+
+    for (size_t color = 0; color < colors.size(); ++color)
+    {
+        // 사라질 셀만 남겨 flood fill은 실제 그룹에만 수행
+        PuyoBitboard remaining = FindVanishCells(colors[color] & BOARD_MASK);
+
+        while (!remaining.IsEmpty())
+        {
+            // 가장 낮은 셀에서 시작해 더 커지지 않을 때까지 이웃으로 확장
+            PuyoBitboard group = remaining.LowestBit();
+            for (;;)
+            {
+                const PuyoBitboard grown = group.Expand() & remaining;
+                if (grown == group)
+                {
+                    break;
+                }
+                group = grown;
+            }
+
+            remaining ^= group;
+
+            groups.masks[groups.count] = group;
+            groups.sizes[groups.count] = static_cast<uint8_t>(group.PopCount());
+            groups.colors[groups.count] = static_cast<uint8_t>(color);
+            groups.cleared |= group;
+            ++groups.count;
+        }
+    }
+
+    if (groups.count > 0)
+    {
+        groups.garbage = groups.cleared.Expand() & garbage & BOARD_MASK;
+    }
+
+    return groups.count;
+}
@@ -0,0 +1,126 @@
+#pragma once
+/*
+ *
+ * 설명: 6x13 보드의 셀 집합을 비트로 표현한 비트보드와 그룹 검색
+ *  1. 열마다 16비트 (y = 0이 최하위 비트). 0~3열은 lo, 4~5열은 hi 워드에 저장.
+ *  2. 비트 번호(x * 16 + y)가 PuyoBoard::ToIndex와 같아 셀 인덱스로 바로 사용 가능.
+ *  3. 그룹 검색은 이웃 수 비트 연산으로 사라질 셀을 먼저 고른 뒤 그 안에서만 시프트/마스크 flood fill
+ *     (재귀, 방문 플래그, 힙 할당 없음).
+ *  4. 결과는 그룹마다 비트마스크로 반환.
+ *
+ */
+
+#include "../core/common/constants/RuleConstants.hpp"
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+struct PuyoBitboard
+{
+    static constexpr int COLUMN_BITS = 16;
+    static constexpr int COLUMNS_PER_WORD = 64 / COLUMN_BITS;
+    static constexpr uint64_t COLUMN_MASK = (uint64_t{ 1 } << Constants::Board::BOARD_Y_COUNT) - 1;
+
+    static_assert(Constants::Board::BOARD_Y_COUNT <= COLUMN_BITS, "column must fit in COLUMN_BITS");
+    static_assert(Constants::Board::BOARD_X_COUNT <= COLUMNS_PER_WORD * 2, "board must fit in two words");
+
+    uint64_t lo{ 0 };   // 0~3열
+    uint64_t hi{ 0 };   // 4~5열
+
+    [[nodiscard]] static constexpr PuyoBitboard FromCell(int x, int y)
+    {
+        const uint64_t bit = uint64_t{ 1 } << ((x % COLUMNS_PER_WORD) * COLUMN_BITS + y);
+        return x < COLUMNS_PER_WORD ? PuyoBitboard{ bit, 0 } : PuyoBitboard{ 0, bit };
+    }
+
+    // 보드 안의 모든 셀
+    [[nodiscard]] static constexpr PuyoBitboard Full()
+    {
+        PuyoBitboard board;
+        for (int x = 0; x < Constants::Board::BOARD_X_COUNT; ++x)
+        {
+            const uint64_t column = COLUMN_MASK << ((x % COLUMNS_PER_WORD) * COLUMN_BITS);
+            (x < COLUMNS_PER_WORD ? board.lo : board.hi) |= column;
+        }
+        return board;
+    }
+
+    constexpr void Set(int x, int y) { *this |= FromCell(x, y); }
+    [[nodiscard]] constexpr bool Test(int x, int y) const { return !(*this & FromCell(x, y)).IsEmpty(); }
+
+    [[nodiscard]] constexpr bool IsEmpty() const { return (lo | hi) == 0; }
+    [[nodiscard]] constexpr int PopCount() const { return std::popcount(lo) + std::popcount(hi); }
+
+    // 가장 낮은 비트 하나만 남김
+    [[nodiscard]] constexpr PuyoBitboard LowestBit() const
+    {
+        return lo != 0 ? PuyoBitboard{ lo & (~lo + 1), 0 } : PuyoBitboard{ 0, hi & (~hi + 1) };
+    }
+
+    // 상하좌우 이웃 (자신 제외). 열 경계를 넘은 비트는 보드 밖 위치(y >= 13)에 떨어지므로 호출 측에서 마스크로 걸러냄
+    [[nodiscard]] constexpr PuyoBitboard Neighbors() const
+    {
+        return PuyoBitboard{
+            (lo << 1) | (lo >> 1) | (lo << COLUMN_BITS) | (lo >> COLUMN_BITS) | (hi << (64 - COLUMN_BITS)),
+            (hi << 1) | (hi >> 1) | (hi << COLUMN_BITS) | (hi >> COLUMN_BITS) | (lo >> (64 - COLUMN_BITS)) };
+    }
+
+    // 자신과 상하좌우 이웃
+    [[nodiscard]] constexpr PuyoBitboard Expand() const { return *this | Neighbors(); }
+
+    // 상하 또는 좌우로 맞닿은 켜진 셀 쌍의 수 (보드 안의 셀만 켜져 있어야 함)
+    [[nodiscard]] constexpr int CountAdjacentPairs() const
+    {
+        return std::popcount(lo & (lo >> 1)) + std::popcount(hi & (hi >> 1)) +
+            std::popcount(lo & (lo >> COLUMN_BITS)) + std::popcount(hi & (hi >> COLUMN_BITS)) +
+            std::popcount((lo >> (64 - COLUMN_BITS)) & hi);
+    }
+
+    // 켜진 비트마다 셀 인덱스(x * 16 + y)로 호출
+    template<typename Func>
+    constexpr void ForEachIndex(Func&& func) const
+    {
+        for (uint64_t word = lo; word != 0; word &= word - 1)
+        {
+            func(static_cast<uint8_t>(std::countr_zero(word)));
+        }
+
+        for (uint64_t word = hi; word != 0; word &= word - 1)
+        {
+            func(static_cast<uint8_t>(64 + std::countr_zero(word)));
+        }
+    }
+
+    [[nodiscard]] constexpr PuyoBitboard operator&(const PuyoBitboard& other) const { return { lo & other.lo, hi & other.hi }; }
+    [[nodiscard]] constexpr PuyoBitboard operator|(const PuyoBitboard& other) const { return { lo | other.lo, hi | other.hi }; }
+    [[nodiscard]] constexpr PuyoBitboard operator^(const PuyoBitboard& other) const { return { lo ^ other.lo, hi ^ other.hi }; }
+    [[nodiscard]] constexpr PuyoBitboard operator~() const { return { ~lo, ~hi }; }
+
+    constexpr PuyoBitboard& operator&=(const PuyoBitboard& other) { lo &= other.lo; hi &= other.hi; return *this; }
+    constexpr PuyoBitboard& operator|=(const PuyoBitboard& other) { lo |= other.lo; hi |= other.hi; return *this; }
+    constexpr PuyoBitboard& operator^=(const PuyoBitboard& other) { lo ^= other.lo; hi ^= other.hi; return *this; }
+
+    [[nodiscard]] constexpr bool operator==(const PuyoBitboard& other) const = default;
+};
+
+// 한 번에 찾은 그룹들 (masks[i]가 i번째 그룹의 셀)
+struct PuyoGroups
+{
+    static constexpr size_t MAX_GROUPS = (Constants::Board::BOARD_X_COUNT * Constants::Board::BOARD_Y_COUNT) / Constants::Game::MIN_MATCH_COUNT;
+
+    std::array<PuyoBitboard, MAX_GROUPS> masks{};
+    std::array<uint8_t, MAX_GROUPS> sizes{};
+    std::array<uint8_t, MAX_GROUPS> colors{};   // 입력 색 비트보드의 인덱스
+    PuyoBitboard cleared{};                     // 모든 그룹의 합
+    PuyoBitboard garbage{};                     // 그룹과 인접해 함께 제거될 방해 블록
+    uint8_t count{ 0 };
+
+    [[nodiscard]] uint8_t GetGroupSize(uint8_t group) const { return sizes[group]; }
+    [[nodiscard]] uint8_t GetCellCount() const { return static_cast<uint8_t>(cleared.PopCount()); }
+};
+
+// 색별 비트보드에서 MIN_MATCH_COUNT 이상 연결된 그룹 검색. 찾은 그룹 수 반환
+uint8_t FindPuyoGroups(std::span<const PuyoBitboard> colors, const PuyoBitboard& garbage, PuyoGroups& groups);
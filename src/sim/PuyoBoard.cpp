@@ -0,0 +1,163 @@
+#include "PuyoBoard.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#define PUYO_BOARD_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#include <bit>
+
+namespace
+{
+    [[nodiscard]] constexpr int GetChildOffsetX(PuyoRotation rotation)
+    {
+        switch (rotation)
+        {
+        case PuyoRotation::Right:
+            return 1;
+        case PuyoRotation::Left:
+            return -1;
+        default:
+            return 0;
+        }
+    }
+}
+
+int PuyoBoard::GetHeight(int x) const
+{
+    const uint8_t* column = GetColumn(x);
+
+#if PUYO_BOARD_SSE2
+    // 빈칸이 아닌 칸 비트마스크에서 바닥부터 이어진 1의 개수 (HEIGHT 이상 칸은 항상 비어 있음)
+    const __m128i cells = _mm_loadu_si128(reinterpret_cast<const __m128i*>(column));
+    const auto empty = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(cells, _mm_setzero_si128())));
+
+    return std::countr_zero(empty);
+#else
+    int height = 0;
+    while (height < HEIGHT && column[height] != 0)
+    {
+        ++height;
+    }
+
+    return height;
+#endif
+}
+
+int PuyoBoard::GetCellCount() const
+{
+    int count = 0;
+    for (int x = 0; x < WIDTH; ++x)
+    {
+        count += GetHeight(x);
+    }
+
+    return count;
+}
+
+bool PuyoBoard::CanPlace(int column, PuyoRotation rotation) const
+{
+    const int child_x = column + GetChildOffsetX(rotation);
+    if (!IsInside(column, 0) || !IsInside(child_x, 0))
+    {
+        return false;
+    }
+
+    if (child_x == column)
+    {
+        return GetHeight(column) + 2 <= HEIGHT;
+    }
+
+    return GetHeight(column) < HEIGHT && GetHeight(child_x) < HEIGHT;
+}
+
+bool PuyoBoard::Place(const PuyoPair& pair, int column, PuyoRotation rotation)
+{
+    if (!CanPlace(column, rotation))
+    {
+        return false;
+    }
+
+    const int child_x = column + GetChildOffsetX(rotation);
+
+    if (child_x != column)
+    {
+        Set(column, GetHeight(column), pair.axis);
+        Set(child_x, GetHeight(child_x), pair.child);
+        return true;
+    }
+
+    // 세로 배치는 아래쪽 블록부터 쌓음
+    const int height = GetHeight(column);
+    const bool child_below = rotation == PuyoRotation::Down;
+
+    Set(column, height, child_below ? pair.child : pair.axis);
+    Set(column, height + 1, child_below ? pair.axis : pair.child);
+    return true;
+}
+
+void PuyoBoard::GetColorBoards(PuyoColorBoards& boards) const
+{
+    std::array<std::array<uint64_t, 8>, 2> words{};
+
+    for (int x = 0; x < WIDTH; ++x)
+    {
+        const uint8_t* column = GetColumn(x);
+        auto& word = words[x / PuyoBitboard::COLUMNS_PER_WORD];
+        const int shift = (x % PuyoBitboard::COLUMNS_PER_WORD) * PuyoBitboard::COLUMN_BITS;
+
+#if PUYO_BOARD_SSE2
+        // 열 16바이트를 셀 값과 비교하면 movemask 결과가 그대로 열 비트마스크 (HEIGHT 이상 칸은 항상 0)
+        const __m128i cells = _mm_loadu_si128(reinterpret_cast<const __m128i*>(column));
+
+        for (uint8_t cell = static_cast<uint8_t>(PuyoCell::Red); cell <= static_cast<uint8_t>(PuyoCell::Garbage); ++cell)
+        {
+            const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(cells, _mm_set1_epi8(static_cast<char>(cell)))));
+            word[cell] |= static_cast<uint64_t>(mask) << shift;
+        }
+#else
+        // 셀 값(0~7)을 인덱스로 바로 누적해 분기 없이 처리
+        for (int y = 0; y < HEIGHT; ++y)
+        {
+            word[column[y] & 7] |= uint64_t{ 1 } << (shift + y);
+        }
+#endif
+    }
+
+    for (uint8_t i = 0; i < PUYO_COLOR_COUNT; ++i)
+    {
+        const uint8_t cell = static_cast<uint8_t>(PuyoCell::Red) + i;
+        boards.colors[i] = PuyoBitboard{ words[0][cell], words[1][cell] };
+    }
+
+    const uint8_t garbage = static_cast<uint8_t>(PuyoCell::Garbage);
+    boards.garbage = PuyoBitboard{ words[0][garbage], words[1][garbage] };
+}
+
+uint8_t PuyoBoard::FindGroups(PuyoGroups& groups) const
+{
+    PuyoColorBoards boards;
+    GetColorBoards(boards);
+
+    return FindPuyoGroups(boards.colors, boards.garbage, groups);
+}
+
+uint8_t PuyoBoard::ClearGroups(const PuyoGroups& groups)
+{
+    // 비트 번호가 셀 인덱스와 같으므로 그대로 지움
+    (groups.cleared | groups.garbage).ForEachIndex([this](uint8_t index)
+        {
+            cells_[index] = static_cast<uint8_t>(PuyoCell::Empty);
+        });
+
+    return static_cast<uint8_t>(groups.garbage.PopCount());
+}
+
+bool PuyoBoard::IsGameOver() const
+{
+    return
+        Get(2, HEIGHT - 1) != PuyoCell::Empty ||
+        Get(3, HEIGHT - 1) != PuyoCell::Empty ||
+        Get(2, HEIGHT - 2) != PuyoCell::Empty ||
+        Get(3, HEIGHT - 2) != PuyoCell::Empty;
+}
@@ -0,0 +1,127 @@
+#pragma once
+/*
+ *
+ * 설명: 헤드리스 규칙 엔진용 6x13 셀 보드 (SDL/GAME_APP/NETWORK 의존 없음)
+ *  1. 셀 하나를 1바이트로 열 우선(column-major) 저장. 열마다 16바이트로 맞춰 열 단위 처리가 쉬움.
+ *  2. y = 0이 바닥, BOARD_Y_COUNT - 1이 최상단 (BasePlayer::board_blocks_와 같은 좌표계).
+ *  3. 셀 값은 BlockType과 같은 숫자 (Empty = 0, 색 1~5, 방해 블록 = 7).
+ *  4. 모든 연산은 고정 크기 배열만 사용 (힙 할당 없음).
+ *  5. 그룹 검색은 색별 비트보드(PuyoBitboard)로 변환해 처리.
+ *  6. 중력은 모든 열을 한 번에 압축 (PuyoGravity).
+ *
+ */
+
+#include "PuyoBitboard.hpp"
+#include "PuyoGravity.hpp"
+#include "../core/common/constants/RuleConstants.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+enum class PuyoCell : uint8_t
+{
+    Empty = 0,
+    Red,
+    Green,
+    Blue,
+    Yellow,
+    Purple,
+    Garbage = 7
+};
+
+inline constexpr uint8_t PUYO_COLOR_COUNT = 5;
+
+[[nodiscard]] constexpr bool IsPuyoColor(PuyoCell cell)
+{
+    return cell >= PuyoCell::Red && cell <= PuyoCell::Purple;
+}
+
+// 조작 블록 (축 블록 + 회전하는 블록)
+struct PuyoPair
+{
+    PuyoCell axis{ PuyoCell::Red };
+    PuyoCell child{ PuyoCell::Red };
+};
+
+// 축 블록 기준 회전 블록의 위치
+enum class PuyoRotation : uint8_t
+{
+    Up,
+    Right,
+    Down,
+    Left
+};
+
+// 셀 종류별 비트보드 (colors[i]는 PuyoCell::Red + i)
+struct PuyoColorBoards
+{
+    std::array<PuyoBitboard, PUYO_COLOR_COUNT> colors{};
+    PuyoBitboard garbage{};
+};
+
+// 중력 적용 전 (x, y)에 있던 블록이 도착하는 행 (빈칸은 PuyoGravity::NO_LANDING)
+struct PuyoLanding
+{
+    alignas(16) std::array<uint8_t, Constants::Board::BOARD_X_COUNT * PuyoGravity::COLUMN_STRIDE> rows{};
+
+    [[nodiscard]] uint8_t GetRow(int x, int y) const { return rows[x * PuyoGravity::COLUMN_STRIDE + y]; }
+};
+
+class PuyoBoard
+{
+public:
+    static constexpr int WIDTH = Constants::Board::BOARD_X_COUNT;
+    static constexpr int HEIGHT = Constants::Board::BOARD_Y_COUNT;
+    static constexpr int COLUMN_STRIDE = 16;
+    static constexpr int CELL_COUNT = WIDTH * HEIGHT;
+
+    static_assert(HEIGHT <= COLUMN_STRIDE, "column must fit in COLUMN_STRIDE bytes");
+    static_assert(COLUMN_STRIDE == PuyoBitboard::COLUMN_BITS, "cell index must match bitboard bit index");
+    static_assert(COLUMN_STRIDE == PuyoGravity::COLUMN_STRIDE, "columns must match gravity kernel stride");
+
+    [[nodiscard]] static constexpr uint8_t ToIndex(int x, int y) { return static_cast<uint8_t>(x * COLUMN_STRIDE + y); }
+    [[nodiscard]] static constexpr int GetX(uint8_t index) { return index / COLUMN_STRIDE; }
+    [[nodiscard]] static constexpr int GetY(uint8_t index) { return index % COLUMN_STRIDE; }
+    [[nodiscard]] static constexpr bool IsInside(int x, int y) { return x >= 0 && x < WIDTH && y >= 0 && y < HEIGHT; }
+
+    void Clear() { cells_.fill(0); }
+
+    [[nodiscard]] PuyoCell Get(int x, int y) const { return static_cast<PuyoCell>(cells_[ToIndex(x, y)]); }
+    void Set(int x, int y, PuyoCell cell) { cells_[ToIndex(x, y)] = static_cast<uint8_t>(cell); }
+
+    // 바닥부터 쌓인 높이 (중력 적용 후의 보드 기준)
+    [[nodiscard]] int GetHeight(int x) const;
+    [[nodiscard]] int GetCellCount() const;
+
+    // 회전 블록이 보드 안에 들어가는 배치인지 (양쪽 열에 모두 자리가 있어야 함)
+    [[nodiscard]] bool CanPlace(int column, PuyoRotation rotation) const;
+
+    // 축/회전 블록을 해당 열에 떨어뜨림 (불가능한 배치면 false, 보드는 변경하지 않음)
+    bool Place(const PuyoPair& pair, int column, PuyoRotation rotation);
+
+    // 셀 종류별 비트보드 생성
+    void GetColorBoards(PuyoColorBoards& boards) const;
+
+    // MIN_MATCH_COUNT 이상 연결된 같은 색 그룹 검색. 찾은 그룹 수 반환
+    uint8_t FindGroups(PuyoGroups& groups) const;
+
+    // 그룹과 인접한 방해 블록(groups.garbage)을 함께 제거. 제거한 방해 블록 수 반환
+    uint8_t ClearGroups(const PuyoGroups& groups);
+
+    // 빈칸을 메우도록 모든 열을 아래로 압축. 블록이 이동했으면 true
+    bool ApplyGravity() { return PuyoGravity::CompactColumns(cells_.data(), nullptr, WIDTH); }
+
+    // 압축하면서 블록마다 착지할 행을 기록
+    bool ApplyGravity(PuyoLanding& landing) { return PuyoGravity::CompactColumns(cells_.data(), landing.rows.data(), WIDTH); }
+
+    // 출현 위치(2, 3열 상단 두 칸)가 막혔는지 (BasePlayer::IsGameOver와 동일)
+    [[nodiscard]] bool IsGameOver() const;
+
+    [[nodiscard]] const uint8_t* GetColumn(int x) const { return cells_.data() + x * COLUMN_STRIDE; }
+
+    [[nodiscard]] bool operator==(const PuyoBoard& other) const = default;
+
+private:
+    alignas(16) std::array<uint8_t, WIDTH * COLUMN_STRIDE> cells_{};
+};
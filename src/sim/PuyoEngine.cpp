@@ -0,0 +1,193 @@
+#include "PuyoEngine.hpp"
+#include "PuyoSimulator.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+PuyoEngine::PuyoEngine(uint32_t seed)
+{
+    Reset(seed);
+}
+
+void PuyoEngine::Reset(uint32_t seed)
+{
+    board_.Clear();
+    phase_ = PuyoPhase::Ready;
+
+    chain_state_ = PuyoChainState{};
+    total_score_ = 0;
+    play_time_ = 0.0f;
+
+    // xorshift 상태는 0이면 안 됨
+    random_state_ = seed != 0 ? seed : 1;
+}
+
+bool PuyoEngine::PlacePair(const PuyoPair& pair, int column, PuyoRotation rotation)
+{
+    if (phase_ != PuyoPhase::Ready || !board_.Place(pair, column, rotation))
+    {
+        return false;
+    }
+
+    phase_ = PuyoPhase::Resolving;
+    return true;
+}
+
+bool PuyoEngine::StepChain(PuyoChainStep& step)
+{
+    if (phase_ != PuyoPhase::Resolving)
+    {
+        step = PuyoChainStep{};
+        return false;
+    }
+
+    if (!PuyoSimulator::StepChain(board_, chain_state_, step))
+    {
+        EndChain();
+        return false;
+    }
+
+    total_score_ += step.score;
+    return true;
+}
+
+void PuyoEngine::ResolveChain(PuyoChainResult& result)
+{
+    result = PuyoChainResult{};
+
+    PuyoChainStep step;
+    while (StepChain(step))
+    {
+        result.Add(step);
+    }
+}
+
+int16_t PuyoEngine::DropGarbage(std::span<const uint8_t> columns)
+{
+    int16_t& pending = chain_state_.pending_garbage;
+    if (phase_ != PuyoPhase::Ready || pending <= 0)
+    {
+        return 0;
+    }
+
+    // 많으면 5줄만 떨어뜨리고 나머지는 다음 턴으로 (BasePlayer::GenerateIceBlocks와 동일)
+    const int16_t count = pending > MAX_GARBAGE_DROP ? MAX_GARBAGE_DROP : pending;
+    pending = static_cast<int16_t>(pending - count);
+
+    const int rows = count / PuyoBoard::WIDTH;
+    const int remainder = count % PuyoBoard::WIDTH;
+
+    std::array<int, PuyoBoard::WIDTH> drop{};
+    drop.fill(rows);
+
+    if (remainder > 0)
+    {
+        if (!columns.empty())
+        {
+            for (size_t i = 0; i < columns.size() && i < static_cast<size_t>(remainder); ++i)
+            {
+                if (columns[i] < PuyoBoard::WIDTH)
+                {
+                    drop[columns[i]] = rows + 1;
+                }
+            }
+        }
+        else
+        {
+            // 서로 다른 열 remainder개를 선택 (부분 셔플)
+            std::array<uint8_t, PuyoBoard::WIDTH> order{};
+            std::iota(order.begin(), order.end(), uint8_t{ 0 });
+
+            for (int i = 0; i < remainder; ++i)
+            {
+                const int pick = i + static_cast<int>(NextRandom() % static_cast<uint32_t>(PuyoBoard::WIDTH - i));
+                std::swap(order[i], order[pick]);
+                drop[order[i]] = rows + 1;
+            }
+        }
+    }
+
+    // 열 높이를 넘는 방해 블록은 버려짐
+    int16_t dropped = 0;
+    for (int x = 0; x < PuyoBoard::WIDTH; ++x)
+    {
+        const int height = board_.GetHeight(x);
+        const int top = std::min(PuyoBoard::HEIGHT, height + drop[x]);
+
+        for (int y = height; y < top; ++y)
+        {
+            board_.Set(x, y, PuyoCell::Garbage);
+            ++dropped;
+        }
+    }
+
+    if (board_.IsGameOver())
+    {
+        phase_ = PuyoPhase::GameOver;
+    }
+
+    return dropped;
+}
+
+bool PuyoEngine::PlayTurn(const PuyoPair& pair, int column, PuyoRotation rotation, PuyoChainResult& result)
+{
+    if (!PlacePair(pair, column, rotation))
+    {
+        return false;
+    }
+
+    ResolveChain(result);
+    DropGarbage();
+
+    return true;
+}
+
+void PuyoEngine::AddPlayTime(float seconds)
+{
+    SetPlayTime(play_time_ + seconds);
+}
+
+void PuyoEngine::SetPlayTime(float seconds)
+{
+    play_time_ = seconds;
+    chain_state_.margin = PuyoRules::GetMargin(play_time_);
+}
+
+void PuyoEngine::SaveState(PuyoEngineState& state) const
+{
+    state.board = board_;
+    state.phase = phase_;
+    state.chain = chain_state_;
+    state.score = total_score_;
+    state.play_time = play_time_;
+    state.random_state = random_state_;
+}
+
+void PuyoEngine::LoadState(const PuyoEngineState& state)
+{
+    board_ = state.board;
+    phase_ = state.phase;
+    chain_state_ = state.chain;
+    total_score_ = state.score;
+    play_time_ = state.play_time;
+    random_state_ = state.random_state;
+}
+
+void PuyoEngine::EndChain()
+{
+    // 연쇄가 끝나면 연쇄 수와 이월 점수 초기화 (BasePlayer::ResetComboState)
+    chain_state_.combo_count = 0;
+    chain_state_.rest_score = 0;
+
+    phase_ = board_.IsGameOver() ? PuyoPhase::GameOver : PuyoPhase::Ready;
+}
+
+uint32_t PuyoEngine::NextRandom()
+{
+    uint32_t x = random_state_;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    random_state_ = x;
+    return x;
+}
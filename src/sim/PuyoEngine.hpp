@@ -0,0 +1,142 @@
+#pragma once
+/*
+ *
+ * 설명: 플레이어 한 명의 헤드리스 규칙 엔진 (배치 -> 연쇄 처리 -> 점수 -> 방해 블록)
+ *  1. 렌더링/애니메이션과 무관하게 규칙만 결정적으로 진행. 같은 입력과 시드면 같은 결과.
+ *  2. StepChain으로 연쇄를 한 단계씩 진행할 수 있어 애니메이션 계층이 단계마다 연출 가능.
+ *  3. 점수/방해 블록 계산은 PuyoRules (LocalPlayer::CalculateScore와 같은 규칙).
+ *     연쇄 한 단계는 PuyoSimulator::StepChain을 그대로 사용.
+ *  4. 힙 할당 없음 (보드와 결과 모두 고정 크기).
+ *  5. SaveState/LoadState로 엔진 상태 전체를 복사/복원 (리플레이 키프레임).
+ *
+ */
+
+#include "PuyoBoard.hpp"
+#include "PuyoRules.hpp"
+
+#include <array>
+#include <cstdint>
+#include <span>
+
+enum class PuyoPhase : uint8_t
+{
+    Ready,          // 다음 블록 배치 대기
+    Resolving,      // 연쇄 처리 중
+    GameOver
+};
+
+struct PuyoChainStep
+{
+    uint8_t groups{ 0 };
+    uint8_t cleared{ 0 };           // 제거한 색 블록 수
+    uint8_t garbage_cleared{ 0 };   // 함께 제거한 방해 블록 수
+    uint32_t score{ 0 };
+    int16_t garbage_sent{ 0 };      // 상쇄 후 상대에게 보낼 방해 블록 수
+    int16_t garbage_offset{ 0 };    // 받을 방해 블록에서 상쇄한 수
+};
+
+struct PuyoChainResult
+{
+    uint8_t chain_count{ 0 };
+    std::array<PuyoChainStep, Constants::Game::MAX_COMBO> steps{};
+    uint32_t score{ 0 };
+    int16_t garbage_sent{ 0 };
+    int16_t garbage_offset{ 0 };    // 받을 방해 블록에서 상쇄한 수
+
+    void Add(const PuyoChainStep& step)
+    {
+        if (chain_count < steps.size())
+        {
+            steps[chain_count] = step;
+        }
+
+        ++chain_count;
+        score += step.score;
+        garbage_sent = static_cast<int16_t>(garbage_sent + step.garbage_sent);
+        garbage_offset = static_cast<int16_t>(garbage_offset + step.garbage_offset);
+    }
+};
+
+// 연쇄 진행 중 단계 사이에 이어지는 값
+struct PuyoChainState
+{
+    uint8_t combo_count{ 0 };
+    uint32_t rest_score{ 0 };       // 방해 블록으로 바꾸고 남은 점수
+    int16_t pending_garbage{ 0 };   // 받을 방해 블록 (상쇄 대상)
+    uint8_t margin{ PuyoRules::GetMargin(0.0f) };
+
+    [[nodiscard]] bool operator==(const PuyoChainState& other) const = default;
+};
+
+// 엔진 상태 전체 (이 값만 복원하면 이후 진행이 같음)
+struct PuyoEngineState
+{
+    PuyoBoard board;
+    PuyoPhase phase{ PuyoPhase::Ready };
+    PuyoChainState chain;
+    uint32_t score{ 0 };
+    float play_time{ 0.0f };
+    uint32_t random_state{ 1 };
+
+    [[nodiscard]] bool operator==(const PuyoEngineState& other) const = default;
+};
+
+class PuyoEngine
+{
+public:
+    // 한 번에 떨어지는 최대 방해 블록 수 (BasePlayer::GenerateLargeIceBlockGroup과 동일하게 5줄)
+    static constexpr int16_t MAX_GARBAGE_DROP = 5 * PuyoBoard::WIDTH;
+
+    explicit PuyoEngine(uint32_t seed = 1);
+
+    void Reset(uint32_t seed = 1);
+
+    // 블록 배치 (Ready 상태에서만 가능). 성공하면 Resolving
+    bool PlacePair(const PuyoPair& pair, int column, PuyoRotation rotation);
+
+    // 연쇄 한 단계 처리. 터질 그룹이 없으면 false를 반환하고 연쇄 종료 (Ready 또는 GameOver)
+    bool StepChain(PuyoChainStep& step);
+
+    // 남은 연쇄를 모두 처리
+    void ResolveChain(PuyoChainResult& result);
+
+    // 연쇄가 끝난 뒤 받을 방해 블록을 떨어뜨리고 게임 오버 판정. 떨어뜨린 수 반환
+    // columns가 있으면 나머지 칸 위치로 사용 (네트워크 동기화), 없으면 엔진 난수로 선택
+    int16_t DropGarbage(std::span<const uint8_t> columns = {});
+
+    // 배치 -> 연쇄 -> 방해 블록까지 한 턴 진행
+    bool PlayTurn(const PuyoPair& pair, int column, PuyoRotation rotation, PuyoChainResult& result);
+
+    void AddIncomingGarbage(int16_t count) { chain_state_.pending_garbage = static_cast<int16_t>(chain_state_.pending_garbage + count); }
+    void AddPlayTime(float seconds);
+
+    // 경과 시간을 누적하지 않고 지정 (틱에서 계산하면 끊어서 진행해도 같은 값)
+    void SetPlayTime(float seconds);
+
+    void SaveState(PuyoEngineState& state) const;
+    void LoadState(const PuyoEngineState& state);
+
+    [[nodiscard]] const PuyoBoard& GetBoard() const { return board_; }
+    [[nodiscard]] PuyoBoard& GetBoard() { return board_; }
+    [[nodiscard]] PuyoPhase GetPhase() const { return phase_; }
+    [[nodiscard]] uint32_t GetScore() const { return total_score_; }
+    [[nodiscard]] uint32_t GetRestScore() const { return chain_state_.rest_score; }
+    [[nodiscard]] uint8_t GetComboCount() const { return chain_state_.combo_count; }
+    [[nodiscard]] int16_t GetPendingGarbage() const { return chain_state_.pending_garbage; }
+    [[nodiscard]] float GetPlayTime() const { return play_time_; }
+    [[nodiscard]] const PuyoChainState& GetChainState() const { return chain_state_; }
+
+private:
+    void EndChain();
+    [[nodiscard]] uint32_t NextRandom();
+
+private:
+    PuyoBoard board_;
+    PuyoPhase phase_{ PuyoPhase::Ready };
+
+    PuyoChainState chain_state_;
+    uint32_t total_score_{ 0 };
+    float play_time_{ 0.0f };
+
+    uint32_t random_state_{ 1 };
+};
@@ -0,0 +1,183 @@
+#include "PuyoGravity.hpp"
+
+#include <array>
+#include <bit>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(_M_AMD64)
+#define PUYO_GRAVITY_X64 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define PUYO_TARGET_SSSE3
+#else
+#define PUYO_TARGET_SSSE3 __attribute__((target("ssse3")))
+#endif
+#endif
+
+namespace
+{
+    bool CompactScalar(uint8_t* columns, uint8_t* landing, int column_count)
+    {
+        bool moved = false;
+
+        for (int x = 0; x < column_count; ++x)
+        {
+            uint8_t* column = columns + x * PuyoGravity::COLUMN_STRIDE;
+            uint8_t* rows = landing ? landing + x * PuyoGravity::COLUMN_STRIDE : nullptr;
+
+            int write = 0;
+            for (int y = 0; y < PuyoGravity::COLUMN_STRIDE; ++y)
+            {
+                const uint8_t cell = column[y];
+                if (cell == 0)
+                {
+                    if (rows)
+                    {
+                        rows[y] = PuyoGravity::NO_LANDING;
+                    }
+                    continue;
+                }
+
+                if (rows)
+                {
+                    rows[y] = static_cast<uint8_t>(write);
+                }
+
+                if (write != y)
+                {
+                    column[write] = cell;
+                    moved = true;
+                }
+                ++write;
+            }
+
+            for (; write < PuyoGravity::COLUMN_STRIDE; ++write)
+            {
+                column[write] = 0;
+            }
+        }
+
+        return moved;
+    }
+
+#if PUYO_GRAVITY_X64
+    // 8비트 점유 마스크 -> 점유된 바이트 위치를 낮은 바이트부터 채운 셔플 인덱스 (남는 바이트는 0)
+    constexpr std::array<uint64_t, 256> MakeShuffleTable(uint8_t base)
+    {
+        std::array<uint64_t, 256> table{};
+        for (int mask = 0; mask < 256; ++mask)
+        {
+            int out = 0;
+            for (int bit = 0; bit < 8; ++bit)
+            {
+                if (mask & (1 << bit))
+                {
+                    table[mask] |= static_cast<uint64_t>(base + bit) << (8 * out++);
+                }
+            }
+        }
+        return table;
+    }
+
+    constexpr auto SHUFFLE_LOW = MakeShuffleTable(0);
+    constexpr auto SHUFFLE_HIGH = MakeShuffleTable(8);
+
+    PUYO_TARGET_SSSE3 bool CompactSsse3(uint8_t* columns, uint8_t* landing, int column_count)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i one = _mm_set1_epi8(1);
+        const __m128i iota = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+
+        bool moved = false;
+
+        for (int x = 0; x < column_count; ++x)
+        {
+            auto* column = reinterpret_cast<__m128i*>(columns + x * PuyoGravity::COLUMN_STRIDE);
+
+            const __m128i cells = _mm_loadu_si128(column);
+            const __m128i empty = _mm_cmpeq_epi8(cells, zero);
+            const auto occupied = static_cast<uint32_t>(~_mm_movemask_epi8(empty)) & 0xFFFF;
+
+            if (landing)
+            {
+                // 아래쪽 블록 수 = 착지 행. 빈칸은 0xFF
+                __m128i below = _mm_andnot_si128(empty, one);
+                __m128i prefix = _mm_add_epi8(below, _mm_slli_si128(below, 1));
+                prefix = _mm_add_epi8(prefix, _mm_slli_si128(prefix, 2));
+                prefix = _mm_add_epi8(prefix, _mm_slli_si128(prefix, 4));
+                prefix = _mm_add_epi8(prefix, _mm_slli_si128(prefix, 8));
+                below = _mm_or_si128(_mm_sub_epi8(prefix, below), empty);
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(landing + x * PuyoGravity::COLUMN_STRIDE), below);
+            }
+
+            const uint32_t low_mask = occupied & 0xFF;
+            const int shift = 8 * std::popcount(low_mask);
+            const uint64_t low = SHUFFLE_LOW[low_mask];
+            const uint64_t high = SHUFFLE_HIGH[occupied >> 8];
+
+            const uint64_t shuffle_low = low | (shift < 64 ? high << shift : 0);
+            const uint64_t shuffle_high = shift == 0 ? 0 : high >> (64 - shift);
+
+            const __m128i shuffle = _mm_set_epi64x(static_cast<long long>(shuffle_high), static_cast<long long>(shuffle_low));
+            const __m128i keep = _mm_cmpgt_epi8(_mm_set1_epi8(static_cast<char>(std::popcount(occupied))), iota);
+
+            _mm_storeu_si128(column, _mm_and_si128(_mm_shuffle_epi8(cells, shuffle), keep));
+
+            // 바닥부터 빈칸 없이 쌓여 있었으면 이동 없음 (분기 없이 모든 열을 같은 경로로 처리)
+            moved |= (occupied & (occupied + 1)) != 0;
+        }
+
+        return moved;
+    }
+
+    [[nodiscard]] bool DetectSsse3()
+    {
+#if defined(_MSC_VER)
+        int info[4]{};
+        __cpuid(info, 1);
+        return (info[2] & (1 << 9)) != 0;
+#else
+        return __builtin_cpu_supports("ssse3");
+#endif
+    }
+#endif
+}
+
+namespace PuyoGravity
+{
+    bool IsKernelSupported(PuyoGravityKernel kernel)
+    {
+        switch (kernel)
+        {
+        case PuyoGravityKernel::Scalar:
+            return true;
+#if PUYO_GRAVITY_X64
+        case PuyoGravityKernel::Ssse3:
+        {
+            static const bool supported = DetectSsse3();
+            return supported;
+        }
+#endif
+        default:
+            return false;
+        }
+    }
+
+    PuyoGravityKernel GetBestKernel()
+    {
+        static const PuyoGravityKernel kernel = IsKernelSupported(PuyoGravityKernel::Ssse3) ? PuyoGravityKernel::Ssse3 : PuyoGravityKernel::Scalar;
+        return kernel;
+    }
+
+    bool CompactColumns(uint8_t* columns, uint8_t* landing, int column_count, PuyoGravityKernel kernel)
+    {
+#if PUYO_GRAVITY_X64
+        if (kernel == PuyoGravityKernel::Ssse3 && IsKernelSupported(kernel))
+        {
+            return CompactSsse3(columns, landing, column_count);
+        }
+#endif
+        return CompactScalar(columns, landing, column_count);
+    }
+}
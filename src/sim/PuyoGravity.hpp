@@ -0,0 +1,39 @@
+#pragma once
+/*
+ *
+ * 설명: 열 우선 바이트 보드의 중력 처리 (모든 열의 빈칸을 한 번에 압축)
+ *  1. 열마다 COLUMN_STRIDE(16)바이트, y = 0이 바닥. 0이 아닌 셀을 순서를 유지한 채 아래로 모음.
+ *  2. SSSE3 커널: 열의 빈칸 비트마스크로 pshufb 셔플 인덱스를 만들어 열 전체를 한 번에 압축하고,
+ *     바이트 prefix sum으로 착지 행을 계산 (셔플 인덱스는 8비트 마스크 256개짜리 테이블 두 개를 이어 붙임).
+ *  3. x64가 아니거나 CPU가 SSSE3를 지원하지 않으면 스칼라 커널 사용 (결과 동일).
+ *  4. 착지 행: 중력 적용 전 (x, y)에 있던 블록이 도착하는 행. 빈칸은 NO_LANDING. 애니메이션 계층이 이 행까지 낙하시킴.
+ *
+ */
+
+#include <cstdint>
+
+enum class PuyoGravityKernel : uint8_t
+{
+    Scalar,
+    Ssse3
+};
+
+namespace PuyoGravity
+{
+    inline constexpr int COLUMN_STRIDE = 16;
+    inline constexpr uint8_t NO_LANDING = 0xFF;
+
+    [[nodiscard]] bool IsKernelSupported(PuyoGravityKernel kernel);
+
+    // 현재 CPU에서 가장 빠른 커널 (처음 호출할 때 한 번만 검사)
+    [[nodiscard]] PuyoGravityKernel GetBestKernel();
+
+    // columns: column_count * COLUMN_STRIDE 바이트. landing은 같은 크기이거나 nullptr
+    // 블록이 하나라도 이동했으면 true
+    bool CompactColumns(uint8_t* columns, uint8_t* landing, int column_count, PuyoGravityKernel kernel);
+
+    inline bool CompactColumns(uint8_t* columns, uint8_t* landing, int column_count)
+    {
+        return CompactColumns(columns, landing, column_count, GetBestKernel());
+    }
+}
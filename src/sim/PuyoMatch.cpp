@@ -0,0 +1,108 @@
+#include "PuyoMatch.hpp"
+
+namespace
+{
+    // 방해 블록 열 선택 난수는 플레이어마다 다른 시드 (블록 순서 시드와도 분리)
+    [[nodiscard]] constexpr uint32_t GetEngineSeed(uint32_t seed, int player)
+    {
+        return (seed ^ 0xA511E9B3u) * 0x9E3779B1u + static_cast<uint32_t>(player + 1);
+    }
+}
+
+PuyoMatch::PuyoMatch(uint32_t seed)
+{
+    Reset(seed);
+}
+
+void PuyoMatch::Reset(uint32_t seed)
+{
+    seed_ = seed;
+    tick_ = 0;
+
+    for (int player = 0; player < PLAYER_COUNT; ++player)
+    {
+        engines_[player].Reset(GetEngineSeed(seed, player));
+        pieces_[player].Reset(seed);
+    }
+}
+
+bool PuyoMatch::Apply(const PuyoMatchInput& input, PuyoChainResult* chain)
+{
+    if (input.player >= PLAYER_COUNT || input.tick < tick_ || IsFinished())
+    {
+        return false;
+    }
+
+    PuyoEngine& engine = engines_[input.player];
+    if (engine.GetPhase() != PuyoPhase::Ready || !engine.GetBoard().CanPlace(input.column, input.rotation))
+    {
+        return false;
+    }
+
+    engine.SetPlayTime(static_cast<float>(input.tick) / static_cast<float>(TICK_RATE));
+
+    PuyoChainResult result;
+    engine.PlayTurn(pieces_[input.player].Next(), input.column, input.rotation, result);
+
+    if (result.garbage_sent > 0)
+    {
+        engines_[1 - input.player].AddIncomingGarbage(result.garbage_sent);
+    }
+
+    tick_ = input.tick;
+
+    if (chain)
+    {
+        *chain = result;
+    }
+
+    return true;
+}
+
+bool PuyoMatch::IsFinished() const
+{
+    for (const auto& engine : engines_)
+    {
+        if (engine.GetPhase() == PuyoPhase::GameOver)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+int PuyoMatch::GetWinner() const
+{
+    const bool first_over = engines_[0].GetPhase() == PuyoPhase::GameOver;
+    const bool second_over = engines_[1].GetPhase() == PuyoPhase::GameOver;
+
+    if (first_over == second_over)
+    {
+        return -1;
+    }
+
+    return first_over ? 1 : 0;
+}
+
+void PuyoMatch::SaveState(PuyoMatchState& state) const
+{
+    for (int player = 0; player < PLAYER_COUNT; ++player)
+    {
+        engines_[player].SaveState(state.players[player]);
+        state.piece_index[player] = pieces_[player].GetIndex();
+    }
+
+    state.tick = tick_;
+}
+
+void PuyoMatch::LoadState(const PuyoMatchState& state)
+{
+    for (int player = 0; player < PLAYER_COUNT; ++player)
+    {
+        engines_[player].LoadState(state.players[player]);
+        pieces_[player].Seek(state.piece_index[player]);
+    }
+
+    tick_ = state.tick;
+}
@@ -0,0 +1,76 @@
+#pragma once
+/*
+ *
+ * 설명: 두 플레이어 헤드리스 대전 (PuyoEngine 2개 + 블록 순서)
+ *  1. 입력은 (틱, 플레이어, 열, 회전) 배치 하나. 틱은 게임 루프 고정 스텝(60 Hz) 번호.
+ *  2. 배치하면 그 플레이어의 다음 쌍으로 한 턴을 진행하고, 상쇄 후 남은 방해 블록은 상대가 받을 수에 더함.
+ *  3. 경과 시간은 누적하지 않고 틱에서 계산해 지정하므로 같은 시드와 입력이면 어디서 끊어 진행해도 결과가 같음
+ *     (리플레이 탐색, 대전 러너).
+ *  4. 블록 순서는 두 플레이어가 같고(시드 하나), 방해 블록 열 선택 난수는 플레이어마다 다름.
+ *
+ */
+
+#include "PuyoEngine.hpp"
+#include "PuyoPieceSequence.hpp"
+
+#include <array>
+#include <cstdint>
+
+struct PuyoMatchInput
+{
+    uint32_t tick{ 0 };
+    uint8_t player{ 0 };
+    uint8_t column{ 0 };
+    PuyoRotation rotation{ PuyoRotation::Up };
+};
+
+// 대전 상태 전체 (리플레이 키프레임)
+struct PuyoMatchState
+{
+    static constexpr int PLAYER_COUNT = 2;
+
+    std::array<PuyoEngineState, PLAYER_COUNT> players{};
+    std::array<uint32_t, PLAYER_COUNT> piece_index{};
+    uint32_t tick{ 0 };     // 마지막으로 적용한 입력의 틱
+
+    [[nodiscard]] bool operator==(const PuyoMatchState& other) const = default;
+};
+
+class PuyoMatch
+{
+public:
+    static constexpr int PLAYER_COUNT = PuyoMatchState::PLAYER_COUNT;
+    static constexpr uint32_t TICK_RATE = 60;
+
+    explicit PuyoMatch(uint32_t seed = 1);
+
+    void Reset(uint32_t seed);
+
+    // 입력 적용. 끝난 대전, 지난 틱, 배치할 수 없는 위치면 false (상태 변화 없음)
+    bool Apply(const PuyoMatchInput& input, PuyoChainResult* chain = nullptr);
+
+    // 플레이어가 ahead번째 뒤에 받을 쌍 (0 = 지금 조작할 쌍)
+    [[nodiscard]] PuyoPair GetPair(int player, uint32_t ahead = 0) const
+    {
+        return pieces_[player].Get(pieces_[player].GetIndex() + ahead);
+    }
+
+    [[nodiscard]] const PuyoEngine& GetEngine(int player) const { return engines_[player]; }
+    [[nodiscard]] uint32_t GetSeed() const { return seed_; }
+    [[nodiscard]] uint32_t GetTick() const { return tick_; }
+
+    [[nodiscard]] bool IsFinished() const;
+
+    // 혼자 남은 플레이어 (진행 중이거나 동시에 끝나면 -1)
+    [[nodiscard]] int GetWinner() const;
+
+    void SaveState(PuyoMatchState& state) const;
+    void LoadState(const PuyoMatchState& state);
+
+private:
+    uint32_t seed_{ 1 };
+    uint32_t tick_{ 0 };
+
+    std::array<PuyoEngine, PLAYER_COUNT> engines_;
+    std::array<PuyoPieceSequence, PLAYER_COUNT> pieces_;
+};
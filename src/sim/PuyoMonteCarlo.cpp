@@ -0,0 +1,352 @@
+#include "PuyoMonteCarlo.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <random>
+
+namespace
+{
+    using SearchClock = std::chrono::steady_clock;
+
+    // 보상(0 ~ 1)을 정수로 누적하기 위한 배율
+    constexpr double VALUE_SCALE = 65536.0;
+
+    // 잠재 연쇄는 실제로 터뜨린 연쇄보다 조금 낮게 평가 (충분히 쌓였으면 터뜨리도록)
+    constexpr float POTENTIAL_DISCOUNT = 0.9f;
+
+    // 시계 확인 간격 (플레이아웃 수)
+    constexpr uint32_t STOP_CHECK_INTERVAL = 8;
+
+    enum NodeState : uint8_t
+    {
+        Leaf,
+        Expanding,
+        Expanded,
+        Full        // 노드 풀이 모자라 확장하지 못함 (잎으로만 사용)
+    };
+
+    [[nodiscard]] PuyoPair RandomPair(std::mt19937& rng)
+    {
+        return { static_cast<PuyoCell>(1 + rng() % PUYO_COLOR_COUNT), static_cast<PuyoCell>(1 + rng() % PUYO_COLOR_COUNT) };
+    }
+
+    // 두 블록 색이 같으면 Down/Left는 Up/Right와 결과가 같으므로 건너뜀
+    [[nodiscard]] bool IsPlayable(const PuyoBoard& board, const PuyoPair& pair, const PuyoPlacement& placement)
+    {
+        if (pair.axis == pair.child && (placement.rotation == PuyoRotation::Down || placement.rotation == PuyoRotation::Left))
+        {
+            return false;
+        }
+
+        return board.CanPlace(placement.column, placement.rotation);
+    }
+
+    void AtomicMax(std::atomic<uint8_t>& target, uint8_t value)
+    {
+        uint8_t current = target.load(std::memory_order_relaxed);
+        while (current < value && !target.compare_exchange_weak(current, value, std::memory_order_relaxed))
+        {
+        }
+    }
+}
+
+struct PuyoMonteCarlo::Node
+{
+    std::atomic<uint32_t> visits{ 0 };
+    std::atomic<uint32_t> virtual_visits{ 0 };
+    std::atomic<uint64_t> value_sum{ 0 };
+    std::atomic<uint32_t> first_child{ 0 };     // 자식 22개의 시작 인덱스 (자식 i는 PLACEMENTS[i])
+    std::atomic<uint8_t> state{ Leaf };
+
+    void Reset()
+    {
+        visits.store(0, std::memory_order_relaxed);
+        virtual_visits.store(0, std::memory_order_relaxed);
+        value_sum.store(0, std::memory_order_relaxed);
+        first_child.store(0, std::memory_order_relaxed);
+        state.store(Leaf, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] uint32_t GetLoadedVisits() const
+    {
+        return visits.load(std::memory_order_relaxed) + virtual_visits.load(std::memory_order_relaxed);
+    }
+};
+
+struct PuyoMonteCarlo::SearchContext
+{
+    const PuyoSearchRequest& request;
+    const PuyoMctsConfig& config;
+    const std::atomic<bool>* cancel{ nullptr };
+    SearchClock::time_point deadline;
+
+    std::atomic<bool> stopped{ false };
+    std::atomic<uint64_t> playouts{ 0 };
+    std::atomic<uint8_t> max_depth{ 0 };
+    std::atomic<uint8_t> best_chain{ 0 };
+
+    [[nodiscard]] bool IsStopped()
+    {
+        if (stopped.load(std::memory_order_relaxed))
+        {
+            return true;
+        }
+
+        if ((cancel && cancel->load(std::memory_order_relaxed)) || SearchClock::now() >= deadline)
+        {
+            stopped.store(true, std::memory_order_relaxed);
+            return true;
+        }
+
+        return false;
+    }
+};
+
+PuyoMonteCarlo::PuyoMonteCarlo(uint32_t node_capacity)
+    : nodes_(std::make_unique<Node[]>(std::max<uint32_t>(node_capacity, 1)))
+    , capacity_(std::max<uint32_t>(node_capacity, 1))
+{
+}
+
+PuyoMonteCarlo::~PuyoMonteCarlo() = default;
+
+bool PuyoMonteCarlo::TryExpand(Node& node)
+{
+    uint8_t expected = Leaf;
+    if (!node.state.compare_exchange_strong(expected, Expanding, std::memory_order_acq_rel))
+    {
+        return expected == Expanded;
+    }
+
+    const uint32_t first = node_count_.fetch_add(static_cast<uint32_t>(PuyoSimulator::PLACEMENT_COUNT), std::memory_order_relaxed);
+    if (static_cast<uint64_t>(first) + PuyoSimulator::PLACEMENT_COUNT > capacity_)
+    {
+        node.state.store(Full, std::memory_order_release);
+        return false;
+    }
+
+    for (size_t i = 0; i < PuyoSimulator::PLACEMENT_COUNT; ++i)
+    {
+        nodes_[first + i].Reset();
+    }
+
+    // 자식 초기화가 끝난 뒤 Expanded를 보여야 다른 스레드가 초기화 전 값을 읽지 않음
+    node.first_child.store(first, std::memory_order_relaxed);
+    node.state.store(Expanded, std::memory_order_release);
+    return true;
+}
+
+void PuyoMonteCarlo::RunPlayouts(SearchContext& context, size_t worker)
+{
+    const auto& request = context.request;
+    const auto& config = context.config;
+
+    std::mt19937 rng(config.seed + static_cast<uint32_t>(worker) * 0x9E3779B9u);
+
+    const uint32_t virtual_loss = std::max<uint32_t>(config.virtual_loss, 1);
+    const float target_chain = static_cast<float>(std::max<uint8_t>(config.target_chain, 1));
+
+    std::array<uint32_t, MAX_TREE_DEPTH + 1> path{};
+    PuyoSimResult simulated;
+
+    for (uint32_t playout = 0;; ++playout)
+    {
+        // 첫 플레이아웃은 시간과 관계없이 진행 (결과가 비지 않도록)
+        if (playout > 0 && playout % STOP_CHECK_INTERVAL == 0 && context.IsStopped())
+        {
+            break;
+        }
+
+        PuyoBoard board = request.board;
+        uint8_t best = 0;
+        bool dead = false;
+
+        size_t depth = 0;
+        uint32_t index = 0;
+
+        // 1. 선택: UCT 점수가 가장 높은 자식으로 내려가며 가상 손실을 더함
+        while (depth < MAX_TREE_DEPTH)
+        {
+            Node& node = nodes_[index];
+
+            uint8_t state = node.state.load(std::memory_order_acquire);
+            if (state == Leaf && (index == 0 || node.visits.load(std::memory_order_relaxed) > 0))
+            {
+                // 두 번째로 도달한 잎만 확장 (한 번 본 잎은 플레이아웃만)
+                state = TryExpand(node) ? static_cast<uint8_t>(Expanded) : node.state.load(std::memory_order_acquire);
+            }
+
+            if (state != Expanded)
+            {
+                break;
+            }
+
+            const PuyoPair pair = depth < request.pair_count ? request.pairs[depth] : RandomPair(rng);
+            const uint32_t first = node.first_child.load(std::memory_order_relaxed);
+            const float log_visits = std::log(static_cast<float>(std::max<uint32_t>(node.GetLoadedVisits(), 1)));
+
+            int chosen = -1;
+            float chosen_score = -std::numeric_limits<float>::infinity();
+
+            for (size_t i = 0; i < PuyoSimulator::PLACEMENT_COUNT; ++i)
+            {
+                if (!IsPlayable(board, pair, PuyoSimulator::PLACEMENTS[i]))
+                {
+                    continue;
+                }
+
+                const Node& child = nodes_[first + i];
+                const uint32_t loaded = child.GetLoadedVisits();
+                if (loaded == 0)
+                {
+                    chosen = static_cast<int>(i);
+                    break;
+                }
+
+                const auto n = static_cast<float>(loaded);
+                const auto mean = static_cast<float>(static_cast<double>(child.value_sum.load(std::memory_order_relaxed)) / VALUE_SCALE) / n;
+                const float score = mean + config.exploration * std::sqrt(log_visits / n);
+
+                if (score > chosen_score)
+                {
+                    chosen_score = score;
+                    chosen = static_cast<int>(i);
+                }
+            }
+
+            if (chosen < 0)
+            {
+                // 놓을 곳이 없음 (출현 위치가 막힘)
+                dead = true;
+                break;
+            }
+
+            index = first + static_cast<uint32_t>(chosen);
+            nodes_[index].virtual_visits.fetch_add(virtual_loss, std::memory_order_relaxed);
+            path[++depth] = index;
+
+            const auto& placement = PuyoSimulator::PLACEMENTS[chosen];
+            if (!PuyoSimulator::Simulate(board, pair, placement.column, placement.rotation, simulated, depth == 1 ? request.state : PuyoChainState{}) ||
+                simulated.game_over)
+            {
+                dead = true;
+                break;
+            }
+
+            board = simulated.board;
+            best = std::max(best, simulated.chain.chain_count);
+        }
+
+        // 2. 잎 평가: 무작위 블록을 무작위 위치에 이어 둔 뒤 잠재 연쇄 확인
+        for (size_t step = 0; !dead && step < config.rollout_depth; ++step)
+        {
+            const size_t piece = depth + step;
+            const PuyoPair pair = piece < request.pair_count ? request.pairs[piece] : RandomPair(rng);
+
+            const size_t start = rng() % PuyoSimulator::PLACEMENT_COUNT;
+            dead = true;
+
+            for (size_t offset = 0; offset < PuyoSimulator::PLACEMENT_COUNT; ++offset)
+            {
+                const auto& placement = PuyoSimulator::PLACEMENTS[(start + offset) % PuyoSimulator::PLACEMENT_COUNT];
+                if (!IsPlayable(board, pair, placement))
+                {
+                    continue;
+                }
+
+                if (PuyoSimulator::Simulate(board, pair, placement.column, placement.rotation, simulated) && !simulated.game_over)
+                {
+                    board = simulated.board;
+                    best = std::max(best, simulated.chain.chain_count);
+                    dead = false;
+                }
+                break;
+            }
+        }
+
+        float reward = 0.0f;
+        if (!dead)
+        {
+            const uint8_t potential = PuyoBeamSearch::GetPotentialChain(board);
+            reward = std::min(1.0f, std::max(static_cast<float>(best), POTENTIAL_DISCOUNT * static_cast<float>(potential)) / target_chain);
+
+            AtomicMax(context.best_chain, std::max(best, potential));
+        }
+
+        // 3. 역전파: 방문 수/보상을 더하고 가상 손실을 되돌림
+        const auto scaled = static_cast<uint64_t>(static_cast<double>(reward) * VALUE_SCALE);
+        for (size_t d = 0; d <= depth; ++d)
+        {
+            Node& node = nodes_[path[d]];
+            node.visits.fetch_add(1, std::memory_order_relaxed);
+            node.value_sum.fetch_add(scaled, std::memory_order_relaxed);
+
+            if (d > 0)
+            {
+                node.virtual_visits.fetch_sub(virtual_loss, std::memory_order_relaxed);
+            }
+        }
+
+        context.playouts.fetch_add(1, std::memory_order_relaxed);
+        AtomicMax(context.max_depth, static_cast<uint8_t>(depth));
+    }
+}
+
+PuyoMctsResult PuyoMonteCarlo::Search(const PuyoSearchRequest& request, const PuyoMctsConfig& config, PuyoWorkerPool* pool, const std::atomic<bool>* cancel)
+{
+    const auto start = SearchClock::now();
+
+    PuyoMctsResult result;
+    if (request.pair_count == 0)
+    {
+        return result;
+    }
+
+    nodes_[0].Reset();
+    node_count_.store(1, std::memory_order_relaxed);
+
+    SearchContext context{ request, config, cancel, start + std::chrono::microseconds(config.time_budget_us) };
+
+    const size_t workers = pool ? pool->GetThreadCount() : 1;
+    if (workers > 1)
+    {
+        pool->ParallelFor(workers, [this, &context](size_t worker) { RunPlayouts(context, worker); });
+    }
+    else
+    {
+        RunPlayouts(context, 0);
+    }
+
+    // 방문 수가 가장 많은 첫 배치 (평균 보상보다 안정적)
+    const Node& root = nodes_[0];
+    if (root.state.load(std::memory_order_acquire) == Expanded)
+    {
+        const uint32_t first = root.first_child.load(std::memory_order_relaxed);
+
+        for (size_t i = 0; i < PuyoSimulator::PLACEMENT_COUNT; ++i)
+        {
+            const Node& child = nodes_[first + i];
+            const uint32_t visits = child.visits.load(std::memory_order_relaxed);
+
+            if (visits == 0 || visits <= result.visits || !IsPlayable(request.board, request.pairs[0], PuyoSimulator::PLACEMENTS[i]))
+            {
+                continue;
+            }
+
+            result.placement = PuyoSimulator::PLACEMENTS[i];
+            result.visits = visits;
+            result.value = static_cast<float>(static_cast<double>(child.value_sum.load(std::memory_order_relaxed)) / VALUE_SCALE / visits);
+            result.found = true;
+        }
+    }
+
+    result.playouts = context.playouts.load(std::memory_order_relaxed);
+    result.nodes = std::min(node_count_.load(std::memory_order_relaxed), capacity_);
+    result.max_depth = context.max_depth.load(std::memory_order_relaxed);
+    result.best_chain = context.best_chain.load(std::memory_order_relaxed);
+    result.elapsed_us = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(SearchClock::now() - start).count());
+
+    return result;
+}
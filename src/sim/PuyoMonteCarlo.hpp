@@ -0,0 +1,75 @@
+#pragma once
+/*
+ *
+ * 설명: 긴 연쇄 계획용 병렬 몬테카를로 트리 탐색 (강한 CPU 상대, 오프라인 퍼즐 생성)
+ *  1. 트리 노드는 배치(PLACEMENTS 인덱스)만 가지는 open-loop 트리. 알려진 블록(요청의 pairs) 뒤로는
+ *     플레이아웃마다 블록 색을 새로 뽑으므로 같은 노드가 여러 블록 순서의 평균 가치를 가짐.
+ *  2. 작업 스레드들이 한 트리를 함께 탐색 (PuyoWorkerPool::ParallelFor). 노드 통계는 원자 변수만 사용하고
+ *     내려가는 동안 가상 손실(virtual loss)을 더해 다른 스레드가 같은 경로로 몰리지 않게 함.
+ *  3. 노드는 미리 잡아 둔 풀에서 22개씩 한 번에 할당하며, 한 스레드만 CAS로 확장 권한을 얻음 (잠금 없음).
+ *  4. 잎 평가는 경로에서 터진 연쇄와 마지막 보드의 잠재 연쇄(PuyoBeamSearch::GetPotentialChain) 중
+ *     큰 값을 target_chain으로 나눈 값. rollout_depth를 주면 잎에서 무작위 블록을 무작위 위치에 더 이어 둠.
+ *  5. 결과는 방문 수가 가장 많은 첫 배치. 시간 예산이 지나거나 취소되면 멈춤.
+ *
+ */
+
+#include "PuyoBeamSearch.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+struct PuyoMctsConfig
+{
+    uint32_t time_budget_us{ 100'000 };
+    uint8_t rollout_depth{ 0 };         // 잎에서 무작위 위치로 이어 둘 블록 수 (무작위 배치는 연쇄 모양을 망쳐 기본은 0)
+    uint8_t virtual_loss{ 3 };          // 내려가는 동안 노드에 더해 두는 방문 수 (보상 0으로 취급)
+    uint8_t target_chain{ 12 };         // 보상 1.0에 해당하는 연쇄 수
+    float exploration{ 0.35f };         // UCT 탐색 상수
+    uint32_t seed{ 1 };
+};
+
+struct PuyoMctsResult
+{
+    PuyoPlacement placement;
+    float value{ 0.0f };            // 선택한 배치의 평균 보상 (0 ~ 1)
+    uint32_t visits{ 0 };           // 선택한 배치의 방문 수
+    uint64_t playouts{ 0 };
+    uint32_t nodes{ 0 };            // 트리에 할당한 노드 수
+    uint8_t max_depth{ 0 };         // 트리에서 가장 깊이 내려간 층
+    uint8_t best_chain{ 0 };        // 플레이아웃에서 본 가장 긴 연쇄 (잠재 연쇄 포함)
+    uint32_t elapsed_us{ 0 };
+    bool found{ false };
+};
+
+class PuyoMonteCarlo
+{
+public:
+    static constexpr uint32_t DEFAULT_NODE_CAPACITY = 1u << 20;    // 노드 24바이트 기준 약 24MB
+    static constexpr uint8_t MAX_TREE_DEPTH = 24;
+
+    explicit PuyoMonteCarlo(uint32_t node_capacity = DEFAULT_NODE_CAPACITY);
+    ~PuyoMonteCarlo();
+
+    PuyoMonteCarlo(const PuyoMonteCarlo&) = delete;
+    PuyoMonteCarlo& operator=(const PuyoMonteCarlo&) = delete;
+
+    // 트리를 비우고 새로 탐색. pool이 있으면 풀의 스레드 수만큼 (호출 스레드 포함) 함께 탐색
+    // 한 인스턴스에서 동시에 두 번 호출하면 안 됨
+    [[nodiscard]] PuyoMctsResult Search(const PuyoSearchRequest& request, const PuyoMctsConfig& config,
+        PuyoWorkerPool* pool = nullptr, const std::atomic<bool>* cancel = nullptr);
+
+    [[nodiscard]] uint32_t GetNodeCapacity() const { return capacity_; }
+
+private:
+    struct Node;
+    struct SearchContext;
+
+    void RunPlayouts(SearchContext& context, size_t worker);
+    [[nodiscard]] bool TryExpand(Node& node);
+
+private:
+    std::unique_ptr<Node[]> nodes_;
+    uint32_t capacity_{ 0 };
+    std::atomic<uint32_t> node_count_{ 0 };
+};
@@ -0,0 +1,69 @@
+#pragma once
+/*
+ *
+ * 설명: 시드 하나로 정해지는 블록 쌍 순서 (두 피어가 같은 순서를 각자 생성)
+ *  1. 카운터 기반 난수: n번째 쌍 = Mix(시드, n). 상태가 없어 임의 위치를 바로 계산할 수 있고(Get),
+ *     앞에서부터 꺼낼 때는 인덱스만 증가(Next).
+ *  2. 64비트 출력 하나에서 상위/하위 32비트를 곱셈-시프트로 색 범위에 맞춰 축/회전 블록 색을 정함.
+ *  3. 난수 엔진/분포 객체를 만들지 않으므로 블록마다 드는 생성 비용이 없고, 플랫폼과 표준 라이브러리 구현에 관계없이
+ *     같은 시드는 같은 순서를 만듦 (리플레이는 시드와 입력만 저장하면 됨).
+ *  4. 시드는 게임 초기화/재시작 패킷으로 한 번만 보내고, 이후 블록은 인덱스로 맞춤.
+ *
+ */
+
+#include "PuyoBoard.hpp"
+
+#include <cstdint>
+
+class PuyoPieceSequence
+{
+public:
+    constexpr PuyoPieceSequence() = default;
+    explicit constexpr PuyoPieceSequence(uint32_t seed) : seed_(seed) {}
+
+    // 시드를 바꾸고 처음부터 다시 시작
+    constexpr void Reset(uint32_t seed)
+    {
+        seed_ = seed;
+        index_ = 0;
+    }
+
+    // index번째 쌍 (순서 상태를 바꾸지 않음)
+    [[nodiscard]] constexpr PuyoPair Get(uint32_t index) const
+    {
+        const uint64_t bits = Mix((static_cast<uint64_t>(seed_) << 32) | index);
+
+        PuyoPair pair;
+        pair.axis = ToColor(static_cast<uint32_t>(bits >> 32));
+        pair.child = ToColor(static_cast<uint32_t>(bits));
+        return pair;
+    }
+
+    // 다음 쌍을 꺼내고 인덱스를 하나 증가
+    [[nodiscard]] constexpr PuyoPair Next() { return Get(index_++); }
+
+    // 다음에 꺼낼 위치 변경 (원격 피어의 인덱스에 맞출 때 사용)
+    constexpr void Seek(uint32_t index) { index_ = index; }
+
+    [[nodiscard]] constexpr uint32_t GetSeed() const { return seed_; }
+    [[nodiscard]] constexpr uint32_t GetIndex() const { return index_; }
+
+private:
+    // splitmix64 마무리 함수 (연속된 카운터도 고르게 섞임)
+    [[nodiscard]] static constexpr uint64_t Mix(uint64_t value)
+    {
+        value += 0x9E3779B97F4A7C15ull;
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+        return value ^ (value >> 31);
+    }
+
+    [[nodiscard]] static constexpr PuyoCell ToColor(uint32_t bits)
+    {
+        return static_cast<PuyoCell>(1 + ((static_cast<uint64_t>(bits) * PUYO_COLOR_COUNT) >> 32));
+    }
+
+private:
+    uint32_t seed_{ 0 };
+    uint32_t index_{ 0 };
+};
@@ -0,0 +1,690 @@
+#include "PuyoReplay.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <span>
+
+namespace
+{
+    constexpr uint32_t FILE_MAGIC = 0x4C505250;     // "PRPL"
+    constexpr uint32_t CHUNK_MAGIC = 0x4B435250;    // "PRCK"
+    constexpr uint32_t INDEX_MAGIC = 0x58495250;    // "PRIX"
+    constexpr uint16_t FORMAT_VERSION = 1;
+
+    constexpr size_t HEADER_SIZE = 12;          // magic, version, tick rate, seed
+    constexpr size_t CHUNK_HEADER_SIZE = 24;    // magic, first tick, last tick, input count, payload size, checksum
+    constexpr size_t INDEX_ENTRY_SIZE = 20;     // first tick, last tick, input count, offset
+    constexpr size_t TRAILER_SIZE = 16;         // index offset, chunk count, magic
+
+    // 손상된 크기 값으로 큰 버퍼를 잡지 않도록 청크 크기 상한
+    constexpr uint32_t MAX_PAYLOAD_SIZE = 1u << 20;
+
+    constexpr int CELL_BITS = 3;
+
+    constexpr uint32_t FNV_OFFSET = 2166136261u;
+    constexpr uint32_t FNV_PRIME = 16777619u;
+
+    [[nodiscard]] uint32_t Fnv1a(std::span<const uint8_t> data, uint32_t hash = FNV_OFFSET)
+    {
+        for (const uint8_t byte : data)
+        {
+            hash = (hash ^ byte) * FNV_PRIME;
+        }
+        return hash;
+    }
+
+    class ByteWriter
+    {
+    public:
+        explicit ByteWriter(std::vector<uint8_t>& out) : out_(out) {}
+
+        void PutU8(uint8_t value) { out_.push_back(value); }
+        void PutU16(uint16_t value) { PutLittle(value, 2); }
+        void PutU32(uint32_t value) { PutLittle(value, 4); }
+        void PutU64(uint64_t value) { PutLittle(value, 8); }
+
+        void PutVarint(uint64_t value)
+        {
+            while (value >= 0x80)
+            {
+                out_.push_back(static_cast<uint8_t>(value | 0x80));
+                value >>= 7;
+            }
+            out_.push_back(static_cast<uint8_t>(value));
+        }
+
+        void PutZigZag(int32_t value)
+        {
+            PutVarint((static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31));
+        }
+
+    private:
+        void PutLittle(uint64_t value, int bytes)
+        {
+            for (int i = 0; i < bytes; ++i)
+            {
+                out_.push_back(static_cast<uint8_t>(value >> (i * 8)));
+            }
+        }
+
+    private:
+        std::vector<uint8_t>& out_;
+    };
+
+    // 범위를 벗어나 읽으면 0을 돌려주고 IsValid()가 false
+    class ByteReader
+    {
+    public:
+        explicit ByteReader(std::span<const uint8_t> data) : data_(data) {}
+
+        [[nodiscard]] bool IsValid() const { return is_valid_; }
+
+        [[nodiscard]] uint8_t GetU8() { return static_cast<uint8_t>(GetLittle(1)); }
+        [[nodiscard]] uint16_t GetU16() { return static_cast<uint16_t>(GetLittle(2)); }
+        [[nodiscard]] uint32_t GetU32() { return static_cast<uint32_t>(GetLittle(4)); }
+        [[nodiscard]] uint64_t GetU64() { return GetLittle(8); }
+
+        [[nodiscard]] uint64_t GetVarint()
+        {
+            uint64_t value = 0;
+            for (int shift = 0; shift < 64; shift += 7)
+            {
+                const uint8_t byte = GetU8();
+                value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+
+                if ((byte & 0x80) == 0)
+                {
+                    return value;
+                }
+            }
+
+            is_valid_ = false;
+            return 0;
+        }
+
+        [[nodiscard]] int32_t GetZigZag()
+        {
+            const auto value = static_cast<uint32_t>(GetVarint());
+            return static_cast<int32_t>((value >> 1) ^ (0u - (value & 1)));
+        }
+
+    private:
+        uint64_t GetLittle(int bytes)
+        {
+            if (!is_valid_ || pos_ + bytes > data_.size())
+            {
+                is_valid_ = false;
+                return 0;
+            }
+
+            uint64_t value = 0;
+            for (int i = 0; i < bytes; ++i)
+            {
+                value |= static_cast<uint64_t>(data_[pos_++]) << (i * 8);
+            }
+            return value;
+        }
+
+    private:
+        std::span<const uint8_t> data_;
+        size_t pos_{ 0 };
+        bool is_valid_{ true };
+    };
+
+    // 보드를 칸당 3비트로 (78칸 -> 30바이트)
+    void PackBoard(const PuyoBoard& board, ByteWriter& out)
+    {
+        uint32_t bits = 0;
+        int count = 0;
+
+        for (int x = 0; x < PuyoBoard::WIDTH; ++x)
+        {
+            for (int y = 0; y < PuyoBoard::HEIGHT; ++y)
+            {
+                bits |= static_cast<uint32_t>(board.Get(x, y)) << count;
+                count += CELL_BITS;
+
+                while (count >= 8)
+                {
+                    out.PutU8(static_cast<uint8_t>(bits));
+                    bits >>= 8;
+                    count -= 8;
+                }
+            }
+        }
+
+        if (count > 0)
+        {
+            out.PutU8(static_cast<uint8_t>(bits));
+        }
+    }
+
+    void UnpackBoard(ByteReader& in, PuyoBoard& board)
+    {
+        uint32_t bits = 0;
+        int count = 0;
+
+        board.Clear();
+        for (int x = 0; x < PuyoBoard::WIDTH; ++x)
+        {
+            for (int y = 0; y < PuyoBoard::HEIGHT; ++y)
+            {
+                if (count < CELL_BITS)
+                {
+                    bits |= static_cast<uint32_t>(in.GetU8()) << count;
+                    count += 8;
+                }
+
+                board.Set(x, y, static_cast<PuyoCell>(bits & ((1u << CELL_BITS) - 1)));
+                bits >>= CELL_BITS;
+                count -= CELL_BITS;
+            }
+        }
+    }
+
+    void EncodeState(const PuyoMatchState& state, ByteWriter& out)
+    {
+        out.PutVarint(state.tick);
+
+        for (int player = 0; player < PuyoMatchState::PLAYER_COUNT; ++player)
+        {
+            const PuyoEngineState& engine = state.players[player];
+
+            out.PutVarint(state.piece_index[player]);
+            out.PutU8(static_cast<uint8_t>(engine.phase));
+            PackBoard(engine.board, out);
+
+            out.PutU8(engine.chain.combo_count);
+            out.PutVarint(engine.chain.rest_score);
+            out.PutZigZag(engine.chain.pending_garbage);
+            out.PutU8(engine.chain.margin);
+
+            out.PutVarint(engine.score);
+            out.PutU32(std::bit_cast<uint32_t>(engine.play_time));
+            out.PutU32(engine.random_state);
+        }
+    }
+
+    [[nodiscard]] bool DecodeState(ByteReader& in, PuyoMatchState& state)
+    {
+        state.tick = static_cast<uint32_t>(in.GetVarint());
+
+        for (int player = 0; player < PuyoMatchState::PLAYER_COUNT; ++player)
+        {
+            PuyoEngineState& engine = state.players[player];
+
+            state.piece_index[player] = static_cast<uint32_t>(in.GetVarint());
+
+            const uint8_t phase = in.GetU8();
+            if (phase > static_cast<uint8_t>(PuyoPhase::GameOver))
+            {
+                return false;
+            }
+            engine.phase = static_cast<PuyoPhase>(phase);
+            UnpackBoard(in, engine.board);
+
+            engine.chain.combo_count = in.GetU8();
+            engine.chain.rest_score = static_cast<uint32_t>(in.GetVarint());
+            engine.chain.pending_garbage = static_cast<int16_t>(in.GetZigZag());
+            engine.chain.margin = in.GetU8();
+
+            engine.score = static_cast<uint32_t>(in.GetVarint());
+            engine.play_time = std::bit_cast<float>(in.GetU32());
+            engine.random_state = in.GetU32();
+        }
+
+        return in.IsValid();
+    }
+
+    // 입력 = 이전 입력과의 틱 차이 + (플레이어 1비트 | 회전 2비트 | 열 3비트)
+    void EncodeInput(const PuyoMatchInput& input, uint32_t previous_tick, ByteWriter& out)
+    {
+        out.PutVarint(input.tick - previous_tick);
+        out.PutU8(static_cast<uint8_t>((input.player << 5) | (static_cast<uint8_t>(input.rotation) << 3) | input.column));
+    }
+
+    [[nodiscard]] bool DecodeInput(ByteReader& in, uint32_t& previous_tick, PuyoMatchInput& input)
+    {
+        input.tick = previous_tick + static_cast<uint32_t>(in.GetVarint());
+
+        const uint8_t packed = in.GetU8();
+        input.player = static_cast<uint8_t>(packed >> 5);
+        input.rotation = static_cast<PuyoRotation>((packed >> 3) & 0x3);
+        input.column = static_cast<uint8_t>(packed & 0x7);
+
+        previous_tick = input.tick;
+        return in.IsValid() && input.player < PuyoMatch::PLAYER_COUNT;
+    }
+
+    [[nodiscard]] bool WriteBytes(std::ofstream& file, std::span<const uint8_t> bytes)
+    {
+        file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        return file.good();
+    }
+
+    [[nodiscard]] bool ReadBytes(std::ifstream& file, uint64_t offset, std::span<uint8_t> bytes)
+    {
+        file.clear();
+        file.seekg(static_cast<std::streamoff>(offset));
+        file.read(reinterpret_cast<char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        return file.gcount() == static_cast<std::streamsize>(bytes.size());
+    }
+
+    struct ChunkHeader
+    {
+        uint32_t first_tick{ 0 };
+        uint32_t last_tick{ 0 };
+        uint32_t input_count{ 0 };
+        uint32_t payload_size{ 0 };
+        uint32_t checksum{ 0 };
+    };
+
+    [[nodiscard]] bool ReadChunkHeader(std::ifstream& file, uint64_t offset, ChunkHeader& header)
+    {
+        std::array<uint8_t, CHUNK_HEADER_SIZE> bytes{};
+        if (!ReadBytes(file, offset, bytes))
+        {
+            return false;
+        }
+
+        ByteReader in(bytes);
+        const uint32_t magic = in.GetU32();
+        header.first_tick = in.GetU32();
+        header.last_tick = in.GetU32();
+        header.input_count = in.GetU32();
+        header.payload_size = in.GetU32();
+        header.checksum = in.GetU32();
+
+        return magic == CHUNK_MAGIC && header.payload_size <= MAX_PAYLOAD_SIZE && header.first_tick <= header.last_tick;
+    }
+
+    [[nodiscard]] bool ReadPayload(std::ifstream& file, uint64_t offset, const ChunkHeader& header, std::vector<uint8_t>& payload)
+    {
+        payload.resize(header.payload_size);
+        return ReadBytes(file, offset + CHUNK_HEADER_SIZE, payload) && Fnv1a(payload) == header.checksum;
+    }
+}
+
+PuyoReplayWriter::~PuyoReplayWriter()
+{
+    if (file_.is_open())
+    {
+        Close();
+    }
+}
+
+bool PuyoReplayWriter::Open(const std::filesystem::path& path, uint32_t seed)
+{
+    if (file_.is_open())
+    {
+        Close();
+    }
+
+    file_.clear();
+    file_.open(path, std::ios::binary | std::ios::trunc);
+    if (!file_.is_open())
+    {
+        return false;
+    }
+
+    keyframe_.clear();
+    inputs_.clear();
+    input_count_ = 0;
+    index_.clear();
+
+    std::vector<uint8_t> header;
+    ByteWriter out(header);
+    out.PutU32(FILE_MAGIC);
+    out.PutU16(FORMAT_VERSION);
+    out.PutU16(static_cast<uint16_t>(PuyoMatch::TICK_RATE));
+    out.PutU32(seed);
+
+    offset_ = header.size();
+    return WriteBytes(file_, header);
+}
+
+bool PuyoReplayWriter::Append(const PuyoMatch& match, const PuyoMatchInput& input)
+{
+    if (!file_.is_open() || (input_count_ > 0 && input.tick < last_tick_))
+    {
+        return false;
+    }
+
+    if (input_count_ > 0 && (input.tick - first_tick_ >= KEYFRAME_TICKS || input_count_ >= MAX_CHUNK_INPUTS))
+    {
+        if (!FlushChunk())
+        {
+            return false;
+        }
+    }
+
+    if (input_count_ == 0)
+    {
+        PuyoMatchState state;
+        match.SaveState(state);
+
+        ByteWriter keyframe(keyframe_);
+        EncodeState(state, keyframe);
+
+        first_tick_ = input.tick;
+        last_tick_ = input.tick;
+    }
+
+    ByteWriter out(inputs_);
+    EncodeInput(input, last_tick_, out);
+
+    last_tick_ = input.tick;
+    ++input_count_;
+
+    return true;
+}
+
+bool PuyoReplayWriter::FlushChunk()
+{
+    if (input_count_ == 0)
+    {
+        return true;
+    }
+
+    std::vector<uint8_t> chunk;
+    chunk.reserve(CHUNK_HEADER_SIZE + keyframe_.size() + inputs_.size());
+
+    ByteWriter out(chunk);
+    out.PutU32(CHUNK_MAGIC);
+    out.PutU32(first_tick_);
+    out.PutU32(last_tick_);
+    out.PutU32(input_count_);
+    out.PutU32(static_cast<uint32_t>(keyframe_.size() + inputs_.size()));
+    out.PutU32(Fnv1a(inputs_, Fnv1a(keyframe_)));
+
+    chunk.insert(chunk.end(), keyframe_.begin(), keyframe_.end());
+    chunk.insert(chunk.end(), inputs_.begin(), inputs_.end());
+
+    // 청크 단위로 바로 내보내 비정상 종료 시에도 끝난 청크는 남음
+    if (!WriteBytes(file_, chunk))
+    {
+        return false;
+    }
+    file_.flush();
+
+    index_.push_back({ first_tick_, last_tick_, input_count_, offset_ });
+    offset_ += chunk.size();
+
+    keyframe_.clear();
+    inputs_.clear();
+    input_count_ = 0;
+
+    return file_.good();
+}
+
+bool PuyoReplayWriter::Close()
+{
+    if (!file_.is_open())
+    {
+        return false;
+    }
+
+    bool result = FlushChunk();
+
+    std::vector<uint8_t> footer;
+    footer.reserve(index_.size() * INDEX_ENTRY_SIZE + TRAILER_SIZE);
+
+    ByteWriter out(footer);
+    for (const auto& entry : index_)
+    {
+        out.PutU32(entry.first_tick);
+        out.PutU32(entry.last_tick);
+        out.PutU32(entry.input_count);
+        out.PutU64(entry.offset);
+    }
+
+    out.PutU64(offset_);
+    out.PutU32(static_cast<uint32_t>(index_.size()));
+    out.PutU32(INDEX_MAGIC);
+
+    result = result && WriteBytes(file_, footer);
+    offset_ += footer.size();
+
+    file_.close();
+    return result;
+}
+
+bool PuyoReplayReader::Open(const std::filesystem::path& path)
+{
+    file_.close();
+    file_.clear();
+    index_.clear();
+    input_count_ = 0;
+    is_recovered_ = false;
+
+    std::error_code ec;
+    const uint64_t file_size = std::filesystem::file_size(path, ec);
+    if (ec || file_size < HEADER_SIZE)
+    {
+        return false;
+    }
+
+    file_.open(path, std::ios::binary);
+    if (!file_.is_open())
+    {
+        return false;
+    }
+
+    std::array<uint8_t, HEADER_SIZE> header{};
+    if (!ReadBytes(file_, 0, header))
+    {
+        return false;
+    }
+
+    ByteReader in(header);
+    const uint32_t magic = in.GetU32();
+    const uint16_t version = in.GetU16();
+    const uint16_t tick_rate = in.GetU16();
+    seed_ = in.GetU32();
+
+    if (magic != FILE_MAGIC || version != FORMAT_VERSION || tick_rate != PuyoMatch::TICK_RATE)
+    {
+        return false;
+    }
+
+    if (!ReadIndex(file_size))
+    {
+        is_recovered_ = true;
+        if (!RebuildIndex(file_size))
+        {
+            return false;
+        }
+    }
+
+    for (const auto& entry : index_)
+    {
+        input_count_ += entry.input_count;
+    }
+
+    return true;
+}
+
+bool PuyoReplayReader::ReadIndex(uint64_t file_size)
+{
+    if (file_size < HEADER_SIZE + TRAILER_SIZE)
+    {
+        return false;
+    }
+
+    std::array<uint8_t, TRAILER_SIZE> trailer{};
+    if (!ReadBytes(file_, file_size - TRAILER_SIZE, trailer))
+    {
+        return false;
+    }
+
+    ByteReader in(trailer);
+    const uint64_t index_offset = in.GetU64();
+    const uint32_t count = in.GetU32();
+    const uint32_t magic = in.GetU32();
+
+    if (magic != INDEX_MAGIC || index_offset < HEADER_SIZE ||
+        index_offset + static_cast<uint64_t>(count) * INDEX_ENTRY_SIZE + TRAILER_SIZE != file_size)
+    {
+        return false;
+    }
+
+    std::vector<uint8_t> bytes(static_cast<size_t>(count) * INDEX_ENTRY_SIZE);
+    if (!ReadBytes(file_, index_offset, bytes))
+    {
+        return false;
+    }
+
+    ByteReader entries(bytes);
+    index_.resize(count);
+    for (auto& entry : index_)
+    {
+        entry.first_tick = entries.GetU32();
+        entry.last_tick = entries.GetU32();
+        entry.input_count = entries.GetU32();
+        entry.offset = entries.GetU64();
+
+        if (entry.offset < HEADER_SIZE || entry.offset + CHUNK_HEADER_SIZE > index_offset)
+        {
+            index_.clear();
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool PuyoReplayReader::RebuildIndex(uint64_t file_size)
+{
+    index_.clear();
+
+    // 체크섬까지 맞는 청크만 인정하고, 처음으로 깨진 곳(기록이 끊긴 위치)에서 멈춤
+    uint64_t offset = HEADER_SIZE;
+    ChunkHeader header;
+
+    while (offset + CHUNK_HEADER_SIZE <= file_size && ReadChunkHeader(file_, offset, header) &&
+        offset + CHUNK_HEADER_SIZE + header.payload_size <= file_size && ReadPayload(file_, offset, header, payload_))
+    {
+        index_.push_back({ header.first_tick, header.last_tick, header.input_count, offset });
+        offset += CHUNK_HEADER_SIZE + header.payload_size;
+    }
+
+    return true;
+}
+
+bool PuyoReplayReader::ReadChunk(size_t chunk, std::vector<uint8_t>& payload)
+{
+    const auto& entry = index_[chunk];
+
+    ChunkHeader header;
+    return ReadChunkHeader(file_, entry.offset, header) && header.first_tick == entry.first_tick &&
+        header.input_count == entry.input_count && ReadPayload(file_, entry.offset, header, payload);
+}
+
+bool PuyoReplayReader::Seek(uint32_t tick, PuyoMatch& match)
+{
+    match.Reset(seed_);
+
+    if (index_.empty())
+    {
+        return true;
+    }
+
+    // tick 이전에 시작한 마지막 청크 (tick이 첫 입력보다 앞이면 첫 청크의 키프레임 = 초기 상태)
+    const auto it = std::upper_bound(index_.begin(), index_.end(), tick,
+        [](uint32_t value, const PuyoReplayIndexEntry& entry) { return value < entry.first_tick; });
+    const size_t chunk = it == index_.begin() ? 0 : static_cast<size_t>(it - index_.begin()) - 1;
+
+    if (!ReadChunk(chunk, payload_))
+    {
+        return false;
+    }
+
+    ByteReader in(payload_);
+
+    PuyoMatchState keyframe;
+    if (!DecodeState(in, keyframe))
+    {
+        return false;
+    }
+    match.LoadState(keyframe);
+
+    uint32_t input_tick = index_[chunk].first_tick;
+    for (uint32_t i = 0; i < index_[chunk].input_count; ++i)
+    {
+        PuyoMatchInput input;
+        if (!DecodeInput(in, input_tick, input))
+        {
+            return false;
+        }
+
+        if (input.tick > tick)
+        {
+            break;
+        }
+
+        if (!match.Apply(input))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool PuyoReplayReader::Play(PuyoMatch& match, uint32_t end_tick)
+{
+    match.Reset(seed_);
+
+    PuyoMatchState keyframe;
+    PuyoMatchState current;
+
+    for (size_t chunk = 0; chunk < index_.size(); ++chunk)
+    {
+        const auto& entry = index_[chunk];
+        if (entry.first_tick > end_tick)
+        {
+            break;
+        }
+
+        if (!ReadChunk(chunk, payload_))
+        {
+            return false;
+        }
+
+        ByteReader in(payload_);
+        if (!DecodeState(in, keyframe))
+        {
+            return false;
+        }
+
+        // 기록할 때의 상태와 재생한 상태가 다르면 결정성이 깨진 것
+        match.SaveState(current);
+        if (current != keyframe)
+        {
+            return false;
+        }
+
+        uint32_t input_tick = entry.first_tick;
+        for (uint32_t i = 0; i < entry.input_count; ++i)
+        {
+            PuyoMatchInput input;
+            if (!DecodeInput(in, input_tick, input))
+            {
+                return false;
+            }
+
+            if (input.tick > end_tick)
+            {
+                return true;
+            }
+
+            if (!match.Apply(input))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,105 @@
+#pragma once
+/*
+ *
+ * 설명: 대전 리플레이 파일 (시드 + 틱별 입력, 주기적 키프레임, 청크 단위 추가 기록 + 인덱스 꼬리말)
+ *  1. 파일 = 헤더 | 청크 ... | 인덱스 | 꼬리말. 청크 하나 = 키프레임(청크 첫 입력 직전 대전 상태) + 뒤따르는 입력들.
+ *     KEYFRAME_TICKS가 지나거나 입력이 MAX_CHUNK_INPUTS개가 되면 청크를 파일 끝에 추가하므로 기록 중 메모리는 청크 하나분.
+ *  2. 압축: 보드는 칸당 3비트(셀 값 0~7), 점수/개수는 varint, 입력은 이전 입력과의 틱 차이 varint + 1바이트(플레이어/회전/열).
+ *     청크마다 체크섬(FNV-1a)을 두어 잘리거나 손상된 청크는 읽지 않음.
+ *  3. 꼬리말이 없으면(기록 중 비정상 종료) 청크를 앞에서부터 훑어 인덱스를 다시 만듦.
+ *  4. 탐색(Seek): 인덱스에서 목표 틱 이전에 시작한 마지막 청크를 이분 탐색해 그 키프레임과 뒤따르는 입력만 디코드.
+ *  5. 재생(Play): 청크를 차례로 읽으며 PuyoMatch에 입력을 적용하고, 청크마다 키프레임과 진행 상태가 같은지 확인 (불일치 = 비결정성).
+ *  6. 모든 값은 리틀 엔디언으로 바이트 단위 기록 (플랫폼과 관계없이 같은 파일).
+ *
+ */
+
+#include "PuyoMatch.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <vector>
+
+struct PuyoReplayIndexEntry
+{
+    uint32_t first_tick{ 0 };
+    uint32_t last_tick{ 0 };
+    uint32_t input_count{ 0 };
+    uint64_t offset{ 0 };
+};
+
+class PuyoReplayWriter
+{
+public:
+    static constexpr uint32_t KEYFRAME_TICKS = 10 * PuyoMatch::TICK_RATE;  // 10초마다 키프레임
+    static constexpr uint32_t MAX_CHUNK_INPUTS = 256;
+
+    PuyoReplayWriter() = default;
+    ~PuyoReplayWriter();
+
+    PuyoReplayWriter(const PuyoReplayWriter&) = delete;
+    PuyoReplayWriter& operator=(const PuyoReplayWriter&) = delete;
+
+    bool Open(const std::filesystem::path& path, uint32_t seed);
+
+    // 입력을 적용하기 직전의 대전 상태와 함께 기록 (새 청크를 시작하면 그 상태가 키프레임)
+    bool Append(const PuyoMatch& match, const PuyoMatchInput& input);
+
+    // 남은 청크, 인덱스, 꼬리말을 쓰고 닫음
+    bool Close();
+
+    [[nodiscard]] bool IsOpen() const { return file_.is_open(); }
+    [[nodiscard]] uint64_t GetSize() const { return offset_; }
+    [[nodiscard]] size_t GetChunkCount() const { return index_.size(); }
+
+private:
+    bool FlushChunk();
+
+private:
+    std::ofstream file_;
+    uint64_t offset_{ 0 };
+
+    std::vector<uint8_t> keyframe_;
+    std::vector<uint8_t> inputs_;
+    uint32_t first_tick_{ 0 };
+    uint32_t last_tick_{ 0 };
+    uint32_t input_count_{ 0 };
+
+    std::vector<PuyoReplayIndexEntry> index_;
+};
+
+class PuyoReplayReader
+{
+public:
+    static constexpr uint32_t END_TICK = std::numeric_limits<uint32_t>::max();
+
+    // 헤더와 인덱스를 읽음 (꼬리말이 없으면 청크를 훑어 인덱스 재구성)
+    bool Open(const std::filesystem::path& path);
+
+    // tick 시점(그 틱의 입력까지 적용)의 상태로 match를 맞춤. 가까운 키프레임 하나와 그 뒤 입력만 디코드
+    bool Seek(uint32_t tick, PuyoMatch& match);
+
+    // 처음부터 end_tick까지 재생. 키프레임과 진행 상태가 다르면 false
+    bool Play(PuyoMatch& match, uint32_t end_tick = END_TICK);
+
+    [[nodiscard]] uint32_t GetSeed() const { return seed_; }
+    [[nodiscard]] size_t GetChunkCount() const { return index_.size(); }
+    [[nodiscard]] uint32_t GetEndTick() const { return index_.empty() ? 0 : index_.back().last_tick; }
+    [[nodiscard]] uint64_t GetInputCount() const { return input_count_; }
+    [[nodiscard]] bool IsRecovered() const { return is_recovered_; }
+
+private:
+    bool ReadIndex(uint64_t file_size);
+    bool RebuildIndex(uint64_t file_size);
+    bool ReadChunk(size_t chunk, std::vector<uint8_t>& payload);
+
+private:
+    std::ifstream file_;
+    uint32_t seed_{ 0 };
+    uint64_t input_count_{ 0 };
+    bool is_recovered_{ false };
+
+    std::vector<PuyoReplayIndexEntry> index_;
+    std::vector<uint8_t> payload_;
+};
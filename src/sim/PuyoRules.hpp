@@ -0,0 +1,118 @@
+#pragma once
+/*
+ *
+ * 설명: 점수/방해 블록 규칙 (BasePlayer, LocalPlayer와 헤드리스 엔진이 함께 사용)
+ *  1. 연쇄 상수, 연결 보너스, 타입 보너스, 시간에 따른 마진은 기존 BasePlayer 규칙 그대로.
+ *  2. 타입 보너스는 LocalPlayer::CalculateScore와 같이 한 단계에서 터진 그룹 수 기준.
+ *  3. 모두 constexpr 이므로 컴파일 타임 테이블/정적 검사에도 사용 가능.
+ *
+ */
+
+#include "../core/common/constants/RuleConstants.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+namespace PuyoRules
+{
+    [[nodiscard]] constexpr int16_t GetComboConstant(uint8_t combo_count)
+    {
+        if (combo_count <= 1)
+        {
+            return 0;
+        }
+
+        if (combo_count <= 4)
+        {
+            return static_cast<int16_t>(1 << (combo_count + 1));
+        }
+
+        if (combo_count <= Constants::Game::MAX_COMBO)
+        {
+            return static_cast<int16_t>(32 * (combo_count - 3));
+        }
+
+        return 0;
+    }
+
+    [[nodiscard]] constexpr uint8_t GetLinkBonus(size_t link_count)
+    {
+        constexpr std::array<uint8_t, 8> LINK_BONUSES = { 0, 0, 0, 0, 2, 3, 4, 5 };
+
+        if (link_count <= 4)
+        {
+            return 0;
+        }
+
+        if (link_count <= 10)
+        {
+            return LINK_BONUSES[link_count - 4];
+        }
+
+        return Constants::Game::Score::MAX_LINK_BONUS;
+    }
+
+    [[nodiscard]] constexpr uint8_t GetTypeBonus(size_t count)
+    {
+        constexpr std::array<uint8_t, 6> TYPE_BONUSES = { 0, 0, 3, 6, 12, Constants::Game::Score::MAX_TYPE_BONUS };
+
+        return count < TYPE_BONUSES.size() ? TYPE_BONUSES[count] : TYPE_BONUSES.back();
+    }
+
+    [[nodiscard]] constexpr uint8_t GetMargin(float play_time)
+    {
+        for (const auto& margin : Constants::Game::SCORE_MARGINS)
+        {
+            if (play_time <= margin.time)
+            {
+                return margin.margin;
+            }
+        }
+
+        return Constants::Game::SCORE_MARGINS[std::size(Constants::Game::SCORE_MARGINS) - 1].margin;
+    }
+
+    // 연쇄 한 단계의 점수 (link_bonus는 그룹별 GetLinkBonus 합)
+    [[nodiscard]] constexpr uint32_t CalculateStepScore(uint8_t combo_count, size_t group_count, size_t block_count, uint32_t link_bonus)
+    {
+        const int32_t multiplier = GetComboConstant(combo_count) + static_cast<int32_t>(link_bonus) + GetTypeBonus(group_count) + 1;
+        return static_cast<uint32_t>(block_count) * Constants::Game::Score::BASE_MATCH_SCORE * static_cast<uint32_t>(multiplier);
+    }
+
+    struct GarbageConversion
+    {
+        int16_t produced{ 0 };      // 이번 단계에서 만든 방해 블록 수
+        uint32_t rest_score{ 0 };   // 마진으로 나누고 남은 점수 (다음 단계로 이월)
+    };
+
+    [[nodiscard]] constexpr GarbageConversion ConvertScoreToGarbage(uint32_t score, uint32_t rest_score, uint8_t margin)
+    {
+        const uint32_t total = score + rest_score;
+        return { static_cast<int16_t>(total / margin), total % margin };
+    }
+
+    // 받을 방해 블록(pending)을 먼저 상쇄하고 남은 수를 상대에게 보낼 양으로 반환
+    [[nodiscard]] constexpr int16_t OffsetGarbage(int16_t& pending, int16_t produced)
+    {
+        if (pending <= 0)
+        {
+            pending = 0;
+            return produced;
+        }
+
+        pending = static_cast<int16_t>(pending - produced);
+        if (pending >= 0)
+        {
+            return 0;
+        }
+
+        const int16_t sent = static_cast<int16_t>(-pending);
+        pending = 0;
+        return sent;
+    }
+
+    static_assert(GetComboConstant(2) == 8 && GetComboConstant(4) == 32 && GetComboConstant(5) == 64);
+    static_assert(CalculateStepScore(1, 1, 4, 0) == 40);
+}
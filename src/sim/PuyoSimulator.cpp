@@ -0,0 +1,99 @@
+#include "PuyoSimulator.hpp"
+
+#include <algorithm>
+
+namespace PuyoSimulator
+{
+    bool StepChain(PuyoBoard& board, PuyoChainState& state, PuyoChainStep& step)
+    {
+        step = PuyoChainStep{};
+
+        PuyoGroups groups;
+        if (board.FindGroups(groups) == 0)
+        {
+            return false;
+        }
+
+        state.combo_count = static_cast<uint8_t>(std::min<int>(state.combo_count + 1, Constants::Game::MAX_COMBO));
+
+        uint32_t link_bonus = 0;
+        for (uint8_t i = 0; i < groups.count; ++i)
+        {
+            link_bonus += PuyoRules::GetLinkBonus(groups.GetGroupSize(i));
+        }
+
+        step.groups = groups.count;
+        step.cleared = groups.GetCellCount();
+        step.score = PuyoRules::CalculateStepScore(state.combo_count, step.groups, step.cleared, link_bonus);
+
+        const auto conversion = PuyoRules::ConvertScoreToGarbage(step.score, state.rest_score, state.margin);
+        state.rest_score = conversion.rest_score;
+
+        const int16_t pending_before = state.pending_garbage;
+        step.garbage_sent = PuyoRules::OffsetGarbage(state.pending_garbage, conversion.produced);
+        step.garbage_offset = static_cast<int16_t>(std::max<int16_t>(pending_before, 0) - state.pending_garbage);
+
+        step.garbage_cleared = board.ClearGroups(groups);
+        board.ApplyGravity();
+
+        return true;
+    }
+
+    void ResolveChain(PuyoBoard& board, PuyoChainState& state, PuyoChainResult& result)
+    {
+        result = PuyoChainResult{};
+
+        PuyoChainStep step;
+        while (StepChain(board, state, step))
+        {
+            result.Add(step);
+        }
+
+        // 연쇄가 끝나면 연쇄 수와 이월 점수 초기화 (BasePlayer::ResetComboState)
+        state.combo_count = 0;
+        state.rest_score = 0;
+    }
+
+    bool Simulate(const PuyoBoard& board, const PuyoPair& pair, int column, PuyoRotation rotation, PuyoSimResult& result, const PuyoChainState& state)
+    {
+        result.board = board;
+        result.chain = PuyoChainResult{};
+        result.game_over = false;
+        result.placed = result.board.Place(pair, column, rotation);
+
+        if (!result.placed)
+        {
+            return false;
+        }
+
+        PuyoChainState chain_state = state;
+        ResolveChain(result.board, chain_state, result.chain);
+
+        result.game_over = result.board.IsGameOver();
+        return true;
+    }
+
+    uint8_t SimulateAll(const PuyoBoard& board, const PuyoPair& pair, std::array<PuyoSimResult, PLACEMENT_COUNT>& results, const PuyoChainState& state)
+    {
+        const bool same_color = pair.axis == pair.child;
+
+        uint8_t placed = 0;
+        for (size_t i = 0; i < PLACEMENTS.size(); ++i)
+        {
+            const auto& placement = PLACEMENTS[i];
+
+            if (same_color && (placement.rotation == PuyoRotation::Down || placement.rotation == PuyoRotation::Left))
+            {
+                results[i].placed = false;
+                continue;
+            }
+
+            if (Simulate(board, pair, placement.column, placement.rotation, results[i], state))
+            {
+                ++placed;
+            }
+        }
+
+        return placed;
+    }
+}
@@ -0,0 +1,139 @@
+#include "PuyoTranspositionTable.hpp"
+
+#include <bit>
+
+namespace
+{
+    // 데이터 64비트 배치: 값(float) 0~31, 깊이 32~39, 세대 40~47, extra 48~62, 사용 중 표시 63
+    constexpr int DEPTH_SHIFT = 32;
+    constexpr int GENERATION_SHIFT = 40;
+    constexpr int EXTRA_SHIFT = 48;
+    constexpr uint64_t EXTRA_MASK = 0x7FFF;
+    constexpr uint64_t VALID_BIT = uint64_t{ 1 } << 63;
+
+    [[nodiscard]] uint64_t Pack(const PuyoTTEntry& entry, uint8_t generation)
+    {
+        return static_cast<uint64_t>(std::bit_cast<uint32_t>(entry.value)) | (static_cast<uint64_t>(entry.depth) << DEPTH_SHIFT) |
+            (static_cast<uint64_t>(generation) << GENERATION_SHIFT) | ((static_cast<uint64_t>(entry.extra) & EXTRA_MASK) << EXTRA_SHIFT) | VALID_BIT;
+    }
+
+    [[nodiscard]] PuyoTTEntry Unpack(uint64_t data)
+    {
+        PuyoTTEntry entry;
+        entry.value = std::bit_cast<float>(static_cast<uint32_t>(data));
+        entry.depth = static_cast<uint8_t>(data >> DEPTH_SHIFT);
+        entry.extra = static_cast<uint16_t>((data >> EXTRA_SHIFT) & EXTRA_MASK);
+        return entry;
+    }
+
+    [[nodiscard]] uint8_t GetDepth(uint64_t data) { return static_cast<uint8_t>(data >> DEPTH_SHIFT); }
+    [[nodiscard]] uint8_t GetGeneration(uint64_t data) { return static_cast<uint8_t>(data >> GENERATION_SHIFT); }
+}
+
+PuyoTranspositionTable::PuyoTranspositionTable(size_t max_bytes)
+{
+    const size_t max_buckets = max_bytes / sizeof(Bucket);
+    bucket_count_ = max_buckets > 1 ? std::bit_floor(max_buckets) : 1;
+    buckets_ = std::make_unique<Bucket[]>(bucket_count_);
+}
+
+PuyoTranspositionTable::~PuyoTranspositionTable() = default;
+
+bool PuyoTranspositionTable::Probe(uint64_t key, PuyoTTEntry& entry)
+{
+    counters_.probes.fetch_add(1, std::memory_order_relaxed);
+
+    for (const auto& slot : GetBucket(key).slots)
+    {
+        const uint64_t data = slot.data.load(std::memory_order_relaxed);
+        if (data == 0 || (slot.check.load(std::memory_order_relaxed) ^ data) != key)
+        {
+            continue;
+        }
+
+        entry = Unpack(data);
+        counters_.hits.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    return false;
+}
+
+void PuyoTranspositionTable::Store(uint64_t key, const PuyoTTEntry& entry)
+{
+    const uint8_t generation = generation_.load(std::memory_order_relaxed);
+    auto& bucket = GetBucket(key);
+
+    Slot* target = nullptr;
+    int target_priority = 0;
+
+    for (auto& slot : bucket.slots)
+    {
+        const uint64_t data = slot.data.load(std::memory_order_relaxed);
+
+        if (data != 0 && (slot.check.load(std::memory_order_relaxed) ^ data) == key)
+        {
+            // 같은 키는 이번 세대의 더 깊은 값을 얕은 값으로 덮지 않음
+            if (GetGeneration(data) == generation && GetDepth(data) > entry.depth)
+            {
+                return;
+            }
+
+            target = &slot;
+            target_priority = -1;
+            break;
+        }
+
+        // 낮을수록 먼저 교체: 빈 엔트리 < 이전 세대 < 얕은 깊이
+        const int priority = data == 0 ? -1 : (GetGeneration(data) == generation ? 256 : 0) + GetDepth(data);
+        if (!target || priority < target_priority)
+        {
+            target = &slot;
+            target_priority = priority;
+        }
+    }
+
+    const uint64_t old_data = target->data.load(std::memory_order_relaxed);
+    if (old_data != 0 && (target->check.load(std::memory_order_relaxed) ^ old_data) != key)
+    {
+        counters_.replacements.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    const uint64_t data = Pack(entry, generation);
+    target->data.store(data, std::memory_order_relaxed);
+    target->check.store(key ^ data, std::memory_order_relaxed);
+
+    counters_.stores.fetch_add(1, std::memory_order_relaxed);
+}
+
+void PuyoTranspositionTable::Clear()
+{
+    for (size_t i = 0; i < bucket_count_; ++i)
+    {
+        for (auto& slot : buckets_[i].slots)
+        {
+            slot.data.store(0, std::memory_order_relaxed);
+            slot.check.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    ResetStats();
+}
+
+PuyoTTStats PuyoTranspositionTable::GetStats() const
+{
+    PuyoTTStats stats;
+    stats.probes = counters_.probes.load(std::memory_order_relaxed);
+    stats.hits = counters_.hits.load(std::memory_order_relaxed);
+    stats.stores = counters_.stores.load(std::memory_order_relaxed);
+    stats.replacements = counters_.replacements.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void PuyoTranspositionTable::ResetStats()
+{
+    counters_.probes.store(0, std::memory_order_relaxed);
+    counters_.hits.store(0, std::memory_order_relaxed);
+    counters_.stores.store(0, std::memory_order_relaxed);
+    counters_.replacements.store(0, std::memory_order_relaxed);
+}
@@ -0,0 +1,96 @@
+#pragma once
+/*
+ *
+ * 설명: 탐색 중 같은 보드를 다시 평가하지 않도록 결과를 저장하는 고정 크기 전치표
+ *  1. 크기는 생성 시 메모리 상한(바이트)으로 정함. 버킷(캐시 라인 64바이트) 수는 상한 이하의 2의 거듭제곱.
+ *  2. 버킷마다 엔트리 4개. 키의 하위 비트로 버킷을 고르고 버킷 안에서 키를 비교.
+ *  3. 잠금 없음. 엔트리는 (키 ^ 데이터, 데이터) 두 원자 변수로 저장해 동시에 쓰다 섞인 엔트리는 읽을 때 키가
+ *     맞지 않아 없는 것으로 처리 (여러 작업 스레드가 한 표를 함께 사용 가능).
+ *  4. 교체 정책: 같은 키 > 빈 엔트리 > 이전 탐색(세대)의 엔트리 > 탐색 깊이가 가장 얕은 엔트리.
+ *  5. 조회/적중/저장/교체 수를 세어 적중률을 확인.
+ *  6. 키는 PuyoZobrist로 만듦. 정적 평가처럼 보드만으로 정해지는 값은 보드 키, 남은 블록에 따라 달라지는
+ *     탐색 값은 보드 키 ^ HashPieces를 키로 사용.
+ *
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+struct PuyoTTEntry
+{
+    float value{ 0.0f };
+    uint8_t depth{ 0 };     // 값을 얻은 탐색 깊이 (0 = 정적 평가). 깊은 값이 얕은 값보다 오래 남음
+    uint16_t extra{ 0 };    // 호출 측이 쓰는 값 (최선 배치 등, 15비트)
+};
+
+struct PuyoTTStats
+{
+    uint64_t probes{ 0 };
+    uint64_t hits{ 0 };
+    uint64_t stores{ 0 };
+    uint64_t replacements{ 0 };     // 다른 키의 엔트리를 덮어쓴 수
+
+    [[nodiscard]] double GetHitRate() const { return probes > 0 ? static_cast<double>(hits) / static_cast<double>(probes) : 0.0; }
+};
+
+class PuyoTranspositionTable
+{
+public:
+    static constexpr size_t ENTRIES_PER_BUCKET = 4;
+    static constexpr size_t DEFAULT_MEMORY_BYTES = size_t{ 16 } << 20;
+
+    explicit PuyoTranspositionTable(size_t max_bytes = DEFAULT_MEMORY_BYTES);
+    ~PuyoTranspositionTable();
+
+    PuyoTranspositionTable(const PuyoTranspositionTable&) = delete;
+    PuyoTranspositionTable& operator=(const PuyoTranspositionTable&) = delete;
+
+    [[nodiscard]] bool Probe(uint64_t key, PuyoTTEntry& entry);
+    void Store(uint64_t key, const PuyoTTEntry& entry);
+
+    // 새 탐색 시작 (이전 세대 엔트리가 먼저 교체됨)
+    void NewSearch() { generation_.fetch_add(1, std::memory_order_relaxed); }
+
+    // 모든 엔트리와 통계를 비움 (다른 스레드가 사용하지 않을 때만 호출)
+    void Clear();
+
+    [[nodiscard]] PuyoTTStats GetStats() const;
+    void ResetStats();
+
+    [[nodiscard]] size_t GetMemoryBytes() const { return bucket_count_ * sizeof(Bucket); }
+    [[nodiscard]] size_t GetEntryCount() const { return bucket_count_ * ENTRIES_PER_BUCKET; }
+
+private:
+    struct Slot
+    {
+        std::atomic<uint64_t> check{ 0 };   // key ^ data
+        std::atomic<uint64_t> data{ 0 };    // 0이면 빈 엔트리
+    };
+
+    struct alignas(64) Bucket
+    {
+        Slot slots[ENTRIES_PER_BUCKET];
+    };
+
+    static_assert(sizeof(Bucket) == 64, "bucket must fill one cache line");
+
+    [[nodiscard]] Bucket& GetBucket(uint64_t key) { return buckets_[key & (bucket_count_ - 1)]; }
+
+private:
+    std::unique_ptr<Bucket[]> buckets_;
+    size_t bucket_count_{ 0 };
+    std::atomic<uint8_t> generation_{ 0 };
+
+    // 통계는 엔트리와 다른 캐시 라인에 둠
+    struct alignas(64) Counters
+    {
+        std::atomic<uint64_t> probes{ 0 };
+        std::atomic<uint64_t> hits{ 0 };
+        std::atomic<uint64_t> stores{ 0 };
+        std::atomic<uint64_t> replacements{ 0 };
+    };
+
+    Counters counters_;
+};
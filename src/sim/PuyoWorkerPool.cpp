@@ -0,0 +1,195 @@
+#include "PuyoWorkerPool.hpp"
+
+#include <algorithm>
+
+namespace
+{
+    // 현재 스레드가 속한 풀과 작업 스레드 번호 (여러 풀이 함께 있어도 구분되도록 풀 주소도 기록)
+    thread_local const PuyoWorkerPool* current_pool = nullptr;
+    thread_local size_t current_index = 0;
+
+    // ParallelFor 한 번의 공유 상태 (늦게 시작한 보조 작업이 참조할 수 있도록 shared_ptr로 보관)
+    struct ParallelState
+    {
+        std::atomic<size_t> next{ 0 };
+        std::atomic<size_t> done{ 0 };
+        size_t count{ 0 };
+        const std::function<void(size_t)>* func{ nullptr };
+
+        std::mutex mutex;
+        std::condition_variable finished;
+
+        void Run()
+        {
+            for (;;)
+            {
+                const size_t index = next.fetch_add(1, std::memory_order_relaxed);
+                if (index >= count)
+                {
+                    return;
+                }
+
+                (*func)(index);
+
+                if (done.fetch_add(1, std::memory_order_acq_rel) + 1 == count)
+                {
+                    std::lock_guard lock(mutex);
+                    finished.notify_all();
+                }
+            }
+        }
+    };
+}
+
+PuyoWorkerPool::PuyoWorkerPool(size_t thread_count)
+{
+    thread_count = std::max<size_t>(thread_count, 1);
+
+    queues_.reserve(thread_count);
+    for (size_t i = 0; i < thread_count; ++i)
+    {
+        queues_.push_back(std::make_unique<WorkQueue>());
+    }
+
+    threads_.reserve(thread_count);
+    for (size_t i = 0; i < thread_count; ++i)
+    {
+        threads_.emplace_back([this, i]() { WorkerLoop(i); });
+    }
+}
+
+PuyoWorkerPool::~PuyoWorkerPool()
+{
+    {
+        std::lock_guard lock(sleep_mutex_);
+        stopping_ = true;
+    }
+    condition_.notify_all();
+
+    for (auto& thread : threads_)
+    {
+        if (thread.joinable())
+        {
+            thread.join();
+        }
+    }
+}
+
+size_t PuyoWorkerPool::GetDefaultThreadCount()
+{
+    const size_t cores = std::thread::hardware_concurrency();
+    return cores > 1 ? cores - 1 : 1;
+}
+
+size_t PuyoWorkerPool::GetCurrentIndex() const
+{
+    return current_pool == this ? current_index : threads_.size();
+}
+
+void PuyoWorkerPool::Submit(std::function<void()> job)
+{
+    size_t index = GetCurrentIndex();
+    if (index >= queues_.size())
+    {
+        index = next_queue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+    }
+
+    // 꺼내는 쪽이 먼저 줄이지 않도록 넣기 전에 올림
+    pending_.fetch_add(1, std::memory_order_release);
+    {
+        std::lock_guard lock(queues_[index]->mutex);
+        queues_[index]->jobs.push_back(std::move(job));
+    }
+
+    // 잠금을 거쳐 깨워야 조건을 확인하고 잠들기 직전의 스레드가 신호를 놓치지 않음
+    {
+        std::lock_guard lock(sleep_mutex_);
+    }
+    condition_.notify_one();
+}
+
+bool PuyoWorkerPool::PopLocal(size_t index, std::function<void()>& job)
+{
+    auto& queue = *queues_[index];
+
+    std::lock_guard lock(queue.mutex);
+    if (queue.jobs.empty())
+    {
+        return false;
+    }
+
+    job = std::move(queue.jobs.back());
+    queue.jobs.pop_back();
+    return true;
+}
+
+bool PuyoWorkerPool::Steal(size_t index, std::function<void()>& job)
+{
+    for (size_t offset = 1; offset < queues_.size(); ++offset)
+    {
+        auto& queue = *queues_[(index + offset) % queues_.size()];
+
+        std::lock_guard lock(queue.mutex);
+        if (queue.jobs.empty())
+        {
+            continue;
+        }
+
+        job = std::move(queue.jobs.front());
+        queue.jobs.pop_front();
+
+        steal_count_.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    return false;
+}
+
+void PuyoWorkerPool::ParallelFor(size_t count, const std::function<void(size_t)>& func)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    auto state = std::make_shared<ParallelState>();
+    state->count = count;
+    state->func = &func;
+
+    // 보조 작업은 남은 인덱스가 없으면 바로 끝나므로 func가 사라진 뒤 시작해도 안전
+    const size_t helpers = std::min(threads_.size(), count - 1);
+    for (size_t i = 0; i < helpers; ++i)
+    {
+        Submit([state]() { state->Run(); });
+    }
+
+    state->Run();
+
+    std::unique_lock lock(state->mutex);
+    state->finished.wait(lock, [&state]() { return state->done.load(std::memory_order_acquire) == state->count; });
+}
+
+void PuyoWorkerPool::WorkerLoop(size_t index)
+{
+    current_pool = this;
+    current_index = index;
+
+    for (;;)
+    {
+        std::function<void()> job;
+        if (PopLocal(index, job) || Steal(index, job))
+        {
+            pending_.fetch_sub(1, std::memory_order_relaxed);
+            job();
+            continue;
+        }
+
+        std::unique_lock lock(sleep_mutex_);
+        condition_.wait(lock, [this]() { return stopping_ || pending_.load(std::memory_order_acquire) > 0; });
+
+        if (stopping_ && pending_.load(std::memory_order_acquire) == 0)
+        {
+            return;
+        }
+    }
+}
@@ -0,0 +1,76 @@
+#pragma once
+/*
+ *
+ * 설명: CPU 탐색용 백그라운드 작업 스레드 풀 (작업 훔치기 스케줄러)
+ *  1. 작업 스레드마다 자기 작업 큐를 가짐. 작업 스레드 안에서 Submit하면 자기 큐 뒤에 넣고 뒤에서 꺼냄(LIFO, 캐시 친화).
+ *     바깥 스레드(렌더 스레드 등)에서 Submit하면 큐를 돌아가며 나눠 넣음.
+ *  2. 자기 큐가 비면 다른 스레드 큐의 앞(가장 오래된 작업)에서 훔쳐 와 실행. 훔칠 것도 없으면 잠듦.
+ *  3. ParallelFor는 호출한 스레드도 인덱스를 가져가 처리하므로 작업 스레드 안에서 호출해도 교착되지 않음.
+ *  4. 스레드 수는 생성 시 고정. 소멸 시 남은 작업을 모두 처리한 뒤 종료.
+ *
+ */
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class PuyoWorkerPool
+{
+public:
+    explicit PuyoWorkerPool(size_t thread_count = GetDefaultThreadCount());
+    ~PuyoWorkerPool();
+
+    PuyoWorkerPool(const PuyoWorkerPool&) = delete;
+    PuyoWorkerPool& operator=(const PuyoWorkerPool&) = delete;
+    PuyoWorkerPool(PuyoWorkerPool&&) = delete;
+    PuyoWorkerPool& operator=(PuyoWorkerPool&&) = delete;
+
+    void Submit(std::function<void()> job);
+
+    // [0, count) 인덱스마다 func 호출. 모든 호출이 끝나면 반환
+    void ParallelFor(size_t count, const std::function<void(size_t)>& func);
+
+    [[nodiscard]] size_t GetThreadCount() const { return threads_.size(); }
+
+    // 다른 스레드 큐에서 훔쳐 실행한 작업 수 (부하 분산 확인용)
+    [[nodiscard]] uint64_t GetStealCount() const { return steal_count_.load(std::memory_order_relaxed); }
+
+    // 렌더 스레드 몫으로 코어 하나를 남긴 스레드 수 (최소 1)
+    [[nodiscard]] static size_t GetDefaultThreadCount();
+
+private:
+    // 큐마다 잠금을 따로 두어 자기 큐 작업은 다른 스레드와 거의 경합하지 않음
+    struct WorkQueue
+    {
+        std::mutex mutex;
+        std::deque<std::function<void()>> jobs;
+    };
+
+    void WorkerLoop(size_t index);
+
+    [[nodiscard]] bool PopLocal(size_t index, std::function<void()>& job);
+    [[nodiscard]] bool Steal(size_t index, std::function<void()>& job);
+
+    // 현재 스레드가 이 풀의 작업 스레드면 그 번호, 아니면 threads_.size()
+    [[nodiscard]] size_t GetCurrentIndex() const;
+
+private:
+    std::vector<std::thread> threads_;
+    std::vector<std::unique_ptr<WorkQueue>> queues_;
+
+    std::atomic<size_t> pending_{ 0 };      // 모든 큐에 남은 작업 수
+    std::atomic<size_t> next_queue_{ 0 };   // 바깥 스레드 Submit을 나눠 넣을 큐
+    std::atomic<uint64_t> steal_count_{ 0 };
+
+    // 잠들고 깨우는 데만 사용 (작업을 넣고 꺼낼 때는 잡지 않음)
+    std::mutex sleep_mutex_;
+    std::condition_variable condition_;
+    bool stopping_{ false };
+};
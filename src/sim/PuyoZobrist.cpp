@@ -0,0 +1,77 @@
+#include "PuyoZobrist.hpp"
+
+#include <algorithm>
+
+namespace PuyoZobrist
+{
+    uint64_t Hash(const PuyoBoard& board)
+    {
+        uint64_t hash = 0;
+
+        for (int x = 0; x < PuyoBoard::WIDTH; ++x)
+        {
+            const uint8_t* column = board.GetColumn(x);
+
+            // 중력 적용 후 보드는 빈칸 위에 블록이 없으므로 높이까지만 확인
+            for (int y = 0; y < PuyoBoard::HEIGHT && column[y] != 0; ++y)
+            {
+                hash ^= GetCellKey(x, y, static_cast<PuyoCell>(column[y]));
+            }
+        }
+
+        return hash;
+    }
+
+    uint64_t HashPieces(std::span<const PuyoPair> pairs)
+    {
+        uint64_t hash = 0;
+
+        const size_t count = std::min(pairs.size(), PIECE_SLOTS);
+        for (size_t slot = 0; slot < count; ++slot)
+        {
+            hash ^= GetPieceKey(slot, pairs[slot]);
+        }
+
+        return hash;
+    }
+
+    uint64_t HashPlacement(const PuyoBoard& board, const PuyoPair& pair, const PuyoPlacement& placement)
+    {
+        const int column = placement.column;
+        if (!board.CanPlace(column, placement.rotation))
+        {
+            return 0;
+        }
+
+        // PuyoBoard::Place와 같은 위치 계산
+        switch (placement.rotation)
+        {
+        case PuyoRotation::Up:
+        {
+            const int height = board.GetHeight(column);
+            return GetCellKey(column, height, pair.axis) ^ GetCellKey(column, height + 1, pair.child);
+        }
+        case PuyoRotation::Down:
+        {
+            const int height = board.GetHeight(column);
+            return GetCellKey(column, height, pair.child) ^ GetCellKey(column, height + 1, pair.axis);
+        }
+        case PuyoRotation::Right:
+            return GetCellKey(column, board.GetHeight(column), pair.axis) ^ GetCellKey(column + 1, board.GetHeight(column + 1), pair.child);
+        case PuyoRotation::Left:
+            return GetCellKey(column, board.GetHeight(column), pair.axis) ^ GetCellKey(column - 1, board.GetHeight(column - 1), pair.child);
+        }
+
+        return 0;
+    }
+
+    uint64_t HashResult(uint64_t board_hash, const PuyoBoard& board, const PuyoPair& pair, const PuyoPlacement& placement, const PuyoSimResult& result)
+    {
+        if (result.chain.chain_count == 0)
+        {
+            return board_hash ^ HashPlacement(board, pair, placement);
+        }
+
+        return Hash(result.board);
+    }
+}
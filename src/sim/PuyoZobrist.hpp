@@ -0,0 +1,74 @@
+#pragma once
+/*
+ *
+ * 설명: 보드/다음 블록 상태의 Zobrist 해시 (전치표 키)
+ *  1. 셀 위치(PuyoBoard::ToIndex)와 셀 값마다 고정 64비트 난수를 두고 채워진 셀의 난수를 모두 XOR. 빈칸은 0.
+ *  2. 난수표는 컴파일 시간에 splitmix64로 생성하므로 실행마다, 플랫폼마다 같은 키가 나옴.
+ *  3. 배치 한 번(연쇄 없음)은 착지한 두 칸의 난수만 XOR하면 되므로 HashPlacement로 증분 갱신.
+ *     연쇄가 일어나 블록이 제거/낙하한 보드는 Hash로 다시 계산.
+ *  4. 다음 블록 상태는 순서(슬롯)마다 다른 난수를 써서 보드 키에 XOR (같은 보드라도 남은 블록이 다르면 다른 키).
+ *
+ */
+
+#include "PuyoSimulator.hpp"
+
+#include <array>
+#include <cstdint>
+#include <span>
+
+namespace PuyoZobrist
+{
+    inline constexpr size_t CELL_VALUES = 8;       // PuyoCell 값 0 ~ 7
+    inline constexpr size_t PIECE_SLOTS = 4;       // 키에 넣을 수 있는 다음 블록 수
+
+    namespace Detail
+    {
+        [[nodiscard]] constexpr uint64_t SplitMix64(uint64_t& state)
+        {
+            uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            return z ^ (z >> 31);
+        }
+
+        inline constexpr size_t CELL_KEY_COUNT = PuyoBoard::WIDTH * PuyoBoard::COLUMN_STRIDE * CELL_VALUES;
+        inline constexpr size_t PIECE_KEY_COUNT = PIECE_SLOTS * CELL_VALUES * CELL_VALUES;
+
+        // 앞쪽은 셀 키, 뒤쪽은 다음 블록 키. 빈칸(값 0)의 셀 키는 0
+        inline constexpr std::array<uint64_t, CELL_KEY_COUNT + PIECE_KEY_COUNT> KEYS = []
+        {
+            std::array<uint64_t, CELL_KEY_COUNT + PIECE_KEY_COUNT> keys{};
+            uint64_t state = 0x5055594F5055594Full;
+
+            for (size_t i = 0; i < keys.size(); ++i)
+            {
+                const bool empty_cell = i < CELL_KEY_COUNT && i % CELL_VALUES == 0;
+                keys[i] = empty_cell ? 0 : SplitMix64(state);
+            }
+
+            return keys;
+        }();
+    }
+
+    [[nodiscard]] constexpr uint64_t GetCellKey(int x, int y, PuyoCell cell)
+    {
+        return Detail::KEYS[static_cast<size_t>(PuyoBoard::ToIndex(x, y)) * CELL_VALUES + static_cast<uint8_t>(cell)];
+    }
+
+    [[nodiscard]] constexpr uint64_t GetPieceKey(size_t slot, const PuyoPair& pair)
+    {
+        return Detail::KEYS[Detail::CELL_KEY_COUNT + (slot * CELL_VALUES + static_cast<uint8_t>(pair.axis)) * CELL_VALUES + static_cast<uint8_t>(pair.child)];
+    }
+
+    // 보드 전체 키
+    [[nodiscard]] uint64_t Hash(const PuyoBoard& board);
+
+    // 다음 블록 상태 키 (앞에서부터 PIECE_SLOTS개까지)
+    [[nodiscard]] uint64_t HashPieces(std::span<const PuyoPair> pairs);
+
+    // board에 pair를 놓았을 때 바뀌는 키 (Hash(board) ^ 반환값 == 연쇄 전 배치 직후 보드의 키). 배치할 수 없으면 0
+    [[nodiscard]] uint64_t HashPlacement(const PuyoBoard& board, const PuyoPair& pair, const PuyoPlacement& placement);
+
+    // 배치 결과 보드의 키. 연쇄가 없었으면 증분 갱신, 있었으면 결과 보드를 다시 계산
+    [[nodiscard]] uint64_t HashResult(uint64_t board_hash, const PuyoBoard& board, const PuyoPair& pair, const PuyoPlacement& placement, const PuyoSimResult& result);
+}
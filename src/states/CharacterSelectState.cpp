@@ -1,6 +1,7 @@
 #include "CharacterSelectState.hpp"
 #include "../network/NetworkController.hpp"
 #include "../core/GameApp.hpp"
+#include "../core/GameUtils.hpp"
 #include "../core/manager/ResourceManager.hpp"
 #include "../core/manager/PlayerManager.hpp"
 #include "../core/manager/StateManager.hpp"
@@ -14,7 +15,6 @@
 #include <SDL3/SDL_keyboard.h >
 #include <format>
 #include <stdexcept>
-#include <random>
 #include "GameState.hpp"
 #include "../utils/Logger.hpp"
 
@@ -276,13 +276,10 @@ void CharacterSelectState::HandleCharacterSelection()
 
 void CharacterSelectState::SelectRandomCharacter() 
 {
-    std::random_device rd;
-    std::mt19937 gen(rd());
-
     while (true) 
     {
-        current_pos_.x = std::uniform_int_distribution<>(0, 6)(gen);
-        current_pos_.y = std::uniform_int_distribution<>(0, 3)(gen);
+        current_pos_.x = GameUtils::Random::Range(0, 6, RandomStream::Ui);
+        current_pos_.y = GameUtils::Random::Range(0, 3, RandomStream::Ui);
 
         uint8_t idx = current_pos_.y * 7 + current_pos_.x;
         if (character_info_[idx] && character_info_[idx]->largePortrait) {
@@ -16,6 +16,7 @@
 
 #include "../game/map/GameBackground.hpp"
 #include "../game/system/LocalPlayer.hpp"
+#include "../game/system/CpuPlayer.hpp"
 #include "../game/system/RemotePlayer.hpp"
 #include "../game/block/GameGroupBlock.hpp"
 
@@ -28,14 +29,23 @@
 
 #include "../utils/Logger.hpp"
 #include "../utils/TimerScheduler.hpp"
+#include "../utils/Random.hpp"
 
 #include <format>
 #include <stdexcept>
 #include <algorithm>
 #include <span>
-#include <random>
 #include "../game/system/GameBoard.hpp"
 
+namespace
+{
+    // 새 게임의 블록 순서 시드 (--seed 고정 시드 모드에서는 같은 시드가 만들어짐)
+    [[nodiscard]] uint32_t NewPieceSeed()
+    {
+        return static_cast<uint32_t>(RandomService::GetEngine(RandomStream::Gameplay)() >> 32);
+    }
+}
+
 GameState::GameState()
 {
     InitializePacketHandlers();
@@ -102,7 +112,16 @@ bool GameState::LoadResources()
 
 bool GameState::CreatePlayers()
 {
-    local_player_ = std::make_shared<LocalPlayer>();
+    if (const auto cpu_level = GAME_APP.GetCpuLevel())
+    {
+        local_player_ = std::make_shared<CpuPlayer>(*cpu_level);
+        is_cpu_player_ = true;
+    }
+    else
+    {
+        local_player_ = std::make_shared<LocalPlayer>();
+    }
+
     remote_player_ = std::make_shared<RemotePlayer>();
 
     return true;
@@ -165,7 +184,7 @@ void GameState::Enter()
     if (restart_button_) restart_button_->SetVisible(false);
     if (exit_button_) exit_button_->SetVisible(false);
 
-    CreateGamePlayer(std::span<const uint8_t>(), std::span<const uint8_t>(), local_player_id_, characterId);
+    CreateGamePlayer(NewPieceSeed(), local_player_id_, characterId);
     ScheduleGameStart();
 
     should_quit_ = false;
@@ -352,7 +371,7 @@ void GameState::HandleKeyboardInput(const SDL_Event& event)
         return;
     }
 
-    if (local_player_ && local_player_->GetGameState() == GamePhase::Playing)
+    if (local_player_ && local_player_->GetGameState() == GamePhase::Playing && !is_cpu_player_)
     {
         switch (event.key.key)
         {
@@ -386,7 +405,7 @@ void GameState::HandleKeyboardState()
 
     if (local_player_)
     {
-        if (local_player_->GetGameState() == GamePhase::Playing)
+        if (local_player_->GetGameState() == GamePhase::Playing && !is_cpu_player_)
         {
             if (keyStates[SDL_SCANCODE_LEFT])
             {
@@ -434,58 +453,15 @@ bool GameState::GameRestart()
     {
         Reset();
 
-        auto success = local_player_->Restart();
+        auto success = local_player_->Restart(NewPieceSeed());
         if (!success)
         {
             LOGGER.Error("Failed to restart local player");
             return false;
         }
 
-        if (NETWORK.IsServer())
-        {
-            const auto& next_blocks = local_player_->GetNextBlock();
-            if (next_blocks.size() >= 2)
-            {
-                std::array<uint8_t, 2> block_type1{};
-                std::array<uint8_t, 2> block_type2{};
-
-                auto first_block = next_blocks[0].get();
-                if (first_block) {
-                    auto blocks = first_block->GetBlocks();
-                    if (blocks.size() >= 2) {
-                        block_type1[0] = static_cast<uint8_t>(blocks[0]->GetBlockType());
-                        block_type1[1] = static_cast<uint8_t>(blocks[1]->GetBlockType());
-                    }
-                }
-
-                auto second_block = next_blocks[1].get();
-                if (second_block) {
-                    auto blocks = second_block->GetBlocks();
-                    if (blocks.size() >= 2) {
-                        block_type2[0] = static_cast<uint8_t>(blocks[0]->GetBlockType());
-                        block_type2[1] = static_cast<uint8_t>(blocks[1]->GetBlockType());
-                    }
-                }
-
-                NETWORK.ReStartGame(block_type1, block_type2);
-            }
-        }
-        else
-        {
-            const auto& next_blocks = local_player_->GetNextBlock();
-            std::array<uint8_t, 2> block_type1{};
-            std::array<uint8_t, 2> block_type2{};
-
-            auto& first_blocks = next_blocks[0]->GetBlocks();
-            block_type1[0] = static_cast<uint8_t>(first_blocks[0]->GetBlockType());
-            block_type1[1] = static_cast<uint8_t>(first_blocks[1]->GetBlockType());
-
-            auto& second_blocks = next_blocks[1]->GetBlocks();
-            block_type2[0] = static_cast<uint8_t>(second_blocks[0]->GetBlockType());
-            block_type2[1] = static_cast<uint8_t>(second_blocks[1]->GetBlockType());
-
-            NETWORK.ReStartGame(block_type1, block_type2);
-        }
+        // 상대는 시드로 같은 블록 순서를 만듦
+        NETWORK.ReStartGame(local_player_->GetPieceSeed());
 
         if (restart_button_) restart_button_->SetVisible(false);
         if (exit_button_) exit_button_->SetVisible(false);
@@ -676,22 +652,18 @@ void GameState::HandleGameInitialize(uint8_t connectionId, const GameInitPacket*
         auto& next_blocks = local_player_->GetNextBlock();
         background_->SetNextBlock(next_blocks[0]);
         background_->SetNextBlock(next_blocks[1]);
-        
-        std::span<const uint8_t> blockType1(packet->block1);
-        std::span<const uint8_t> blockType2(packet->block2);
 
-        CreateGamePlayer(blockType1, blockType2, packet->player_id, packet->character_id);
+        CreateGamePlayer(packet->piece_seed, packet->player_id, packet->character_id);
 
         ScheduleGameStart();
     }
 }
 
-void GameState::CreateGamePlayer(const std::span<const uint8_t>& blockType1, const std::span<const uint8_t>& blockType2,
-    uint8_t playerIdx, uint16_t characterIdx)
+void GameState::CreateGamePlayer(uint32_t pieceSeed, uint8_t playerIdx, uint16_t characterIdx)
 {
     if (playerIdx == GAME_APP.GetPlayerManager().GetMyPlayer()->GetId())
     {
-        if (local_player_->Initialize(blockType1, blockType2, playerIdx, characterIdx, background_) == false)
+        if (local_player_->Initialize(pieceSeed, playerIdx, characterIdx, background_) == false)
         {
             LOGGER.Error("Failed to initialize local player");
         }
@@ -701,7 +673,7 @@ void GameState::CreateGamePlayer(const std::span<const uint8_t>& blockType1, con
     }
     else
     {
-        if (remote_player_->Initialize(blockType1, blockType2, playerIdx, characterIdx, background_) == false)
+        if (remote_player_->Initialize(pieceSeed, playerIdx, characterIdx, background_) == false)
         {
             LOGGER.Error("Failed to initialize remote player");
         }
@@ -722,7 +694,7 @@ void GameState::HandleAddNewBlock(uint8_t connectionId, const AddNewBlockPacket*
 
     if (player->GetId() != local_player_id_ && remote_player_)
     {
-        remote_player_->AddNewBlock(packet->block_type);
+        remote_player_->AddNewBlock(packet->piece_index);
     }
 }
 
@@ -852,12 +824,9 @@ void GameState::HandleRestart(uint8_t connectionId, const RestartGamePacket* pac
 
     if (player->GetId() != local_player_id_ && remote_player_)
     {
-        std::span<const uint8_t> blockType1(packet->block1);
-        std::span<const uint8_t> blockType2(packet->block2);
-
         GameRestart();
 
-        remote_player_->Restart(blockType1, blockType2);
+        remote_player_->Restart(packet->piece_seed);
     }
 }
 
@@ -1002,7 +971,7 @@ void GameState::Release()
     SDL_StopTextInput(GAME_APP.GetWindow());
 }
 
-Block* (*GameState::GetGameBlocks(uint8_t playerId))[Constants::Board::BOARD_X_COUNT]
+BlockGrid* GameState::GetGameBlocks(uint8_t playerId)
 {
     if (local_player_->GetPlayerID() == playerId)
     {
@@ -28,6 +28,7 @@ class ComboView;
 class ResultView;
 class LocalPlayer;
 class RemotePlayer;
+class BlockGrid;
 class Player;
 class NetworkController;
 struct ClientInfo;
@@ -100,14 +101,13 @@ public:
     [[nodiscard]] const std::shared_ptr<LocalPlayer>& GetLocalPlayer() const { return local_player_; }
     [[nodiscard]] const std::shared_ptr<RemotePlayer>& GetRemotePlayer() const { return remote_player_; }
     [[nodiscard]] GameBackground* GetBackGround() const { return background_.get(); }
-    [[nodiscard]] Block* (*GetGameBlocks(uint8_t playerId))[Constants::Board::BOARD_X_COUNT];
+    [[nodiscard]] BlockGrid* GetGameBlocks(uint8_t playerId);
 
     //  Flow 
     bool GameRestart();
     bool GameExit();
     void GameQuit();
-    void CreateGamePlayer(const std::span<const uint8_t>& blockType1, const std::span<const uint8_t>& blockType2,
-        uint8_t playerIdx, uint16_t characterIdx);
+    void CreateGamePlayer(uint32_t pieceSeed, uint8_t playerIdx, uint16_t characterIdx);
 
     void ScheduleGameStart();
 
@@ -177,6 +177,7 @@ private:
     uint64_t lastInputTime_{ 0 };
     bool initialized_{ false };
     bool is_network_game_{ false };
+    bool is_cpu_player_{ false };   //  ڸ CpuPlayer  (Ű Է )
     uint8_t local_player_id_{ 0 };
     bool should_quit_{ false };
 
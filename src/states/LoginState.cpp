@@ -280,10 +280,15 @@ bool LoginState::RequireConnect()
     NETWORK.SetAddress("127.0.0.1");
     return NETWORK.Start();
 #else
-    if (ui_elements_.ip_input && !ui_elements_.ip_input->IsEmpty()) 
+    // ߰ 带 ġ ȣƮ IP   ڵ常 
+    const bool has_address = ui_elements_.ip_input && !ui_elements_.ip_input->IsEmpty();
+    if (has_address || NETWORK.GetRelaySessionCode() != 0) 
     {
         NETWORK.Initialize(NetworkRole::Client);
-        NETWORK.SetAddress(ui_elements_.ip_input->GetText(TextType::ANSI));
+        if (has_address)
+        {
+            NETWORK.SetAddress(ui_elements_.ip_input->GetText(TextType::ANSI));
+        }
         return NETWORK.Start();
     }
     return false;
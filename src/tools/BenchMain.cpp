@@ -0,0 +1,48 @@
+/*
+ *
+ * 설명: 벤치마크/부하 테스트 진입점
+ *  사용법: puzzle_bench.exe <이름> [인자...]
+ *
+ */
+
+#include "Benchmarks.hpp"
+
+#include <cstdio>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    void PrintUsage()
+    {
+        std::printf("usage: puzzle_bench <name> [args...]\n");
+
+        for (const auto& bench : BENCHMARKS)
+        {
+            std::printf("  %.*s\n", static_cast<int>(bench.usage.size()), bench.usage.data());
+        }
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc < 2)
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    const std::string_view name = argv[1];
+    const std::vector<std::string_view> args(argv + 2, argv + argc);
+
+    for (const auto& bench : BENCHMARKS)
+    {
+        if (bench.name == name)
+        {
+            return bench.run(args);
+        }
+    }
+
+    PrintUsage();
+    return 1;
+}
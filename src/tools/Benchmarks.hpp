@@ -0,0 +1,102 @@
+#pragma once
+/*
+ *
+ * 설명: 벤치마크/부하 테스트 목록 (puzzle_bench.exe <이름> [인자...])
+ *  1. 각 벤치마크는 bench/ 아래 파일 하나에 구현하고 여기에 등록.
+ *  2. 결과는 콘솔에 출력하며 게임 클라이언트(SDL)에 의존하지 않음.
+ *
+ */
+
+#include <array>
+#include <charconv>
+#include <span>
+#include <string_view>
+
+using BenchArgs = std::span<const std::string_view>;
+
+struct BenchEntry
+{
+    std::string_view name;
+    std::string_view usage;
+    int (*run)(BenchArgs args);
+};
+
+// 전용 서버 부하 테스트 (bench/LoadTestBench.cpp)
+int RunLoadTestBench(BenchArgs args);
+
+// 대용량 메시지 조각 전송/재조립 (bench/ChunkBench.cpp)
+int RunChunkBench(BenchArgs args);
+
+// CPU 빔 탐색 난이도별 비용/실력 (bench/CpuBench.cpp)
+int RunCpuBench(BenchArgs args);
+
+// 중력 커널 비교 (bench/GravityBench.cpp)
+int RunGravityBench(BenchArgs args);
+
+// 보드 열 비트 판정과 기존 배열/사각형 검사 비교 (bench/GridBench.cpp)
+int RunGridBench(BenchArgs args);
+
+// 연결 그룹 검색 비교 (bench/MatchBench.cpp)
+int RunMatchBench(BenchArgs args);
+
+// 매치메이킹 대기열 시뮬레이션 (bench/MatchmakingBench.cpp)
+int RunMatchmakingBench(BenchArgs args);
+
+// 병렬 몬테카를로 트리 탐색 스레드 수별 확장성 (bench/MctsBench.cpp)
+int RunMctsBench(BenchArgs args);
+
+// 난수 생성 비용 (bench/RandomBench.cpp)
+int RunRandomBench(BenchArgs args);
+
+// 리플레이 파일 크기/재생/탐색 (bench/ReplayBench.cpp)
+int RunReplayBench(BenchArgs args);
+
+// 중계 노드 지연 측정 (bench/RelayBench.cpp)
+int RunRelayBench(BenchArgs args);
+
+// 배치 시뮬레이터 처리량 (bench/SimulateBench.cpp)
+int RunSimulateBench(BenchArgs args);
+
+// 타이밍 휠 예약/취소/만료 비용 (bench/TimerWheelBench.cpp)
+int RunTimerWheelBench(BenchArgs args);
+
+// CPU 대 CPU 대전 대량 진행 (bench/TournamentBench.cpp)
+int RunTournamentBench(BenchArgs args);
+
+// Zobrist 해시와 전치표 적중률 (bench/TranspositionBench.cpp)
+int RunTranspositionBench(BenchArgs args);
+
+inline constexpr std::array BENCHMARKS
+{
+    BenchEntry{ "chunk", "chunk [messages=2000] [reopen=100000]", &RunChunkBench },
+    BenchEntry{ "cpu", "cpu [games=4] [turns=200] [threads=cores-1]", &RunCpuBench },
+    BenchEntry{ "gravity", "gravity [boards=10000] [iterations=200]", &RunGravityBench },
+    BenchEntry{ "grid", "grid [boards=10000] [operations=64] [iterations=100]", &RunGridBench },
+    BenchEntry{ "loadtest", "loadtest [ip=127.0.0.1] [matches=100] [seconds=30] [moves_per_sec=30]", &RunLoadTestBench },
+    BenchEntry{ "match", "match [boards=10000] [iterations=100]", &RunMatchBench },
+    BenchEntry{ "matchmaking", "matchmaking [players...=10000 100000 1000000]", &RunMatchmakingBench },
+    BenchEntry{ "mcts", "mcts [budget_ms=50] [turns=60] [max_threads=32]", &RunMctsBench },
+    BenchEntry{ "random", "random [values=10000000]", &RunRandomBench },
+    BenchEntry{ "replay", "replay [games=8] [turns=300]", &RunReplayBench },
+    BenchEntry{ "relay", "relay [ip=127.0.0.1] [pairs=1000] [seconds=30] [msgs_per_sec=30]", &RunRelayBench },
+    BenchEntry{ "simulate", "simulate [boards=10000] [iterations=20]", &RunSimulateBench },
+    BenchEntry{ "timerwheel", "timerwheel [timers=1000000]", &RunTimerWheelBench },
+    BenchEntry{ "tournament", "tournament [matches=1000] [first=easy] [second=random] [turns=200] [threads=cores-1]", &RunTournamentBench },
+    BenchEntry{ "transposition", "transposition [turns=200] [memory_kb...=256 4096 65536]", &RunTranspositionBench },
+};
+
+// index 위치의 인자를 숫자로 변환 (없거나 잘못된 값이면 기본값)
+template<typename T>
+[[nodiscard]] T GetBenchArg(BenchArgs args, size_t index, T default_value)
+{
+    if (index >= args.size())
+    {
+        return default_value;
+    }
+
+    T value{};
+    const auto arg = args[index];
+    const auto [ptr, ec] = std::from_chars(arg.data(), arg.data() + arg.size(), value);
+
+    return (ec == std::errc{} && ptr == arg.data() + arg.size()) ? value : default_value;
+}
@@ -0,0 +1,302 @@
+/*
+ *
+ * 설명: 대용량 메시지 조각 전송/재조립 왕복과 재조립 메모리 제한 확인
+ *  1. roundtrip: 257B~256KB 임의 크기 메시지를 최대 CHUNK_MAX_STREAMS개씩 ChunkSender에 넣고 CHUNK_SEND_BUDGET씩 뽑아
+ *     ChunkAssembler로 재조립. 원본과 다르거나 완성되지 않은 메시지는 mismatch로 출력.
+ *  2. abandon: 첫 조각만 보내고 멈춘 메시지가 차지하는 재조립 바이트와 타임아웃 후 회수 여부.
+ *  3. reopen: 잘못된 조각 + 새 메시지 시작을 반복할 때의 비용 (버퍼를 미리 잡지 않으므로 조각 크기만큼만 복사).
+ *  4. cap: 동시에 재조립 중인 바이트가 CHUNK_MAX_PENDING_BYTES를 넘으면 거부되는지.
+ *
+ */
+
+#include "../Benchmarks.hpp"
+#include "../../core/common/constants/NetworkConstants.hpp"
+#include "../../network/ChunkChannel.hpp"
+#include "../../network/packets/GamePackets.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+    using BenchClock = std::chrono::steady_clock;
+
+    constexpr size_t CHUNK_DATA_SIZE = sizeof(MessageChunkPacket::data);
+
+    [[nodiscard]] double ElapsedNs(BenchClock::time_point start)
+    {
+        return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(BenchClock::now() - start).count());
+    }
+
+    // 헤더가 자기 크기를 가진 유효한 패킷 (내용은 임의 바이트)
+    [[nodiscard]] std::vector<char> MakeMessage(std::mt19937& rng, size_t size)
+    {
+        std::vector<char> message(size);
+        for (auto& byte : message)
+        {
+            byte = static_cast<char>(rng());
+        }
+
+        PacketBase header{};
+        header.size = static_cast<uint32_t>(size);
+        header.type = static_cast<uint16_t>(PacketType::ChatMessage);
+        std::memcpy(message.data(), &header, sizeof(PacketBase));
+        return message;
+    }
+
+    // 이어 붙은 조각 스트림을 패킷 단위로 나눠 재조립기에 전달
+    template<typename OnComplete>
+    size_t FeedChunks(const std::vector<char>& stream, ChunkAssembler& assembler, ChunkBufferPool& pool,
+        BenchClock::time_point now, OnComplete&& on_complete)
+    {
+        size_t invalid = 0;
+
+        for (size_t offset = 0; offset + sizeof(PacketBase) <= stream.size();)
+        {
+            PacketBase header{};
+            std::memcpy(&header, stream.data() + offset, sizeof(PacketBase));
+
+            ChunkBufferPtr completed;
+            switch (assembler.OnChunk(std::span<const char>(stream.data() + offset, header.size), pool, completed, now))
+            {
+            case ChunkAssembler::Result::Complete:
+                on_complete(*completed);
+                break;
+
+            case ChunkAssembler::Result::Invalid:
+                ++invalid;
+                break;
+
+            default:
+                break;
+            }
+
+            offset += header.size;
+        }
+
+        return invalid;
+    }
+
+    // 메시지의 offset 위치 조각 하나 (ChunkSender와 같은 형식)
+    [[nodiscard]] std::vector<char> MakeChunk(uint32_t message_id, const std::vector<char>& message, size_t offset)
+    {
+        const size_t data_size = (std::min)(CHUNK_DATA_SIZE, message.size() - offset);
+
+        MessageChunkPacket chunk;
+        chunk.size = static_cast<uint32_t>(MessageChunkPacket::HEADER_SIZE + data_size);
+        chunk.message_id = message_id;
+        chunk.total_size = static_cast<uint32_t>(message.size());
+        chunk.offset = static_cast<uint32_t>(offset);
+        std::memcpy(chunk.data.data(), message.data() + offset, data_size);
+
+        const char* bytes = reinterpret_cast<const char*>(&chunk);
+        return std::vector<char>(bytes, bytes + chunk.size);
+    }
+
+    void RunRoundTrip(size_t message_count)
+    {
+        std::mt19937 rng(static_cast<uint32_t>(message_count));
+        std::uniform_int_distribution<size_t> size_dist(Constants::Network::MAX_PACKET_SIZE + 1, Constants::Network::MAX_CHUNKED_MESSAGE_SIZE);
+
+        ChunkSender sender;
+        ChunkAssembler assembler;
+        ChunkBufferPool pool;
+
+        std::vector<std::vector<char>> batch;
+        std::vector<char> stream;
+        stream.reserve(Constants::Network::CHUNK_SEND_BUDGET * Constants::Network::MAX_PACKET_SIZE);
+
+        size_t completed = 0;
+        size_t mismatched = 0;
+        size_t invalid = 0;
+        size_t max_pending_bytes = 0;
+        uint64_t bytes = 0;
+        double elapsed_ns = 0.0;
+
+        for (size_t sent = 0; sent < message_count;)
+        {
+            // 동시에 재조립되는 메시지 수와 바이트 제한을 넘지 않도록 한 번에 넣는 메시지 묶음을 정함
+            batch.clear();
+            size_t batch_bytes = 0;
+            while (sent + batch.size() < message_count && batch.size() < Constants::Network::CHUNK_MAX_STREAMS)
+            {
+                const size_t size = size_dist(rng);
+                if (batch_bytes + size > Constants::Network::CHUNK_MAX_PENDING_BYTES)
+                {
+                    break;
+                }
+
+                batch.push_back(MakeMessage(rng, size));
+                batch_bytes += size;
+            }
+
+            if (batch.empty())
+            {
+                batch.push_back(MakeMessage(rng, Constants::Network::MAX_CHUNKED_MESSAGE_SIZE));
+            }
+
+            std::vector<bool> matched(batch.size(), false);
+
+            const auto start = BenchClock::now();
+            for (const auto& message : batch)
+            {
+                if (sender.Queue(message) == false)
+                {
+                    std::printf("  mismatch: sender rejected %zu byte message\n", message.size());
+                }
+            }
+
+            while (!sender.IsEmpty())
+            {
+                stream.clear();
+                sender.Pump(Constants::Network::CHUNK_SEND_BUDGET, stream);
+
+                invalid += FeedChunks(stream, assembler, pool, BenchClock::now(),
+                    [&](const std::vector<char>& result)
+                    {
+                        ++completed;
+                        for (size_t i = 0; i < batch.size(); ++i)
+                        {
+                            if (!matched[i] && batch[i] == result)
+                            {
+                                matched[i] = true;
+                                return;
+                            }
+                        }
+                        ++mismatched;
+                    });
+
+                max_pending_bytes = (std::max)(max_pending_bytes, assembler.GetPendingBytes());
+            }
+            elapsed_ns += ElapsedNs(start);
+
+            mismatched += static_cast<size_t>(std::count(matched.begin(), matched.end(), false));
+            bytes += batch_bytes;
+            sent += batch.size();
+        }
+
+        std::printf("roundtrip (%zu messages, %.1f MB)\n", message_count, static_cast<double>(bytes) / (1024.0 * 1024.0));
+        std::printf("  throughput      : %.1f MB/s (%.2f us/message)\n",
+            static_cast<double>(bytes) / (1024.0 * 1024.0) / (elapsed_ns / 1e9), elapsed_ns / 1000.0 / static_cast<double>((std::max)(message_count, size_t{ 1 })));
+        std::printf("  max pending     : %zu bytes, pooled buffers %zu\n", max_pending_bytes, pool.GetPooledCount());
+
+        if (completed != message_count || mismatched > 0 || invalid > 0 || assembler.GetPendingCount() > 0)
+        {
+            std::printf("  mismatch: %zu completed, %zu mismatched, %zu invalid, %zu pending\n",
+                completed, mismatched, invalid, assembler.GetPendingCount());
+        }
+    }
+
+    void RunAbandon()
+    {
+        std::mt19937 rng(1);
+        ChunkAssembler assembler;
+        ChunkBufferPool pool;
+
+        const auto now = BenchClock::now();
+        const auto message = MakeMessage(rng, Constants::Network::MAX_CHUNKED_MESSAGE_SIZE);
+
+        size_t invalid = 0;
+        for (uint32_t id = 1; id <= Constants::Network::CHUNK_MAX_STREAMS; ++id)
+        {
+            invalid += FeedChunks(MakeChunk(id, message, 0), assembler, pool, now, [](const std::vector<char>&) {});
+        }
+
+        const size_t pending_bytes = assembler.GetPendingBytes();
+        const size_t pending_count = assembler.GetPendingCount();
+
+        // 제한 시간이 지나면 회수되고, 늦게 온 나머지 조각은 잘못된 조각으로 세지 않고 무시
+        const auto later = now + std::chrono::milliseconds(Constants::Network::CHUNK_REASSEMBLY_TIMEOUT);
+        const size_t expired = assembler.Expire(later);
+        const size_t late_invalid = FeedChunks(MakeChunk(1, message, CHUNK_DATA_SIZE), assembler, pool, later, [](const std::vector<char>&) {});
+
+        std::printf("abandon (%zu streams of %zu bytes, first chunk only)\n", Constants::Network::CHUNK_MAX_STREAMS, message.size());
+        std::printf("  pending         : %zu bytes in %zu streams (full preallocation would be %zu bytes)\n",
+            pending_bytes, pending_count, Constants::Network::CHUNK_MAX_STREAMS * message.size());
+        std::printf("  expired         : %zu streams after %d ms, %zu bytes pending\n",
+            expired, Constants::Network::CHUNK_REASSEMBLY_TIMEOUT, assembler.GetPendingBytes());
+
+        if (invalid > 0 || pending_bytes != Constants::Network::CHUNK_MAX_STREAMS * CHUNK_DATA_SIZE ||
+            expired != pending_count || assembler.GetPendingBytes() != 0 || late_invalid > 0)
+        {
+            std::printf("  mismatch: invalid %zu, expired %zu, late invalid %zu\n", invalid, expired, late_invalid);
+        }
+    }
+
+    void RunReopen(size_t iterations)
+    {
+        std::mt19937 rng(2);
+        ChunkAssembler assembler;
+        ChunkBufferPool pool;
+
+        const auto message = MakeMessage(rng, Constants::Network::MAX_CHUNKED_MESSAGE_SIZE);
+        const auto first = MakeChunk(1, message, 0);
+        const auto skipped = MakeChunk(1, message, CHUNK_DATA_SIZE * 2);   // 순서가 어긋난 조각
+
+        size_t invalid = 0;
+        const auto now = BenchClock::now();
+        const auto start = BenchClock::now();
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            invalid += FeedChunks(first, assembler, pool, now, [](const std::vector<char>&) {});
+            invalid += FeedChunks(skipped, assembler, pool, now, [](const std::vector<char>&) {});
+            assembler.Reset();
+        }
+        const double elapsed_ns = ElapsedNs(start);
+
+        std::printf("reopen (%zu x open + invalid chunk)\n", iterations);
+        std::printf("  cost            : %.1f ns/cycle\n", elapsed_ns / static_cast<double>((std::max)(iterations, size_t{ 1 })));
+
+        if (invalid != iterations)
+        {
+            std::printf("  mismatch: %zu invalid chunks, expected %zu\n", invalid, iterations);
+        }
+    }
+
+    void RunCap()
+    {
+        std::mt19937 rng(3);
+        ChunkAssembler assembler;
+        ChunkBufferPool pool;
+
+        // 두 메시지를 번갈아 보내 합이 제한을 넘는 시점에 거부되는지 확인
+        const auto message = MakeMessage(rng, Constants::Network::MAX_CHUNKED_MESSAGE_SIZE);
+        const auto now = BenchClock::now();
+
+        size_t invalid = 0;
+        size_t accepted_bytes = 0;
+        for (size_t offset = 0; offset < message.size() && invalid == 0; offset += CHUNK_DATA_SIZE)
+        {
+            for (uint32_t id = 1; id <= 2 && invalid == 0; ++id)
+            {
+                invalid += FeedChunks(MakeChunk(id, message, offset), assembler, pool, now, [](const std::vector<char>&) {});
+            }
+            accepted_bytes = (std::max)(accepted_bytes, assembler.GetPendingBytes());
+        }
+
+        std::printf("cap (2 interleaved %zu byte messages, limit %zu)\n", message.size(), Constants::Network::CHUNK_MAX_PENDING_BYTES);
+        std::printf("  rejected at     : %zu pending bytes\n", accepted_bytes);
+
+        if (invalid != 1 || accepted_bytes > Constants::Network::CHUNK_MAX_PENDING_BYTES)
+        {
+            std::printf("  mismatch: limit not enforced (invalid %zu)\n", invalid);
+        }
+    }
+}
+
+int RunChunkBench(BenchArgs args)
+{
+    const size_t message_count = GetBenchArg<size_t>(args, 0, 2'000);
+    const size_t reopen_count = GetBenchArg<size_t>(args, 1, 100'000);
+
+    RunRoundTrip(message_count);
+    RunAbandon();
+    RunReopen(reopen_count);
+    RunCap();
+
+    return 0;
+}
@@ -0,0 +1,131 @@
+/*
+ *
+ * 설명: CPU 빔 탐색(PuyoBeamSearch) 난이도별 비용과 실력 측정
+ *  1. 난이도마다 같은 시드의 블록 순서로 엔진 게임을 진행하며 매 턴 탐색 결과대로 배치.
+ *  2. 배치당 탐색 시간, 평가한 보드 수, 시간 예산 초과 횟수를 측정.
+ *  3. 실력 지표로 최대 연쇄, 5연쇄 이상 횟수, 평균 점수, 게임 오버 수를 출력.
+ *
+ */
+
+#include "../Benchmarks.hpp"
+#include "../../sim/PuyoBeamSearch.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+
+namespace
+{
+    struct LevelStats
+    {
+        uint64_t moves{ 0 };
+        uint64_t nodes{ 0 };
+        uint64_t elapsed_us{ 0 };
+        uint64_t timeouts{ 0 };
+        uint64_t big_chains{ 0 };
+        uint64_t score{ 0 };
+        uint32_t game_overs{ 0 };
+        uint8_t max_chain{ 0 };
+    };
+
+    constexpr uint8_t BIG_CHAIN = 5;
+
+    [[nodiscard]] const char* GetLevelName(PuyoCpuLevel level)
+    {
+        switch (level)
+        {
+        case PuyoCpuLevel::Easy:
+            return "easy";
+        case PuyoCpuLevel::Hard:
+            return "hard";
+        default:
+            return "normal";
+        }
+    }
+
+    [[nodiscard]] PuyoPair RandomPair(std::mt19937& rng)
+    {
+        return { static_cast<PuyoCell>(1 + rng() % PUYO_COLOR_COUNT), static_cast<PuyoCell>(1 + rng() % PUYO_COLOR_COUNT) };
+    }
+
+    void PlayGame(uint32_t seed, int turns, const PuyoBeamConfig& config, PuyoWorkerPool& pool, LevelStats& stats)
+    {
+        std::mt19937 rng(seed);
+        PuyoEngine engine(seed);
+
+        std::array<PuyoPair, PuyoSearchRequest::MAX_PAIRS> pairs{};
+        for (auto& pair : pairs)
+        {
+            pair = RandomPair(rng);
+        }
+
+        PuyoChainResult chain;
+
+        for (int turn = 0; turn < turns; ++turn)
+        {
+            PuyoSearchRequest request;
+            request.board = engine.GetBoard();
+            request.pairs = pairs;
+            request.pair_count = static_cast<uint8_t>(pairs.size());
+            request.state = engine.GetChainState();
+
+            const auto result = PuyoBeamSearch::Search(request, config, &pool);
+
+            ++stats.moves;
+            stats.nodes += result.nodes;
+            stats.elapsed_us += result.elapsed_us;
+            stats.timeouts += result.timed_out ? 1 : 0;
+
+            if (!result.found || !engine.PlayTurn(pairs[0], result.placement.column, result.placement.rotation, chain) ||
+                engine.GetPhase() == PuyoPhase::GameOver)
+            {
+                ++stats.game_overs;
+                break;
+            }
+
+            stats.max_chain = std::max(stats.max_chain, chain.chain_count);
+            stats.big_chains += chain.chain_count >= BIG_CHAIN ? 1 : 0;
+
+            std::rotate(pairs.begin(), pairs.begin() + 1, pairs.end());
+            pairs.back() = RandomPair(rng);
+        }
+
+        stats.score += engine.GetScore();
+    }
+}
+
+int RunCpuBench(BenchArgs args)
+{
+    const int games = GetBenchArg<int>(args, 0, 4);
+    const int turns = GetBenchArg<int>(args, 1, 200);
+    const size_t threads = GetBenchArg<size_t>(args, 2, PuyoWorkerPool::GetDefaultThreadCount());
+
+    PuyoWorkerPool pool(threads);
+
+    std::printf("cpu (%d games x %d turns, %zu threads)\n", games, turns, pool.GetThreadCount());
+
+    for (const auto level : { PuyoCpuLevel::Easy, PuyoCpuLevel::Normal, PuyoCpuLevel::Hard })
+    {
+        const auto config = PuyoBeamSearch::GetLevelConfig(level);
+
+        LevelStats stats;
+        for (int game = 0; game < games; ++game)
+        {
+            PlayGame(static_cast<uint32_t>(game + 1), turns, config, pool, stats);
+        }
+
+        const double moves = static_cast<double>(std::max<uint64_t>(stats.moves, 1));
+        const double elapsed_us = static_cast<double>(std::max<uint64_t>(stats.elapsed_us, 1));
+
+        std::printf("  %-6s (width %3u, depth %u, budget %3u ms)\n", GetLevelName(level), config.beam_width, config.depth,
+            config.time_budget_us / 1000);
+        std::printf("    search : %7.2f ms/move, %6.0f boards/move, %.2f M boards/s, over budget %llu/%llu\n",
+            elapsed_us / moves / 1000.0, static_cast<double>(stats.nodes) / moves, static_cast<double>(stats.nodes) / elapsed_us,
+            static_cast<unsigned long long>(stats.timeouts), static_cast<unsigned long long>(stats.moves));
+        std::printf("    play   : max chain %u, %u+ chains %llu, avg score %llu, game over %u/%d\n", stats.max_chain, BIG_CHAIN,
+            static_cast<unsigned long long>(stats.big_chains), static_cast<unsigned long long>(stats.score / std::max(games, 1)),
+            stats.game_overs, games);
+    }
+
+    return 0;
+}
@@ -0,0 +1,154 @@
+/*
+ *
+ * 설명: 중력 커널(열 압축) 비용 비교
+ *  1. 연쇄 직후처럼 열마다 임의 높이로 채운 뒤 일부 칸을 비운 보드를 미리 만들어 둠.
+ *  2. 매 반복마다 원본 보드를 복사해 압축하고, 착지 행 기록 여부별로 스칼라/SSSE3 커널을 측정.
+ *  3. 두 커널의 결과(보드, 착지 행)가 다르면 mismatch로 출력.
+ *
+ */
+
+#include "../Benchmarks.hpp"
+#include "../../sim/PuyoBoard.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace
+{
+    using BenchClock = std::chrono::steady_clock;
+
+    [[nodiscard]] double ElapsedNs(BenchClock::time_point start)
+    {
+        return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(BenchClock::now() - start).count());
+    }
+
+    // PuyoBoard와 같은 배치의 열 바이트 (커널을 직접 골라 호출하기 위해 따로 보관)
+    struct Columns
+    {
+        alignas(16) std::array<uint8_t, PuyoBoard::WIDTH * PuyoGravity::COLUMN_STRIDE> cells{};
+    };
+
+    [[nodiscard]] Columns MakeClearedColumns(std::mt19937& rng)
+    {
+        Columns columns;
+        for (int x = 0; x < PuyoBoard::WIDTH; ++x)
+        {
+            const int height = static_cast<int>(rng() % (PuyoBoard::HEIGHT + 1));
+            for (int y = 0; y < height; ++y)
+            {
+                // 약 25%는 그룹이 지워진 빈칸
+                if (rng() % 4 != 0)
+                {
+                    columns.cells[PuyoBoard::ToIndex(x, y)] = static_cast<uint8_t>(1 + rng() % PUYO_COLOR_COUNT);
+                }
+            }
+        }
+        return columns;
+    }
+
+    [[nodiscard]] const char* GetKernelName(PuyoGravityKernel kernel)
+    {
+        return kernel == PuyoGravityKernel::Ssse3 ? "ssse3" : "scalar";
+    }
+
+    // 보드마다 복사 -> 압축. 복사 비용은 baseline으로 따로 측정해 뺌
+    double Measure(const std::vector<Columns>& boards, int iterations, PuyoGravityKernel kernel, bool with_landing, uint64_t& checksum)
+    {
+        PuyoLanding landing;
+
+        const auto start = BenchClock::now();
+        for (int it = 0; it < iterations; ++it)
+        {
+            for (const auto& source : boards)
+            {
+                Columns board = source;
+
+                checksum += PuyoGravity::CompactColumns(board.cells.data(), with_landing ? landing.rows.data() : nullptr, PuyoBoard::WIDTH, kernel) ? 1 : 0;
+                checksum += board.cells[0] + landing.rows[1];
+            }
+        }
+        return ElapsedNs(start);
+    }
+
+    double MeasureCopy(const std::vector<Columns>& boards, int iterations, uint64_t& checksum)
+    {
+        const auto start = BenchClock::now();
+        for (int it = 0; it < iterations; ++it)
+        {
+            for (const auto& source : boards)
+            {
+                Columns board = source;
+                checksum += board.cells[0];
+            }
+        }
+        return ElapsedNs(start);
+    }
+
+    [[nodiscard]] bool Verify(const std::vector<Columns>& boards)
+    {
+        for (const auto& source : boards)
+        {
+            Columns scalar = source;
+            Columns simd = source;
+            PuyoLanding scalar_landing;
+            PuyoLanding simd_landing;
+
+            PuyoGravity::CompactColumns(scalar.cells.data(), scalar_landing.rows.data(), PuyoBoard::WIDTH, PuyoGravityKernel::Scalar);
+            PuyoGravity::CompactColumns(simd.cells.data(), simd_landing.rows.data(), PuyoBoard::WIDTH, PuyoGravityKernel::Ssse3);
+
+            if (scalar.cells != simd.cells || scalar_landing.rows != simd_landing.rows)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+int RunGravityBench(BenchArgs args)
+{
+    const size_t board_count = GetBenchArg<size_t>(args, 0, 10'000);
+    const int iterations = GetBenchArg<int>(args, 1, 200);
+
+    std::mt19937 rng(static_cast<uint32_t>(board_count));
+
+    std::vector<Columns> boards(board_count);
+    for (auto& board : boards)
+    {
+        board = MakeClearedColumns(rng);
+    }
+
+    const double searches = static_cast<double>(board_count) * iterations;
+    uint64_t checksum = 0;
+
+    const double copy_ns = MeasureCopy(boards, iterations, checksum) / searches;
+
+    std::printf("gravity (%zu boards x %d, best kernel %s)\n", board_count, iterations, GetKernelName(PuyoGravity::GetBestKernel()));
+    std::printf("  board copy        : %6.2f ns/board (baseline, subtracted below)\n", copy_ns);
+
+    for (const auto kernel : { PuyoGravityKernel::Scalar, PuyoGravityKernel::Ssse3 })
+    {
+        if (!PuyoGravity::IsKernelSupported(kernel))
+        {
+            std::printf("  %-6s            : not supported\n", GetKernelName(kernel));
+            continue;
+        }
+
+        const double compact_ns = Measure(boards, iterations, kernel, false, checksum) / searches - copy_ns;
+        const double landing_ns = Measure(boards, iterations, kernel, true, checksum) / searches - copy_ns;
+
+        std::printf("  %-6s compact    : %6.2f ns/board\n", GetKernelName(kernel), compact_ns);
+        std::printf("  %-6s + landing  : %6.2f ns/board\n", GetKernelName(kernel), landing_ns);
+    }
+
+    if (PuyoGravity::IsKernelSupported(PuyoGravityKernel::Ssse3) && !Verify(boards))
+    {
+        std::printf("  mismatch: scalar and ssse3 results differ\n");
+    }
+
+    std::printf("  (checksum %llu)\n", static_cast<unsigned long long>(checksum));
+    return 0;
+}
@@ -0,0 +1,444 @@
+/*
+ *
+ * 설명: 보드 열 비트(BlockGrid) 판정과 기존 배열/사각형 검사의 차등 비교
+ *  1. 임의의 쌓기/제거를 BlockGrid와 기존 Block* 배열에 똑같이 적용하고, 매 단계 모든 열의 판정을 비교.
+ *  2. 이동 가능(IsPossibleMove), 게임 오버(IsGameOver), 착지 위치 표시(UpdateTargetPosIdx)는 기존 배열 스캔과,
+ *     조작 블록의 옆 칸 충돌(MoveLeft/MoveRight)과 착지 y(MoveDown)는 블록 목록 전체에 대한 사각형 교차 검사와 비교.
+ *  3. 옆 칸 충돌은 칸에 맞춰 선 x에서만 비교 (기존 사각형은 수평 이동 중 자기 열과도 겹쳐 판정이 달라짐).
+ *  4. 결과가 다르면 mismatch로 출력하고, 미리 만든 보드에서 두 방식의 판정 비용을 측정.
+ *
+ */
+
+#include "../Benchmarks.hpp"
+#include "../../game/system/BlockGrid.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace
+{
+    using BenchClock = std::chrono::steady_clock;
+
+    constexpr int X_COUNT = BlockGrid::X_COUNT;
+    constexpr int Y_COUNT = BlockGrid::Y_COUNT;
+    constexpr float BLOCK_SIZE = Constants::Block::SIZE;
+    constexpr float WIDTH_MARGIN = Constants::Board::WIDTH_MARGIN;
+    constexpr int BOARD_HEIGHT = Constants::Board::HEIGHT;
+
+    constexpr int MAX_MISMATCH_LOGS = 8;
+
+    [[nodiscard]] double ElapsedNs(BenchClock::time_point start)
+    {
+        return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(BenchClock::now() - start).count());
+    }
+
+    // 칸마다 다른 Block* (비교에만 쓰고 역참조하지 않음)
+    std::array<std::byte, X_COUNT * Y_COUNT> block_storage{};
+
+    [[nodiscard]] Block* GetCellBlock(int x, int y)
+    {
+        return reinterpret_cast<Block*>(&block_storage[static_cast<size_t>(y * X_COUNT + x)]);
+    }
+
+    // SDL_Rect와 같은 정수 사각형
+    struct LegacyRect
+    {
+        int x{ 0 };
+        int y{ 0 };
+        int w{ 0 };
+        int h{ 0 };
+    };
+
+    // SDL_HasRectIntersection과 같은 판정 (변만 닿으면 교차 아님)
+    [[nodiscard]] bool HasIntersection(const LegacyRect& a, const LegacyRect& b)
+    {
+        return a.w > 0 && a.h > 0 && b.w > 0 && b.h > 0 &&
+            a.x < b.x + b.w && b.x < a.x + a.w &&
+            a.y < b.y + b.h && b.y < a.y + a.h;
+    }
+
+    // 기존 판정 (BasePlayer/LocalPlayer의 배열 스캔, GameGroupBlock의 블록 목록 사각형 검사)
+    class LegacyBoard
+    {
+    public:
+        void Set(int x, int y, Block* block)
+        {
+            cells_[y][x] = block;
+
+            // 게임의 블록 목록처럼 보드에 있는 블록의 사각형을 유지
+            rects_.clear();
+            for (int row = 0; row < Y_COUNT; ++row)
+            {
+                for (int column = 0; column < X_COUNT; ++column)
+                {
+                    if (cells_[row][column])
+                    {
+                        rects_.push_back(LegacyRect{
+                            static_cast<int>(column * BLOCK_SIZE + WIDTH_MARGIN),
+                            static_cast<int>(((Y_COUNT - 2) - row) * BLOCK_SIZE),
+                            static_cast<int>(BLOCK_SIZE),
+                            static_cast<int>(BLOCK_SIZE) });
+                    }
+                }
+            }
+        }
+
+        [[nodiscard]] bool IsPossibleMove(int x) const
+        {
+            return cells_[Y_COUNT - 2][x] == nullptr || cells_[Y_COUNT - 1][x] == nullptr;
+        }
+
+        [[nodiscard]] bool IsGameOver() const
+        {
+            return cells_[Y_COUNT - 2][2] != nullptr || cells_[Y_COUNT - 2][3] != nullptr ||
+                cells_[Y_COUNT - 1][2] != nullptr || cells_[Y_COUNT - 1][3] != nullptr;
+        }
+
+        // 바닥부터 처음 만나는 빈 칸 (앞서 표시한 칸은 건너뜀, 없으면 Y_COUNT)
+        [[nodiscard]] int GetDropRow(int x, int skip_x, int skip_y) const
+        {
+            for (int y = 0; y < Y_COUNT; ++y)
+            {
+                if (skip_x == x && skip_y == y)
+                {
+                    continue;
+                }
+
+                if (cells_[y][x] == nullptr)
+                {
+                    return y;
+                }
+            }
+
+            return Y_COUNT;
+        }
+
+        // GetCollisionRect(Left/Right) 사각형과 블록 목록의 교차
+        [[nodiscard]] bool IsSideBlocked(float x, float y, bool left) const
+        {
+            const float half_width = BLOCK_SIZE / 2.0f;
+            const LegacyRect side{
+                static_cast<int>(left ? x - half_width : x + BLOCK_SIZE),
+                static_cast<int>(y),
+                static_cast<int>(half_width),
+                static_cast<int>(BLOCK_SIZE) };
+
+            return HitsBlock(side);
+        }
+
+        [[nodiscard]] bool HitsBlock(const LegacyRect& rect) const
+        {
+            for (const auto& target : rects_)
+            {
+                if (HasIntersection(rect, target))
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        // MoveDown처럼 프레임마다 speed만큼 내려가며 처음 겹친 블록 바로 위 (없으면 바닥)
+        [[nodiscard]] float GetLandingY(float x, float speed) const
+        {
+            for (float y = -BLOCK_SIZE * 2.0f; ; y += speed)
+            {
+                const LegacyRect falling{ static_cast<int>(x), static_cast<int>(y), static_cast<int>(BLOCK_SIZE), static_cast<int>(BLOCK_SIZE) };
+
+                for (const auto& target : rects_)
+                {
+                    if (HasIntersection(falling, target))
+                    {
+                        return static_cast<float>(target.y) - BLOCK_SIZE;
+                    }
+                }
+
+                if (y + BLOCK_SIZE >= static_cast<float>(BOARD_HEIGHT))
+                {
+                    return static_cast<float>(BOARD_HEIGHT) - BLOCK_SIZE;
+                }
+            }
+        }
+
+    private:
+        Block* cells_[Y_COUNT][X_COUNT]{};
+        std::vector<LegacyRect> rects_;
+    };
+
+    struct BoardPair
+    {
+        BlockGrid grid;
+        LegacyBoard legacy;
+
+        void Set(int x, int y, Block* block)
+        {
+            grid.Set(x, y, block);
+            legacy.Set(x, y, block);
+        }
+    };
+
+    // 2/3는 임의 열에 쌓고 1/3은 임의 칸을 비움 (빈 칸 위에 뜬 블록도 생김)
+    void ApplyRandomOperation(BoardPair& board, std::mt19937& rng)
+    {
+        std::uniform_int_distribution<int> column_dist(0, X_COUNT - 1);
+        std::uniform_int_distribution<int> row_dist(0, Y_COUNT - 1);
+        std::uniform_int_distribution<int> op_dist(0, 2);
+
+        const int x = column_dist(rng);
+        if (op_dist(rng) != 0)
+        {
+            const int y = board.grid.GetLowestEmptyRow(x);
+            if (y < Y_COUNT)
+            {
+                board.Set(x, y, GetCellBlock(x, y));
+            }
+        }
+        else
+        {
+            board.Set(x, row_dist(rng), nullptr);
+        }
+    }
+
+    [[nodiscard]] float GetColumnX(int column)
+    {
+        return static_cast<float>(column) * BLOCK_SIZE + WIDTH_MARGIN;
+    }
+
+    struct VerifyStats
+    {
+        uint64_t queries{ 0 };
+        uint64_t mismatches{ 0 };
+
+        template<typename... Args>
+        void Report(const char* format, Args... args)
+        {
+            if (++mismatches <= MAX_MISMATCH_LOGS)
+            {
+                std::printf("  mismatch: ");
+                std::printf(format, args...);
+                std::printf("\n");
+            }
+        }
+    };
+
+    void VerifyBoard(const BoardPair& board, std::mt19937& rng, VerifyStats& stats)
+    {
+        const BlockGrid& grid = board.grid;
+        const LegacyBoard& legacy = board.legacy;
+
+        std::uniform_int_distribution<int> column_dist(0, X_COUNT - 1);
+        std::uniform_int_distribution<int> row_dist(0, Y_COUNT - 1);
+        std::uniform_real_distribution<float> y_dist(-BLOCK_SIZE, static_cast<float>(BOARD_HEIGHT) - BLOCK_SIZE);
+        std::uniform_real_distribution<float> x_dist(WIDTH_MARGIN, GetColumnX(X_COUNT - 1));
+        std::uniform_real_distribution<float> speed_dist(1.0f, BLOCK_SIZE - 1.0f);
+
+        if (legacy.IsGameOver() != (grid.IsTopOccupied(2) || grid.IsTopOccupied(3)))
+        {
+            stats.Report("game over legacy %d", legacy.IsGameOver());
+        }
+        ++stats.queries;
+
+        for (int x = 0; x < X_COUNT; ++x)
+        {
+            if (legacy.IsPossibleMove(x) != !grid.IsTopFull(x))
+            {
+                stats.Report("possible move x=%d legacy %d", x, legacy.IsPossibleMove(x));
+            }
+
+            // 첫 블록의 표시 칸이 없을 때와 있을 때 (두 번째 블록은 같은 열이면 그 칸을 건너뜀)
+            const int skip_x = column_dist(rng);
+            const int skip_y = row_dist(rng);
+
+            const int legacy_row = legacy.GetDropRow(x, -1, -1);
+            const int grid_row = grid.GetLowestEmptyRow(x);
+            const int legacy_skip_row = legacy.GetDropRow(x, skip_x, skip_y);
+            const int grid_skip_row = grid.GetLowestEmptyRow(x, skip_x == x ? skip_y : -1);
+
+            if (legacy_row != grid_row || legacy_skip_row != grid_skip_row)
+            {
+                stats.Report("drop row x=%d skip=(%d,%d) legacy %d/%d grid %d/%d",
+                    x, skip_x, skip_y, legacy_row, legacy_skip_row, grid_row, grid_skip_row);
+            }
+
+            const float block_x = GetColumnX(x);
+            const float block_y = y_dist(rng);
+
+            for (const bool left : { true, false })
+            {
+                const bool legacy_blocked = legacy.IsSideBlocked(block_x, block_y, left);
+                const bool grid_blocked = grid.IsCellBlocked(BlockGrid::GetColumnAt(block_x) + (left ? -1 : 1), block_y);
+
+                if (legacy_blocked != grid_blocked)
+                {
+                    stats.Report("%s side x=%d y=%.2f legacy %d grid %d", left ? "left" : "right", x, block_y, legacy_blocked, grid_blocked);
+                }
+            }
+
+            stats.queries += 5;
+        }
+
+        // 수평 이동 중처럼 칸 사이에 걸친 x 포함
+        const float fall_x = x_dist(rng);
+        const float speed = speed_dist(rng);
+        const float legacy_landing = legacy.GetLandingY(fall_x, speed);
+        const float grid_landing = grid.GetLandingY(fall_x);
+
+        if (legacy_landing != grid_landing)
+        {
+            stats.Report("landing x=%.2f speed=%.2f legacy %.1f grid %.1f", fall_x, speed, legacy_landing, grid_landing);
+        }
+        ++stats.queries;
+    }
+
+    // 같은 보드/위치에 대한 질의 (측정 루프에서 난수 생성 비용을 빼기 위해 미리 뽑아 둠)
+    struct Query
+    {
+        int column{ 0 };
+        float y{ 0.0f };
+        float fall_x{ 0.0f };
+    };
+
+    void MeasureQueries(const std::vector<BoardPair>& boards, const std::vector<Query>& queries, int iterations)
+    {
+        const double count = static_cast<double>(boards.size()) * static_cast<double>(iterations);
+
+        // 옆 칸 충돌 (좌우 한 번씩)
+        uint64_t legacy_side = 0;
+        auto start = BenchClock::now();
+        for (int it = 0; it < iterations; ++it)
+        {
+            for (size_t i = 0; i < boards.size(); ++i)
+            {
+                const float x = GetColumnX(queries[i].column);
+                legacy_side += boards[i].legacy.IsSideBlocked(x, queries[i].y, true);
+                legacy_side += boards[i].legacy.IsSideBlocked(x, queries[i].y, false);
+            }
+        }
+        const double legacy_side_ns = ElapsedNs(start);
+
+        uint64_t grid_side = 0;
+        start = BenchClock::now();
+        for (int it = 0; it < iterations; ++it)
+        {
+            for (size_t i = 0; i < boards.size(); ++i)
+            {
+                const int column = BlockGrid::GetColumnAt(GetColumnX(queries[i].column));
+                grid_side += boards[i].grid.IsCellBlocked(column - 1, queries[i].y);
+                grid_side += boards[i].grid.IsCellBlocked(column + 1, queries[i].y);
+            }
+        }
+        const double grid_side_ns = ElapsedNs(start);
+
+        // 착지 위치 표시 (모든 열)
+        uint64_t legacy_rows = 0;
+        start = BenchClock::now();
+        for (int it = 0; it < iterations; ++it)
+        {
+            for (const auto& board : boards)
+            {
+                for (int x = 0; x < X_COUNT; ++x)
+                {
+                    legacy_rows += static_cast<uint64_t>(board.legacy.GetDropRow(x, -1, -1));
+                }
+            }
+        }
+        const double legacy_rows_ns = ElapsedNs(start);
+
+        uint64_t grid_rows = 0;
+        start = BenchClock::now();
+        for (int it = 0; it < iterations; ++it)
+        {
+            for (const auto& board : boards)
+            {
+                for (int x = 0; x < X_COUNT; ++x)
+                {
+                    grid_rows += static_cast<uint64_t>(board.grid.GetLowestEmptyRow(x));
+                }
+            }
+        }
+        const double grid_rows_ns = ElapsedNs(start);
+
+        // 낙하 한 프레임의 충돌 검사 (기존: 블록 목록 전체와 교차, 열 비트: 착지 y 계산)
+        uint64_t legacy_hits = 0;
+        start = BenchClock::now();
+        for (int it = 0; it < iterations; ++it)
+        {
+            for (size_t i = 0; i < boards.size(); ++i)
+            {
+                const LegacyRect falling{ static_cast<int>(queries[i].fall_x), static_cast<int>(queries[i].y),
+                    static_cast<int>(BLOCK_SIZE), static_cast<int>(BLOCK_SIZE) };
+                legacy_hits += boards[i].legacy.HitsBlock(falling);
+            }
+        }
+        const double legacy_fall_ns = ElapsedNs(start);
+
+        uint64_t grid_hits = 0;
+        start = BenchClock::now();
+        for (int it = 0; it < iterations; ++it)
+        {
+            for (size_t i = 0; i < boards.size(); ++i)
+            {
+                grid_hits += queries[i].y >= boards[i].grid.GetLandingY(queries[i].fall_x);
+            }
+        }
+        const double grid_fall_ns = ElapsedNs(start);
+
+        std::printf("cost (%zu boards x %d)\n", boards.size(), iterations);
+        std::printf("  side check  rect scan : %8.1f ns, column bits: %8.1f ns (x%.1f)\n",
+            legacy_side_ns / count, grid_side_ns / count, legacy_side_ns / grid_side_ns);
+        std::printf("  drop rows   array scan: %8.1f ns, column bits: %8.1f ns (x%.1f)\n",
+            legacy_rows_ns / count, grid_rows_ns / count, legacy_rows_ns / grid_rows_ns);
+        std::printf("  fall check  rect scan : %8.1f ns, column bits: %8.1f ns (x%.1f, %llu/%llu hits)\n",
+            legacy_fall_ns / count, grid_fall_ns / count, legacy_fall_ns / grid_fall_ns,
+            static_cast<unsigned long long>(legacy_hits), static_cast<unsigned long long>(grid_hits));
+
+        if (legacy_side != grid_side || legacy_rows != grid_rows)
+        {
+            std::printf("  mismatch: side %llu/%llu, drop rows %llu/%llu\n",
+                static_cast<unsigned long long>(legacy_side), static_cast<unsigned long long>(grid_side),
+                static_cast<unsigned long long>(legacy_rows), static_cast<unsigned long long>(grid_rows));
+        }
+    }
+}
+
+int RunGridBench(BenchArgs args)
+{
+    const size_t board_count = GetBenchArg<size_t>(args, 0, 10'000);
+    const int operations = GetBenchArg<int>(args, 1, 64);
+    const int iterations = GetBenchArg<int>(args, 2, 100);
+
+    std::mt19937 rng(static_cast<uint32_t>(board_count));
+    std::uniform_int_distribution<int> column_dist(0, X_COUNT - 1);
+    std::uniform_real_distribution<float> y_dist(-BLOCK_SIZE, static_cast<float>(BOARD_HEIGHT) - BLOCK_SIZE);
+    std::uniform_real_distribution<float> x_dist(WIDTH_MARGIN, GetColumnX(X_COUNT - 1));
+
+    // 쌓기/제거 한 번마다 비교하고, 마지막 상태는 비용 측정에 사용
+    std::vector<BoardPair> boards(board_count);
+    std::vector<Query> queries(board_count);
+    VerifyStats stats;
+
+    std::printf("verify (%zu boards x %d operations)\n", board_count, operations);
+
+    for (size_t i = 0; i < board_count; ++i)
+    {
+        for (int op = 0; op < operations; ++op)
+        {
+            ApplyRandomOperation(boards[i], rng);
+            VerifyBoard(boards[i], rng, stats);
+        }
+
+        queries[i] = Query{ column_dist(rng), y_dist(rng), x_dist(rng) };
+    }
+
+    std::printf("  %llu queries, %llu mismatches\n",
+        static_cast<unsigned long long>(stats.queries), static_cast<unsigned long long>(stats.mismatches));
+
+    MeasureQueries(boards, queries, iterations);
+
+    return 0;
+}
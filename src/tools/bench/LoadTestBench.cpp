@@ -0,0 +1,300 @@
+/*
+ *
+ * 설명: 전용 서버 부하 테스트
+ *  1. matches * 2 개의 클라이언트가 접속해 자동 배정된 방에서 캐릭터를 결정하고 게임을 시작.
+ *  2. 게임 시작 후 각 클라이언트는 초당 moves_per_sec 개의 MoveBlock 패킷을 송신 (속도 제한 이하).
+ *  3. 중계된 패킷 수로 처리량을, 패킷에 기록한 송신 시각으로 왕복 지연을 측정.
+ *
+ */
+
+#include "../Benchmarks.hpp"
+#include "../../network/packets/GamePackets.hpp"
+#include "../../core/common/constants/NetworkConstants.hpp"
+
+#include <winsock2.h>
+#include <ws2tcpip.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    // float 정밀도 안에서 표현 가능한 범위로 시각을 잘라 패킷에 기록
+    constexpr uint32_t STAMP_RANGE_MS = 1'000'000;
+
+    struct LoadClient
+    {
+        SOCKET socket{ INVALID_SOCKET };
+        std::vector<char> recv_buffer;
+        size_t recv_size{ 0 };
+        uint8_t player_id{ 0 };
+        bool playing{ false };
+        Clock::time_point next_move{};
+    };
+
+    struct LoadStats
+    {
+        uint64_t sent{ 0 };
+        uint64_t send_blocked{ 0 };
+        uint64_t received{ 0 };
+        uint64_t relayed{ 0 };
+        uint64_t matches_started{ 0 };
+        std::vector<uint32_t> latency_ms;
+    };
+
+    uint32_t GetStampMs(Clock::time_point start)
+    {
+        const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start).count();
+        return static_cast<uint32_t>(elapsed % STAMP_RANGE_MS);
+    }
+
+    bool SendPacket(LoadClient& client, const PacketBase& packet, LoadStats& stats)
+    {
+        const int result = send(client.socket, reinterpret_cast<const char*>(&packet), static_cast<int>(packet.size), 0);
+        if (result == SOCKET_ERROR)
+        {
+            ++stats.send_blocked;
+            return false;
+        }
+
+        ++stats.sent;
+        return true;
+    }
+
+    void HandlePacket(LoadClient& client, const char* data, LoadStats& stats, Clock::time_point start)
+    {
+        PacketBase header{};
+        std::memcpy(&header, data, sizeof(PacketBase));
+
+        switch (static_cast<PacketType>(header.type))
+        {
+        case PacketType::GiveId:
+        {
+            GiveIdPacket packet;
+            std::memcpy(&packet, data, sizeof(GiveIdPacket));
+            client.player_id = packet.player_id;
+            break;
+        }
+
+        case PacketType::StartCharSelect:
+        {
+            DecideCharacterPacket packet;
+            packet.player_id = client.player_id;
+            SendPacket(client, packet, stats);
+            break;
+        }
+
+        case PacketType::StartGame:
+            if (!client.playing)
+            {
+                client.playing = true;
+                client.next_move = Clock::now();
+                ++stats.matches_started;
+            }
+            break;
+
+        case PacketType::UpdateBlockMove:
+        {
+            MoveBlockPacket packet;
+            std::memcpy(&packet, data, sizeof(MoveBlockPacket));
+
+            const int64_t now = GetStampMs(start);
+            int64_t latency = now - static_cast<int64_t>(packet.position);
+            if (latency < 0)
+            {
+                latency += STAMP_RANGE_MS;
+            }
+
+            ++stats.relayed;
+            stats.latency_ms.push_back(static_cast<uint32_t>(latency));
+            break;
+        }
+
+        default:
+            break;
+        }
+    }
+
+    // 논블로킹 수신 후 완성된 패킷만 처리. 처리한 패킷이 있으면 true
+    bool PollClient(LoadClient& client, LoadStats& stats, Clock::time_point start)
+    {
+        bool progressed = false;
+
+        while (true)
+        {
+            if (client.recv_size == client.recv_buffer.size())
+            {
+                client.recv_buffer.resize(client.recv_buffer.size() * 2);
+            }
+
+            const int result = recv(client.socket, client.recv_buffer.data() + client.recv_size,
+                static_cast<int>(client.recv_buffer.size() - client.recv_size), 0);
+
+            if (result <= 0)
+            {
+                break;
+            }
+
+            client.recv_size += static_cast<size_t>(result);
+            progressed = true;
+        }
+
+        size_t offset = 0;
+        while (client.recv_size - offset >= sizeof(PacketBase))
+        {
+            PacketBase header{};
+            std::memcpy(&header, client.recv_buffer.data() + offset, sizeof(PacketBase));
+
+            if (header.size < sizeof(PacketBase) || client.recv_size - offset < header.size)
+            {
+                break;
+            }
+
+            ++stats.received;
+            HandlePacket(client, client.recv_buffer.data() + offset, stats, start);
+            offset += header.size;
+        }
+
+        if (offset > 0)
+        {
+            std::memmove(client.recv_buffer.data(), client.recv_buffer.data() + offset, client.recv_size - offset);
+            client.recv_size -= offset;
+        }
+
+        return progressed;
+    }
+
+    bool ConnectClient(LoadClient& client, const std::string& ip)
+    {
+        client.socket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+        if (client.socket == INVALID_SOCKET)
+        {
+            return false;
+        }
+
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(Constants::Network::NET_PORT);
+        inet_pton(AF_INET, ip.c_str(), &addr.sin_addr);
+
+        if (connect(client.socket, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == SOCKET_ERROR)
+        {
+            closesocket(client.socket);
+            client.socket = INVALID_SOCKET;
+            return false;
+        }
+
+        BOOL no_delay = TRUE;
+        setsockopt(client.socket, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char*>(&no_delay), sizeof(no_delay));
+
+        u_long non_blocking = 1;
+        ioctlsocket(client.socket, FIONBIO, &non_blocking);
+
+        client.recv_buffer.resize(Constants::Network::MAX_PACKET_SIZE * 16);
+        return true;
+    }
+
+    uint32_t GetPercentile(std::vector<uint32_t>& samples, double ratio)
+    {
+        if (samples.empty())
+        {
+            return 0;
+        }
+
+        const auto index = static_cast<size_t>(ratio * static_cast<double>(samples.size() - 1));
+        std::nth_element(samples.begin(), samples.begin() + index, samples.end());
+        return samples[index];
+    }
+}
+
+int RunLoadTestBench(BenchArgs args)
+{
+    const std::string ip = args.size() > 0 ? std::string(args[0]) : std::string("127.0.0.1");
+    const int matches = GetBenchArg(args, 1, 100);
+    const int seconds = GetBenchArg(args, 2, 30);
+    const int moves_per_sec = std::max(GetBenchArg(args, 3, 30), 1);
+
+    WSADATA wsa_data;
+    if (WSAStartup(MAKEWORD(2, 2), &wsa_data) != 0)
+    {
+        std::printf("WSAStartup failed\n");
+        return 1;
+    }
+
+    std::vector<LoadClient> clients(static_cast<size_t>(matches) * Constants::Network::ROOM_CAPACITY);
+    size_t connected = 0;
+
+    for (auto& client : clients)
+    {
+        if (ConnectClient(client, ip))
+        {
+            ++connected;
+        }
+    }
+
+    std::printf("connected %zu / %zu clients\n", connected, clients.size());
+
+    LoadStats stats;
+    const auto start = Clock::now();
+    const auto end = start + std::chrono::seconds(seconds);
+    const auto move_interval = std::chrono::microseconds(1'000'000 / moves_per_sec);
+
+    while (Clock::now() < end)
+    {
+        bool progressed = false;
+
+        for (auto& client : clients)
+        {
+            if (client.socket == INVALID_SOCKET)
+            {
+                continue;
+            }
+
+            progressed |= PollClient(client, stats, start);
+
+            const auto now = Clock::now();
+            if (client.playing && now >= client.next_move)
+            {
+                MoveBlockPacket packet;
+                packet.player_id = client.player_id;
+                packet.position = static_cast<float>(GetStampMs(start));
+
+                SendPacket(client, packet, stats);
+                client.next_move += move_interval;
+                progressed = true;
+            }
+        }
+
+        if (!progressed)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    const double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+
+    std::printf("matches started : %llu / %d\n", static_cast<unsigned long long>(stats.matches_started / Constants::Network::ROOM_CAPACITY), matches);
+    std::printf("sent            : %llu (blocked %llu)\n", static_cast<unsigned long long>(stats.sent), static_cast<unsigned long long>(stats.send_blocked));
+    std::printf("received        : %llu\n", static_cast<unsigned long long>(stats.received));
+    std::printf("relayed moves/s : %.1f\n", static_cast<double>(stats.relayed) / elapsed);
+    std::printf("latency ms      : p50 %u, p99 %u, max %u\n",
+        GetPercentile(stats.latency_ms, 0.50), GetPercentile(stats.latency_ms, 0.99), GetPercentile(stats.latency_ms, 1.0));
+
+    for (auto& client : clients)
+    {
+        if (client.socket != INVALID_SOCKET)
+        {
+            closesocket(client.socket);
+        }
+    }
+
+    WSACleanup();
+    return 0;
+}
@@ -0,0 +1,300 @@
+/*
+ *
+ * 설명: 연결 그룹 검색 비용 비교 (기존 Block* 재귀 탐색 vs 비트보드)
+ *  1. random: 열마다 임의 높이로 4색 + 방해 블록을 채운 보드.
+ *  2. chain: 세로 3개 묶음을 엇갈리게 꽉 채워 3개짜리 그룹이 많은 연쇄형 보드 (몇 칸을 바꿔 매치를 만듦).
+ *  3. legacy는 BasePlayer::FindMatchedBlocks/RecursionCheckBlock와 같은 방식
+ *     (포인터 격자, 재귀, 체크 플래그, std::list<std::vector>)으로 구현해 비교.
+ *  4. 두 방식의 그룹 수/셀 수가 다르면 mismatch로 출력.
+ *
+ */
+
+#include "../Benchmarks.hpp"
+#include "../../sim/PuyoBoard.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <list>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace
+{
+    using BenchClock = std::chrono::steady_clock;
+
+    constexpr int BOARD_COLORS = 4;
+
+    [[nodiscard]] double ElapsedNs(BenchClock::time_point start)
+    {
+        return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(BenchClock::now() - start).count());
+    }
+
+    // Block에서 탐색에 쓰던 값만 남긴 셀
+    struct LegacyBlock
+    {
+        PuyoCell type{ PuyoCell::Empty };
+        bool recursion_check{ false };
+    };
+
+    class LegacyBoard
+    {
+    public:
+        explicit LegacyBoard(const PuyoBoard& board)
+        {
+            for (int y = 0; y < PuyoBoard::HEIGHT; ++y)
+            {
+                for (int x = 0; x < PuyoBoard::WIDTH; ++x)
+                {
+                    if (board.Get(x, y) != PuyoCell::Empty)
+                    {
+                        auto& block = blocks_.emplace_back(std::make_unique<LegacyBlock>());
+                        block->type = board.Get(x, y);
+                        grid_[y][x] = block.get();
+                    }
+                }
+            }
+        }
+
+        bool FindMatchedBlocks(std::list<std::vector<LegacyBlock*>>& matched_groups)
+        {
+            std::vector<LegacyBlock*> current_group;
+
+            for (int y = 0; y < PuyoBoard::HEIGHT; ++y)
+            {
+                for (int x = 0; x < PuyoBoard::WIDTH; ++x)
+                {
+                    LegacyBlock* block = grid_[y][x];
+                    if (!block || block->type == PuyoCell::Garbage || block->recursion_check)
+                    {
+                        continue;
+                    }
+
+                    block->recursion_check = true;
+                    current_group.clear();
+
+                    if (RecursionCheckBlock(x, y, -1, current_group) >= Constants::Game::MIN_MATCH_COUNT - 1)
+                    {
+                        current_group.push_back(block);
+                        matched_groups.push_back(current_group);
+                    }
+                    else
+                    {
+                        block->recursion_check = false;
+                        for (auto* matched : current_group)
+                        {
+                            matched->recursion_check = false;
+                        }
+                    }
+                }
+            }
+
+            return !matched_groups.empty();
+        }
+
+        // 게임에서는 매치된 블록이 제거되지만 여기서는 반복 측정을 위해 플래그만 되돌림
+        static void ResetChecks(const std::list<std::vector<LegacyBlock*>>& matched_groups)
+        {
+            for (const auto& group : matched_groups)
+            {
+                for (auto* block : group)
+                {
+                    block->recursion_check = false;
+                }
+            }
+        }
+
+    private:
+        short RecursionCheckBlock(int x, int y, int from, std::vector<LegacyBlock*>& matched_blocks)
+        {
+            static constexpr int OFFSETS[4][2] = { { 0, 1 }, { 1, 0 }, { 0, -1 }, { -1, 0 } };
+
+            const PuyoCell type = grid_[y][x]->type;
+            short match_count = 0;
+
+            for (int dir = 0; dir < 4; ++dir)
+            {
+                if (dir == from)
+                {
+                    continue;
+                }
+
+                const int check_x = x + OFFSETS[dir][0];
+                const int check_y = y + OFFSETS[dir][1];
+
+                if (!PuyoBoard::IsInside(check_x, check_y))
+                {
+                    continue;
+                }
+
+                LegacyBlock* check = grid_[check_y][check_x];
+                if (!check || check->recursion_check || check->type != type)
+                {
+                    continue;
+                }
+
+                check->recursion_check = true;
+                matched_blocks.push_back(check);
+                ++match_count;
+                match_count += RecursionCheckBlock(check_x, check_y, (dir + 2) % 4, matched_blocks);
+            }
+
+            return match_count;
+        }
+
+    private:
+        std::vector<std::unique_ptr<LegacyBlock>> blocks_;
+        LegacyBlock* grid_[PuyoBoard::HEIGHT][PuyoBoard::WIDTH]{};
+    };
+
+    [[nodiscard]] PuyoCell RandomColor(std::mt19937& rng)
+    {
+        return static_cast<PuyoCell>(static_cast<int>(PuyoCell::Red) + static_cast<int>(rng() % BOARD_COLORS));
+    }
+
+    [[nodiscard]] PuyoBoard MakeRandomBoard(std::mt19937& rng)
+    {
+        PuyoBoard board;
+        for (int x = 0; x < PuyoBoard::WIDTH; ++x)
+        {
+            const int height = static_cast<int>(rng() % (PuyoBoard::HEIGHT + 1));
+            for (int y = 0; y < height; ++y)
+            {
+                board.Set(x, y, rng() % 10 == 0 ? PuyoCell::Garbage : RandomColor(rng));
+            }
+        }
+        return board;
+    }
+
+    [[nodiscard]] PuyoBoard MakeChainBoard(std::mt19937& rng)
+    {
+        PuyoBoard board;
+        const int offset = static_cast<int>(rng() % BOARD_COLORS);
+
+        for (int x = 0; x < PuyoBoard::WIDTH; ++x)
+        {
+            for (int y = 0; y < PuyoBoard::HEIGHT; ++y)
+            {
+                // 옆 열과 색이 겹치지 않는 세로 3개 묶음
+                const int color = (x + y / 3 + offset) % BOARD_COLORS;
+                board.Set(x, y, static_cast<PuyoCell>(static_cast<int>(PuyoCell::Red) + color));
+            }
+        }
+
+        for (int i = 0; i < 3; ++i)
+        {
+            board.Set(static_cast<int>(rng() % PuyoBoard::WIDTH), static_cast<int>(rng() % PuyoBoard::HEIGHT), RandomColor(rng));
+        }
+        return board;
+    }
+
+    void RunCase(const char* name, const std::vector<PuyoBoard>& boards, int iterations)
+    {
+        std::vector<LegacyBoard> legacy_boards;
+        legacy_boards.reserve(boards.size());
+        for (const auto& board : boards)
+        {
+            legacy_boards.emplace_back(board);
+        }
+
+        std::vector<PuyoColorBoards> color_boards(boards.size());
+        for (size_t i = 0; i < boards.size(); ++i)
+        {
+            boards[i].GetColorBoards(color_boards[i]);
+        }
+
+        const uint64_t searches = static_cast<uint64_t>(boards.size()) * static_cast<uint64_t>(iterations);
+
+        // 기존 방식
+        uint64_t legacy_groups = 0;
+        uint64_t legacy_cells = 0;
+        std::list<std::vector<LegacyBlock*>> matched;
+
+        auto start = BenchClock::now();
+        for (int it = 0; it < iterations; ++it)
+        {
+            for (auto& legacy : legacy_boards)
+            {
+                matched.clear();
+                legacy.FindMatchedBlocks(matched);
+
+                legacy_groups += matched.size();
+                for (const auto& group : matched)
+                {
+                    legacy_cells += group.size();
+                }
+
+                LegacyBoard::ResetChecks(matched);
+            }
+        }
+        const double legacy_ns = ElapsedNs(start);
+
+        // 비트보드 (보드 -> 비트보드 변환 포함)
+        uint64_t board_groups = 0;
+        uint64_t board_cells = 0;
+        PuyoGroups groups;
+
+        start = BenchClock::now();
+        for (int it = 0; it < iterations; ++it)
+        {
+            for (const auto& board : boards)
+            {
+                board_groups += board.FindGroups(groups);
+                board_cells += groups.GetCellCount();
+            }
+        }
+        const double board_ns = ElapsedNs(start);
+
+        // 비트보드 (그룹 검색만)
+        uint64_t bitboard_groups = 0;
+
+        start = BenchClock::now();
+        for (int it = 0; it < iterations; ++it)
+        {
+            for (const auto& colors : color_boards)
+            {
+                bitboard_groups += FindPuyoGroups(colors.colors, colors.garbage, groups);
+            }
+        }
+        const double bitboard_ns = ElapsedNs(start);
+
+        const double legacy_per = legacy_ns / static_cast<double>(searches);
+        const double board_per = board_ns / static_cast<double>(searches);
+        const double bitboard_per = bitboard_ns / static_cast<double>(searches);
+
+        std::printf("%s (%zu boards x %d, %.2f groups/board)\n", name, boards.size(), iterations,
+            static_cast<double>(legacy_groups) / static_cast<double>(searches));
+        std::printf("  legacy recursion  : %8.1f ns/search\n", legacy_per);
+        std::printf("  PuyoBoard         : %8.1f ns/search (x%.1f)\n", board_per, legacy_per / board_per);
+        std::printf("  bitboard only     : %8.1f ns/search (x%.1f)\n", bitboard_per, legacy_per / bitboard_per);
+
+        if (legacy_groups != board_groups || legacy_cells != board_cells || legacy_groups != bitboard_groups)
+        {
+            std::printf("  mismatch: legacy %llu groups/%llu cells, bitboard %llu groups/%llu cells\n",
+                static_cast<unsigned long long>(legacy_groups), static_cast<unsigned long long>(legacy_cells),
+                static_cast<unsigned long long>(board_groups), static_cast<unsigned long long>(board_cells));
+        }
+    }
+}
+
+int RunMatchBench(BenchArgs args)
+{
+    const size_t board_count = GetBenchArg<size_t>(args, 0, 10'000);
+    const int iterations = GetBenchArg<int>(args, 1, 100);
+
+    std::mt19937 rng(static_cast<uint32_t>(board_count));
+
+    std::vector<PuyoBoard> random_boards(board_count);
+    std::vector<PuyoBoard> chain_boards(board_count);
+
+    for (size_t i = 0; i < board_count; ++i)
+    {
+        random_boards[i] = MakeRandomBoard(rng);
+        chain_boards[i] = MakeChainBoard(rng);
+    }
+
+    RunCase("random", random_boards, iterations);
+    RunCase("chain", chain_boards, iterations);
+
+    return 0;
+}
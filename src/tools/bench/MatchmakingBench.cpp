@@ -0,0 +1,147 @@
+/*
+ *
+ * 설명: 매치메이킹 대기열 시뮬레이션
+ *  1. 플레이어 수(기본 10k/100k/1M)만큼 평균 1500, 표준편차 300의 레이팅으로 ARRIVAL_SECONDS 동안 고르게 도착.
+ *  2. 시뮬레이션 시계로 TICK_MS 마다 Update를 호출해 서버 라우터 틱과 같은 흐름으로 처리.
+ *  3. 실제 소요 시간으로 연산당 비용을, 시뮬레이션 시계로 대기 시간과 레이팅 차이를 측정.
+ *
+ */
+
+#include "../Benchmarks.hpp"
+#include "../../server/Matchmaker.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+namespace
+{
+    using Clock = Matchmaker::Clock;
+
+    constexpr int ARRIVAL_SECONDS = 60;
+    constexpr int DRAIN_SECONDS = 30;   // 도착이 끝난 뒤 남은 대기열을 비우는 시간
+    constexpr int TICK_MS = 100;
+
+    struct MatchStats
+    {
+        std::vector<uint32_t> wait_ms;
+        std::vector<uint32_t> rating_diff;
+        uint64_t operations{ 0 };
+    };
+
+    uint32_t GetPercentile(std::vector<uint32_t>& samples, double ratio)
+    {
+        if (samples.empty())
+        {
+            return 0;
+        }
+
+        const auto index = static_cast<size_t>(ratio * static_cast<double>(samples.size() - 1));
+        std::nth_element(samples.begin(), samples.begin() + index, samples.end());
+        return samples[index];
+    }
+
+    void Collect(std::vector<MatchPair>& pairs, MatchStats& stats)
+    {
+        for (const auto& pair : pairs)
+        {
+            stats.wait_ms.push_back(static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(pair.first_wait).count()));
+            stats.wait_ms.push_back(static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(pair.second_wait).count()));
+            stats.rating_diff.push_back(static_cast<uint32_t>(std::abs(pair.first_rating - pair.second_rating)));
+        }
+
+        pairs.clear();
+    }
+
+    void RunPopulation(size_t players)
+    {
+        std::mt19937 rng(static_cast<uint32_t>(players));
+        std::normal_distribution<double> rating_dist(Constants::Network::MATCH_DEFAULT_RATING, 300.0);
+
+        std::vector<uint16_t> ratings(players);
+        for (auto& rating : ratings)
+        {
+            rating = static_cast<uint16_t>(std::clamp(rating_dist(rng), 0.0, static_cast<double>(Constants::Network::MATCH_MAX_RATING)));
+        }
+
+        Matchmaker matchmaker;
+        MatchStats stats;
+        stats.wait_ms.reserve(players);
+        stats.rating_diff.reserve(players / 2);
+
+        std::vector<MatchPair> pairs;
+        const Clock::time_point sim_start{};
+        const size_t total_ticks = static_cast<size_t>((ARRIVAL_SECONDS + DRAIN_SECONDS) * 1000 / TICK_MS);
+        const size_t arrival_ticks = static_cast<size_t>(ARRIVAL_SECONDS * 1000 / TICK_MS);
+
+        size_t next_player = 0;
+        size_t peak_queue = 0;
+
+        const auto wall_start = std::chrono::steady_clock::now();
+
+        for (size_t tick = 0; tick < total_ticks; ++tick)
+        {
+            const auto now = sim_start + std::chrono::milliseconds(tick * TICK_MS);
+
+            // 이번 틱까지 도착해야 하는 플레이어 등록
+            const size_t arrived = tick < arrival_ticks ? players * (tick + 1) / arrival_ticks : players;
+            for (; next_player < arrived; ++next_player)
+            {
+                matchmaker.Enqueue(static_cast<SlotId>(next_player + 1), ratings[next_player], now, pairs);
+                ++stats.operations;
+            }
+
+            matchmaker.Update(now, pairs);
+            ++stats.operations;
+
+            peak_queue = std::max(peak_queue, matchmaker.GetQueuedCount());
+            Collect(pairs, stats);
+        }
+
+        const auto wall_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - wall_start).count();
+
+        uint64_t diff_sum = 0;
+        for (const uint32_t diff : stats.rating_diff)
+        {
+            diff_sum += diff;
+        }
+
+        const size_t matches = stats.rating_diff.size();
+
+        std::printf("players %zu\n", players);
+        std::printf("  matches         : %zu (unmatched %zu, peak queue %zu)\n", matches, matchmaker.GetQueuedCount(), peak_queue);
+        std::printf("  wall time       : %.1f ms, %.0f ns/op\n", static_cast<double>(wall_ns) / 1e6, static_cast<double>(wall_ns) / static_cast<double>(std::max<uint64_t>(stats.operations, 1)));
+        std::printf("  wait ms         : p50 %u, p99 %u, max %u\n",
+            GetPercentile(stats.wait_ms, 0.50), GetPercentile(stats.wait_ms, 0.99), GetPercentile(stats.wait_ms, 1.0));
+        std::printf("  rating diff     : mean %.1f, p99 %u, max %u\n",
+            matches > 0 ? static_cast<double>(diff_sum) / static_cast<double>(matches) : 0.0,
+            GetPercentile(stats.rating_diff, 0.99), GetPercentile(stats.rating_diff, 1.0));
+    }
+}
+
+int RunMatchmakingBench(BenchArgs args)
+{
+    std::vector<size_t> populations;
+    for (size_t i = 0; i < args.size(); ++i)
+    {
+        if (const size_t players = GetBenchArg<size_t>(args, i, 0); players > 0)
+        {
+            populations.push_back(players);
+        }
+    }
+
+    if (populations.empty())
+    {
+        populations = { 10'000, 100'000, 1'000'000 };
+    }
+
+    for (const size_t players : populations)
+    {
+        RunPopulation(players);
+    }
+
+    return 0;
+}
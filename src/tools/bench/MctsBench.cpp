@@ -0,0 +1,124 @@
+/*
+ *
+ * 설명: 병렬 몬테카를로 트리 탐색(PuyoMonteCarlo) 스레드 수별 확장성과 연쇄 계획 능력 측정
+ *  1. 스레드 수를 1부터 max_threads까지 두 배씩 늘리며 같은 시드의 블록 순서로 엔진 게임을 진행.
+ *  2. 배치마다 같은 시간 예산으로 탐색하고 초당 플레이아웃 수, 1스레드 대비 배율, 트리 노드 수/깊이, 작업 훔치기 횟수를 측정.
+ *  3. 실력 지표로 게임에서 실제로 터뜨린 최대 연쇄, 5연쇄 이상 횟수, 게임 오버 여부를 출력.
+ *  4. 물리 코어보다 스레드가 많으면 배율은 코어 수에서 멈추는 것이 정상.
+ *
+ */
+
+#include "../Benchmarks.hpp"
+#include "../../sim/PuyoMonteCarlo.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <thread>
+
+namespace
+{
+    struct ThreadStats
+    {
+        uint64_t moves{ 0 };
+        uint64_t playouts{ 0 };
+        uint64_t elapsed_us{ 0 };
+        uint64_t nodes{ 0 };
+        uint64_t big_chains{ 0 };
+        uint8_t max_depth{ 0 };
+        uint8_t max_chain{ 0 };
+        bool game_over{ false };
+    };
+
+    constexpr uint8_t BIG_CHAIN = 5;
+    constexpr uint32_t GAME_SEED = 1;
+
+    [[nodiscard]] PuyoPair RandomPair(std::mt19937& rng)
+    {
+        return { static_cast<PuyoCell>(1 + rng() % PUYO_COLOR_COUNT), static_cast<PuyoCell>(1 + rng() % PUYO_COLOR_COUNT) };
+    }
+
+    void PlayGame(int turns, const PuyoMctsConfig& config, PuyoMonteCarlo& search, PuyoWorkerPool& pool, ThreadStats& stats)
+    {
+        std::mt19937 rng(GAME_SEED);
+        PuyoEngine engine(GAME_SEED);
+
+        std::array<PuyoPair, PuyoSearchRequest::MAX_PAIRS> pairs{};
+        for (auto& pair : pairs)
+        {
+            pair = RandomPair(rng);
+        }
+
+        PuyoChainResult chain;
+
+        for (int turn = 0; turn < turns; ++turn)
+        {
+            PuyoSearchRequest request;
+            request.board = engine.GetBoard();
+            request.pairs = pairs;
+            request.pair_count = static_cast<uint8_t>(pairs.size());
+            request.state = engine.GetChainState();
+
+            const auto result = search.Search(request, config, &pool);
+
+            ++stats.moves;
+            stats.playouts += result.playouts;
+            stats.elapsed_us += result.elapsed_us;
+            stats.nodes += result.nodes;
+            stats.max_depth = std::max(stats.max_depth, result.max_depth);
+
+            if (!result.found || !engine.PlayTurn(pairs[0], result.placement.column, result.placement.rotation, chain) ||
+                engine.GetPhase() == PuyoPhase::GameOver)
+            {
+                stats.game_over = true;
+                return;
+            }
+
+            stats.max_chain = std::max(stats.max_chain, chain.chain_count);
+            stats.big_chains += chain.chain_count >= BIG_CHAIN ? 1 : 0;
+
+            std::rotate(pairs.begin(), pairs.begin() + 1, pairs.end());
+            pairs.back() = RandomPair(rng);
+        }
+    }
+}
+
+int RunMctsBench(BenchArgs args)
+{
+    const uint32_t budget_ms = GetBenchArg<uint32_t>(args, 0, 50);
+    const int turns = GetBenchArg<int>(args, 1, 60);
+    const size_t max_threads = std::max<size_t>(GetBenchArg<size_t>(args, 2, 32), 1);
+
+    PuyoMctsConfig config;
+    config.time_budget_us = budget_ms * 1000;
+
+    PuyoMonteCarlo search;
+
+    std::printf("mcts (%u ms/move, %d turns, %u hardware threads, node pool %u)\n", budget_ms, turns,
+        std::thread::hardware_concurrency(), search.GetNodeCapacity());
+    std::printf("  threads  playouts/s  speedup  nodes/move  depth  steals  max chain  %u+ chains  game over\n", BIG_CHAIN);
+
+    double base_rate = 0.0;
+
+    for (size_t threads = 1; threads <= max_threads; threads *= 2)
+    {
+        // 호출 스레드도 탐색에 참여하므로 풀 스레드 threads개 중 threads - 1개와 함께 threads개가 탐색
+        PuyoWorkerPool pool(threads);
+
+        ThreadStats stats;
+        PlayGame(turns, config, search, pool, stats);
+
+        const double moves = static_cast<double>(std::max<uint64_t>(stats.moves, 1));
+        const double rate = static_cast<double>(stats.playouts) * 1'000'000.0 / static_cast<double>(std::max<uint64_t>(stats.elapsed_us, 1));
+        if (threads == 1)
+        {
+            base_rate = rate;
+        }
+
+        std::printf("  %7zu  %10.0f  %6.2fx  %10.0f  %5u  %6llu  %9u  %10llu  %9s\n", threads, rate, base_rate > 0.0 ? rate / base_rate : 0.0,
+            static_cast<double>(stats.nodes) / moves, stats.max_depth, static_cast<unsigned long long>(pool.GetStealCount()), stats.max_chain,
+            static_cast<unsigned long long>(stats.big_chains), stats.game_over ? "yes" : "no");
+    }
+
+    return 0;
+}
@@ -0,0 +1,108 @@
+/*
+ *
+ * 설명: 난수 생성 비용 비교 (기존 std::random_device/mt19937 사용 방식과 RandomService)
+ *  1. 호출마다 random_device + mt19937 생성, 정적 mt19937 + 분포 객체, RandomService::Range, RandomService::Fill(배치)
+ *     순서로 값 하나당 비용을 출력.
+ *  2. Fill은 4개 레인(SSE2)으로 한 번에 채운 결과와 스칼라로 나누어 채운 결과가 같은지 확인.
+ *
+ */
+
+#include "../Benchmarks.hpp"
+#include "../../utils/Random.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace
+{
+    using BenchClock = std::chrono::steady_clock;
+
+    constexpr size_t FILL_BATCH = 4096;
+    constexpr size_t DEVICE_SAMPLES = 100'000;
+
+    [[nodiscard]] double ElapsedNs(BenchClock::time_point start)
+    {
+        return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(BenchClock::now() - start).count());
+    }
+
+    // 배치(4개 레인 동시)와 3개씩 나누어 채운 값(스칼라 경로)의 레인별 일치 여부
+    [[nodiscard]] size_t CountLaneMismatches()
+    {
+        Xoshiro128x4 batch(1);
+        Xoshiro128x4 scalar(1);
+
+        std::vector<float> batch_values(FILL_BATCH);
+        std::vector<float> scalar_values(FILL_BATCH);
+
+        batch.Fill(batch_values);
+        for (size_t i = 0; i < FILL_BATCH; i += Xoshiro128x4::LANES)
+        {
+            scalar.Fill(std::span<float>(scalar_values.data() + i, Xoshiro128x4::LANES - 1));
+        }
+
+        size_t mismatches = 0;
+        for (size_t i = 0; i < FILL_BATCH; i += Xoshiro128x4::LANES)
+        {
+            for (size_t lane = 0; lane + 1 < Xoshiro128x4::LANES; ++lane)
+            {
+                mismatches += batch_values[i + lane] != scalar_values[i + lane];
+            }
+        }
+
+        return mismatches;
+    }
+}
+
+int RunRandomBench(BenchArgs args)
+{
+    const size_t count = std::max<size_t>(GetBenchArg<size_t>(args, 0, 10'000'000), FILL_BATCH);
+
+    float checksum = 0.0f;
+
+    auto start = BenchClock::now();
+    for (size_t i = 0; i < DEVICE_SAMPLES; ++i)
+    {
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        std::uniform_real_distribution<float> dist(100.0f, 500.0f);
+        checksum += dist(gen);
+    }
+    const double device_ns = ElapsedNs(start) / static_cast<double>(DEVICE_SAMPLES);
+
+    std::mt19937 engine(1);
+    start = BenchClock::now();
+    for (size_t i = 0; i < count; ++i)
+    {
+        std::uniform_real_distribution<float> dist(100.0f, 500.0f);
+        checksum += dist(engine);
+    }
+    const double mt_ns = ElapsedNs(start) / static_cast<double>(count);
+
+    start = BenchClock::now();
+    for (size_t i = 0; i < count; ++i)
+    {
+        checksum += RandomService::Range(100.0f, 500.0f, RandomStream::Effects);
+    }
+    const double range_ns = ElapsedNs(start) / static_cast<double>(count);
+
+    std::vector<float> values(FILL_BATCH);
+    const size_t batches = count / FILL_BATCH;
+    start = BenchClock::now();
+    for (size_t i = 0; i < batches; ++i)
+    {
+        RandomService::Fill(values, 100.0f, 500.0f);
+        checksum += values[i % FILL_BATCH];
+    }
+    const double fill_ns = ElapsedNs(start) / static_cast<double>(batches * FILL_BATCH);
+
+    std::printf("random (%zu values, checksum %.1f)\n", count, static_cast<double>(checksum));
+    std::printf("  random_device + mt19937 per call : %9.2f ns/value\n", device_ns);
+    std::printf("  static mt19937 + distribution    : %9.2f ns/value\n", mt_ns);
+    std::printf("  RandomService::Range             : %9.2f ns/value\n", range_ns);
+    std::printf("  RandomService::Fill (batch %zu) : %9.2f ns/value, lane mismatch %zu\n", FILL_BATCH, fill_ns, CountLaneMismatches());
+
+    return 0;
+}
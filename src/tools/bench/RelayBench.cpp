@@ -0,0 +1,361 @@
+/*
+ *
+ * 설명: 중계 노드 지연/처리량 측정
+ *  1. pairs 쌍의 호스트/게스트가 같은 session_code로 중계 노드에 접속해 짝을 지음.
+ *  2. 호스트는 초당 msgs_per_sec 개의 프레임에 송신 시각(us)을 기록해 보내고, 게스트는 받은 프레임을 그대로 돌려보냄.
+ *  3. 왕복 시간의 절반을 중계를 거친 단방향 지연으로 보고 p50/p99를 출력 (localhost에서는 대부분이 중계 비용).
+ *  4. 측정 전에 게임(--relay=IP:코드)과 같은 접속 절차(ConnectRelay)로 호스트/게스트 한 쌍을 만들어
+ *     게임 패킷이 양방향으로 그대로 전달되는지 확인.
+ *
+ */
+
+#include "../Benchmarks.hpp"
+#include "../../network/RelayHandshake.hpp"
+#include "../../network/packets/GamePackets.hpp"
+#include "../../core/common/constants/NetworkConstants.hpp"
+
+#include <winsock2.h>
+#include <ws2tcpip.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    // 중계 노드는 내용을 해석하지 않으므로 측정용 프레임을 직접 정의
+    #pragma pack(push, 1)
+    struct EchoFrame : PacketBase
+    {
+        int64_t send_us{};
+
+        EchoFrame()
+        {
+            type = static_cast<uint16_t>(PacketType::UpdateBlockMove);
+            size = sizeof(EchoFrame);
+        }
+    };
+    #pragma pack(pop)
+
+    struct RelayPeer
+    {
+        SOCKET socket{ INVALID_SOCKET };
+        std::vector<char> recv_buffer;
+        size_t recv_size{ 0 };
+        bool paired{ false };
+        bool host{ false };
+        Clock::time_point next_send{};
+    };
+
+    struct RelayBenchStats
+    {
+        uint64_t sent{ 0 };
+        uint64_t send_blocked{ 0 };
+        uint64_t echoed{ 0 };
+        uint64_t pairs_joined{ 0 };
+        std::vector<uint32_t> one_way_us;
+    };
+
+    int64_t GetElapsedUs(Clock::time_point start)
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count();
+    }
+
+    // 정해진 크기를 다 받을 때까지 블로킹 수신 (timeout_ms 안에 못 받으면 false)
+    bool ReceiveExact(SOCKET socket, std::vector<char>& out, size_t size, int timeout_ms)
+    {
+        DWORD timeout = static_cast<DWORD>(timeout_ms);
+        setsockopt(socket, SOL_SOCKET, SO_RCVTIMEO, reinterpret_cast<const char*>(&timeout), sizeof(timeout));
+
+        out.assign(size, 0);
+        size_t received = 0;
+        while (received < size)
+        {
+            const int result = recv(socket, out.data() + received, static_cast<int>(size - received), 0);
+            if (result <= 0)
+            {
+                return false;
+            }
+            received += static_cast<size_t>(result);
+        }
+
+        return true;
+    }
+
+    // 게임 서버(NetServer::AcceptClientSocket)와 클라이언트(NetClient::Connect)가 쓰는 접속 절차로 짝을 지은 뒤
+    // 호스트의 GiveId와 게스트의 ConnectLobby가 바이트 그대로 상대에게 도착하는지 확인
+    bool CheckGameHandshake(const std::string& ip, uint32_t session_code)
+    {
+        SOCKET host = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+        SOCKET guest = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+
+        bool host_paired = false;
+        std::thread host_thread([&]()
+            {
+                host_paired = ConnectRelay(host, ip, Constants::Network::RELAY_PORT, session_code, Constants::Network::RELAY_PAIR_TIMEOUT);
+            });
+        const bool guest_paired = ConnectRelay(guest, ip, Constants::Network::RELAY_PORT, session_code, Constants::Network::RELAY_PAIR_TIMEOUT);
+        host_thread.join();
+
+        bool delivered = false;
+        if (host_paired && guest_paired)
+        {
+            GiveIdPacket give_id;
+            give_id.player_id = 1;
+            const auto host_bytes = give_id.ToBytes();
+
+            ConnectLobbyPacket connect_lobby;
+            connect_lobby.id = 2;
+            const auto guest_bytes = connect_lobby.ToBytes();
+
+            send(host, host_bytes.data(), static_cast<int>(host_bytes.size()), 0);
+            send(guest, guest_bytes.data(), static_cast<int>(guest_bytes.size()), 0);
+
+            std::vector<char> at_guest;
+            std::vector<char> at_host;
+            delivered = ReceiveExact(guest, at_guest, host_bytes.size(), Constants::Network::RELAY_PAIR_TIMEOUT) && at_guest == host_bytes &&
+                ReceiveExact(host, at_host, guest_bytes.size(), Constants::Network::RELAY_PAIR_TIMEOUT) && at_host == guest_bytes;
+        }
+
+        std::printf("game handshake  : host %s, guest %s, packets %s\n",
+            host_paired ? "paired" : "failed", guest_paired ? "paired" : "failed", delivered ? "delivered" : "mismatch");
+
+        closesocket(host);
+        closesocket(guest);
+        return delivered;
+    }
+
+    bool ConnectPeer(RelayPeer& peer, const std::string& ip, uint32_t session_code)
+    {
+        peer.socket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+        if (peer.socket == INVALID_SOCKET)
+        {
+            return false;
+        }
+
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(Constants::Network::RELAY_PORT);
+        inet_pton(AF_INET, ip.c_str(), &addr.sin_addr);
+
+        if (connect(peer.socket, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == SOCKET_ERROR)
+        {
+            closesocket(peer.socket);
+            peer.socket = INVALID_SOCKET;
+            return false;
+        }
+
+        BOOL no_delay = TRUE;
+        setsockopt(peer.socket, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char*>(&no_delay), sizeof(no_delay));
+
+        // 응답은 폴링 루프에서 받으므로 요청만 보내고 논블로킹으로 전환
+        RelayJoinPacket join;
+        join.session_code = session_code;
+        send(peer.socket, reinterpret_cast<const char*>(&join), sizeof(RelayJoinPacket), 0);
+
+        u_long non_blocking = 1;
+        ioctlsocket(peer.socket, FIONBIO, &non_blocking);
+
+        peer.recv_buffer.resize(Constants::Network::MAX_PACKET_SIZE * 16);
+        return true;
+    }
+
+    void HandleFrame(RelayPeer& peer, const char* data, RelayBenchStats& stats, Clock::time_point start)
+    {
+        PacketBase header{};
+        std::memcpy(&header, data, sizeof(PacketBase));
+
+        if (header.type == static_cast<uint16_t>(PacketType::RelayJoin))
+        {
+            peer.paired = true;
+            if (peer.host)
+            {
+                ++stats.pairs_joined;
+                peer.next_send = Clock::now();
+            }
+            return;
+        }
+
+        if (header.size != sizeof(EchoFrame))
+        {
+            return;
+        }
+
+        if (!peer.host)
+        {
+            // 게스트: 받은 프레임을 그대로 반사
+            send(peer.socket, data, sizeof(EchoFrame), 0);
+            return;
+        }
+
+        EchoFrame frame;
+        std::memcpy(&frame, data, sizeof(EchoFrame));
+
+        const int64_t round_trip = GetElapsedUs(start) - frame.send_us;
+        stats.one_way_us.push_back(static_cast<uint32_t>(std::max<int64_t>(round_trip, 0) / 2));
+        ++stats.echoed;
+    }
+
+    void PollPeer(RelayPeer& peer, RelayBenchStats& stats, Clock::time_point start)
+    {
+        while (true)
+        {
+            const int result = recv(peer.socket, peer.recv_buffer.data() + peer.recv_size,
+                static_cast<int>(peer.recv_buffer.size() - peer.recv_size), 0);
+
+            if (result <= 0)
+            {
+                break;
+            }
+
+            peer.recv_size += static_cast<size_t>(result);
+            if (peer.recv_size == peer.recv_buffer.size())
+            {
+                peer.recv_buffer.resize(peer.recv_buffer.size() * 2);
+            }
+        }
+
+        size_t offset = 0;
+        while (peer.recv_size - offset >= sizeof(PacketBase))
+        {
+            PacketBase header{};
+            std::memcpy(&header, peer.recv_buffer.data() + offset, sizeof(PacketBase));
+
+            if (header.size < sizeof(PacketBase) || peer.recv_size - offset < header.size)
+            {
+                break;
+            }
+
+            HandleFrame(peer, peer.recv_buffer.data() + offset, stats, start);
+            offset += header.size;
+        }
+
+        if (offset > 0)
+        {
+            std::memmove(peer.recv_buffer.data(), peer.recv_buffer.data() + offset, peer.recv_size - offset);
+            peer.recv_size -= offset;
+        }
+    }
+
+    uint32_t GetPercentile(std::vector<uint32_t>& samples, double ratio)
+    {
+        if (samples.empty())
+        {
+            return 0;
+        }
+
+        const auto index = static_cast<size_t>(ratio * static_cast<double>(samples.size() - 1));
+        std::nth_element(samples.begin(), samples.begin() + index, samples.end());
+        return samples[index];
+    }
+}
+
+int RunRelayBench(BenchArgs args)
+{
+    const std::string ip = args.size() > 0 ? std::string(args[0]) : std::string("127.0.0.1");
+    const int pairs = GetBenchArg(args, 1, 1000);
+    const int seconds = GetBenchArg(args, 2, 30);
+    const int msgs_per_sec = std::max(GetBenchArg(args, 3, 30), 1);
+
+    WSADATA wsa_data;
+    if (WSAStartup(MAKEWORD(2, 2), &wsa_data) != 0)
+    {
+        std::printf("WSAStartup failed\n");
+        return 1;
+    }
+
+    // 측정용 짝과 겹치지 않는 session_code 사용
+    if (CheckGameHandshake(ip, static_cast<uint32_t>(pairs) + 1) == false)
+    {
+        std::printf("  mismatch: game relay handshake failed\n");
+    }
+
+    // 짝마다 서로 다른 session_code 사용 (짝수: 호스트, 홀수: 게스트)
+    std::vector<RelayPeer> peers(static_cast<size_t>(pairs) * 2);
+    size_t connected = 0;
+
+    for (size_t i = 0; i < peers.size(); ++i)
+    {
+        peers[i].host = (i % 2) == 0;
+        if (ConnectPeer(peers[i], ip, static_cast<uint32_t>(i / 2 + 1)))
+        {
+            ++connected;
+        }
+    }
+
+    std::printf("connected %zu / %zu peers\n", connected, peers.size());
+
+    std::vector<WSAPOLLFD> poll_fds;
+    poll_fds.reserve(peers.size());
+    for (const auto& peer : peers)
+    {
+        poll_fds.push_back(WSAPOLLFD{ peer.socket, POLLRDNORM, 0 });
+    }
+
+    RelayBenchStats stats;
+    const auto start = Clock::now();
+    const auto end = start + std::chrono::seconds(seconds);
+    const auto send_interval = std::chrono::microseconds(1'000'000 / msgs_per_sec);
+
+    while (Clock::now() < end)
+    {
+        // 읽을 데이터가 있는 소켓만 처리 (수만 개 소켓을 매번 recv로 확인하면 측정 지연이 커짐)
+        const int ready = WSAPoll(poll_fds.data(), static_cast<ULONG>(poll_fds.size()), 1);
+
+        for (size_t i = 0; ready > 0 && i < peers.size(); ++i)
+        {
+            if (peers[i].socket != INVALID_SOCKET && (poll_fds[i].revents & POLLRDNORM))
+            {
+                PollPeer(peers[i], stats, start);
+            }
+        }
+
+        const auto now = Clock::now();
+        for (auto& peer : peers)
+        {
+            if (!peer.host || !peer.paired || now < peer.next_send)
+            {
+                continue;
+            }
+
+            EchoFrame frame;
+            frame.send_us = GetElapsedUs(start);
+
+            if (send(peer.socket, reinterpret_cast<const char*>(&frame), sizeof(EchoFrame), 0) == SOCKET_ERROR)
+            {
+                ++stats.send_blocked;
+            }
+            else
+            {
+                ++stats.sent;
+            }
+
+            peer.next_send += send_interval;
+        }
+    }
+
+    const double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+
+    std::printf("pairs joined    : %llu / %d\n", static_cast<unsigned long long>(stats.pairs_joined), pairs);
+    std::printf("sent            : %llu (blocked %llu)\n", static_cast<unsigned long long>(stats.sent), static_cast<unsigned long long>(stats.send_blocked));
+    std::printf("echoed frames/s : %.1f\n", static_cast<double>(stats.echoed) / elapsed);
+    std::printf("one-way us      : p50 %u, p99 %u, max %u\n",
+        GetPercentile(stats.one_way_us, 0.50), GetPercentile(stats.one_way_us, 0.99), GetPercentile(stats.one_way_us, 1.0));
+
+    for (auto& peer : peers)
+    {
+        if (peer.socket != INVALID_SOCKET)
+        {
+            closesocket(peer.socket);
+        }
+    }
+
+    WSACleanup();
+    return 0;
+}
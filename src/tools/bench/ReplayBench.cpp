@@ -0,0 +1,257 @@
+/*
+ *
+ * 설명: 리플레이 파일(PuyoReplay) 크기, 재생 속도, 탐색 비용 측정
+ *  1. 같은 시드의 CPU(Easy 빔 탐색) 대전을 진행하며 입력을 파일로 기록. 플레이어마다 배치 간격을 0.5~1.5초로 둠.
+ *  2. 파일 크기를 입력 수와 비교하고 구조체를 그대로 쓸 때(입력/키프레임 원본 크기)와 비율을 출력.
+ *  3. 처음부터 끝까지 렌더링 없이 재생해 초당 틱 수와 실시간 대비 배속을 측정하고, 최종 상태가 기록 때와 같은지 확인.
+ *  4. 임의 틱으로 탐색하는 비용과, 그 결과가 처음부터 그 틱까지 재생한 상태와 같은지 확인.
+ *  5. 꼬리말을 잘라낸 파일(기록 중 종료)에서 인덱스를 다시 만들 수 있는지 확인.
+ *
+ */
+
+#include "../Benchmarks.hpp"
+#include "../../sim/PuyoBeamSearch.hpp"
+#include "../../sim/PuyoReplay.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using BenchClock = std::chrono::steady_clock;
+
+    constexpr int SEEKS_PER_GAME = 200;
+    constexpr int VERIFIED_SEEKS_PER_GAME = 20;
+    constexpr int PLAY_REPEAT = 20;
+
+    [[nodiscard]] double ElapsedUs(BenchClock::time_point start)
+    {
+        return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(BenchClock::now() - start).count()) / 1000.0;
+    }
+
+    struct RecordedGame
+    {
+        std::filesystem::path path;
+        PuyoMatchState final_state;
+        uint64_t inputs{ 0 };
+        uint32_t end_tick{ 0 };
+    };
+
+    // CPU 대전을 진행하며 기록. 두 플레이어 중 다음 배치 틱이 빠른 쪽이 둠
+    [[nodiscard]] bool RecordGame(uint32_t seed, int turns, const PuyoBeamConfig& config, PuyoWorkerPool& pool, RecordedGame& game)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<uint32_t> think(PuyoMatch::TICK_RATE / 2, PuyoMatch::TICK_RATE * 3 / 2);
+
+        PuyoMatch match(seed);
+        PuyoReplayWriter writer;
+        if (!writer.Open(game.path, seed))
+        {
+            return false;
+        }
+
+        std::array<uint32_t, PuyoMatch::PLAYER_COUNT> next_tick{ think(rng), think(rng) };
+
+        for (int turn = 0; turn < turns * PuyoMatch::PLAYER_COUNT && !match.IsFinished(); ++turn)
+        {
+            const uint8_t player = next_tick[0] <= next_tick[1] ? 0 : 1;
+
+            PuyoSearchRequest request;
+            request.board = match.GetEngine(player).GetBoard();
+            for (uint32_t i = 0; i < PuyoSearchRequest::MAX_PAIRS; ++i)
+            {
+                request.pairs[i] = match.GetPair(player, i);
+            }
+            request.pair_count = static_cast<uint8_t>(PuyoSearchRequest::MAX_PAIRS);
+            request.state = match.GetEngine(player).GetChainState();
+
+            const auto result = PuyoBeamSearch::Search(request, config, &pool);
+            if (!result.found)
+            {
+                break;
+            }
+
+            const PuyoMatchInput input{ next_tick[player], player, result.placement.column, result.placement.rotation };
+            if (!writer.Append(match, input) || !match.Apply(input))
+            {
+                return false;
+            }
+
+            ++game.inputs;
+            next_tick[player] += think(rng);
+        }
+
+        match.SaveState(game.final_state);
+        game.end_tick = match.GetTick();
+
+        return writer.Close();
+    }
+
+    [[nodiscard]] bool IsSameState(const PuyoMatch& match, const PuyoMatchState& expected)
+    {
+        PuyoMatchState state;
+        match.SaveState(state);
+        return state == expected;
+    }
+}
+
+int RunReplayBench(BenchArgs args)
+{
+    const int games = std::max(GetBenchArg<int>(args, 0, 8), 1);
+    const int turns = GetBenchArg<int>(args, 1, 300);
+
+    PuyoWorkerPool pool;
+    const auto config = PuyoBeamSearch::GetLevelConfig(PuyoCpuLevel::Easy);
+
+    const auto directory = std::filesystem::temp_directory_path();
+
+    std::printf("replay (%d games, up to %d turns per player)\n", games, turns);
+
+    std::vector<RecordedGame> recorded(static_cast<size_t>(games));
+    uint64_t total_bytes = 0;
+    uint64_t total_inputs = 0;
+    uint64_t total_chunks = 0;
+    uint64_t total_ticks = 0;
+
+    for (int game = 0; game < games; ++game)
+    {
+        auto& record = recorded[static_cast<size_t>(game)];
+        record.path = directory / ("puyo_replay_bench_" + std::to_string(game) + ".prp");
+
+        if (!RecordGame(static_cast<uint32_t>(game + 1), turns, config, pool, record))
+        {
+            std::printf("  failed to record %s\n", record.path.string().c_str());
+            return 1;
+        }
+
+        PuyoReplayReader reader;
+        if (!reader.Open(record.path))
+        {
+            std::printf("  failed to open %s\n", record.path.string().c_str());
+            return 1;
+        }
+
+        total_bytes += std::filesystem::file_size(record.path);
+        total_inputs += record.inputs;
+        total_chunks += reader.GetChunkCount();
+        total_ticks += record.end_tick;
+    }
+
+    const double inputs = static_cast<double>(std::max<uint64_t>(total_inputs, 1));
+    const double raw_bytes = static_cast<double>(total_inputs * sizeof(PuyoMatchInput) + total_chunks * sizeof(PuyoMatchState));
+
+    std::printf("  size    : %llu inputs, %llu keyframes, %.1f min of play\n", static_cast<unsigned long long>(total_inputs),
+        static_cast<unsigned long long>(total_chunks), static_cast<double>(total_ticks) / PuyoMatch::TICK_RATE / 60.0);
+    std::printf("            %llu bytes, %.2f bytes/input (raw structs %.0f bytes, %.1fx smaller)\n",
+        static_cast<unsigned long long>(total_bytes), static_cast<double>(total_bytes) / inputs, raw_bytes,
+        raw_bytes / static_cast<double>(std::max<uint64_t>(total_bytes, 1)));
+
+    // 전체 재생 (렌더링 없이)
+    size_t play_mismatches = 0;
+    PuyoMatch match;
+
+    auto start = BenchClock::now();
+    for (int repeat = 0; repeat < PLAY_REPEAT; ++repeat)
+    {
+        for (const auto& record : recorded)
+        {
+            PuyoReplayReader reader;
+            if (!reader.Open(record.path) || !reader.Play(match) || !IsSameState(match, record.final_state))
+            {
+                ++play_mismatches;
+            }
+        }
+    }
+    const double play_us = ElapsedUs(start);
+    const double played_seconds = static_cast<double>(total_ticks) * PLAY_REPEAT / PuyoMatch::TICK_RATE;
+
+    std::printf("  play    : %.2f M ticks/s, %.0fx real time, mismatch %zu/%d\n",
+        static_cast<double>(total_ticks) * PLAY_REPEAT / std::max(play_us, 1.0), played_seconds * 1'000'000.0 / std::max(play_us, 1.0),
+        play_mismatches, games * PLAY_REPEAT);
+
+    // 임의 틱 탐색 (가까운 키프레임 + 뒤따르는 입력만 디코드)
+    std::mt19937 rng(1);
+    size_t seek_failures = 0;
+    size_t seek_mismatches = 0;
+    double seek_us = 0.0;
+    double full_us = 0.0;
+    int seeks = 0;
+    int verified = 0;
+
+    for (const auto& record : recorded)
+    {
+        PuyoReplayReader reader;
+        if (!reader.Open(record.path))
+        {
+            continue;
+        }
+
+        std::uniform_int_distribution<uint32_t> pick(0, std::max(record.end_tick, 1u));
+
+        for (int i = 0; i < SEEKS_PER_GAME; ++i)
+        {
+            const uint32_t tick = pick(rng);
+
+            start = BenchClock::now();
+            seek_failures += reader.Seek(tick, match) ? 0 : 1;
+            seek_us += ElapsedUs(start);
+            ++seeks;
+
+            if (i < VERIFIED_SEEKS_PER_GAME)
+            {
+                PuyoMatchState sought;
+                match.SaveState(sought);
+
+                PuyoMatch reference;
+                start = BenchClock::now();
+                reader.Play(reference, tick);
+                full_us += ElapsedUs(start);
+                ++verified;
+
+                seek_mismatches += IsSameState(reference, sought) ? 0 : 1;
+            }
+        }
+    }
+
+    std::printf("  seek    : %.1f us/seek (replay from start %.1f us), failed %zu, mismatch %zu/%d\n",
+        seek_us / std::max(seeks, 1), full_us / std::max(verified, 1), seek_failures, seek_mismatches, verified);
+
+    // 꼬리말 없이 잘린 파일에서 인덱스 재구성
+    size_t recovered_chunks = 0;
+    size_t expected_chunks = 0;
+    for (const auto& record : recorded)
+    {
+        PuyoReplayReader reader;
+        if (!reader.Open(record.path))
+        {
+            continue;
+        }
+        expected_chunks += reader.GetChunkCount();
+
+        const auto truncated = record.path.string() + ".partial";
+        std::filesystem::copy_file(record.path, truncated, std::filesystem::copy_options::overwrite_existing);
+        std::filesystem::resize_file(truncated, std::filesystem::file_size(record.path) - 1);
+
+        PuyoReplayReader partial;
+        if (partial.Open(truncated) && partial.IsRecovered())
+        {
+            recovered_chunks += partial.GetChunkCount();
+        }
+
+        std::filesystem::remove(truncated);
+    }
+
+    std::printf("  recover : %zu/%zu chunks indexed without footer\n", recovered_chunks, expected_chunks);
+
+    for (const auto& record : recorded)
+    {
+        std::filesystem::remove(record.path);
+    }
+
+    return 0;
+}
@@ -0,0 +1,175 @@
+/*
+ *
+ * 설명: 배치 시뮬레이터(PuyoSimulator) 처리량 측정
+ *  1. 엔진으로 무작위 배치를 진행하며 중간 보드를 모아 실제 게임과 비슷한 보드 집합을 만듦.
+ *  2. Simulate 한 번(무작위 배치)과 SimulateAll(22개 배치 전체)의 호출당 비용을 측정.
+ *  3. 결과가 엔진(PuyoEngine::PlayTurn)과 같은지 일부 보드에서 확인해 mismatch로 출력.
+ *
+ */
+
+#include "../Benchmarks.hpp"
+#include "../../sim/PuyoSimulator.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace
+{
+    using BenchClock = std::chrono::steady_clock;
+
+    constexpr int MAX_BOARD_CELLS = 48;
+    constexpr size_t VERIFY_BOARDS = 1000;
+
+    [[nodiscard]] double ElapsedNs(BenchClock::time_point start)
+    {
+        return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(BenchClock::now() - start).count());
+    }
+
+    [[nodiscard]] PuyoPair RandomPair(std::mt19937& rng)
+    {
+        return { static_cast<PuyoCell>(1 + rng() % 4), static_cast<PuyoCell>(1 + rng() % 4) };
+    }
+
+    // 무작위 배치로 게임을 진행하며 보드를 모음 (너무 높아지면 새 게임)
+    [[nodiscard]] std::vector<PuyoBoard> CollectBoards(size_t count, std::mt19937& rng)
+    {
+        std::vector<PuyoBoard> boards;
+        boards.reserve(count);
+
+        PuyoEngine engine(static_cast<uint32_t>(rng()));
+        PuyoChainResult result;
+
+        while (boards.size() < count)
+        {
+            const auto& placement = PuyoSimulator::PLACEMENTS[rng() % PuyoSimulator::PLACEMENT_COUNT];
+
+            if (!engine.PlayTurn(RandomPair(rng), placement.column, placement.rotation, result) ||
+                engine.GetPhase() == PuyoPhase::GameOver || engine.GetBoard().GetCellCount() > MAX_BOARD_CELLS)
+            {
+                engine.Reset(static_cast<uint32_t>(rng()));
+                continue;
+            }
+
+            boards.push_back(engine.GetBoard());
+        }
+
+        return boards;
+    }
+
+    [[nodiscard]] bool Verify(const std::vector<PuyoBoard>& boards, const std::vector<PuyoPair>& pairs)
+    {
+        PuyoSimResult simulated;
+        PuyoChainResult played;
+
+        for (size_t i = 0; i < std::min(boards.size(), VERIFY_BOARDS); ++i)
+        {
+            for (const auto& placement : PuyoSimulator::PLACEMENTS)
+            {
+                PuyoEngine engine;
+                engine.GetBoard() = boards[i];
+
+                const bool engine_placed = engine.PlacePair(pairs[i], placement.column, placement.rotation);
+                if (engine_placed)
+                {
+                    engine.ResolveChain(played);
+                }
+
+                const bool sim_placed = PuyoSimulator::Simulate(boards[i], pairs[i], placement.column, placement.rotation, simulated);
+
+                if (engine_placed != sim_placed)
+                {
+                    return false;
+                }
+
+                if (sim_placed && (!(engine.GetBoard() == simulated.board) || played.chain_count != simulated.chain.chain_count ||
+                    played.score != simulated.chain.score || played.garbage_sent != simulated.chain.garbage_sent))
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+}
+
+int RunSimulateBench(BenchArgs args)
+{
+    const size_t board_count = GetBenchArg<size_t>(args, 0, 10'000);
+    const int iterations = GetBenchArg<int>(args, 1, 20);
+
+    std::mt19937 rng(static_cast<uint32_t>(board_count));
+
+    const auto boards = CollectBoards(board_count, rng);
+
+    std::vector<PuyoPair> pairs(board_count);
+    std::vector<PuyoPlacement> placements(board_count);
+    for (size_t i = 0; i < board_count; ++i)
+    {
+        pairs[i] = RandomPair(rng);
+        placements[i] = PuyoSimulator::PLACEMENTS[rng() % PuyoSimulator::PLACEMENT_COUNT];
+    }
+
+    // 배치 한 번
+    PuyoSimResult result;
+    uint64_t simulations = 0;
+    uint64_t chains = 0;
+    uint64_t max_chain = 0;
+
+    auto start = BenchClock::now();
+    for (int it = 0; it < iterations; ++it)
+    {
+        for (size_t i = 0; i < board_count; ++i)
+        {
+            if (PuyoSimulator::Simulate(boards[i], pairs[i], placements[i].column, placements[i].rotation, result))
+            {
+                chains += result.chain.chain_count;
+                max_chain = std::max<uint64_t>(max_chain, result.chain.chain_count);
+            }
+            ++simulations;
+        }
+    }
+    const double single_ns = ElapsedNs(start) / static_cast<double>(simulations);
+
+    // 22개 배치 전체
+    std::array<PuyoSimResult, PuyoSimulator::PLACEMENT_COUNT> results;
+    uint64_t batches = 0;
+    uint64_t placed = 0;
+    uint64_t best_chain = 0;
+
+    start = BenchClock::now();
+    for (int it = 0; it < iterations; ++it)
+    {
+        for (size_t i = 0; i < board_count; ++i)
+        {
+            placed += PuyoSimulator::SimulateAll(boards[i], pairs[i], results);
+
+            for (const auto& placement : results)
+            {
+                if (placement.placed)
+                {
+                    best_chain = std::max<uint64_t>(best_chain, placement.chain.chain_count);
+                }
+            }
+            ++batches;
+        }
+    }
+    const double batch_ns = ElapsedNs(start) / static_cast<double>(batches);
+
+    std::printf("simulate (%zu boards x %d)\n", board_count, iterations);
+    std::printf("  Simulate        : %8.1f ns/call (avg chain %.3f, max %llu)\n", single_ns,
+        static_cast<double>(chains) / static_cast<double>(simulations), static_cast<unsigned long long>(max_chain));
+    std::printf("  SimulateAll     : %8.1f ns/batch, %.1f ns/placement (%.1f placements/batch, max chain %llu)\n", batch_ns,
+        batch_ns * static_cast<double>(batches) / static_cast<double>(std::max<uint64_t>(placed, 1)),
+        static_cast<double>(placed) / static_cast<double>(batches), static_cast<unsigned long long>(best_chain));
+
+    if (!Verify(boards, pairs))
+    {
+        std::printf("  mismatch: simulator and engine results differ\n");
+    }
+
+    return 0;
+}
@@ -0,0 +1,159 @@
+/*
+ *
+ * 설명: 타이밍 휠 예약/취소/만료 비용 측정
+ *  1. 타이머 수(기본 1M)만큼 0~60초 사이 지연으로 예약하고 절반을 무작위 순서로 취소.
+ *  2. 서버 타이머 틱(SERVER_TIMER_TICK) 단위로 시계를 진행하며 남은 타이머를 모두 만료시킴.
+ *  3. 비교용으로 기존 TimerScheduler와 같은 방식(벡터 + 매 틱 remove_if)을 적은 타이머 수로 측정.
+ *
+ */
+
+#include "../Benchmarks.hpp"
+#include "../../core/common/constants/NetworkConstants.hpp"
+#include "../../utils/TimingWheel.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace
+{
+    using BenchClock = std::chrono::steady_clock;
+
+    constexpr uint64_t MAX_DELAY_MS = 60'000;
+    constexpr size_t BASELINE_TIMERS = 10'000;
+
+    [[nodiscard]] double ElapsedNs(BenchClock::time_point start)
+    {
+        return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(BenchClock::now() - start).count());
+    }
+
+    [[nodiscard]] double PerOp(double ns, uint64_t count)
+    {
+        return ns / static_cast<double>(std::max<uint64_t>(count, 1));
+    }
+
+    void RunWheel(size_t timers, const std::vector<uint64_t>& delays)
+    {
+        const uint32_t tick_ms = Constants::Network::SERVER_TIMER_TICK;
+
+        TimingWheel<uint32_t> wheel(tick_ms);
+        wheel.Reserve(timers);
+
+        std::vector<TimerId> ids(timers);
+
+        auto start = BenchClock::now();
+        for (size_t i = 0; i < timers; ++i)
+        {
+            ids[i] = wheel.Schedule(delays[i], static_cast<uint32_t>(i));
+        }
+        const double schedule_ns = ElapsedNs(start);
+
+        // 예약 순서와 무관한 순서로 절반 취소
+        std::vector<size_t> order(timers);
+        std::iota(order.begin(), order.end(), size_t{ 0 });
+        std::shuffle(order.begin(), order.end(), std::mt19937(7));
+        order.resize(timers / 2);
+
+        size_t cancelled = 0;
+        start = BenchClock::now();
+        for (const size_t index : order)
+        {
+            cancelled += wheel.Cancel(ids[index]) ? 1 : 0;
+        }
+        const double cancel_ns = ElapsedNs(start);
+
+        std::vector<uint32_t> expired;
+        expired.reserve(timers);
+
+        uint64_t advances = 0;
+        size_t max_batch = 0;
+        start = BenchClock::now();
+        for (uint64_t now_ms = tick_ms; !wheel.Empty(); now_ms += tick_ms)
+        {
+            const size_t before = expired.size();
+            wheel.Advance(now_ms, expired);
+
+            max_batch = std::max(max_batch, expired.size() - before);
+            ++advances;
+        }
+        const double expire_ns = ElapsedNs(start);
+
+        std::printf("timing wheel (%zu timers, tick %u ms)\n", timers, tick_ms);
+        std::printf("  schedule        : %.1f ns/op\n", PerOp(schedule_ns, timers));
+        std::printf("  cancel          : %.1f ns/op (%zu cancelled)\n", PerOp(cancel_ns, cancelled), cancelled);
+        std::printf("  expire          : %.1f ns/timer, %.2f us/advance (%zu expired, %llu advances, max batch %zu)\n",
+            PerOp(expire_ns, expired.size()), PerOp(expire_ns, advances) / 1000.0, expired.size(), static_cast<unsigned long long>(advances), max_batch);
+    }
+
+    // TimerScheduler::Update와 같은 방식 (매 틱 전체 벡터를 훑음)
+    void RunLinearBaseline(size_t timers, const std::vector<uint64_t>& delays)
+    {
+        const uint32_t tick_ms = Constants::Network::SERVER_TIMER_TICK;
+
+        struct Task
+        {
+            uint64_t expire_ms{ 0 };
+            uint32_t value{ 0 };
+        };
+
+        std::vector<Task> tasks;
+        tasks.reserve(timers);
+
+        for (size_t i = 0; i < timers; ++i)
+        {
+            tasks.push_back({ delays[i], static_cast<uint32_t>(i) });
+        }
+
+        std::vector<uint32_t> expired;
+        expired.reserve(timers);
+
+        uint64_t advances = 0;
+        const auto start = BenchClock::now();
+        for (uint64_t now_ms = tick_ms; !tasks.empty(); now_ms += tick_ms)
+        {
+            const auto end = std::remove_if(tasks.begin(), tasks.end(),
+                [&](const Task& task)
+                {
+                    if (task.expire_ms <= now_ms)
+                    {
+                        expired.push_back(task.value);
+                        return true;
+                    }
+                    return false;
+                });
+
+            tasks.erase(end, tasks.end());
+            ++advances;
+        }
+        const double expire_ns = ElapsedNs(start);
+
+        std::printf("linear scan baseline (%zu timers)\n", timers);
+        std::printf("  expire          : %.1f ns/timer, %.2f us/advance (%llu advances)\n",
+            PerOp(expire_ns, expired.size()), PerOp(expire_ns, advances) / 1000.0, static_cast<unsigned long long>(advances));
+    }
+}
+
+int RunTimerWheelBench(BenchArgs args)
+{
+    const size_t timers = GetBenchArg<size_t>(args, 0, 1'000'000);
+
+    std::mt19937_64 rng(static_cast<uint64_t>(timers));
+    std::uniform_int_distribution<uint64_t> delay_dist(0, MAX_DELAY_MS);
+
+    std::vector<uint64_t> delays(timers);
+    for (auto& delay : delays)
+    {
+        delay = delay_dist(rng);
+    }
+
+    RunWheel(timers, delays);
+
+    const size_t baseline = std::min(timers, BASELINE_TIMERS);
+    RunWheel(baseline, delays);
+    RunLinearBaseline(baseline, delays);
+
+    return 0;
+}
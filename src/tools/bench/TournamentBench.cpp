@@ -0,0 +1,333 @@
+/*
+ *
+ * 설명: CPU 대 CPU 헤드리스 대전을 모든 코어에서 대량으로 진행 (밸런스/회귀 확인)
+ *  1. 대전마다 번호로 정해지는 시드를 쓰고 SDL 없이 PuyoMatch로 진행. 선후공 유리함을 없애려고 짝수 번째 대전은 자리를 바꿈.
+ *  2. 플레이어 종류: random(배치 가능한 곳 중 무작위), easy/normal/hard(빔 탐색 난이도).
+ *     탐색 시간 예산은 없애서 실행 환경과 스레드 수에 관계없이 같은 결과가 나옴.
+ *  3. 대전은 작업 풀(ParallelFor)로 나눠 돌리고, 각 대전의 탐색은 그 스레드 안에서 단일 스레드로 처리.
+ *  4. 승률, 연쇄 길이 분포, 주고받은 방해 블록, 대전 시간(틱 기준)을 합산하고 초당 대전/턴 수를 출력.
+ *  5. 대전 결과를 순서대로 해시해 출력. 점수 규칙(SCORE_MARGINS, GetComboConstant 등)을 바꾸면 이 값이 달라지므로 회귀 확인용.
+ *
+ */
+
+#include "../Benchmarks.hpp"
+#include "../../sim/PuyoBeamSearch.hpp"
+#include "../../sim/PuyoMatch.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <limits>
+#include <optional>
+#include <random>
+#include <vector>
+
+namespace
+{
+    using BenchClock = std::chrono::steady_clock;
+
+    constexpr size_t CHAIN_BUCKETS = 8;     // 1 ~ 7연쇄, 마지막은 그 이상
+
+    struct AiPlayer
+    {
+        const char* name{ "random" };
+        std::optional<PuyoBeamConfig> config;   // 없으면 무작위 배치
+    };
+
+    [[nodiscard]] std::optional<AiPlayer> ParsePlayer(BenchArgs args, size_t index, std::string_view default_name)
+    {
+        const std::string_view name = index < args.size() ? args[index] : default_name;
+
+        std::optional<PuyoCpuLevel> level;
+        AiPlayer player;
+
+        if (name == "random")
+        {
+            return player;
+        }
+        else if (name == "easy")
+        {
+            player.name = "easy";
+            level = PuyoCpuLevel::Easy;
+        }
+        else if (name == "normal")
+        {
+            player.name = "normal";
+            level = PuyoCpuLevel::Normal;
+        }
+        else if (name == "hard")
+        {
+            player.name = "hard";
+            level = PuyoCpuLevel::Hard;
+        }
+        else
+        {
+            return std::nullopt;
+        }
+
+        player.config = PuyoBeamSearch::GetLevelConfig(*level);
+        player.config->time_budget_us = std::numeric_limits<uint32_t>::max();
+        return player;
+    }
+
+    struct SideStats
+    {
+        uint64_t score{ 0 };
+        uint64_t turns{ 0 };
+        uint64_t garbage_sent{ 0 };
+        uint64_t garbage_offset{ 0 };
+        std::array<uint64_t, CHAIN_BUCKETS> chains{};
+        uint8_t max_chain{ 0 };
+
+        void Merge(const SideStats& other)
+        {
+            score += other.score;
+            turns += other.turns;
+            garbage_sent += other.garbage_sent;
+            garbage_offset += other.garbage_offset;
+            for (size_t i = 0; i < CHAIN_BUCKETS; ++i)
+            {
+                chains[i] += other.chains[i];
+            }
+            max_chain = std::max(max_chain, other.max_chain);
+        }
+    };
+
+    struct MatchResult
+    {
+        int winner{ -1 };           // 0 = 첫 번째 플레이어(A), 1 = 두 번째(B), -1 = 무승부/턴 제한
+        bool turn_limit{ false };
+        uint32_t ticks{ 0 };
+        std::array<SideStats, PuyoMatch::PLAYER_COUNT> sides{};
+    };
+
+    [[nodiscard]] std::optional<PuyoPlacement> ChooseRandom(const PuyoBoard& board, std::mt19937& rng)
+    {
+        std::array<PuyoPlacement, PuyoSimulator::PLACEMENT_COUNT> valid{};
+        size_t count = 0;
+
+        for (const auto& placement : PuyoSimulator::PLACEMENTS)
+        {
+            if (board.CanPlace(placement.column, placement.rotation))
+            {
+                valid[count++] = placement;
+            }
+        }
+
+        if (count == 0)
+        {
+            return std::nullopt;
+        }
+
+        return valid[rng() % count];
+    }
+
+    [[nodiscard]] std::optional<PuyoPlacement> Choose(const AiPlayer& ai, const PuyoMatch& match, int player, std::mt19937& rng)
+    {
+        const PuyoEngine& engine = match.GetEngine(player);
+
+        if (ai.config)
+        {
+            PuyoSearchRequest request;
+            request.board = engine.GetBoard();
+            for (uint32_t i = 0; i < PuyoSearchRequest::MAX_PAIRS; ++i)
+            {
+                request.pairs[i] = match.GetPair(player, i);
+            }
+            request.pair_count = static_cast<uint8_t>(PuyoSearchRequest::MAX_PAIRS);
+            request.state = engine.GetChainState();
+
+            const auto result = PuyoBeamSearch::Search(request, *ai.config, nullptr);
+            if (result.found)
+            {
+                return result.placement;
+            }
+        }
+
+        // 무작위 플레이어이거나, 게임 오버를 피할 배치가 없을 때
+        return ChooseRandom(engine.GetBoard(), rng);
+    }
+
+    [[nodiscard]] MatchResult PlayMatch(uint32_t seed, const std::array<const AiPlayer*, 2>& players, int max_turns)
+    {
+        // 짝수 번째 대전은 A/B 자리를 바꿈 (같은 틱이면 0번 자리가 먼저 둠)
+        const int a_seat = seed % 2 == 0 ? 1 : 0;
+
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<uint32_t> think(PuyoMatch::TICK_RATE / 2, PuyoMatch::TICK_RATE * 3 / 2);
+
+        PuyoMatch match(seed);
+        MatchResult result;
+
+        std::array<uint32_t, PuyoMatch::PLAYER_COUNT> next_tick{ think(rng), think(rng) };
+        PuyoChainResult chain;
+
+        for (int turn = 0; turn < max_turns * PuyoMatch::PLAYER_COUNT && !match.IsFinished(); ++turn)
+        {
+            const int seat = next_tick[0] <= next_tick[1] ? 0 : 1;
+            const int side = seat == a_seat ? 0 : 1;
+
+            const auto placement = Choose(*players[side], match, seat, rng);
+            if (!placement ||
+                !match.Apply({ next_tick[seat], static_cast<uint8_t>(seat), placement->column, placement->rotation }, &chain))
+            {
+                // 둘 곳이 없으면 진 것으로 처리
+                result.winner = 1 - side;
+                break;
+            }
+
+            SideStats& stats = result.sides[side];
+            ++stats.turns;
+
+            if (chain.chain_count > 0)
+            {
+                ++stats.chains[std::min<size_t>(chain.chain_count, CHAIN_BUCKETS) - 1];
+                stats.max_chain = std::max(stats.max_chain, chain.chain_count);
+            }
+
+            stats.garbage_sent += static_cast<uint64_t>(std::max<int16_t>(chain.garbage_sent, 0));
+            stats.garbage_offset += static_cast<uint64_t>(std::max<int16_t>(chain.garbage_offset, 0));
+
+            next_tick[seat] += think(rng);
+        }
+
+        if (match.IsFinished())
+        {
+            const int winner_seat = match.GetWinner();
+            result.winner = winner_seat < 0 ? -1 : (winner_seat == a_seat ? 0 : 1);
+        }
+        else if (result.winner < 0)
+        {
+            result.turn_limit = true;
+        }
+
+        result.ticks = match.GetTick();
+        result.sides[0].score = match.GetEngine(a_seat).GetScore();
+        result.sides[1].score = match.GetEngine(1 - a_seat).GetScore();
+
+        return result;
+    }
+
+    // 대전 순서대로 결과를 섞은 값 (스레드 실행 순서와 무관)
+    [[nodiscard]] uint64_t HashResults(const std::vector<MatchResult>& results)
+    {
+        uint64_t hash = 14695981039346656037ull;
+        const auto mix = [&hash](uint64_t value)
+        {
+            hash = (hash ^ value) * 1099511628211ull;
+        };
+
+        for (const auto& result : results)
+        {
+            mix(static_cast<uint64_t>(result.winner + 1));
+            mix(result.ticks);
+            for (const auto& side : result.sides)
+            {
+                mix(side.score);
+                mix(side.turns);
+                mix(side.garbage_sent);
+            }
+        }
+
+        return hash;
+    }
+
+    void PrintChains(const char* name, const SideStats& stats)
+    {
+        uint64_t total = 0;
+        for (const uint64_t count : stats.chains)
+        {
+            total += count;
+        }
+
+        std::printf("    chains %-6s:", name);
+        for (size_t i = 0; i < CHAIN_BUCKETS; ++i)
+        {
+            std::printf(" %zu%s %.1f%%", i + 1, i + 1 == CHAIN_BUCKETS ? "+" : "",
+                100.0 * static_cast<double>(stats.chains[i]) / static_cast<double>(std::max<uint64_t>(total, 1)));
+        }
+        std::printf(" (%llu fired, max %u)\n", static_cast<unsigned long long>(total), stats.max_chain);
+    }
+}
+
+int RunTournamentBench(BenchArgs args)
+{
+    const int matches = std::max(GetBenchArg<int>(args, 0, 1000), 1);
+    const auto first = ParsePlayer(args, 1, "easy");
+    const auto second = ParsePlayer(args, 2, "random");
+    const int max_turns = std::max(GetBenchArg<int>(args, 3, 200), 1);
+    const size_t threads = GetBenchArg<size_t>(args, 4, PuyoWorkerPool::GetDefaultThreadCount());
+
+    if (!first || !second)
+    {
+        std::printf("tournament: player must be one of random, easy, normal, hard\n");
+        return 1;
+    }
+
+    PuyoWorkerPool pool(threads);
+    const std::array<const AiPlayer*, 2> players{ &*first, &*second };
+
+    std::printf("tournament (%d matches, %s vs %s, up to %d turns per player, %zu threads)\n", matches, first->name, second->name,
+        max_turns, pool.GetThreadCount());
+
+    std::vector<MatchResult> results(static_cast<size_t>(matches));
+
+    const auto start = BenchClock::now();
+    pool.ParallelFor(results.size(),
+        [&](size_t index)
+        {
+            results[index] = PlayMatch(static_cast<uint32_t>(index + 1), players, max_turns);
+        });
+    const double seconds = std::max(std::chrono::duration<double>(BenchClock::now() - start).count(), 1e-9);
+
+    std::array<uint64_t, 2> wins{};
+    uint64_t draws = 0;
+    uint64_t turn_limits = 0;
+    uint64_t total_ticks = 0;
+    uint32_t max_ticks = 0;
+    std::array<SideStats, 2> sides{};
+
+    for (const auto& result : results)
+    {
+        if (result.winner >= 0)
+        {
+            ++wins[result.winner];
+        }
+        else
+        {
+            ++draws;
+        }
+
+        turn_limits += result.turn_limit ? 1 : 0;
+        total_ticks += result.ticks;
+        max_ticks = std::max(max_ticks, result.ticks);
+
+        sides[0].Merge(result.sides[0]);
+        sides[1].Merge(result.sides[1]);
+    }
+
+    const double count = static_cast<double>(matches);
+    const double turns = static_cast<double>(sides[0].turns + sides[1].turns);
+
+    std::printf("  speed    : %.1f matches/s, %.0f turns/s (%.2f s)\n", count / seconds, turns / seconds, seconds);
+    std::printf("  result   : %s %.1f%%, %s %.1f%%, draw %.1f%% (turn limit %llu)\n", first->name,
+        100.0 * static_cast<double>(wins[0]) / count, second->name, 100.0 * static_cast<double>(wins[1]) / count,
+        100.0 * static_cast<double>(draws) / count, static_cast<unsigned long long>(turn_limits));
+    std::printf("  duration : avg %.1f s, max %.1f s of play, %.1f turns per player\n",
+        static_cast<double>(total_ticks) / count / PuyoMatch::TICK_RATE, static_cast<double>(max_ticks) / PuyoMatch::TICK_RATE,
+        turns / count / PuyoMatch::PLAYER_COUNT);
+
+    for (size_t side = 0; side < sides.size(); ++side)
+    {
+        const char* name = side == 0 ? first->name : second->name;
+        std::printf("  %-6s   : avg score %.0f, garbage sent %.1f, offset %.1f per match\n", name,
+            static_cast<double>(sides[side].score) / count, static_cast<double>(sides[side].garbage_sent) / count,
+            static_cast<double>(sides[side].garbage_offset) / count);
+        PrintChains(name, sides[side]);
+    }
+
+    std::printf("  result hash %016llx\n", static_cast<unsigned long long>(HashResults(results)));
+
+    return 0;
+}
@@ -0,0 +1,215 @@
+/*
+ *
+ * 설명: Zobrist 해시와 전치표(PuyoTranspositionTable)의 비용과 효과 측정
+ *  1. 무작위 게임 보드에서 전체 해시(Hash)와 배치 후 증분 갱신(HashResult) 비용을 비교하고 두 값이 같은지 확인.
+ *  2. Normal/Hard 빔 탐색으로 같은 시드의 게임을 전치표 없이, 그리고 메모리 상한별로 진행하며
+ *     배치당 탐색 시간, 적중률, 교체 수, 전치표 없이 둔 수와 같은지(same moves)를 출력.
+ *
+ */
+
+#include "../Benchmarks.hpp"
+#include "../../sim/PuyoBeamSearch.hpp"
+#include "../../sim/PuyoZobrist.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+    using BenchClock = std::chrono::steady_clock;
+
+    constexpr size_t HASH_BOARDS = 10'000;
+    constexpr int HASH_ITERATIONS = 50;
+
+    [[nodiscard]] double ElapsedNs(BenchClock::time_point start)
+    {
+        return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(BenchClock::now() - start).count());
+    }
+
+    [[nodiscard]] PuyoPair RandomPair(std::mt19937& rng)
+    {
+        return { static_cast<PuyoCell>(1 + rng() % PUYO_COLOR_COUNT), static_cast<PuyoCell>(1 + rng() % PUYO_COLOR_COUNT) };
+    }
+
+    struct HashSample
+    {
+        PuyoBoard board;
+        uint64_t hash{ 0 };
+        PuyoPair pair;
+        PuyoPlacement placement;
+        PuyoSimResult result;
+    };
+
+    void RunHashBench()
+    {
+        std::mt19937 rng(1);
+        std::vector<HashSample> samples;
+        samples.reserve(HASH_BOARDS);
+
+        // 무작위 배치로 게임을 진행하며 (보드, 다음 배치, 결과)를 모음
+        PuyoBoard board;
+        while (samples.size() < HASH_BOARDS)
+        {
+            HashSample sample;
+            sample.board = board;
+            sample.hash = PuyoZobrist::Hash(board);
+            sample.pair = RandomPair(rng);
+            sample.placement = PuyoSimulator::PLACEMENTS[rng() % PuyoSimulator::PLACEMENT_COUNT];
+
+            if (!PuyoSimulator::Simulate(board, sample.pair, sample.placement.column, sample.placement.rotation, sample.result) ||
+                sample.result.game_over)
+            {
+                board.Clear();
+                continue;
+            }
+
+            board = sample.result.board;
+            samples.push_back(sample);
+        }
+
+        uint64_t checksum = 0;
+        auto start = BenchClock::now();
+        for (int it = 0; it < HASH_ITERATIONS; ++it)
+        {
+            for (const auto& sample : samples)
+            {
+                checksum += PuyoZobrist::Hash(sample.result.board);
+            }
+        }
+        const double full_ns = ElapsedNs(start) / static_cast<double>(samples.size() * HASH_ITERATIONS);
+
+        start = BenchClock::now();
+        for (int it = 0; it < HASH_ITERATIONS; ++it)
+        {
+            for (const auto& sample : samples)
+            {
+                checksum += PuyoZobrist::HashResult(sample.hash, sample.board, sample.pair, sample.placement, sample.result);
+            }
+        }
+        const double incremental_ns = ElapsedNs(start) / static_cast<double>(samples.size() * HASH_ITERATIONS);
+
+        size_t mismatches = 0;
+        for (const auto& sample : samples)
+        {
+            mismatches += PuyoZobrist::HashResult(sample.hash, sample.board, sample.pair, sample.placement, sample.result) !=
+                PuyoZobrist::Hash(sample.result.board);
+        }
+
+        std::printf("  hash (%zu boards, checksum %016llx)\n", samples.size(), static_cast<unsigned long long>(checksum));
+        std::printf("    full        : %6.1f ns/board\n", full_ns);
+        std::printf("    incremental : %6.1f ns/board (chains rehash), mismatch %zu\n", incremental_ns, mismatches);
+    }
+
+    struct GameStats
+    {
+        std::vector<PuyoPlacement> moves;
+        uint64_t elapsed_us{ 0 };
+        uint64_t nodes{ 0 };
+        uint32_t score{ 0 };
+    };
+
+    [[nodiscard]] GameStats PlayGame(int turns, const PuyoBeamConfig& config, PuyoWorkerPool& pool, PuyoTranspositionTable* table)
+    {
+        constexpr uint32_t GAME_SEED = 1;
+
+        std::mt19937 rng(GAME_SEED);
+        PuyoEngine engine(GAME_SEED);
+
+        std::array<PuyoPair, PuyoSearchRequest::MAX_PAIRS> pairs{};
+        for (auto& pair : pairs)
+        {
+            pair = RandomPair(rng);
+        }
+
+        GameStats stats;
+        PuyoChainResult chain;
+
+        for (int turn = 0; turn < turns; ++turn)
+        {
+            PuyoSearchRequest request;
+            request.board = engine.GetBoard();
+            request.pairs = pairs;
+            request.pair_count = static_cast<uint8_t>(pairs.size());
+            request.state = engine.GetChainState();
+
+            const auto result = PuyoBeamSearch::Search(request, config, &pool, nullptr, table);
+
+            stats.elapsed_us += result.elapsed_us;
+            stats.nodes += result.nodes;
+
+            if (!result.found || !engine.PlayTurn(pairs[0], result.placement.column, result.placement.rotation, chain) ||
+                engine.GetPhase() == PuyoPhase::GameOver)
+            {
+                break;
+            }
+
+            stats.moves.push_back(result.placement);
+
+            std::rotate(pairs.begin(), pairs.begin() + 1, pairs.end());
+            pairs.back() = RandomPair(rng);
+        }
+
+        stats.score = engine.GetScore();
+        return stats;
+    }
+
+    [[nodiscard]] bool IsSameMoves(const std::vector<PuyoPlacement>& a, const std::vector<PuyoPlacement>& b)
+    {
+        return std::equal(a.begin(), a.end(), b.begin(), b.end(),
+            [](const PuyoPlacement& l, const PuyoPlacement& r) { return l.column == r.column && l.rotation == r.rotation; });
+    }
+}
+
+int RunTranspositionBench(BenchArgs args)
+{
+    const int turns = GetBenchArg<int>(args, 0, 200);
+
+    std::vector<size_t> memory_kb;
+    for (size_t i = 1; i < args.size(); ++i)
+    {
+        memory_kb.push_back(GetBenchArg<size_t>(args, i, 0));
+    }
+    if (memory_kb.empty())
+    {
+        memory_kb = { 256, 4096, 65536 };
+    }
+
+    PuyoWorkerPool pool;
+
+    std::printf("transposition (%d turns, %zu threads)\n", turns, pool.GetThreadCount());
+    RunHashBench();
+
+    for (const auto level : { PuyoCpuLevel::Normal, PuyoCpuLevel::Hard })
+    {
+        auto config = PuyoBeamSearch::GetLevelConfig(level);
+
+        // 탐색 시간 예산으로 결과가 달라지지 않도록 예산을 없앰 (수 비교용)
+        config.time_budget_us = std::numeric_limits<uint32_t>::max();
+
+        const auto baseline = PlayGame(turns, config, pool, nullptr);
+        const double moves = static_cast<double>(std::max<size_t>(baseline.moves.size(), 1));
+
+        std::printf("  %s (width %u, depth %u)\n", level == PuyoCpuLevel::Hard ? "hard" : "normal", config.beam_width, config.depth);
+        std::printf("    no table   : %7.2f ms/move, %6.0f boards/move, score %u\n", static_cast<double>(baseline.elapsed_us) / moves / 1000.0,
+            static_cast<double>(baseline.nodes) / moves, baseline.score);
+
+        for (const size_t kb : memory_kb)
+        {
+            PuyoTranspositionTable table(kb << 10);
+            const auto stats = PlayGame(turns, config, pool, &table);
+            const auto table_stats = table.GetStats();
+            const double table_moves = static_cast<double>(std::max<size_t>(stats.moves.size(), 1));
+
+            std::printf("    %6zu KB  : %7.2f ms/move, hit %5.1f%%, replaced %llu/%llu stores, same moves %s\n", table.GetMemoryBytes() >> 10,
+                static_cast<double>(stats.elapsed_us) / table_moves / 1000.0, table_stats.GetHitRate() * 100.0,
+                static_cast<unsigned long long>(table_stats.replacements), static_cast<unsigned long long>(table_stats.stores),
+                IsSameMoves(baseline.moves, stats.moves) ? "yes" : "no");
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,122 @@
+#pragma once
+/*
+ *
+ * 설명: 고정 간격 시뮬레이션 스텝을 위한 누적 시계
+ *  1. 프레임마다 실제 경과 시간을 누적하고, 누적값이 스텝 간격 이상인 동안 한 스텝씩 꺼냄(ConsumeStep).
+ *     게임 로직은 항상 같은 deltaTime으로 갱신되므로 프레임 속도와 관계없이 낙하 속도/연출 시간이 같고 피어 간 오차가 쌓이지 않음.
+ *  2. 스파이크 보호: 한 프레임의 경과 시간은 max_frame_time으로 자르고, 한 프레임에 진행하는 스텝 수도 max_steps로 제한.
+ *     제한을 넘은 시간은 버려서 따라잡기 때문에 프레임이 더 느려지는 악순환을 막음.
+ *  3. 스텝을 모두 꺼낸 뒤 남은 누적값 / 스텝 간격 = 보간 비율(GetAlpha). 렌더링은 직전 스텝과 현재 스텝 사이를 이 비율로 보간.
+ *  4. 최근 WINDOW 프레임의 평균/최대 프레임 시간과 따라잡은 프레임, 자른 프레임, 버린 시간 통계.
+ *
+ */
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+struct FrameStats
+{
+    uint64_t frames{ 0 };
+    uint64_t steps{ 0 };
+    uint64_t catch_up_frames{ 0 };  // 한 프레임에 스텝을 두 번 이상 진행한 프레임
+    uint64_t clamped_frames{ 0 };   // 경과 시간이 max_frame_time을 넘어 잘린 프레임
+    double dropped_time{ 0.0 };     // 잘리거나 스텝 상한으로 버린 시간 (초)
+
+    float average_frame_time{ 0.0f };  // 최근 WINDOW 프레임 기준 (초)
+    float max_frame_time{ 0.0f };
+};
+
+class FixedStepClock
+{
+public:
+    static constexpr size_t WINDOW = 120;
+
+    FixedStepClock(float step, float max_frame_time, uint32_t max_steps)
+        : step_(step), max_frame_time_(max_frame_time), max_steps_(std::max<uint32_t>(max_steps, 1))
+    {
+    }
+
+    // 프레임 시작. 실제 경과 시간(초)을 누적
+    void BeginFrame(float frame_time)
+    {
+        frame_times_[stats_.frames % WINDOW] = frame_time;
+        ++stats_.frames;
+
+        if (frame_time > max_frame_time_)
+        {
+            ++stats_.clamped_frames;
+            stats_.dropped_time += frame_time - max_frame_time_;
+            frame_time = max_frame_time_;
+        }
+
+        accumulator_ += std::max(frame_time, 0.0f);
+        frame_steps_ = 0;
+    }
+
+    // 진행할 스텝이 남아 있으면 하나를 꺼내고 true
+    [[nodiscard]] bool ConsumeStep()
+    {
+        if (accumulator_ < step_)
+        {
+            return false;
+        }
+
+        if (frame_steps_ >= max_steps_)
+        {
+            // 상한 도달: 밀린 스텝은 버리고 보간용 나머지만 유지
+            const double remainder = std::fmod(accumulator_, static_cast<double>(step_));
+            stats_.dropped_time += accumulator_ - remainder;
+            accumulator_ = remainder;
+            return false;
+        }
+
+        accumulator_ -= step_;
+        ++frame_steps_;
+        ++stats_.steps;
+
+        if (frame_steps_ == 2)
+        {
+            ++stats_.catch_up_frames;
+        }
+
+        return true;
+    }
+
+    [[nodiscard]] float GetStep() const { return step_; }
+
+    // 0 ~ 1, 직전 스텝에서 다음 스텝까지 진행된 비율
+    [[nodiscard]] float GetAlpha() const { return std::clamp(static_cast<float>(accumulator_ / step_), 0.0f, 1.0f); }
+
+    [[nodiscard]] FrameStats GetStats() const
+    {
+        FrameStats stats = stats_;
+
+        const size_t count = static_cast<size_t>(std::min<uint64_t>(stats_.frames, WINDOW));
+        if (count > 0)
+        {
+            float total = 0.0f;
+            for (size_t i = 0; i < count; ++i)
+            {
+                total += frame_times_[i];
+                stats.max_frame_time = std::max(stats.max_frame_time, frame_times_[i]);
+            }
+            stats.average_frame_time = total / static_cast<float>(count);
+        }
+
+        return stats;
+    }
+
+private:
+    float step_;
+    float max_frame_time_;
+    uint32_t max_steps_;
+
+    double accumulator_{ 0.0 };
+    uint32_t frame_steps_{ 0 };
+
+    FrameStats stats_;
+    std::array<float, WINDOW> frame_times_{};
+};
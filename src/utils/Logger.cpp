@@ -2,8 +2,10 @@
 #include <Windows.h>
 #include <format>
 #include <iostream>
+#ifndef PUZZLE_HEADLESS
 #include <SDL3/SDL_log.h>
 #include <SDL3/SDL_oldnames.h>
+#endif
 
 Logger& Logger::GetInstance() {
     static Logger instance;
@@ -27,7 +29,9 @@ bool Logger::Initialize(const std::filesystem::path& logDir)
 
         current_log_file_.reset(file);
 
+#ifndef PUZZLE_HEADLESS
         InitializeSDLLogging();
+#endif
 
         return true;
     }
@@ -105,6 +109,7 @@ std::string_view Logger::LogLevelToString(LogLevel level)
     }
 }
 
+#ifndef PUZZLE_HEADLESS
 // SDL α׸ Logger Ŭ ϴ ݹ Լ
 void Logger::SDLLogOutputFunction(void* userdata, int category, SDL_LogPriority priority, const char* message) {
     Logger& logger = *static_cast<Logger*>(userdata);
@@ -226,4 +231,5 @@ void Logger::SDLLogCritical(int category, const char* fmt, ...)
     va_start(args, fmt);
     SDL_LogMessageV(category, SDL_LOG_PRIORITY_CRITICAL, fmt, args);
     va_end(args);
-}
\ No newline at end of file
+}
+#endif
\ No newline at end of file
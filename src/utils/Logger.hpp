@@ -10,7 +10,10 @@
 #include <stdexcept>
 #include <Windows.h>
 
+// 帮 (/߰/ġ) PUZZLE_HEADLESS  SDL α   
+#ifndef PUZZLE_HEADLESS
 #include <SDL3/SDL_log.h>
+#endif
 
 enum class LogLevel {
     Debug,
@@ -29,8 +32,10 @@ public:
     Logger(Logger&&) = delete;
     Logger& operator=(Logger&&) = delete;
 
+#ifndef PUZZLE_HEADLESS
     static void SDLLogOutputFunction(void* userdata, int category, SDL_LogPriority priority, const char* message);
     void InitializeSDLLogging();
+#endif
 
     template<typename... Args>
     void Debug(std::format_string<Args...> fmt, Args&&... args);
@@ -57,6 +62,7 @@ public:
     void SetLogToDebugger(bool enable) { log_to_debugger_ = enable; }
     void SetLogLevel(LogLevel level) { log_level_ = level; }
 
+#ifndef PUZZLE_HEADLESS
     // SDL α  ´ Լ
     void SDLLogVerbose(int category, const char* fmt, ...);
     void SDLLogDebug(int category, const char* fmt, ...);
@@ -64,6 +70,7 @@ public:
     void SDLLogWarn(int category, const char* fmt, ...);
     void SDLLogError(int category, const char* fmt, ...);
     void SDLLogCritical(int category, const char* fmt, ...);
+#endif
 
 private:
     Logger() = default;
@@ -185,9 +192,11 @@ void Logger::Log(LogLevel level,
 #define LOG_ERROR(...) LOGGER.Error(__VA_ARGS__)
 #define LOG_CRITICAL(...) LOGGER.Critical(__VA_ARGS__)
 
+#ifndef PUZZLE_HEADLESS
 #define SDL_LOG_VERBOSE(category, ...) LOGGER.SDLLogVerbose(category, __VA_ARGS__)
 #define SDL_LOG_DEBUG(category, ...) LOGGER.SDLLogDebug(category, __VA_ARGS__)
 #define SDL_LOG_INFO(category, ...) LOGGER.SDLLogInfo(category, __VA_ARGS__)
 #define SDL_LOG_WARN(category, ...) LOGGER.SDLLogWarn(category, __VA_ARGS__)
 #define SDL_LOG_ERROR(category, ...) LOGGER.SDLLogError(category, __VA_ARGS__)
-#define SDL_LOG_CRITICAL(category, ...) LOGGER.SDLLogCritical(category, __VA_ARGS__)
\ No newline at end of file
+#define SDL_LOG_CRITICAL(category, ...) LOGGER.SDLLogCritical(category, __VA_ARGS__)
+#endif
\ No newline at end of file
@@ -0,0 +1,343 @@
+#pragma once
+/*
+ *
+ * 설명: 게임 전체가 함께 쓰는 빠른 난수 서비스 (xoshiro 엔진 + 스트림별/스레드별 시드)
+ *  1. 엔진은 xoshiro256++(64비트 출력). UniformRandomBitGenerator 요건을 만족하므로 std::shuffle 등에도 사용 가능.
+ *  2. 범위 변환은 표준 분포 객체 대신 곱셈-시프트(정수)와 24비트 가수(실수)로 직접 계산하므로
+ *     같은 시드는 플랫폼/표준 라이브러리 구현에 관계없이 같은 값을 냄.
+ *  3. 스트림(RandomStream)마다, 스레드마다 따로 엔진을 두고 시드는 (마스터 시드, 스트림, 스레드 번호)에서 유도.
+ *     thread_local이므로 잠금이 없고, random_device는 마스터 시드를 만들 때 한 번만 사용.
+ *  4. 결정적 모드: SetSeed로 마스터 시드를 고정하면 모든 스레드의 엔진이 다음 사용 때 다시 시드됨 (리플레이/재현용).
+ *     스레드 번호는 처음 사용하는 순서로 정해지므로 재현이 필요한 스트림은 한 스레드에서만 사용.
+ *  5. 파티클처럼 난수를 한꺼번에 많이 쓰는 곳은 Fill로 묶어서 생성 (x86-64는 SSE2로 4개 레인 xoshiro128+ 동시 진행).
+ *
+ */
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <type_traits>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(_M_AMD64)
+#define RANDOM_SSE2 1
+#include <emmintrin.h>
+#else
+#define RANDOM_SSE2 0
+#endif
+
+enum class RandomStream : uint8_t
+{
+    Default,        // 분류 없는 일반 사용
+    Gameplay,       // 게임 결과에 영향을 주는 값 (방해 블록 위치 등)
+    Effects,        // 파티클/연출
+    Ui,             // 화면/메뉴
+    Map,            // 맵 선택
+    Count
+};
+
+namespace RandomDetail
+{
+    [[nodiscard]] constexpr uint64_t SplitMix64(uint64_t& state)
+    {
+        uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    [[nodiscard]] constexpr uint64_t Rotl(uint64_t value, int shift)
+    {
+        return (value << shift) | (value >> (64 - shift));
+    }
+
+    [[nodiscard]] inline uint64_t MakeRandomSeed()
+    {
+        std::random_device rd;
+        return rd() | (static_cast<uint64_t>(rd()) << 32);
+    }
+
+    // [0, 1) 실수 (상위 24비트 사용)
+    [[nodiscard]] constexpr float ToUnitFloat(uint32_t bits)
+    {
+        return static_cast<float>(bits >> 8) * (1.0f / 16777216.0f);
+    }
+}
+
+// xoshiro256++ (Blackman, Vigna)
+class Xoshiro256
+{
+public:
+    using result_type = uint64_t;
+
+    explicit constexpr Xoshiro256(uint64_t seed = 0) { Seed(seed); }
+
+    constexpr void Seed(uint64_t seed)
+    {
+        // 상태가 모두 0이 되지 않도록 splitmix64로 펼침
+        for (auto& word : state_)
+        {
+            word = RandomDetail::SplitMix64(seed);
+        }
+    }
+
+    [[nodiscard]] static constexpr result_type min() { return 0; }
+    [[nodiscard]] static constexpr result_type max() { return ~result_type{ 0 }; }
+
+    constexpr result_type operator()()
+    {
+        const uint64_t result = RandomDetail::Rotl(state_[0] + state_[3], 23) + state_[0];
+        const uint64_t t = state_[1] << 17;
+
+        state_[2] ^= state_[0];
+        state_[3] ^= state_[1];
+        state_[1] ^= state_[2];
+        state_[0] ^= state_[3];
+        state_[2] ^= t;
+        state_[3] = RandomDetail::Rotl(state_[3], 45);
+
+        return result;
+    }
+
+    // [0, bound) 정수 (곱셈-시프트, bound가 작으면 편향은 무시할 수준)
+    [[nodiscard]] constexpr uint32_t NextBelow(uint32_t bound)
+    {
+        return static_cast<uint32_t>(((operator()() >> 32) * bound) >> 32);
+    }
+
+    // [0, 1) 실수
+    [[nodiscard]] constexpr float NextFloat()
+    {
+        return RandomDetail::ToUnitFloat(static_cast<uint32_t>(operator()() >> 32));
+    }
+
+    // [min, max] 정수, [min, max) 실수
+    template<typename T>
+    [[nodiscard]] constexpr T Range(T min, T max)
+    {
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            return min + static_cast<T>(NextFloat()) * (max - min);
+        }
+        else
+        {
+            const auto count = static_cast<uint64_t>(static_cast<int64_t>(max) - static_cast<int64_t>(min)) + 1;
+            const auto offset = count > 0xFFFFFFFFull ? operator()() % count : NextBelow(static_cast<uint32_t>(count));
+            return static_cast<T>(static_cast<int64_t>(min) + static_cast<int64_t>(offset));
+        }
+    }
+
+private:
+    std::array<uint64_t, 4> state_{};
+};
+
+// xoshiro128+ 4개 레인. 실수 배열을 한꺼번에 채울 때 사용 (x86-64는 SSE2로 4개 레인을 동시에 진행)
+class Xoshiro128x4
+{
+public:
+    static constexpr size_t LANES = 4;
+
+    explicit Xoshiro128x4(uint64_t seed = 0) { Seed(seed); }
+
+    void Seed(uint64_t seed)
+    {
+        for (auto& lane_state : state_)
+        {
+            for (auto& lane : lane_state)
+            {
+                lane = static_cast<uint32_t>(RandomDetail::SplitMix64(seed) >> 32) | 1u;
+            }
+        }
+    }
+
+    // [0, 1) 실수로 채움
+    void Fill(std::span<float> out)
+    {
+        size_t i = 0;
+
+#if RANDOM_SSE2
+        __m128i s0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(state_[0].data()));
+        __m128i s1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(state_[1].data()));
+        __m128i s2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(state_[2].data()));
+        __m128i s3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(state_[3].data()));
+        const __m128 scale = _mm_set1_ps(1.0f / 16777216.0f);
+
+        for (; i + LANES <= out.size(); i += LANES)
+        {
+            const __m128i result = _mm_add_epi32(s0, s3);
+            const __m128i t = _mm_slli_epi32(s1, 9);
+
+            s2 = _mm_xor_si128(s2, s0);
+            s3 = _mm_xor_si128(s3, s1);
+            s1 = _mm_xor_si128(s1, s2);
+            s0 = _mm_xor_si128(s0, s3);
+            s2 = _mm_xor_si128(s2, t);
+            s3 = _mm_or_si128(_mm_slli_epi32(s3, 11), _mm_srli_epi32(s3, 21));
+
+            // 상위 24비트는 int32 범위 안이므로 부호 있는 변환을 그대로 사용
+            _mm_storeu_ps(out.data() + i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(result, 8)), scale));
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(state_[0].data()), s0);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(state_[1].data()), s1);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(state_[2].data()), s2);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(state_[3].data()), s3);
+#endif
+
+        // 스칼라 경로 (SSE2 경로와 같은 순서/값)
+        while (i < out.size())
+        {
+            const auto results = NextScalar();
+            for (size_t lane = 0; lane < LANES && i < out.size(); ++lane, ++i)
+            {
+                out[i] = RandomDetail::ToUnitFloat(results[lane]);
+            }
+        }
+    }
+
+    // [min, max) 실수로 채움
+    void Fill(std::span<float> out, float min, float max)
+    {
+        Fill(out);
+
+        const float range = max - min;
+        for (auto& value : out)
+        {
+            value = min + value * range;
+        }
+    }
+
+private:
+    [[nodiscard]] std::array<uint32_t, LANES> NextScalar()
+    {
+        std::array<uint32_t, LANES> results{};
+
+        for (size_t lane = 0; lane < LANES; ++lane)
+        {
+            uint32_t& s0 = state_[0][lane];
+            uint32_t& s1 = state_[1][lane];
+            uint32_t& s2 = state_[2][lane];
+            uint32_t& s3 = state_[3][lane];
+
+            results[lane] = s0 + s3;
+            const uint32_t t = s1 << 9;
+
+            s2 ^= s0;
+            s3 ^= s1;
+            s1 ^= s2;
+            s0 ^= s3;
+            s2 ^= t;
+            s3 = (s3 << 11) | (s3 >> 21);
+        }
+
+        return results;
+    }
+
+private:
+    // state_[word][lane]
+    std::array<std::array<uint32_t, LANES>, 4> state_{};
+};
+
+namespace RandomService
+{
+    namespace Detail
+    {
+        inline constexpr size_t STREAM_COUNT = static_cast<size_t>(RandomStream::Count);
+
+        struct Global
+        {
+            std::atomic<uint64_t> seed{ RandomDetail::MakeRandomSeed() };
+            std::atomic<uint32_t> generation{ 1 };
+            std::atomic<uint32_t> next_thread{ 0 };
+            std::atomic<bool> deterministic{ false };
+        };
+
+        [[nodiscard]] inline Global& GetGlobal()
+        {
+            static Global global;
+            return global;
+        }
+
+        struct ThreadEngines
+        {
+            std::array<Xoshiro256, STREAM_COUNT> engines;
+            std::array<Xoshiro128x4, STREAM_COUNT> batches;
+            uint32_t thread_index{ GetGlobal().next_thread.fetch_add(1, std::memory_order_relaxed) };
+            uint32_t generation{ 0 };
+        };
+
+        [[nodiscard]] inline uint64_t DeriveSeed(uint64_t seed, size_t stream, uint32_t thread_index, uint64_t salt)
+        {
+            uint64_t state = seed ^ (static_cast<uint64_t>(stream) << 56) ^ (static_cast<uint64_t>(thread_index) << 32) ^ salt;
+            return RandomDetail::SplitMix64(state);
+        }
+
+        [[nodiscard]] inline ThreadEngines& GetThreadEngines()
+        {
+            thread_local ThreadEngines engines;
+
+            // 시드가 바뀌었으면 이 스레드의 모든 스트림을 다시 시드
+            auto& global = GetGlobal();
+            const uint32_t generation = global.generation.load(std::memory_order_acquire);
+            if (engines.generation != generation)
+            {
+                const uint64_t seed = global.seed.load(std::memory_order_relaxed);
+                for (size_t stream = 0; stream < STREAM_COUNT; ++stream)
+                {
+                    engines.engines[stream].Seed(DeriveSeed(seed, stream, engines.thread_index, 0));
+                    engines.batches[stream].Seed(DeriveSeed(seed, stream, engines.thread_index, 0xB47C4ull));
+                }
+                engines.generation = generation;
+            }
+
+            return engines;
+        }
+    }
+
+    // 결정적 모드: 마스터 시드 고정 (모든 스레드의 엔진이 다음 사용 때 다시 시드됨)
+    inline void SetSeed(uint64_t seed)
+    {
+        auto& global = Detail::GetGlobal();
+        global.seed.store(seed, std::memory_order_relaxed);
+        global.deterministic.store(true, std::memory_order_relaxed);
+        global.generation.fetch_add(1, std::memory_order_release);
+    }
+
+    // 결정적 모드 해제 (random_device로 새 마스터 시드)
+    inline void SetRandomSeed()
+    {
+        auto& global = Detail::GetGlobal();
+        global.seed.store(RandomDetail::MakeRandomSeed(), std::memory_order_relaxed);
+        global.deterministic.store(false, std::memory_order_relaxed);
+        global.generation.fetch_add(1, std::memory_order_release);
+    }
+
+    [[nodiscard]] inline uint64_t GetSeed() { return Detail::GetGlobal().seed.load(std::memory_order_relaxed); }
+    [[nodiscard]] inline bool IsDeterministic() { return Detail::GetGlobal().deterministic.load(std::memory_order_relaxed); }
+
+    // 현재 스레드의 스트림 엔진
+    [[nodiscard]] inline Xoshiro256& GetEngine(RandomStream stream = RandomStream::Default)
+    {
+        return Detail::GetThreadEngines().engines[static_cast<size_t>(stream)];
+    }
+
+    template<typename T>
+    [[nodiscard]] inline T Range(T min, T max, RandomStream stream = RandomStream::Default)
+    {
+        return GetEngine(stream).Range(min, max);
+    }
+
+    // 실수 배열을 한꺼번에 [min, max)로 채움
+    inline void Fill(std::span<float> out, float min, float max, RandomStream stream = RandomStream::Effects)
+    {
+        Detail::GetThreadEngines().batches[static_cast<size_t>(stream)].Fill(out, min, max);
+    }
+
+    // [0, 1)로 채움
+    inline void Fill(std::span<float> out, RandomStream stream = RandomStream::Effects)
+    {
+        Detail::GetThreadEngines().batches[static_cast<size_t>(stream)].Fill(out);
+    }
+}
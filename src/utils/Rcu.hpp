@@ -0,0 +1,341 @@
+#pragma once
+/*
+ *
+ * 설명: 읽기 위주 데이터를 위한 RCU(read-copy-update) 포인터와 에포크 기반 회수
+ *  1. 읽기: RcuPtr::Read()가 반환한 가드가 살아 있는 동안 잠금/복사 없이 스냅샷을 읽음.
+ *  2. 쓰기: 새 스냅샷을 만들어 Publish로 원자적 교체. 쓰기끼리의 직렬화는 호출 측 책임.
+ *  3. 회수: 교체된 스냅샷은 교체 시점 이전에 진입한 읽기 가드가 모두 빠져나간 뒤에 삭제.
+ *  4. 읽기 스레드는 처음 진입할 때 슬롯을 하나 빌리고 스레드가 끝나면 반납 (IOCP 작업 스레드처럼 생겼다 사라지는 스레드 대비).
+ *     슬롯이 모두 사용 중이면 공유 잠금으로 읽고, 회수는 그 잠금을 배타적으로 잡을 수 있을 때만 진행.
+ *
+ */
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <vector>
+
+class EpochDomain
+{
+public:
+    static constexpr size_t MAX_READER_THREAD = 64;
+
+    EpochDomain() : table_(std::make_shared<SlotTable>()) {}
+    ~EpochDomain() { ReclaimAll(); }
+
+    EpochDomain(const EpochDomain&) = delete;
+    EpochDomain& operator=(const EpochDomain&) = delete;
+
+    // 읽기 구간 진입/이탈 (같은 스레드에서 중첩 가능)
+    void Enter()
+    {
+        ThreadEntry& entry = GetThreadEntry();
+        if (entry.depth++ > 0)
+        {
+            return;
+        }
+
+        if (!entry.slot)
+        {
+            entry.slot = table_->Acquire();
+        }
+
+        if (entry.slot)
+        {
+            // 진입 에포크를 게시한 뒤 포인터를 읽어야 하므로 seq_cst로 순서 보장
+            entry.slot->epoch.store(global_epoch_.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+        }
+        else
+        {
+            // 빈 슬롯이 없으면 회수가 진행 중인 동안만 기다리는 공유 잠금으로 읽음
+            table_->overflow_mutex.lock_shared();
+        }
+    }
+
+    void Exit()
+    {
+        ThreadEntry& entry = GetThreadEntry();
+        if (--entry.depth > 0)
+        {
+            return;
+        }
+
+        if (entry.slot)
+        {
+            entry.slot->epoch.store(INACTIVE, std::memory_order_release);
+        }
+        else
+        {
+            table_->overflow_mutex.unlock_shared();
+        }
+    }
+
+    // 교체된 객체를 회수 대기열에 추가
+    template<typename T>
+    void Retire(const T* object)
+    {
+        if (!object)
+        {
+            return;
+        }
+
+        {
+            std::lock_guard lock(retire_mutex_);
+
+            // 현재 에포크에 진입한 읽기는 이전 포인터를 볼 수 있으므로 이 에포크를 기록하고 다음 에포크로 넘김
+            const uint64_t epoch = global_epoch_.fetch_add(1, std::memory_order_seq_cst);
+            retired_.push_back(Retired{ object, [](const void* ptr) { delete static_cast<const T*>(ptr); }, epoch });
+        }
+
+        Reclaim();
+    }
+
+    // 모든 활성 읽기의 진입 에포크보다 이전에 교체된 객체 삭제
+    void Reclaim()
+    {
+        // 이 스레드가 공유 잠금으로 읽는 중이면 배타 잠금을 시도할 수 없으므로 다음 회수로 미룸
+        const ThreadEntry& entry = GetThreadEntry();
+        if (entry.depth > 0 && !entry.slot)
+        {
+            return;
+        }
+
+        // 슬롯 없이 읽는 스레드가 있으면 건너뜀 (남은 객체는 다음 Retire/Reclaim에서 회수)
+        std::unique_lock overflow_lock(table_->overflow_mutex, std::try_to_lock);
+        if (!overflow_lock.owns_lock())
+        {
+            return;
+        }
+
+        const uint64_t min_epoch = GetMinActiveEpoch();
+
+        std::vector<Retired> reclaimable;
+        {
+            std::lock_guard lock(retire_mutex_);
+
+            size_t i = 0;
+            while (i < retired_.size())
+            {
+                if (retired_[i].epoch < min_epoch)
+                {
+                    reclaimable.push_back(retired_[i]);
+                    retired_[i] = retired_.back();
+                    retired_.pop_back();
+                }
+                else
+                {
+                    ++i;
+                }
+            }
+        }
+
+        for (const auto& retired : reclaimable)
+        {
+            retired.deleter(retired.object);
+        }
+    }
+
+    [[nodiscard]] size_t GetRetiredCount()
+    {
+        std::lock_guard lock(retire_mutex_);
+        return retired_.size();
+    }
+
+private:
+    static constexpr uint64_t INACTIVE = UINT64_MAX;
+
+    struct alignas(64) ReaderSlot
+    {
+        std::atomic<uint64_t> epoch{ INACTIVE };
+        std::atomic<bool> in_use{ false };
+
+        void Release()
+        {
+            epoch.store(INACTIVE, std::memory_order_release);
+            in_use.store(false, std::memory_order_release);
+        }
+    };
+
+    // 스레드 쪽 항목이 공유하므로 도메인이 먼저 사라져도 스레드 종료 시 슬롯 반납이 안전
+    struct SlotTable
+    {
+        std::array<ReaderSlot, MAX_READER_THREAD> slots{};
+        std::shared_mutex overflow_mutex;
+
+        [[nodiscard]] ReaderSlot* Acquire()
+        {
+            for (auto& slot : slots)
+            {
+                bool expected = false;
+                if (!slot.in_use.load(std::memory_order_relaxed) &&
+                    slot.in_use.compare_exchange_strong(expected, true, std::memory_order_acq_rel))
+                {
+                    return &slot;
+                }
+            }
+
+            return nullptr;
+        }
+    };
+
+    struct ThreadEntry
+    {
+        std::shared_ptr<SlotTable> table;
+        ReaderSlot* slot{ nullptr };    // 없으면 공유 잠금으로 읽음
+        uint32_t depth{ 0 };
+    };
+
+    // 스레드가 끝날 때 빌린 슬롯을 모두 반납
+    struct ThreadEntries
+    {
+        std::vector<ThreadEntry> entries;
+
+        ~ThreadEntries()
+        {
+            for (auto& entry : entries)
+            {
+                if (entry.slot)
+                {
+                    entry.slot->Release();
+                }
+            }
+        }
+    };
+
+    struct Retired
+    {
+        const void* object{ nullptr };
+        void (*deleter)(const void*) { nullptr };
+        uint64_t epoch{ 0 };
+    };
+
+    ThreadEntry& GetThreadEntry()
+    {
+        thread_local ThreadEntries thread_entries;
+        auto& entries = thread_entries.entries;
+
+        for (auto& entry : entries)
+        {
+            if (entry.table == table_)
+            {
+                return entry;
+            }
+        }
+
+        // 이 스레드만 테이블을 잡고 있는 항목 = 사라진 도메인
+        std::erase_if(entries, [](const ThreadEntry& entry) { return entry.table.use_count() == 1 && entry.depth == 0; });
+
+        entries.push_back(ThreadEntry{ table_ });
+        return entries.back();
+    }
+
+    [[nodiscard]] uint64_t GetMinActiveEpoch() const
+    {
+        uint64_t min_epoch = global_epoch_.load(std::memory_order_seq_cst);
+
+        for (const auto& slot : table_->slots)
+        {
+            min_epoch = std::min(min_epoch, slot.epoch.load(std::memory_order_seq_cst));
+        }
+
+        return min_epoch;
+    }
+
+    void ReclaimAll()
+    {
+        for (const auto& retired : retired_)
+        {
+            retired.deleter(retired.object);
+        }
+
+        retired_.clear();
+    }
+
+private:
+    std::atomic<uint64_t> global_epoch_{ 1 };
+    std::shared_ptr<SlotTable> table_;
+
+    std::mutex retire_mutex_;
+    std::vector<Retired> retired_;
+};
+
+// 읽기 가드: 살아 있는 동안 스냅샷이 회수되지 않음
+template<typename T>
+class RcuReadGuard
+{
+public:
+    RcuReadGuard(EpochDomain& domain, const std::atomic<const T*>& source) : domain_(&domain)
+    {
+        domain_->Enter();
+        value_ = source.load(std::memory_order_seq_cst);
+    }
+
+    ~RcuReadGuard()
+    {
+        if (domain_)
+        {
+            domain_->Exit();
+        }
+    }
+
+    RcuReadGuard(const RcuReadGuard&) = delete;
+    RcuReadGuard& operator=(const RcuReadGuard&) = delete;
+
+    RcuReadGuard(RcuReadGuard&& other) noexcept : domain_(other.domain_), value_(other.value_)
+    {
+        other.domain_ = nullptr;
+        other.value_ = nullptr;
+    }
+
+    RcuReadGuard& operator=(RcuReadGuard&&) = delete;
+
+    [[nodiscard]] const T* get() const { return value_; }
+    [[nodiscard]] const T& operator*() const { return *value_; }
+    [[nodiscard]] const T* operator->() const { return value_; }
+    [[nodiscard]] explicit operator bool() const { return value_ != nullptr; }
+
+private:
+    EpochDomain* domain_{ nullptr };
+    const T* value_{ nullptr };
+};
+
+template<typename T>
+class RcuPtr
+{
+public:
+    explicit RcuPtr(std::unique_ptr<T> initial = std::make_unique<T>()) : value_(initial.release()) {}
+
+    ~RcuPtr()
+    {
+        delete value_.load(std::memory_order_acquire);
+    }
+
+    RcuPtr(const RcuPtr&) = delete;
+    RcuPtr& operator=(const RcuPtr&) = delete;
+
+    [[nodiscard]] RcuReadGuard<T> Read() const
+    {
+        return RcuReadGuard<T>(domain_, value_);
+    }
+
+    // 쓰기 측 전용 (호출 측에서 직렬화)
+    void Publish(std::unique_ptr<T> next)
+    {
+        // 읽기 측 진입(에포크 게시 후 포인터 읽기)과의 순서를 위해 seq_cst
+        const T* previous = value_.exchange(next.release(), std::memory_order_seq_cst);
+        domain_.Retire(previous);
+    }
+
+    // 쓰기 측에서 현재 스냅샷을 읽음 (새 스냅샷을 만들 때 사용)
+    [[nodiscard]] const T* GetCurrent() const { return value_.load(std::memory_order_acquire); }
+
+    void Reclaim() { domain_.Reclaim(); }
+
+private:
+    mutable EpochDomain domain_;
+    std::atomic<const T*> value_;
+};
@@ -0,0 +1,193 @@
+#pragma once
+/*
+ *
+ * 설명: 세대(generation) 카운터를 가진 슬롯 맵
+ *  1. id = 하위 32비트 슬롯 인덱스 + 상위 32비트 세대. 0은 유효하지 않은 id.
+ *     32비트 하나에 담으면 10만 슬롯(17비트)에 세대가 15비트만 남아 자주 재사용되는 슬롯이 3만여 번 만에 폐기되므로
+ *     세대 폭을 위해 64비트로 둠. 서버 내부 핸들이라 패킷에는 실리지 않음 (클라이언트가 보는 id는 uint8_t player_id).
+ *  2. 삭제 시 슬롯의 세대를 올리므로 재사용된 슬롯에 대한 이전 id 조회는 실패 (id 재사용 문제 방지).
+ *     세대가 한 바퀴 돌면 그 슬롯은 빈 목록에 돌려놓지 않고 폐기하므로 같은 id가 다시 나오지 않음.
+ *  3. 값은 연속 배열에 보관하고 삭제는 마지막 원소와 교체 (조회/삽입/삭제 O(1), 순회는 캐시 친화적).
+ *  4. 동기화는 사용하는 쪽 책임.
+ *
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+using SlotId = uint64_t;
+
+inline constexpr SlotId INVALID_SLOT_ID = 0;
+
+template<typename T>
+class SlotMap
+{
+public:
+    static constexpr uint32_t INDEX_BITS = 32;
+    static constexpr SlotId INDEX_MASK = (SlotId{ 1 } << INDEX_BITS) - 1;
+    static constexpr size_t MAX_SLOT_COUNT = UINT32_MAX - 1;   // UINT32_MAX는 빈 목록 끝 표시
+
+    class Iterator
+    {
+    public:
+        Iterator(SlotMap* owner, size_t pos) : owner_(owner), pos_(pos) {}
+
+        // 범위 기반 for에서 [id, value]로 분해해 사용
+        [[nodiscard]] std::pair<SlotId, T&> operator*() const
+        {
+            return { owner_->dense_ids_[pos_], owner_->values_[pos_] };
+        }
+
+        Iterator& operator++() { ++pos_; return *this; }
+        [[nodiscard]] bool operator==(const Iterator& other) const { return pos_ == other.pos_; }
+
+    private:
+        SlotMap* owner_{ nullptr };
+        size_t pos_{ 0 };
+    };
+
+    SlotMap() = default;
+
+    void Reserve(size_t count)
+    {
+        slots_.reserve(count);
+        values_.reserve(count);
+        dense_ids_.reserve(count);
+    }
+
+    // 가득 찼으면 INVALID_SLOT_ID 반환
+    [[nodiscard]] SlotId Insert(T value)
+    {
+        uint32_t index = 0;
+
+        if (free_head_ != NO_FREE_SLOT)
+        {
+            index = free_head_;
+            free_head_ = slots_[index].next_free;
+        }
+        else
+        {
+            if (slots_.size() >= MAX_SLOT_COUNT)
+            {
+                return INVALID_SLOT_ID;
+            }
+
+            index = static_cast<uint32_t>(slots_.size());
+            slots_.push_back(Slot{});
+        }
+
+        Slot& slot = slots_[index];
+        slot.dense_index = static_cast<uint32_t>(values_.size());
+        slot.occupied = true;
+
+        const SlotId id = MakeId(index, slot.generation);
+        values_.push_back(std::move(value));
+        dense_ids_.push_back(id);
+
+        return id;
+    }
+
+    [[nodiscard]] T* Find(SlotId id)
+    {
+        const Slot* slot = FindSlot(id);
+        return slot ? &values_[slot->dense_index] : nullptr;
+    }
+
+    [[nodiscard]] const T* Find(SlotId id) const
+    {
+        const Slot* slot = FindSlot(id);
+        return slot ? &values_[slot->dense_index] : nullptr;
+    }
+
+    [[nodiscard]] bool Contains(SlotId id) const { return FindSlot(id) != nullptr; }
+
+    bool Erase(SlotId id)
+    {
+        if (FindSlot(id) == nullptr)
+        {
+            return false;
+        }
+
+        const uint32_t index = static_cast<uint32_t>(id & INDEX_MASK);
+        Slot& slot = slots_[index];
+        const uint32_t dense_index = slot.dense_index;
+        const uint32_t last = static_cast<uint32_t>(values_.size() - 1);
+
+        // 마지막 원소를 빈 자리로 옮기고 해당 슬롯의 위치 갱신
+        if (dense_index != last)
+        {
+            values_[dense_index] = std::move(values_[last]);
+            dense_ids_[dense_index] = dense_ids_[last];
+            slots_[dense_ids_[dense_index] & INDEX_MASK].dense_index = dense_index;
+        }
+
+        values_.pop_back();
+        dense_ids_.pop_back();
+
+        slot.occupied = false;
+
+        // 세대가 한 바퀴 돌면 이전 id와 겹칠 수 있으므로 슬롯을 폐기 (빈 목록에 넣지 않음)
+        if (slot.generation == UINT32_MAX)
+        {
+            return true;
+        }
+
+        ++slot.generation;
+        slot.next_free = free_head_;
+        free_head_ = index;
+
+        return true;
+    }
+
+    void Clear()
+    {
+        slots_.clear();
+        values_.clear();
+        dense_ids_.clear();
+        free_head_ = NO_FREE_SLOT;
+    }
+
+    [[nodiscard]] size_t Size() const { return values_.size(); }
+    [[nodiscard]] bool Empty() const { return values_.empty(); }
+
+    [[nodiscard]] Iterator begin() { return Iterator(this, 0); }
+    [[nodiscard]] Iterator end() { return Iterator(this, values_.size()); }
+
+private:
+    static constexpr uint32_t NO_FREE_SLOT = UINT32_MAX;
+
+    struct Slot
+    {
+        uint32_t generation{ 1 };
+        uint32_t dense_index{ 0 };
+        uint32_t next_free{ NO_FREE_SLOT };
+        bool occupied{ false };
+    };
+
+    [[nodiscard]] static SlotId MakeId(uint32_t index, uint32_t generation)
+    {
+        return (static_cast<SlotId>(generation) << INDEX_BITS) | index;
+    }
+
+    [[nodiscard]] const Slot* FindSlot(SlotId id) const
+    {
+        const uint32_t index = static_cast<uint32_t>(id & INDEX_MASK);
+        const uint32_t generation = static_cast<uint32_t>(id >> INDEX_BITS);
+
+        if (id == INVALID_SLOT_ID || index >= slots_.size())
+        {
+            return nullptr;
+        }
+
+        const Slot& slot = slots_[index];
+        return (slot.occupied && slot.generation == generation) ? &slot : nullptr;
+    }
+
+private:
+    std::vector<Slot> slots_;
+    std::vector<T> values_;
+    std::vector<SlotId> dense_ids_;
+    uint32_t free_head_{ NO_FREE_SLOT };
+};
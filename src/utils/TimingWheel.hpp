@@ -0,0 +1,324 @@
+#pragma once
+/*
+ *
+ * 설명: 계층형 타이밍 휠 (서버 타임아웃/예약 이벤트용)
+ *  1. 단계마다 64칸, 4단계 (틱 단위로 64^4 까지). 그보다 먼 타이머는 최상위 단계에 두었다가 내려올 때 다시 배치.
+ *  2. 예약/취소 O(1): 노드는 인덱스 기반 이중 연결 리스트로 연결하고 풀에서 재사용. id에 세대를 넣어 해제된 노드 재사용 구분.
+ *  3. Advance는 지난 틱들을 순서대로 처리하며 만료된 값들을 한 번에 모아서 반환 (콜백 없음, 처리는 호출 측).
+ *  4. 지연 시간은 마지막 Advance 시각 기준. 동기화는 사용하는 쪽 책임 (샤드/스레드마다 인스턴스 하나).
+ *
+ */
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+using TimerId = uint64_t;
+
+inline constexpr TimerId INVALID_TIMER_ID = 0;
+
+template<typename T>
+class TimingWheel
+{
+public:
+    static constexpr uint32_t SLOT_BITS = 6;
+    static constexpr uint32_t SLOT_COUNT = 1u << SLOT_BITS;
+    static constexpr uint32_t SLOT_MASK = SLOT_COUNT - 1;
+    static constexpr uint32_t LEVEL_COUNT = 4;
+    static constexpr uint64_t MAX_DELAY_TICKS = (uint64_t{ 1 } << (SLOT_BITS * LEVEL_COUNT)) - 1;
+
+    explicit TimingWheel(uint32_t tick_ms = 10, uint64_t start_ms = 0) :
+        tick_ms_(std::max<uint32_t>(tick_ms, 1)),
+        current_tick_(start_ms / tick_ms_)
+    {
+        for (auto& level : heads_)
+        {
+            level.fill(NIL);
+        }
+    }
+
+    TimingWheel(const TimingWheel&) = delete;
+    TimingWheel& operator=(const TimingWheel&) = delete;
+
+    void Reserve(size_t count) { nodes_.reserve(count); }
+
+    // delay_ms 뒤(틱 단위 올림)에 만료. 풀이 가득 차면 INVALID_TIMER_ID
+    [[nodiscard]] TimerId Schedule(uint64_t delay_ms, T value)
+    {
+        const uint32_t index = AllocateNode();
+        if (index == NIL)
+        {
+            return INVALID_TIMER_ID;
+        }
+
+        Node& node = nodes_[index];
+        node.expire_tick = current_tick_ + (delay_ms + tick_ms_ - 1) / tick_ms_;
+        node.value = std::move(value);
+        node.active = true;
+
+        Link(index, current_tick_);
+        ++size_;
+
+        return MakeId(index, node.generation);
+    }
+
+    bool Cancel(TimerId id)
+    {
+        const uint32_t index = static_cast<uint32_t>(id);
+        const uint32_t generation = static_cast<uint32_t>(id >> 32);
+
+        if (id == INVALID_TIMER_ID || index >= nodes_.size())
+        {
+            return false;
+        }
+
+        Node& node = nodes_[index];
+        if (!node.active || node.generation != generation)
+        {
+            return false;
+        }
+
+        Unlink(index);
+        FreeNode(index);
+        --size_;
+
+        return true;
+    }
+
+    // now_ms까지의 틱을 처리하고 만료된 값을 expired 뒤에 추가. 추가한 개수 반환
+    size_t Advance(uint64_t now_ms, std::vector<T>& expired)
+    {
+        const uint64_t target_tick = now_ms / tick_ms_;
+        const size_t before = expired.size();
+
+        while (current_tick_ < target_tick)
+        {
+            if (size_ == 0)
+            {
+                current_tick_ = target_tick;
+                break;
+            }
+
+            // 최하위 단계가 비어 있으면 다음 내림(cascade) 직전 틱까지 건너뜀
+            if (occupied_[0] == 0 && ((current_tick_ + 1) & SLOT_MASK) != 0)
+            {
+                current_tick_ = std::min(target_tick, current_tick_ | SLOT_MASK);
+                continue;
+            }
+
+            ++current_tick_;
+
+            if ((current_tick_ & SLOT_MASK) == 0)
+            {
+                Cascade(1);
+            }
+
+            ExpireSlot(static_cast<uint32_t>(current_tick_ & SLOT_MASK), expired);
+        }
+
+        return expired.size() - before;
+    }
+
+    void Clear()
+    {
+        nodes_.clear();
+        free_head_ = NIL;
+        size_ = 0;
+        occupied_.fill(0);
+
+        for (auto& level : heads_)
+        {
+            level.fill(NIL);
+        }
+    }
+
+    [[nodiscard]] size_t Size() const { return size_; }
+    [[nodiscard]] bool Empty() const { return size_ == 0; }
+    [[nodiscard]] uint32_t GetTickMs() const { return tick_ms_; }
+    [[nodiscard]] uint64_t GetCurrentMs() const { return current_tick_ * tick_ms_; }
+
+private:
+    static constexpr uint32_t NIL = UINT32_MAX;
+
+    struct Node
+    {
+        uint64_t expire_tick{ 0 };
+        uint32_t prev{ NIL };
+        uint32_t next{ NIL };       // 해제 상태에서는 free 리스트 연결로 사용
+        uint32_t generation{ 1 };
+        uint8_t level{ 0 };
+        uint8_t slot{ 0 };
+        bool active{ false };
+        T value{};
+    };
+
+    [[nodiscard]] static TimerId MakeId(uint32_t index, uint32_t generation)
+    {
+        return (static_cast<uint64_t>(generation) << 32) | index;
+    }
+
+    [[nodiscard]] uint32_t AllocateNode()
+    {
+        if (free_head_ != NIL)
+        {
+            const uint32_t index = free_head_;
+            free_head_ = nodes_[index].next;
+            return index;
+        }
+
+        if (nodes_.size() >= NIL)
+        {
+            return NIL;
+        }
+
+        nodes_.emplace_back();
+        return static_cast<uint32_t>(nodes_.size() - 1);
+    }
+
+    void FreeNode(uint32_t index)
+    {
+        Node& node = nodes_[index];
+        node.active = false;
+        node.value = T{};
+
+        // 세대 증가 (0은 건너뛰어 id가 0이 되지 않도록 함)
+        if (++node.generation == 0)
+        {
+            node.generation = 1;
+        }
+
+        node.prev = NIL;
+        node.next = free_head_;
+        free_head_ = index;
+    }
+
+    // processed_tick까지 처리가 끝났다고 보고 배치.
+    // 단계 L의 칸은 그 칸의 시작 틱에 도달할 때 처리되므로, 만료 틱을 단계 단위로 내린 시작 틱이
+    // processed_tick 이후 한 바퀴(64^(L+1)) 안에 처음 오는 가장 낮은 단계를 선택
+    void Link(uint32_t index, uint64_t processed_tick)
+    {
+        Node& node = nodes_[index];
+
+        // 이미 지난 타이머는 다음 틱에 만료
+        node.expire_tick = std::max(node.expire_tick, processed_tick + 1);
+
+        uint32_t level = 0;
+        uint64_t slot_tick = 0;
+
+        for (; level < LEVEL_COUNT; ++level)
+        {
+            slot_tick = node.expire_tick & ~((uint64_t{ 1 } << (SLOT_BITS * level)) - 1);
+            if (slot_tick - processed_tick <= (uint64_t{ 1 } << (SLOT_BITS * (level + 1))))
+            {
+                break;
+            }
+        }
+
+        // 범위를 넘는 타이머는 최상위 단계에서 가장 늦게 처리되는 칸에 두고, 그 칸이 처리될 때 다시 배치
+        if (level == LEVEL_COUNT)
+        {
+            level = LEVEL_COUNT - 1;
+            slot_tick = (processed_tick + MAX_DELAY_TICKS + 1) & ~((uint64_t{ 1 } << (SLOT_BITS * level)) - 1);
+        }
+
+        const uint32_t slot = static_cast<uint32_t>((slot_tick >> (SLOT_BITS * level)) & SLOT_MASK);
+
+        node.level = static_cast<uint8_t>(level);
+        node.slot = static_cast<uint8_t>(slot);
+        node.prev = NIL;
+        node.next = heads_[level][slot];
+
+        if (node.next != NIL)
+        {
+            nodes_[node.next].prev = index;
+        }
+
+        heads_[level][slot] = index;
+        occupied_[level] |= uint64_t{ 1 } << slot;
+    }
+
+    void Unlink(uint32_t index)
+    {
+        Node& node = nodes_[index];
+
+        if (node.prev != NIL)
+        {
+            nodes_[node.prev].next = node.next;
+        }
+        else
+        {
+            heads_[node.level][node.slot] = node.next;
+            if (node.next == NIL)
+            {
+                occupied_[node.level] &= ~(uint64_t{ 1 } << node.slot);
+            }
+        }
+
+        if (node.next != NIL)
+        {
+            nodes_[node.next].prev = node.prev;
+        }
+    }
+
+    [[nodiscard]] uint32_t DetachSlot(uint32_t level, uint32_t slot)
+    {
+        const uint32_t head = heads_[level][slot];
+        heads_[level][slot] = NIL;
+        occupied_[level] &= ~(uint64_t{ 1 } << slot);
+        return head;
+    }
+
+    // 상위 단계의 현재 칸을 한 단계 아래로 재배치 (그 단계도 한 바퀴를 돌았으면 더 위 단계부터)
+    void Cascade(uint32_t level)
+    {
+        if (level >= LEVEL_COUNT)
+        {
+            return;
+        }
+
+        const uint32_t slot = static_cast<uint32_t>((current_tick_ >> (SLOT_BITS * level)) & SLOT_MASK);
+        if (slot == 0)
+        {
+            Cascade(level + 1);
+        }
+
+        uint32_t index = DetachSlot(level, slot);
+        while (index != NIL)
+        {
+            const uint32_t next = nodes_[index].next;
+            // 현재 틱은 아직 처리 전
+            Link(index, current_tick_ - 1);
+            index = next;
+        }
+    }
+
+    void ExpireSlot(uint32_t slot, std::vector<T>& expired)
+    {
+        uint32_t index = DetachSlot(0, slot);
+        while (index != NIL)
+        {
+            Node& node = nodes_[index];
+            const uint32_t next = node.next;
+
+            expired.push_back(std::move(node.value));
+            FreeNode(index);
+            --size_;
+
+            index = next;
+        }
+    }
+
+private:
+    uint32_t tick_ms_{ 1 };
+    uint64_t current_tick_{ 0 };
+
+    std::vector<Node> nodes_;
+    uint32_t free_head_{ NIL };
+    size_t size_{ 0 };
+
+    std::array<std::array<uint32_t, SLOT_COUNT>, LEVEL_COUNT> heads_{};
+    std::array<uint64_t, LEVEL_COUNT> occupied_{};    // 칸별 비어 있지 않음 비트
+};